@@ -38,7 +38,8 @@
  * The general usage pattern for async I/O is:
  *
  * - Create one or more SDL_AsyncIOQueue objects.
- * - Open files with SDL_AsyncIOFromFile.
+ * - Open files with SDL_AsyncIOFromFile, or with SDL_OpenAsyncIO to open
+ *   them without blocking too.
  * - Start I/O tasks to the files with SDL_ReadAsyncIO or SDL_WriteAsyncIO,
  *   putting those tasks into one of the queues.
  * - Later on, use SDL_GetAsyncIOResult on a queue to see if any task is
@@ -104,6 +105,7 @@
 #define SDL_asyncio_h_
 
 #include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_properties.h>
 
 #include <SDL3/SDL_begin_code.h>
 /* Set up for C function definitions, even when using C++ */
@@ -132,7 +134,9 @@ typedef enum SDL_AsyncIOTaskType
 {
     SDL_ASYNCIO_TASK_READ,   /**< A read operation. */
     SDL_ASYNCIO_TASK_WRITE,  /**< A write operation. */
-    SDL_ASYNCIO_TASK_CLOSE   /**< A close operation. */
+    SDL_ASYNCIO_TASK_CLOSE,  /**< A close operation. */
+    SDL_ASYNCIO_TASK_OPEN,   /**< An open operation, from SDL_OpenAsyncIO. */
+    SDL_ASYNCIO_TASK_STAT    /**< A file size query, from SDL_StatAsyncIO. */
 } SDL_AsyncIOTaskType;
 
 /**
@@ -154,13 +158,13 @@ typedef enum SDL_AsyncIOResult
  */
 typedef struct SDL_AsyncIOOutcome
 {
-    SDL_AsyncIO *asyncio;   /**< what generated this task. This pointer will be invalid if it was closed! */
+    SDL_AsyncIO *asyncio;   /**< what generated this task, or the newly-opened file for an open task (NULL if the open failed). This pointer will be invalid if it was closed! */
     SDL_AsyncIOTaskType type;  /**< What sort of task was this? Read, write, etc? */
     SDL_AsyncIOResult result;  /**< the result of the work (success, failure, cancellation). */
     void *buffer;  /**< buffer where data was read/written. */
     Uint64 offset;  /**< offset in the SDL_AsyncIO where data was read/written. */
     Uint64 bytes_requested;  /**< number of bytes the task was to read/write. */
-    Uint64 bytes_transferred;  /**< actual number of bytes that were read/written. */
+    Uint64 bytes_transferred;  /**< actual number of bytes that were read/written, or the size of the file for a stat task. */
     void *userdata;    /**< pointer provided by the app when starting the task */
 } SDL_AsyncIOOutcome;
 
@@ -205,7 +209,8 @@ typedef struct SDL_AsyncIOQueue SDL_AsyncIOQueue;
  *
  * This call is _not_ asynchronous; it will open the file before returning,
  * under the assumption that doing so is generally a fast operation. Future
- * reads and writes to the opened file will be async, however.
+ * reads and writes to the opened file will be async, however. Use
+ * SDL_OpenAsyncIO() to open a file without blocking.
  *
  * \param file a UTF-8 string representing the filename to open.
  * \param mode an ASCII string representing the mode to be used for opening
@@ -216,16 +221,52 @@ typedef struct SDL_AsyncIOQueue SDL_AsyncIOQueue;
  * \since This function is available since SDL 3.2.0.
  *
  * \sa SDL_CloseAsyncIO
+ * \sa SDL_OpenAsyncIO
  * \sa SDL_ReadAsyncIO
  * \sa SDL_WriteAsyncIO
  */
 extern SDL_DECLSPEC SDL_AsyncIO * SDLCALL SDL_AsyncIOFromFile(const char *file, const char *mode);
 
+/**
+ * Start an async open of a named file.
+ *
+ * This works like SDL_AsyncIOFromFile(), with the same `mode` strings, but
+ * the file is opened in the background, so this won't block while a slow disk
+ * or network filesystem finds the file.
+ *
+ * When the task completes, its SDL_AsyncIOOutcome has a type of
+ * SDL_ASYNCIO_TASK_OPEN. If the result is SDL_ASYNCIO_COMPLETE, the outcome's
+ * `asyncio` field is the newly-opened file, which should eventually be closed
+ * with SDL_CloseAsyncIO(). Otherwise, `asyncio` is NULL.
+ *
+ * If the work begins, even failure is asynchronous: a failing return value
+ * from this function only means the work couldn't start at all.
+ *
+ * \param file a UTF-8 string representing the filename to open.
+ * \param mode an ASCII string representing the mode to be used for opening
+ *             the file.
+ * \param queue a queue to add the new task to when it completes.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AsyncIOFromFile
+ * \sa SDL_CloseAsyncIO
+ * \sa SDL_GetAsyncIOResult
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_OpenAsyncIO(const char *file, const char *mode, SDL_AsyncIOQueue *queue, void *userdata);
+
 /**
  * Use this function to get the size of the data stream in an SDL_AsyncIO.
  *
  * This call is _not_ asynchronous; it assumes that obtaining this info is a
- * non-blocking operation in most reasonable cases.
+ * non-blocking operation in most reasonable cases. Use SDL_StatAsyncIO() to
+ * get the size without blocking.
  *
  * \param asyncio the SDL_AsyncIO to get the size of the data stream from.
  * \returns the size of the data stream in the SDL_IOStream on success or a
@@ -238,6 +279,32 @@ extern SDL_DECLSPEC SDL_AsyncIO * SDLCALL SDL_AsyncIOFromFile(const char *file,
  */
 extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetAsyncIOSize(SDL_AsyncIO *asyncio);
 
+/**
+ * Start an async query of the size of the data stream in an SDL_AsyncIO.
+ *
+ * When the task completes, its SDL_AsyncIOOutcome has a type of
+ * SDL_ASYNCIO_TASK_STAT, and if the result is SDL_ASYNCIO_COMPLETE, the
+ * outcome's `bytes_transferred` field is the size of the data stream.
+ *
+ * If the work begins, even failure is asynchronous: a failing return value
+ * from this function only means the work couldn't start at all.
+ *
+ * \param asyncio the SDL_AsyncIO to get the size of the data stream from.
+ * \param queue a queue to add the new task to when it completes.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAsyncIOSize
+ * \sa SDL_GetAsyncIOResult
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_StatAsyncIO(SDL_AsyncIO *asyncio, SDL_AsyncIOQueue *queue, void *userdata);
+
 /**
  * Start an async read.
  *
@@ -505,6 +572,108 @@ extern SDL_DECLSPEC bool SDLCALL SDL_WaitAsyncIOResult(SDL_AsyncIOQueue *queue,
  */
 extern SDL_DECLSPEC void SDLCALL SDL_SignalAsyncIOQueue(SDL_AsyncIOQueue *queue);
 
+/**
+ * Start a batch of async I/O tasks on a queue.
+ *
+ * Until the matching call to SDL_EndAsyncIOBatch(), tasks started on this
+ * queue may be held back and handed to the operating system all at once,
+ * which can save a system call per task when starting many small reads or
+ * writes. Tasks started by any thread on this queue are batched, not just
+ * those started by the calling thread.
+ *
+ * Batches nest; the held-back tasks are started when the outermost batch
+ * ends. Tasks are also started if the backend runs out of room to hold more
+ * of them, or when a thread checks the queue with SDL_GetAsyncIOResult() or
+ * SDL_WaitAsyncIOResult(), so waiting inside a batch won't block forever.
+ *
+ * Backends that can't batch tasks start each task right away, as usual.
+ *
+ * \param queue the async I/O task queue to batch tasks on.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_EndAsyncIOBatch
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_BeginAsyncIOBatch(SDL_AsyncIOQueue *queue);
+
+/**
+ * Finish a batch of async I/O tasks on a queue.
+ *
+ * When the outermost batch on the queue ends, every task held back since it
+ * began is started. Calling this without a matching SDL_BeginAsyncIOBatch()
+ * fails, on every backend. If the tasks can't be started right now, this
+ * fails too, but the tasks stay queued and are started later, so their
+ * results still arrive through the queue.
+ *
+ * \param queue the async I/O task queue passed to SDL_BeginAsyncIOBatch().
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_BeginAsyncIOBatch
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_EndAsyncIOBatch(SDL_AsyncIOQueue *queue);
+
+/**
+ * Tell an async I/O task queue which memory will be read into or written from.
+ *
+ * Some backends can set up memory ahead of time, so reads and writes that
+ * land entirely inside one of these buffers skip some work in the operating
+ * system for each task. Reads and writes using other memory still work as
+ * usual.
+ *
+ * Each call replaces the buffers from the previous call; pass zero buffers to
+ * forget them. The memory must stay allocated until the buffers are replaced
+ * or the queue is destroyed.
+ *
+ * Backends that can't set up memory ahead of time ignore these buffers.
+ *
+ * \param queue the async I/O task queue the buffers will be used with.
+ * \param buffers an array of `num_buffers` pointers to memory. May be NULL if
+ *                `num_buffers` is zero.
+ * \param sizes an array of the size in bytes of each buffer. May be NULL if
+ *              `num_buffers` is zero.
+ * \param num_buffers the number of buffers.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but no
+ *               tasks that use the previous buffers should be pending.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetAsyncIOQueueBuffers(SDL_AsyncIOQueue *queue, void * const *buffers, const size_t *sizes, int num_buffers);
+
+/**
+ * Get the properties associated with an async I/O task queue.
+ *
+ * The following read-only properties are provided by SDL, and are updated
+ * each time this function is called:
+ *
+ * - `SDL_PROP_ASYNCIO_QUEUE_SYSCALLS_NUMBER`: the number of system calls
+ *   this queue has made to start tasks and wait for them to finish. This is
+ *   only available with backends that hand tasks to the operating system
+ *   through the queue, such as io_uring on Linux.
+ *
+ * \param queue the async I/O task queue to query.
+ * \returns a valid property ID on success or 0 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAsyncIOQueueProperties(SDL_AsyncIOQueue *queue);
+
+#define SDL_PROP_ASYNCIO_QUEUE_SYSCALLS_NUMBER  "SDL.asyncio.queue.syscalls"
+
 /**
  * Load all the data from a file path, asynchronously.
  *
@@ -521,6 +690,16 @@ extern SDL_DECLSPEC void SDLCALL SDL_SignalAsyncIOQueue(SDL_AsyncIOQueue *queue)
  * deallocated by calling SDL_free() on SDL_AsyncIOOutcome's buffer field
  * after completion.
  *
+ * Opening the file and getting its size happen in the background too, so this
+ * function doesn't wait for the disk at all. Only a single read task is
+ * reported for this load; if the file couldn't be opened, that read task
+ * reports failure with a NULL buffer.
+ *
+ * Before SDL 3.4.0, this function opened the file before returning, so a file
+ * that didn't exist or couldn't be opened made it return false right away.
+ * Now this function returns true in that case, and the failure is reported
+ * later, through the queue, by the read task.
+ *
  * An SDL_AsyncIOQueue must be specified. The newly-created task will be added
  * to it when it completes its work.
  *
@@ -648,6 +648,50 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetAudioDeviceFormat(SDL_AudioDeviceID devi
  */
 extern SDL_DECLSPEC int * SDLCALL SDL_GetAudioDeviceChannelMap(SDL_AudioDeviceID devid, int *count);
 
+/**
+ * Get the properties associated with an audio device.
+ *
+ * Logical device IDs return the properties of the physical device they are
+ * associated with, and SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK or
+ * SDL_AUDIO_DEVICE_DEFAULT_RECORDING return the properties of the current
+ * default device.
+ *
+ * The following property can be set by the app before the device is opened:
+ *
+ * - `SDL_PROP_AUDIO_DEVICE_MIX_THREADS_NUMBER`: the number of helper threads
+ *   a playback device uses to convert its bound audio streams, overriding
+ *   SDL_HINT_AUDIO_DEVICE_MIX_THREADS.
+ *
+ * The following read-only properties are updated by SDL after every
+ * iteration of an opened playback device:
+ *
+ * - `SDL_PROP_AUDIO_DEVICE_ITERATION_NS_NUMBER`: the time, in nanoseconds,
+ *   the most recent iteration spent converting and mixing audio, including
+ *   time spent in the app's callbacks.
+ * - `SDL_PROP_AUDIO_DEVICE_ITERATION_MAX_NS_NUMBER`: the longest iteration,
+ *   in nanoseconds, since the device was opened.
+ * - `SDL_PROP_AUDIO_DEVICE_BUFFER_PERIOD_NS_NUMBER`: the amount of time, in
+ *   nanoseconds, that one device buffer plays for. Iterations must finish
+ *   within this time to avoid audible glitches.
+ * - `SDL_PROP_AUDIO_DEVICE_OVERRUNS_NUMBER`: the number of iterations, since
+ *   the device was opened, that took longer than the buffer period.
+ *
+ * \param devid the instance ID of the device to query.
+ * \returns a valid property ID on success or 0 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioDeviceProperties(SDL_AudioDeviceID devid);
+
+#define SDL_PROP_AUDIO_DEVICE_MIX_THREADS_NUMBER        "SDL.audio.device.mix_threads"
+#define SDL_PROP_AUDIO_DEVICE_ITERATION_NS_NUMBER       "SDL.audio.device.iteration_ns"
+#define SDL_PROP_AUDIO_DEVICE_ITERATION_MAX_NS_NUMBER   "SDL.audio.device.iteration_max_ns"
+#define SDL_PROP_AUDIO_DEVICE_BUFFER_PERIOD_NS_NUMBER   "SDL.audio.device.buffer_period_ns"
+#define SDL_PROP_AUDIO_DEVICE_OVERRUNS_NUMBER           "SDL.audio.device.overruns"
+
 /**
  * Open a specific audio device.
  *
@@ -1060,9 +1104,69 @@ extern SDL_DECLSPEC SDL_AudioDeviceID SDLCALL SDL_GetAudioStreamDevice(SDL_Audio
  */
 extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec);
 
+/**
+ * Create a new audio stream with the specified properties.
+ *
+ * These are the supported properties:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_CREATE_INPUT_RING_SIZE_NUMBER`: if greater than
+ *   zero, the stream gets a lock-free ring buffer of at least this many bytes
+ *   for input data. While there is room in the ring, SDL_PutAudioStreamData()
+ *   copies into it without taking the stream's lock, so a thread pulling data
+ *   from the stream (such as an audio device thread) never waits on the
+ *   thread putting data into it. The ring is emptied into the stream by
+ *   whichever thread next reads from the stream. When the ring is full, or
+ *   the stream has a put callback, SDL_PutAudioStreamData() falls back to
+ *   the usual locked path. Streams with a ring must have a `src_spec`, and
+ *   its input format and channel map can not be changed afterwards. Only one
+ *   thread may put data into such a stream at a time.
+ *
+ * \param src_spec the format details of the input audio.
+ * \param dst_spec the format details of the output audio.
+ * \param props the properties to use.
+ * \returns a new audio stream on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateAudioStream
+ * \sa SDL_PutAudioStreamData
+ * \sa SDL_DestroyAudioStream
+ */
+extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStreamWithProperties(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec, SDL_PropertiesID props);
+
+#define SDL_PROP_AUDIOSTREAM_CREATE_INPUT_RING_SIZE_NUMBER  "SDL.audiostream.create.input_ring_size"
+
+/**
+ * The resampling quality an audio stream uses when its input and output
+ * sample rates differ.
+ *
+ * Higher quality costs more CPU time, and adds a little latency, as the
+ * resampler needs to look further ahead in the input.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ */
+typedef enum SDL_AudioResampleQuality
+{
+    SDL_AUDIO_RESAMPLE_QUALITY_FAST,    /**< Linear interpolation. Cheap, but dulls high frequencies and aliases. */
+    SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM,  /**< A short windowed-sinc filter. This is the default. */
+    SDL_AUDIO_RESAMPLE_QUALITY_HIGH     /**< A long polyphase windowed-sinc filter. */
+} SDL_AudioResampleQuality;
+
 /**
  * Get the properties associated with an audio stream.
  *
+ * The following read-write properties are provided by SDL:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER`: an SDL_AudioResampleQuality
+ *   value for the resampler to use, defaults to
+ *   SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM. Changes take effect the next time data
+ *   is read from the stream.
+ *
  * \param stream the SDL_AudioStream to query.
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -1073,6 +1177,8 @@ extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_Au
  */
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioStreamProperties(SDL_AudioStream *stream);
 
+#define SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER    "SDL.audiostream.resample_quality"
+
 /**
  * Query the current format of an audio stream.
  *
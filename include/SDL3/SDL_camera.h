@@ -388,6 +388,20 @@ extern SDL_DECLSPEC SDL_CameraID SDLCALL SDL_GetCameraID(SDL_Camera *camera);
 /**
  * Get the properties associated with an opened camera.
  *
+ * The following read-only properties are provided by SDL:
+ *
+ * - `SDL_PROP_CAMERA_FRAME_BUFFERS_NUMBER`: the number of frames SDL can
+ *   buffer for the app, set by SDL_HINT_CAMERA_FRAME_BUFFERS when the camera
+ *   was opened. New frames are dropped while all of them are waiting to be
+ *   acquired or are held by the app.
+ * - `SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER`: the number of frames dropped
+ *   since the camera was opened because every frame buffer was in use.
+ * - `SDL_PROP_CAMERA_CONVERTED_FRAMES_NUMBER`: the number of frames SDL has
+ *   scaled or converted to the format the app asked for since the camera was
+ *   opened. This stays zero while the app uses the hardware's own format.
+ * - `SDL_PROP_CAMERA_CONVERSION_TIME_NS_NUMBER`: the total time in
+ *   nanoseconds SDL has spent scaling or converting those frames.
+ *
  * \param camera the SDL_Camera obtained from SDL_OpenCamera().
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -398,6 +412,11 @@ extern SDL_DECLSPEC SDL_CameraID SDLCALL SDL_GetCameraID(SDL_Camera *camera);
  */
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetCameraProperties(SDL_Camera *camera);
 
+#define SDL_PROP_CAMERA_FRAME_BUFFERS_NUMBER        "SDL.camera.frame_buffers"
+#define SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER       "SDL.camera.dropped_frames"
+#define SDL_PROP_CAMERA_CONVERTED_FRAMES_NUMBER     "SDL.camera.converted_frames"
+#define SDL_PROP_CAMERA_CONVERSION_TIME_NS_NUMBER   "SDL.camera.conversion_time_ns"
+
 /**
  * Get the spec that a camera is using when generating images.
  *
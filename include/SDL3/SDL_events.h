@@ -1269,6 +1269,62 @@ extern SDL_DECLSPEC void SDLCALL SDL_FlushEvents(Uint32 minType, Uint32 maxType)
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_PollEvent(SDL_Event *event);
 
+/**
+ * Remove all currently pending events from the queue in a single batch.
+ *
+ * This pumps the event loop and then hands back every event in the queue at
+ * once, in the order they were queued. This is equivalent to calling
+ * SDL_PollEvent() until it returns false, but the event queue is only locked
+ * once, which matters when input devices are generating thousands of events
+ * a second.
+ *
+ * ```c
+ * while (game_is_still_running) {
+ *     int i, count;
+ *     const SDL_Event *events = SDL_AcquireEvents(&count);
+ *     for (i = 0; i < count; ++i) {
+ *         // decide what to do with events[i].
+ *     }
+ *     SDL_ReleaseEvents(events);
+ *
+ *     // update game state, draw the current frame
+ * }
+ * ```
+ *
+ * The returned array belongs to SDL and must be given back with
+ * SDL_ReleaseEvents() before the next call to this function. Any memory
+ * referenced by the events, such as text input strings, stays valid until
+ * the next time events are pumped, the same as events from SDL_PollEvent().
+ *
+ * As this function implicitly calls SDL_PumpEvents(), you can only call this
+ * function in the thread that set the video mode.
+ *
+ * \param count a pointer filled in with the number of events returned.
+ * \returns an array of events, or NULL if there are no events pending or on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_PollEvent
+ * \sa SDL_ReleaseEvents
+ */
+extern SDL_DECLSPEC const SDL_Event * SDLCALL SDL_AcquireEvents(int *count);
+
+/**
+ * Give back events acquired with SDL_AcquireEvents().
+ *
+ * \param events the array returned by SDL_AcquireEvents(), may be NULL.
+ *
+ * \threadsafety This function should only be called on the main thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AcquireEvents
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ReleaseEvents(const SDL_Event *events);
+
 /**
  * Wait indefinitely for the next available event.
  *
@@ -1535,6 +1591,75 @@ extern SDL_DECLSPEC void SDLCALL SDL_SetEventEnabled(Uint32 type, bool enabled);
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_EventEnabled(Uint32 type);
 
+/**
+ * Set whether consecutive queued events of a type should be merged.
+ *
+ * When coalescing is enabled for a type, an event of that type that is added
+ * to the queue right after other events of the same type is merged into the
+ * earlier one from the same source, instead of being queued separately. The
+ * merged event has the latest position, value and timestamp, and relative
+ * motion is added together, so an app that only wants the latest state each
+ * frame sees one event per device instead of hundreds.
+ *
+ * Events are only merged across a run of events of the same type, so they
+ * are never moved past events of any other type, like button presses. Event
+ * watchers still see every event as it's added.
+ *
+ * Coalescing is supported for these event types:
+ *
+ * - SDL_EVENT_MOUSE_MOTION, merged per window, mouse and button state.
+ * - SDL_EVENT_PEN_MOTION, merged per window, pen and pen state.
+ * - SDL_EVENT_FINGER_MOTION, merged per window, touch device and finger.
+ * - SDL_EVENT_JOYSTICK_AXIS_MOTION, merged per joystick and axis.
+ * - SDL_EVENT_GAMEPAD_AXIS_MOTION, merged per gamepad and axis.
+ *
+ * Coalescing is disabled for all event types by default.
+ *
+ * \param type the type of event; see SDL_EventType for details.
+ * \param enabled whether to merge consecutive events of this type.
+ * \returns true on success or false if `type` can't be coalesced; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_EventCoalescingEnabled
+ * \sa SDL_GetCoalescedEventCount
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetEventCoalescingEnabled(Uint32 type, bool enabled);
+
+/**
+ * Query whether consecutive queued events of a type are being merged.
+ *
+ * \param type the type of event; see SDL_EventType for details.
+ * \returns true if events of this type are being coalesced, false
+ *          otherwise.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetEventCoalescingEnabled
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_EventCoalescingEnabled(Uint32 type);
+
+/**
+ * Get the number of events of a type that have been merged into earlier
+ * events.
+ *
+ * \param type the type of event; see SDL_EventType for details.
+ * \returns the number of events of this type that were merged instead of
+ *          being queued separately, since the event system was initialized.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetEventCoalescingEnabled
+ */
+extern SDL_DECLSPEC Uint64 SDLCALL SDL_GetCoalescedEventCount(Uint32 type);
+
 /**
  * Allocate a set of user-defined events, and return the beginning event
  * number for that set of events.
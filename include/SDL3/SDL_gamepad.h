@@ -298,6 +298,76 @@ typedef struct SDL_GamepadBinding
     } output;
 } SDL_GamepadBinding;
 
+/**
+ * The maximum number of touchpads in an SDL_GamepadState.
+ *
+ * \since This macro is available since SDL 3.4.0.
+ */
+#define SDL_GAMEPAD_STATE_MAX_TOUCHPADS 2
+
+/**
+ * The maximum number of fingers per touchpad in an SDL_GamepadState.
+ *
+ * \since This macro is available since SDL 3.4.0.
+ */
+#define SDL_GAMEPAD_STATE_MAX_FINGERS   2
+
+/**
+ * The maximum number of sensors in an SDL_GamepadState.
+ *
+ * \since This macro is available since SDL 3.4.0.
+ */
+#define SDL_GAMEPAD_STATE_MAX_SENSORS   6
+
+/**
+ * The state of a finger on a gamepad touchpad, as part of an
+ * SDL_GamepadState.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGamepadState
+ */
+typedef struct SDL_GamepadFingerState
+{
+    bool down;          /**< true if the finger is touching the touchpad */
+    float x;            /**< the x position, normalized 0 to 1, with the origin in the upper left */
+    float y;            /**< the y position, normalized 0 to 1, with the origin in the upper left */
+    float pressure;     /**< the pressure, normalized 0 to 1 */
+} SDL_GamepadFingerState;
+
+/**
+ * The state of a gamepad sensor, as part of an SDL_GamepadState.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGamepadState
+ */
+typedef struct SDL_GamepadSensorState
+{
+    SDL_SensorType type;    /**< the type of sensor */
+    bool enabled;           /**< true if the sensor is enabled and data is updated */
+    float data[3];          /**< the most recent sensor data, see SDL_sensor.h for details */
+} SDL_GamepadSensorState;
+
+/**
+ * A snapshot of the complete mapped state of a gamepad.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGamepadState
+ */
+typedef struct SDL_GamepadState
+{
+    Uint64 timestamp;                           /**< when this snapshot was taken, in nanoseconds, using SDL_GetTicksNS() */
+    Sint16 axes[SDL_GAMEPAD_AXIS_COUNT];        /**< the axis values, see SDL_GetGamepadAxis() */
+    bool buttons[SDL_GAMEPAD_BUTTON_COUNT];     /**< the button states, see SDL_GetGamepadButton() */
+    int num_touchpads;                          /**< the number of touchpads in touchpads */
+    int num_fingers[SDL_GAMEPAD_STATE_MAX_TOUCHPADS];  /**< the number of fingers for each touchpad */
+    SDL_GamepadFingerState fingers[SDL_GAMEPAD_STATE_MAX_TOUCHPADS][SDL_GAMEPAD_STATE_MAX_FINGERS]; /**< the fingers on each touchpad */
+    int num_sensors;                            /**< the number of sensors in sensors */
+    SDL_GamepadSensorState sensors[SDL_GAMEPAD_STATE_MAX_SENSORS]; /**< the gamepad sensors */
+} SDL_GamepadState;
+
 
 /**
  * Add support for gamepads that SDL is unaware of or change the binding of an
@@ -1381,6 +1451,33 @@ extern SDL_DECLSPEC float SDLCALL SDL_GetGamepadSensorDataRate(SDL_Gamepad *game
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetGamepadSensorData(SDL_Gamepad *gamepad, SDL_SensorType type, float *data, int num_values);
 
+/**
+ * Get a consistent snapshot of the mapped state of a gamepad.
+ *
+ * The snapshot holds all the axes, buttons, touchpad fingers and sensors of
+ * the gamepad, as they were at the end of the most recent call to
+ * SDL_UpdateJoysticks(), which is also called when events are processed.
+ *
+ * Unlike the other functions that get gamepad state, this doesn't take the
+ * joystick lock, so several threads can poll the same gamepads without
+ * waiting on each other or on the thread updating the joysticks.
+ *
+ * \param gamepad the gamepad to query.
+ * \param state a pointer filled in with the gamepad state.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               the gamepad isn't being closed at the same time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetGamepadAxis
+ * \sa SDL_GetGamepadButton
+ * \sa SDL_UpdateJoysticks
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetGamepadState(SDL_Gamepad *gamepad, SDL_GamepadState *state);
+
 /**
  * Start a rumble effect on a gamepad.
  *
@@ -2274,6 +2274,18 @@ extern SDL_DECLSPEC SDL_GPUDevice * SDLCALL SDL_CreateGPUDevice(
  * - `SDL_PROP_GPU_DEVICE_CREATE_VULKAN_SAMPLERANISOTROPY_BOOLEAN`: Enable
  *   device feature samplerAnisotropy. If disabled, enable_anisotropy of
  *   SDL_GPUSamplerCreateInfo must be set to false. Defaults to true.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_FILENAME_STRING`: the
+ *   path of a file holding pipeline cache data. If the file exists and was
+ *   written for the same physical device and driver, it seeds the pipeline
+ *   cache; the cache is written back to this file when the device is
+ *   destroyed.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_DATA_POINTER`: pipeline
+ *   cache data previously returned by SDL_GetGPUPipelineCacheData(), used
+ *   instead of the file contents. Data for a different device or driver is
+ *   ignored. The data only needs to be valid during this call.
+ * - `SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_SIZE_NUMBER`: the size
+ *   in bytes of the data in
+ *   `SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_DATA_POINTER`.
  *
  * \param props the properties to use.
  * \returns a GPU context on success or NULL on failure; call SDL_GetError()
@@ -2304,6 +2316,9 @@ extern SDL_DECLSPEC SDL_GPUDevice * SDLCALL SDL_CreateGPUDeviceWithProperties(
 #define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DEPTHCLAMP_BOOLEAN         "SDL.gpu.device.create.vulkan.depthclamp"
 #define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_DRAWINDIRECTFIRST_BOOLEAN  "SDL.gpu.device.create.vulkan.drawindirectfirstinstance"
 #define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_SAMPLERANISOTROPY_BOOLEAN  "SDL.gpu.device.create.vulkan.sampleranisotropy"
+#define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_FILENAME_STRING "SDL.gpu.device.create.vulkan.pipelinecache.filename"
+#define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_DATA_POINTER "SDL.gpu.device.create.vulkan.pipelinecache.data"
+#define SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_SIZE_NUMBER "SDL.gpu.device.create.vulkan.pipelinecache.size"
 
 /**
  * Destroys a GPU context previously returned by SDL_CreateGPUDevice.
@@ -2461,6 +2476,19 @@ extern SDL_DECLSPEC SDL_GPUShaderFormat SDLCALL SDL_GetGPUShaderFormats(SDL_GPUD
  * Driver Branch: promo490_3_Google
  * ```
  *
+ * With the Vulkan renderer, these properties are also available and are
+ * updated as pipelines are created:
+ *
+ * - `SDL_PROP_GPU_DEVICE_PIPELINES_CREATED_NUMBER`: the number of graphics
+ *   and compute pipelines created so far.
+ * - `SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_HITS_NUMBER`: the number of those
+ *   pipelines that the driver found in the pipeline cache.
+ * - `SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_MISSES_NUMBER`: the number of those
+ *   pipelines that the driver had to compile.
+ *
+ * Cache hits and misses are only counted if the driver supports
+ * VK_EXT_pipeline_creation_feedback.
+ *
  * \param device a GPU context to query.
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -2475,6 +2503,34 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetGPUDeviceProperties(SDL_GPUD
 #define SDL_PROP_GPU_DEVICE_DRIVER_NAME_STRING        "SDL.gpu.device.driver_name"
 #define SDL_PROP_GPU_DEVICE_DRIVER_VERSION_STRING     "SDL.gpu.device.driver_version"
 #define SDL_PROP_GPU_DEVICE_DRIVER_INFO_STRING        "SDL.gpu.device.driver_info"
+#define SDL_PROP_GPU_DEVICE_PIPELINES_CREATED_NUMBER  "SDL.gpu.device.pipelines_created"
+#define SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_HITS_NUMBER "SDL.gpu.device.pipeline_cache_hits"
+#define SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_MISSES_NUMBER "SDL.gpu.device.pipeline_cache_misses"
+
+/**
+ * Get the contents of the device's pipeline cache.
+ *
+ * The returned data can be saved and passed back to a later device with
+ * `SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_DATA_POINTER` so that
+ * pipelines created in an earlier run don't need to be compiled again. It is
+ * only useful with the same GPU and driver version; mismatched data is
+ * ignored.
+ *
+ * This is currently only supported by the Vulkan renderer.
+ *
+ * \param device a GPU context to query.
+ * \param size a pointer filled in with the number of bytes returned, may
+ *             not be NULL.
+ * \returns the pipeline cache data, which should be freed with SDL_free(),
+ *          or NULL on failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateGPUDeviceWithProperties
+ */
+extern SDL_DECLSPEC void * SDLCALL SDL_GetGPUPipelineCacheData(SDL_GPUDevice *device, size_t *size);
 
 
 /* State Creation */
@@ -212,6 +212,61 @@ extern "C" {
  */
 #define SDL_HINT_APPLE_TV_REMOTE_ALLOW_ROTATION "SDL_APPLE_TV_REMOTE_ALLOW_ROTATION"
 
+/**
+ * A variable controlling how many open files each async I/O queue registers
+ * with the operating system.
+ *
+ * A registered file skips some work in the operating system for each read or
+ * write. Files are registered with a queue the first time a task uses them
+ * there, until the table is full; other files work as usual.
+ *
+ * The value is a number of files, or "0" to not register files. The default
+ * is "0".
+ *
+ * Currently only the io_uring backend on Linux uses this.
+ *
+ * This hint should be set before calling SDL_CreateAsyncIOQueue().
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_ASYNCIO_FIXED_FILES "SDL_ASYNCIO_FIXED_FILES"
+
+/**
+ * A variable controlling the most threads async I/O will use.
+ *
+ * When the platform has no native async I/O (or it isn't available), SDL
+ * does the work on a pool of threads that grows up to this size as needed
+ * and shrinks again when idle.
+ *
+ * The value is a number of threads. The default is twice the number of CPU
+ * cores, plus one, up to a maximum of 8.
+ *
+ * This hint should be set before the first async I/O queue is created or file
+ * is opened.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_ASYNCIO_MAX_THREADS "SDL_ASYNCIO_MAX_THREADS"
+
+/**
+ * A variable controlling how many tasks an async I/O queue can hand to the
+ * operating system at once.
+ *
+ * Larger queues let a batch (see SDL_BeginAsyncIOBatch()) hand more tasks to
+ * the operating system in a single system call, at the cost of memory shared
+ * with the kernel.
+ *
+ * The value is a number of entries, rounded up to a power of two by the
+ * operating system. The default is "128".
+ *
+ * Currently only the io_uring backend on Linux uses this.
+ *
+ * This hint should be set before calling SDL_CreateAsyncIOQueue().
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_ASYNCIO_QUEUE_ENTRIES "SDL_ASYNCIO_QUEUE_ENTRIES"
+
 /**
  * Specify the default ALSA audio device name.
  *
@@ -322,6 +377,35 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_DEVICE_APP_ICON_NAME "SDL_AUDIO_DEVICE_APP_ICON_NAME"
 
+/**
+ * A variable controlling how many helper threads a playback device uses to
+ * convert its bound audio streams.
+ *
+ * Normally, a playback device's thread converts, resamples and mixes every
+ * bound audio stream by itself, one after another. Apps that bind a large
+ * number of streams to a single device can set this to a number > 0 to
+ * spread that work across that many additional threads. The device thread
+ * still does a share of the work, and then sums the partial mixes together.
+ * The mix is only clamped to the -1.0f to 1.0f range once every stream has
+ * been summed, so streams that cancel each other out don't clip along the
+ * way.
+ *
+ * When this is enabled, audio stream callbacks (see
+ * SDL_SetAudioStreamGetCallback) may be called from any of these threads,
+ * and callbacks for different streams may run at the same time.
+ *
+ * The default value is "0", which disables the helper threads. This can be
+ * overridden for a specific device with the
+ * `SDL_PROP_AUDIO_DEVICE_MIX_THREADS_NUMBER` property.
+ *
+ * This hint should be set before an audio device is opened.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioDeviceProperties
+ */
+#define SDL_HINT_AUDIO_DEVICE_MIX_THREADS "SDL_AUDIO_DEVICE_MIX_THREADS"
+
 /**
  * A variable controlling device buffer size.
  *
@@ -522,6 +606,27 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_INCLUDE_MONITORS "SDL_AUDIO_INCLUDE_MONITORS"
 
+/**
+ * A variable controlling whether audio streams use precalculated filters for
+ * simple sample rate ratios.
+ *
+ * When the ratio between the input and output sample rates reduces to a small
+ * fraction, like 44100 to 48000 (147:160), the resampler only ever needs a
+ * small, fixed set of filter positions. SDL calculates the filters for those
+ * positions once, shares them between all audio streams that use that ratio,
+ * and keeps the stream's position exactly on those positions.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Always calculate the filter for each output frame.
+ * - "1": Use precalculated filters for simple ratios. (default)
+ *
+ * This hint is checked when an audio stream's sample rates change.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_AUDIO_RESAMPLER_EXACT_RATIOS "SDL_AUDIO_RESAMPLER_EXACT_RATIOS"
+
 /**
  * A variable controlling whether SDL updates joystick state when getting
  * input events.
@@ -552,6 +657,36 @@ extern "C" {
  */
 #define SDL_HINT_AUTO_UPDATE_SENSORS "SDL_AUTO_UPDATE_SENSORS"
 
+/**
+ * A variable limiting the CPU instruction set tier used by the surface
+ * blitters and the RGB to YUV conversions.
+ *
+ * Each tier includes the ones below it on the same architecture, and
+ * features that the CPU doesn't have (or that are disabled with
+ * SDL_HINT_CPU_FEATURE_MASK) are never used. This is mostly useful to
+ * compare the performance of each tier on the same machine.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "auto": Use the best blitters supported by the CPU. (default)
+ * - "scalar": Only use blitters written in C.
+ * - "mmx": Use MMX blitters.
+ * - "sse2": Use SSE and SSE2 blitters, and the tiers below.
+ * - "sse4.1": Use SSE4.1 blitters, and the tiers below.
+ * - "avx2": Use AVX2 blitters, and the tiers below.
+ * - "avx512bw": Use AVX-512BW blitters, and the tiers below.
+ * - "altivec": Use AltiVec blitters.
+ * - "neon": Use NEON blitters.
+ * - "lsx": Use LSX blitters.
+ *
+ * This hint can be set anytime, and takes effect the next time a surface is
+ * blitted to a different destination or has its blit settings changed, and
+ * the next time pixels are converted to YUV.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_BLIT_CPU_TIER "SDL_BLIT_CPU_TIER"
+
 /**
  * Prevent SDL from using version 4 of the bitmap header when saving BMPs.
  *
@@ -591,6 +726,25 @@ extern "C" {
  */
 #define SDL_HINT_CAMERA_DRIVER "SDL_CAMERA_DRIVER"
 
+/**
+ * A variable that decides how many frames SDL buffers for an opened camera.
+ *
+ * Frames wait in these buffers until the app acquires them with
+ * SDL_AcquireCameraFrame(), and stay there until it releases them with
+ * SDL_ReleaseCameraFrame(). When all of them are in use, new frames from the
+ * camera are dropped. More buffers let an app fall further behind or hold on
+ * to more frames, at the cost of memory and, when SDL is not converting
+ * frames, of the camera driver's own buffers.
+ *
+ * The value is a number between 1 and 64. The default is 8.
+ *
+ * This hint should be set before a camera is opened. The number in use is
+ * reported by SDL_PROP_CAMERA_FRAME_BUFFERS_NUMBER.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_CAMERA_FRAME_BUFFERS "SDL_CAMERA_FRAME_BUFFERS"
+
 /**
  * A variable that limits what CPU features are available.
  *
@@ -613,6 +767,7 @@ extern "C" {
  * - "avx"
  * - "avx2"
  * - "avx512f"
+ * - "avx512bw"
  * - "arm-simd"
  * - "neon"
  * - "lsx"
@@ -1159,6 +1314,20 @@ extern "C" {
  */
 #define SDL_HINT_IOS_HIDE_HOME_INDICATOR "SDL_IOS_HIDE_HOME_INDICATOR"
 
+/**
+ * A variable controlling the number of worker threads that run jobs.
+ *
+ * The value is a number of threads. The default is one thread per logical
+ * CPU core.
+ *
+ * This hint should be set before the first job is submitted. The threads are
+ * stopped by SDL_Quit(), and the hint is checked again the next time they
+ * are started.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_JOB_THREADS "SDL_JOB_THREADS"
+
 /**
  * A variable that lets you enable joystick (and gamecontroller) events even
  * when your app is in the background.
@@ -2075,6 +2244,27 @@ extern "C" {
  */
 #define SDL_HINT_JOYSTICK_LINUX_HAT_DEADZONES "SDL_JOYSTICK_LINUX_HAT_DEADZONES"
 
+/**
+ * A variable controlling whether joysticks on Linux are read by a dedicated
+ * input thread.
+ *
+ * The input thread waits on all the open evdev devices and on device
+ * hotplug notifications, and applies the input events as soon as the kernel
+ * delivers them, instead of when the application pumps events. The joystick
+ * state and events are then up to date regardless of the application frame
+ * rate.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Read joystick input when the application pumps events. (default)
+ * - "1": Read joystick input on a dedicated thread.
+ *
+ * This hint should be set before the joystick subsystem is initialized.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD "SDL_JOYSTICK_LINUX_INPUT_THREAD"
+
 /**
  * A variable controlling whether GCController should be used for controller
  * handling.
@@ -3038,6 +3228,26 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_METAL_PREFER_LOW_POWER_DEVICE "SDL_RENDER_METAL_PREFER_LOW_POWER_DEVICE"
 
+/**
+ * A variable controlling how many threads the software renderer uses.
+ *
+ * When more than one thread is used, the render target is split into
+ * horizontal bands and clears, fills, points and unscaled copies are drawn
+ * into each band in parallel. Other drawing is done on the thread submitting
+ * the commands. The output is identical to rendering on a single thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "1": Render on the thread submitting the commands. (default)
+ * - "0": Use one thread per logical CPU core.
+ * - N: Use N threads, including the thread submitting the commands.
+ *
+ * This hint should be set before creating a renderer.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS "SDL_RENDER_SOFTWARE_THREADS"
+
 /**
  * A variable controlling whether updates to the SDL screen surface should be
  * synchronized with the vertical refresh, to avoid tearing.
@@ -3192,6 +3402,30 @@ extern "C" {
  */
 #define SDL_HINT_STORAGE_USER_DRIVER "SDL_STORAGE_USER_DRIVER"
 
+/**
+ * A variable controlling how many threads are used to convert large images.
+ *
+ * When more than one thread is used, SDL_ConvertSurface(),
+ * SDL_ConvertPixels() and their colorspace variants split the image into
+ * bands of rows that are converted in parallel. Small images and
+ * conversions to indexed formats are always converted on the calling
+ * thread. The output is identical to converting on a single thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "1": Convert on the calling thread. (default)
+ * - "0": Use one thread per logical CPU core.
+ * - N: Use N threads, including the calling thread.
+ *
+ * The extra threads are SDL's job threads, so no more than
+ * SDL_GetNumJobThreads() of them are used at once.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_SURFACE_CONVERT_THREADS "SDL_SURFACE_CONVERT_THREADS"
+
 /**
  * Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as
  * realtime.
@@ -3264,6 +3498,26 @@ extern "C" {
  */
 #define SDL_HINT_TIMER_RESOLUTION "SDL_TIMER_RESOLUTION"
 
+/**
+ * A variable controlling how long, in nanoseconds, timers may be delayed so
+ * they can be fired together.
+ *
+ * When the timer thread wakes up for a timer, it also fires every other timer
+ * that has come due by then. Allowing each timer some slack means timers
+ * scheduled close together are handled in a single wakeup, which saves CPU
+ * time and power when lots of timers are running. Timers never fire early.
+ *
+ * The default value is "0", timers are fired as close to their deadline as
+ * possible.
+ *
+ * This can be overridden with SDL_PROP_TIMER_SLACK_NS_NUMBER.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_TIMER_SLACK "SDL_TIMER_SLACK"
+
 /**
  * A variable controlling whether touch events should generate synthetic mouse
  * events.
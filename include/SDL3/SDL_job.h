@@ -0,0 +1,259 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* WIKI CATEGORY: Job */
+
+/**
+ * # CategoryJob
+ *
+ * SDL offers a small job system: a pool of worker threads, one per CPU core
+ * by default, that run short pieces of work submitted by the app (and by SDL
+ * itself, for things like converting large images).
+ *
+ * The general usage pattern is:
+ *
+ * - Create an SDL_JobCounter with SDL_CreateJobCounter.
+ * - Submit jobs with SDL_SubmitJob, passing the counter as the job's
+ *   `counter`. The counter goes up by one for each job submitted and down by
+ *   one as each job finishes.
+ * - Call SDL_WaitJobCounter to wait until every job on the counter is done.
+ *   The waiting thread runs jobs itself while it waits, instead of sleeping.
+ * - Destroy the counter with SDL_DestroyJobCounter when it's no longer
+ *   needed.
+ *
+ * A job can also be given a `dependency` counter, in which case it doesn't
+ * start until that counter reaches zero. This makes it easy to build chains
+ * and graphs of work: give every job in one stage the same counter, and use
+ * that counter as the dependency of every job in the next stage.
+ *
+ * For the common case of running the same function over a range of numbers,
+ * such as the rows of an image or the elements of an array, SDL_ParallelFor
+ * splits the range into pieces, runs them on the worker threads and the
+ * calling thread, and returns when they're all done.
+ *
+ * Each worker thread has its own queue of jobs, and a worker that runs out of
+ * work takes jobs from the others, so the load spreads out across the pool
+ * without every thread contending for a single queue.
+ *
+ * Jobs should not block for long periods of time, for example waiting on file
+ * or network I/O, since a blocked job ties up a worker thread that other jobs
+ * could be using. Use SDL_AsyncIO for I/O instead. It is safe for a job to
+ * submit more jobs, to call SDL_ParallelFor, and to wait on a counter.
+ *
+ * The worker threads are started the first time a job is submitted, and are
+ * stopped by SDL_Quit. All jobs should be finished before SDL_Quit is called.
+ */
+
+#ifndef SDL_job_h_
+#define SDL_job_h_
+
+#include <SDL3/SDL_stdinc.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A counter of unfinished jobs.
+ *
+ * This operates as an opaque handle. Every job submitted with a counter adds
+ * one to it, and takes one away again when it finishes.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateJobCounter
+ * \sa SDL_SubmitJob
+ * \sa SDL_WaitJobCounter
+ */
+typedef struct SDL_JobCounter SDL_JobCounter;
+
+/**
+ * A function that runs as a job.
+ *
+ * \param userdata the `userdata` pointer passed to SDL_SubmitJob.
+ *
+ * \threadsafety This function is called on one of SDL's worker threads, or
+ *               on a thread that is waiting on a job counter.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+typedef void (SDLCALL *SDL_JobFunction)(void *userdata);
+
+/**
+ * A function that runs over part of the range given to SDL_ParallelFor.
+ *
+ * \param userdata the `userdata` pointer passed to SDL_ParallelFor.
+ * \param start the first number in this part of the range.
+ * \param end one past the last number in this part of the range.
+ *
+ * \threadsafety This function is called on several threads at once, each
+ *               with a different part of the range.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_ParallelFor
+ */
+typedef void (SDLCALL *SDL_ParallelForFunction)(void *userdata, int start, int end);
+
+/**
+ * Create a job counter.
+ *
+ * A new counter starts at zero.
+ *
+ * \returns a new job counter or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyJobCounter
+ * \sa SDL_SubmitJob
+ * \sa SDL_WaitJobCounter
+ */
+extern SDL_DECLSPEC SDL_JobCounter * SDLCALL SDL_CreateJobCounter(void);
+
+/**
+ * Destroy a job counter.
+ *
+ * The counter must be at zero: every job that uses it, as its counter or as
+ * its dependency, must have finished. Call SDL_WaitJobCounter first if
+ * there's any doubt.
+ *
+ * \param counter the job counter to destroy.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateJobCounter
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyJobCounter(SDL_JobCounter *counter);
+
+/**
+ * Submit a job to run on SDL's worker threads.
+ *
+ * This function returns as soon as the job is queued; it does not wait for
+ * the job to run.
+ *
+ * If `counter` isn't NULL, it goes up by one now, and down by one once
+ * `function` has returned.
+ *
+ * If `dependency` isn't NULL, the job doesn't start until `dependency` is at
+ * zero. If it is already at zero, the job is queued straight away.
+ *
+ * \param function the function to run.
+ * \param userdata a pointer that is passed to `function`.
+ * \param dependency a counter that must reach zero before the job starts, or
+ *                   NULL.
+ * \param counter a counter that tracks this job until it finishes, or NULL.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateJobCounter
+ * \sa SDL_ParallelFor
+ * \sa SDL_WaitJobCounter
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SubmitJob(SDL_JobFunction function, void *userdata, SDL_JobCounter *dependency, SDL_JobCounter *counter);
+
+/**
+ * Wait until a job counter reaches zero.
+ *
+ * While it waits, the calling thread runs other queued jobs, so waiting from
+ * inside a job doesn't take a thread away from the pool. It only goes to
+ * sleep when there is nothing else to run.
+ *
+ * \param counter the job counter to wait on.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_WaitJobCounter(SDL_JobCounter *counter);
+
+/**
+ * Run a function over a range of numbers on several threads at once.
+ *
+ * The range from `start` to `end - 1` is split into pieces of `grain_size`
+ * numbers (the last piece may be smaller), and `function` is called once per
+ * piece. The pieces run on SDL's worker threads and on the calling thread,
+ * in no particular order, and this function returns when they've all
+ * finished.
+ *
+ * If `grain_size` is zero or less, SDL picks a size that gives each thread a
+ * few pieces, so threads that finish early can take more.
+ *
+ * Unlike SDL_WaitJobCounter, the calling thread doesn't run unrelated jobs
+ * while it waits; once every piece has been started, it just waits for the
+ * pieces still running on other threads to finish.
+ *
+ * \param start the first number in the range.
+ * \param end one past the last number in the range.
+ * \param grain_size the most numbers to give `function` in one call, or 0 to
+ *                   let SDL decide.
+ * \param function the function to run.
+ * \param userdata a pointer that is passed to `function`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ParallelFor(int start, int end, int grain_size, SDL_ParallelForFunction function, void *userdata);
+
+/**
+ * Get the number of worker threads that run jobs.
+ *
+ * This starts the worker threads if they aren't running yet.
+ *
+ * \returns the number of worker threads, or 0 if they couldn't be started.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_HINT_JOB_THREADS
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetNumJobThreads(void);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_job_h_ */
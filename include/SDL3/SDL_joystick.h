@@ -647,6 +647,14 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SendJoystickVirtualSensorData(SDL_Joystick
  *   left/right rumble
  * - `SDL_PROP_JOYSTICK_CAP_TRIGGER_RUMBLE_BOOLEAN`: true if this joystick has
  *   simple trigger rumble
+ * - `SDL_PROP_JOYSTICK_LATENCY_HISTOGRAM_POINTER`: a pointer to an array of
+ *   SDL_JOYSTICK_LATENCY_HISTOGRAM_BUCKETS Uint64 counts of input reports by
+ *   the time between the device generating them and SDL applying them to the
+ *   joystick state. Bucket N counts the reports that took less than 2^N * 64
+ *   microseconds and more than the previous bucket, and the last bucket
+ *   counts all the slower reports. This is currently only available for
+ *   Linux evdev devices, and the counts should be read while holding
+ *   SDL_LockJoysticks(), since they are updated as input arrives.
  *
  * \param joystick the SDL_Joystick obtained from SDL_OpenJoystick().
  * \returns a valid property ID on success or 0 on failure; call
@@ -661,6 +669,15 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetJoystickProperties(SDL_Joyst
 #define SDL_PROP_JOYSTICK_CAP_PLAYER_LED_BOOLEAN        "SDL.joystick.cap.player_led"
 #define SDL_PROP_JOYSTICK_CAP_RUMBLE_BOOLEAN            "SDL.joystick.cap.rumble"
 #define SDL_PROP_JOYSTICK_CAP_TRIGGER_RUMBLE_BOOLEAN    "SDL.joystick.cap.trigger_rumble"
+#define SDL_PROP_JOYSTICK_LATENCY_HISTOGRAM_POINTER     "SDL.joystick.latency_histogram"
+
+/**
+ * The number of buckets in the SDL_PROP_JOYSTICK_LATENCY_HISTOGRAM_POINTER
+ * joystick property.
+ *
+ * \since This macro is available since SDL 3.4.0.
+ */
+#define SDL_JOYSTICK_LATENCY_HISTOGRAM_BUCKETS  12
 
 /**
  * Get the implementation dependent name of a joystick.
@@ -463,6 +463,16 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetRendererName(SDL_Renderer *rende
  *   that can be displayed, in terms of the SDR white point. When HDR is not
  *   enabled, this will be 1.0. This property can change dynamically when
  *   SDL_EVENT_WINDOW_HDR_STATE_CHANGED is sent.
+ * - `SDL_PROP_RENDERER_COMMANDS_NUMBER`: the number of render commands passed
+ *   to the rendering driver since the renderer was created. This is updated
+ *   each time queued rendering is flushed.
+ * - `SDL_PROP_RENDERER_MERGED_COMMANDS_NUMBER`: the number of texture copies
+ *   and geometry draws that were appended to the previous command because
+ *   they used the same texture and render state. This is updated each time
+ *   queued rendering is flushed.
+ * - `SDL_PROP_RENDERER_VERTEX_BYTES_NUMBER`: the number of bytes of vertex
+ *   data passed to the rendering driver since the renderer was created. This
+ *   is updated each time queued rendering is flushed.
  *
  * With the direct3d renderer:
  *
@@ -528,6 +538,9 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetRendererProperties(SDL_Rende
 #define SDL_PROP_RENDERER_HDR_ENABLED_BOOLEAN                       "SDL.renderer.HDR_enabled"
 #define SDL_PROP_RENDERER_SDR_WHITE_POINT_FLOAT                     "SDL.renderer.SDR_white_point"
 #define SDL_PROP_RENDERER_HDR_HEADROOM_FLOAT                        "SDL.renderer.HDR_headroom"
+#define SDL_PROP_RENDERER_COMMANDS_NUMBER                           "SDL.renderer.commands"
+#define SDL_PROP_RENDERER_MERGED_COMMANDS_NUMBER                    "SDL.renderer.merged_commands"
+#define SDL_PROP_RENDERER_VERTEX_BYTES_NUMBER                       "SDL.renderer.vertex_bytes"
 #define SDL_PROP_RENDERER_D3D9_DEVICE_POINTER                       "SDL.renderer.d3d9.device"
 #define SDL_PROP_RENDERER_D3D11_DEVICE_POINTER                      "SDL.renderer.d3d11.device"
 #define SDL_PROP_RENDERER_D3D11_SWAPCHAIN_POINTER                   "SDL.renderer.d3d11.swap_chain"
@@ -236,6 +236,11 @@ extern SDL_DECLSPEC void SDLCALL SDL_DestroySurface(SDL_Surface *surface);
  *   left edge of the image, if this surface is being used as a cursor.
  * - `SDL_PROP_SURFACE_HOTSPOT_Y_NUMBER`: the hotspot pixel offset from the
  *   top edge of the image, if this surface is being used as a cursor.
+ * - `SDL_PROP_SURFACE_CONVERT_THREADS_NUMBER`: the number of threads used to
+ *   convert large images from or to this surface's pixels, overriding
+ *   SDL_HINT_SURFACE_CONVERT_THREADS. This is also used when it is set in
+ *   the properties passed to SDL_ConvertSurfaceAndColorspace() or
+ *   SDL_ConvertPixelsAndColorspace().
  *
  * \param surface the SDL_Surface structure to query.
  * \returns a valid property ID on success or 0 on failure; call
@@ -252,6 +257,7 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetSurfaceProperties(SDL_Surfac
 #define SDL_PROP_SURFACE_TONEMAP_OPERATOR_STRING            "SDL.surface.tonemap"
 #define SDL_PROP_SURFACE_HOTSPOT_X_NUMBER                   "SDL.surface.hotspot.x"
 #define SDL_PROP_SURFACE_HOTSPOT_Y_NUMBER                   "SDL.surface.hotspot.y"
+#define SDL_PROP_SURFACE_CONVERT_THREADS_NUMBER             "SDL.surface.convert_threads"
 
 /**
  * Set the colorspace used by a surface.
@@ -43,6 +43,7 @@
 
 #include <SDL3/SDL_stdinc.h>
 #include <SDL3/SDL_error.h>
+#include <SDL3/SDL_properties.h>
 
 #include <SDL3/SDL_begin_code.h>
 /* Set up for C function definitions, even when using C++ */
@@ -442,6 +443,43 @@ extern SDL_DECLSPEC SDL_TimerID SDLCALL SDL_AddTimerNS(Uint64 interval, SDL_NSTi
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_RemoveTimer(SDL_TimerID id);
 
+/**
+ * Get the properties associated with the timer system.
+ *
+ * The following property can be set by the app at any time:
+ *
+ * - `SDL_PROP_TIMER_SLACK_NS_NUMBER`: how long, in nanoseconds, a timer may
+ *   be delayed so it can fire in the same wakeup as timers due shortly after
+ *   it, overriding SDL_HINT_TIMER_SLACK. Timers never fire early. A new
+ *   value applies to timers added afterwards, and to timers that are already
+ *   waiting within about a second.
+ *
+ * The following read-only properties are updated by SDL at most about once
+ * a second, when the timer thread wakes up:
+ *
+ * - `SDL_PROP_TIMER_WAKEUPS_NUMBER`: the number of times the timer thread
+ *   has woken up.
+ * - `SDL_PROP_TIMER_WAKEUPS_PER_SECOND_FLOAT`: the rate the timer thread
+ *   woke up at, averaged over roughly the last second.
+ * - `SDL_PROP_TIMER_CALLBACKS_NUMBER`: the number of timer callbacks that
+ *   have been called.
+ *
+ * \returns a valid property ID on success or 0 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AddTimer
+ */
+extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetTimerProperties(void);
+
+#define SDL_PROP_TIMER_SLACK_NS_NUMBER              "SDL.timer.slack_ns"
+#define SDL_PROP_TIMER_WAKEUPS_NUMBER               "SDL.timer.wakeups"
+#define SDL_PROP_TIMER_WAKEUPS_PER_SECOND_FLOAT     "SDL.timer.wakeups_per_second"
+#define SDL_PROP_TIMER_CALLBACKS_NUMBER             "SDL.timer.callbacks"
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
@@ -204,6 +204,7 @@
 #cmakedefine HAVE_IBUS_IBUS_H 1
 #cmakedefine HAVE_INOTIFY_INIT1 1
 #cmakedefine HAVE_INOTIFY 1
+#cmakedefine HAVE_EPOLL 1
 #cmakedefine HAVE_LIBUSB 1
 #cmakedefine HAVE_O_CLOEXEC 1
 
@@ -351,6 +352,7 @@
 #cmakedefine SDL_THREAD_PTHREAD 1
 #cmakedefine SDL_THREAD_PTHREAD_RECURSIVE_MUTEX 1
 #cmakedefine SDL_THREAD_PTHREAD_RECURSIVE_MUTEX_NP 1
+#cmakedefine SDL_THREAD_LINUX_FUTEX 1
 #cmakedefine SDL_THREAD_WINDOWS 1
 #cmakedefine SDL_THREAD_VITA 1
 #cmakedefine SDL_THREAD_PSP 1
@@ -665,6 +665,7 @@ void SDL_Quit(void)
 
     SDL_QuitTimers();
     SDL_QuitAsyncIO();
+    SDL_QuitJobs();
 
     SDL_SetObjectsInvalid();
     SDL_AssertionsQuit();
@@ -678,6 +679,9 @@ void SDL_Quit(void)
      */
     SDL_memset(SDL_SubsystemRefCount, 0x0, sizeof(SDL_SubsystemRefCount));
 
+#if defined(SDL_THREAD_LINUX_FUTEX) && !defined(NDEBUG)
+    SDL_LogFutexStats();
+#endif
     SDL_QuitLog();
     SDL_QuitHints();
     SDL_QuitProperties();
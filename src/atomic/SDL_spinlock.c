@@ -44,6 +44,10 @@
 #include <libkern/OSAtomic.h>
 #endif
 
+#ifdef SDL_THREAD_LINUX_FUTEX
+#include "../thread/linux/SDL_sysfutex.h"
+#endif
+
 /* *INDENT-OFF* */ // clang-format off
 #if defined(__WATCOMC__) && defined(__386__)
 SDL_COMPILE_TIME_ASSERT(locksize, 4==sizeof(SDL_SpinLock));
@@ -59,7 +63,12 @@ extern __inline int _SDL_xchg_watcom(volatile int *a, int v);
 // This function is where all the magic happens...
 bool SDL_TryLockSpinlock(SDL_SpinLock *lock)
 {
-#if defined(HAVE_GCC_ATOMICS) || defined(HAVE_GCC_SYNC_LOCK_TEST_AND_SET)
+#ifdef SDL_THREAD_LINUX_FUTEX
+    // The lock is 2 when there are threads asleep waiting for it, so it mustn't be overwritten with 1
+    int expected = 0;
+    return __atomic_compare_exchange_n(lock, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+
+#elif defined(HAVE_GCC_ATOMICS) || defined(HAVE_GCC_SYNC_LOCK_TEST_AND_SET)
     return __sync_lock_test_and_set(lock, 1) == 0;
 
 #elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
@@ -163,6 +172,30 @@ bool SDL_TryLockSpinlock(SDL_SpinLock *lock)
 
 void SDL_LockSpinlock(SDL_SpinLock *lock)
 {
+#ifdef SDL_THREAD_LINUX_FUTEX
+    int iterations;
+
+    if (SDL_TryLockSpinlock(lock)) {
+        return;
+    }
+
+    SDL_FUTEX_STAT(NULL, SDL_FUTEX_STATS_SPINLOCK, contended);
+    if (SDL_FutexCanSpin()) {
+        for (iterations = 0; iterations < 32; ++iterations) {
+            SDL_CPUPauseInstruction();
+            if (__atomic_load_n(lock, __ATOMIC_RELAXED) == 0 && SDL_TryLockSpinlock(lock)) {
+                SDL_FUTEX_STAT(NULL, SDL_FUTEX_STATS_SPINLOCK, spun);
+                return;
+            }
+        }
+    }
+
+    // Go to sleep until the lock is released, instead of yielding over and over
+    SDL_FUTEX_STAT(NULL, SDL_FUTEX_STATS_SPINLOCK, slept);
+    while (__atomic_exchange_n(lock, 2, __ATOMIC_ACQUIRE) != 0) {
+        SDL_FutexWait(lock, 2, -1);
+    }
+#else
     int iterations = 0;
     // FIXME: Should we have an eventual timeout?
     while (!SDL_TryLockSpinlock(lock)) {
@@ -174,11 +207,17 @@ void SDL_LockSpinlock(SDL_SpinLock *lock)
             SDL_Delay(0);
         }
     }
+#endif // SDL_THREAD_LINUX_FUTEX
 }
 
 void SDL_UnlockSpinlock(SDL_SpinLock *lock)
 {
-#if defined(HAVE_GCC_ATOMICS) || defined(HAVE_GCC_SYNC_LOCK_TEST_AND_SET)
+#ifdef SDL_THREAD_LINUX_FUTEX
+    if (__atomic_exchange_n(lock, 0, __ATOMIC_RELEASE) == 2) {
+        SDL_FutexWake(lock, 1);
+    }
+
+#elif defined(HAVE_GCC_ATOMICS) || defined(HAVE_GCC_SYNC_LOCK_TEST_AND_SET)
     __sync_lock_release(lock);
 
 #elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
@@ -270,6 +270,8 @@ static void UpdateAudioStreamFormatsPhysical(SDL_AudioDevice *device)
             SDL_LockMutex(stream->lock);
             SDL_copyp(streamspec, &spec);
             SetAudioStreamChannelMap(stream, streamspec, streamchmap, device->chmap, device->spec.channels, -1);  // this should be fast for normal cases, though!
+            UpdateAudioStreamInputRing(stream);
+            UpdateAudioStreamResamplePlans(stream);
             SDL_UnlockMutex(stream->lock);
         }
     }
@@ -580,6 +582,7 @@ static void DestroyPhysicalAudioDevice(SDL_AudioDevice *device)
 
     SDL_UnlockMutex(device->lock);  // don't use ReleaseAudioDevice because we don't want to change refcounts while destroying.
 
+    SDL_DestroyProperties(device->props);
     SDL_DestroyMutex(device->lock);
     SDL_DestroyCondition(device->close_cond);
     SDL_free(device->work_buffer);
@@ -1110,10 +1113,231 @@ void SDL_AudioThreadFinalize(SDL_AudioDevice *device)
 {
 }
 
-static void MixFloat32Audio(float *dst, const float *src, const int buffer_size)
+// Gets the next chunk of converted data from `stream` into `work_buffer` and sums it into `mix_buffer`. Returns bytes mixed, or -1 on failure.
+// The sum isn't clamped; the caller clamps the finished mix once with ClampFloat32Audio(), so it doesn't matter what order streams are added in.
+static int MixAudioStream(SDL_AudioDevice *device, SDL_AudioStream *stream, float *mix_buffer, Uint8 *work_buffer, int work_buffer_size, float gain)
 {
-    if (!SDL_MixAudio((Uint8 *) dst, (const Uint8 *) src, SDL_AUDIO_F32, buffer_size, 1.0f)) {
-        SDL_assert(!"This shouldn't happen.");
+    /* this will hold a lock on `stream` while getting. We don't explicitly lock the streams
+       for iterating here because the binding linked list can only change while the device lock is held.
+       (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
+       the same stream to different devices at the same time, though.) */
+    const int br = SDL_GetAudioStreamDataAdjustGain(stream, work_buffer, work_buffer_size, gain);
+    if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
+        // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
+        if (!SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap)) {
+            ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), work_buffer, device->spec.format, device->spec.channels, NULL,
+                         work_buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
+        }
+        AccumulateFloat32Audio(mix_buffer, (const float *) work_buffer, br / sizeof (float));
+    }
+    return br;
+}
+
+// Mixes the streams that belong to mix slot `slot`, in order. This runs on the device thread and the mix workers at the same time.
+// Every slot always gets the same streams and the device thread sums the slots in order, so a given number of workers always
+// produces the same mix. It can differ from the single-threaded mix in the last bits, because floating point sums depend on order.
+static bool MixAudioStreamSlot(SDL_AudioDevice *device, int slot, float *mix_buffer, Uint8 *work_buffer, bool *mixed)
+{
+    const int work_buffer_size = device->mix_buffer_size;
+    for (int i = slot; i < device->num_mix_streams; i += device->num_mix_slots) {
+        if (!*mixed) {
+            SDL_memset(mix_buffer, '\0', work_buffer_size);  // start with silence.
+            *mixed = true;
+        }
+
+        if (MixAudioStream(device, device->mix_streams[i], mix_buffer, work_buffer, work_buffer_size, device->mix_gain) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int SDLCALL AudioMixWorkerThread(void *data)
+{
+    SDL_AudioMixWorker *worker = (SDL_AudioMixWorker *) data;
+    SDL_AudioDevice *device = worker->device;
+
+    while (true) {
+        SDL_WaitSemaphore(device->mix_start_sem);
+        if (SDL_GetAtomicInt(&device->mix_workers_quit)) {
+            break;
+        }
+
+        // slot 0 is the device thread's, and slot N uses mix_workers[N-1]'s buffers, no matter which thread claims it.
+        // the device thread resets `mixed` and `failed` before waking us, so we only ever set them here.
+        const int slot = SDL_AddAtomicInt(&device->mix_next_slot, 1);
+        SDL_AudioMixWorker *partial = &device->mix_workers[slot - 1];
+        if (!MixAudioStreamSlot(device, slot, partial->mix_buffer, partial->work_buffer, &partial->mixed)) {
+            partial->failed = true;
+        }
+
+        SDL_SignalSemaphore(device->mix_done_sem);
+    }
+
+    return 0;
+}
+
+// this expects the device lock to be held, and only runs on the device thread. `mix_buffer` must already be silenced.
+static bool MixAudioStreamsInParallel(SDL_AudioDevice *device, SDL_LogicalAudioDevice *logdev, float *mix_buffer, int work_buffer_size)
+{
+    int num_streams = 0;
+    for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+        num_streams++;
+    }
+
+    if (num_streams > device->mix_streams_allocation) {
+        SDL_AudioStream **ptr = (SDL_AudioStream **) SDL_realloc(device->mix_streams, num_streams * sizeof (*ptr));
+        if (!ptr) {
+            return false;
+        }
+        device->mix_streams = ptr;
+        device->mix_streams_allocation = num_streams;
+    }
+
+    num_streams = 0;
+    for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+        device->mix_streams[num_streams++] = stream;
+    }
+
+    // the device format might have grown since the workers last ran, so make sure they have enough space.
+    for (int i = 0; i < device->num_mix_workers; i++) {
+        SDL_AudioMixWorker *worker = &device->mix_workers[i];
+        if (worker->buffer_size < work_buffer_size) {
+            SDL_aligned_free(worker->mix_buffer);
+            SDL_aligned_free(worker->work_buffer);
+            worker->mix_buffer = (float *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), work_buffer_size);
+            worker->work_buffer = (Uint8 *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), work_buffer_size);
+            if (!worker->mix_buffer || !worker->work_buffer) {
+                worker->buffer_size = 0;
+                return false;
+            }
+            worker->buffer_size = work_buffer_size;
+        }
+        worker->mixed = false;
+        worker->failed = false;
+    }
+
+    // the device thread takes a share of the streams, too, so don't wake more workers than there is work for.
+    const int num_workers = SDL_min(device->num_mix_workers, num_streams - 1);
+
+    device->num_mix_streams = num_streams;
+    device->num_mix_slots = num_workers + 1;
+    device->mix_gain = logdev->gain;
+    device->mix_buffer_size = work_buffer_size;
+    SDL_SetAtomicInt(&device->mix_next_slot, 1);  // slot 0 is the device thread's.
+
+    for (int i = 0; i < num_workers; i++) {
+        SDL_SignalSemaphore(device->mix_start_sem);
+    }
+
+    bool mixed = true;  // the device thread mixes straight into the final buffer, which is silenced or holds earlier logical devices.
+    bool result = MixAudioStreamSlot(device, 0, mix_buffer, device->work_buffer, &mixed);
+
+    for (int i = 0; i < num_workers; i++) {
+        SDL_WaitSemaphore(device->mix_done_sem);
+    }
+
+    // sum the partial mixes into the final buffer in slot order, and only clamp once everything is in, like the single-threaded path.
+    for (int i = 0; i < num_workers; i++) {
+        const SDL_AudioMixWorker *worker = &device->mix_workers[i];
+        if (worker->failed) {
+            result = false;
+        } else if (worker->mixed) {
+            AccumulateFloat32Audio(mix_buffer, worker->mix_buffer, work_buffer_size / sizeof (float));
+        }
+    }
+    ClampFloat32Audio(mix_buffer, work_buffer_size / sizeof (float));
+
+    return result;
+}
+
+// this is called without the device lock held, after the device thread has joined.
+static void StopAudioMixWorkers(SDL_AudioDevice *device)
+{
+    if (device->mix_workers) {
+        SDL_SetAtomicInt(&device->mix_workers_quit, 1);
+        for (int i = 0; i < device->num_mix_workers; i++) {
+            SDL_SignalSemaphore(device->mix_start_sem);
+        }
+        for (int i = 0; i < device->num_mix_workers; i++) {
+            SDL_AudioMixWorker *worker = &device->mix_workers[i];
+            SDL_WaitThread(worker->thread, NULL);
+            SDL_aligned_free(worker->mix_buffer);
+            SDL_aligned_free(worker->work_buffer);
+        }
+        SDL_free(device->mix_workers);
+        device->mix_workers = NULL;
+        device->num_mix_workers = 0;
+    }
+
+    SDL_DestroySemaphore(device->mix_start_sem);
+    device->mix_start_sem = NULL;
+    SDL_DestroySemaphore(device->mix_done_sem);
+    device->mix_done_sem = NULL;
+
+    SDL_free(device->mix_streams);
+    device->mix_streams = NULL;
+    device->num_mix_streams = 0;
+    device->mix_streams_allocation = 0;
+}
+
+// this expects the device lock to be held. Failing to start workers isn't fatal; we just mix everything on the device thread.
+static void StartAudioMixWorkers(SDL_AudioDevice *device)
+{
+    int num_workers = (int) SDL_GetNumberProperty(device->props, SDL_PROP_AUDIO_DEVICE_MIX_THREADS_NUMBER, -1);
+    if (num_workers < 0) {
+        const char *hint = SDL_GetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+        num_workers = hint ? SDL_atoi(hint) : 0;
+    }
+    num_workers = SDL_clamp(num_workers, 0, SDL_MAX_AUDIO_MIX_THREADS);
+
+    if (device->recording || (num_workers == 0)) {
+        return;
+    }
+
+    SDL_SetAtomicInt(&device->mix_workers_quit, 0);
+    device->mix_start_sem = SDL_CreateSemaphore(0);
+    device->mix_done_sem = SDL_CreateSemaphore(0);
+    device->mix_workers = (SDL_AudioMixWorker *) SDL_calloc(num_workers, sizeof (SDL_AudioMixWorker));
+    if (!device->mix_start_sem || !device->mix_done_sem || !device->mix_workers) {
+        StopAudioMixWorkers(device);
+        return;
+    }
+
+    for (int i = 0; i < num_workers; i++) {
+        char threadname[64];
+        SDL_AudioMixWorker *worker = &device->mix_workers[i];
+        worker->device = device;
+        (void)SDL_snprintf(threadname, sizeof (threadname), "SDLAudioMix%d.%d", (int) device->instance_id, i);
+        worker->thread = SDL_CreateThread(AudioMixWorkerThread, threadname, worker);
+        if (!worker->thread) {
+            break;
+        }
+        device->num_mix_workers++;
+    }
+
+    if (device->num_mix_workers == 0) {
+        StopAudioMixWorkers(device);
+    }
+}
+
+// this expects the device lock to be held.
+static void TrackPlaybackIterationTime(SDL_AudioDevice *device, int buffer_size, Uint64 elapsed_ns)
+{
+    const Uint64 frames = (Uint64) (buffer_size / SDL_AUDIO_FRAMESIZE(device->spec));
+    const Uint64 period_ns = (frames * SDL_NS_PER_SECOND) / device->spec.freq;
+
+    device->max_iteration_ns = SDL_max(device->max_iteration_ns, elapsed_ns);
+    if (elapsed_ns > period_ns) {
+        device->num_overruns++;
+    }
+
+    // don't bother with properties unless the app asked for them.
+    if (device->props) {
+        SDL_SetNumberProperty(device->props, SDL_PROP_AUDIO_DEVICE_ITERATION_NS_NUMBER, (Sint64) elapsed_ns);
+        SDL_SetNumberProperty(device->props, SDL_PROP_AUDIO_DEVICE_ITERATION_MAX_NS_NUMBER, (Sint64) device->max_iteration_ns);
+        SDL_SetNumberProperty(device->props, SDL_PROP_AUDIO_DEVICE_BUFFER_PERIOD_NS_NUMBER, (Sint64) period_ns);
+        SDL_SetNumberProperty(device->props, SDL_PROP_AUDIO_DEVICE_OVERRUNS_NUMBER, device->num_overruns);
     }
 }
 
@@ -1148,6 +1372,8 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
         SDL_assert(buffer_size <= device->buffer_size);  // you can ask for less, but not more.
         SDL_assert(AudioDeviceCanUseSimpleCopy(device) == device->simple_copy);  // make sure this hasn't gotten out of sync.
 
+        const Uint64 iteration_start_ns = SDL_GetTicksNS();
+
         // can we do a basic copy without silencing/mixing the buffer? This is an extremely likely scenario, so we special-case it.
         if (device->simple_copy) {
             SDL_LogicalAudioDevice *logdev = device->logical_devices;
@@ -1211,26 +1437,22 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                     logdev->iteration_start(logdev->iteration_userdata, logdev->instance_id, true);
                 }
 
-                for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
-                    // We should have updated this elsewhere if the format changed!
-                    SDL_assert(SDL_AudioSpecsEqual(&stream->dst_spec, &outspec, NULL, NULL));
+                if (device->num_mix_workers && logdev->bound_streams && logdev->bound_streams->next_binding) {
+                    // more than one stream and we have helper threads? Spread the conversion work across them.
+                    if (!MixAudioStreamsInParallel(device, logdev, mix_buffer, work_buffer_size)) {
+                        failed = true;  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
+                    }
+                } else {
+                    for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+                        // We should have updated this elsewhere if the format changed!
+                        SDL_assert(SDL_AudioSpecsEqual(&stream->dst_spec, &outspec, NULL, NULL));
 
-                    /* this will hold a lock on `stream` while getting. We don't explicitly lock the streams
-                       for iterating here because the binding linked list can only change while the device lock is held.
-                       (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
-                       the same stream to different devices at the same time, though.) */
-                    const int br = SDL_GetAudioStreamDataAdjustGain(stream, device->work_buffer, work_buffer_size, logdev->gain);
-                    if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
-                        failed = true;
-                        break;
-                    } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
-                        // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
-                        if (!SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap)) {
-                            ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), device->work_buffer, device->spec.format, device->spec.channels, NULL,
-                                         device->work_buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
+                        if (MixAudioStream(device, stream, mix_buffer, device->work_buffer, work_buffer_size, logdev->gain) < 0) {
+                            failed = true;  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
+                            break;
                         }
-                        MixFloat32Audio(mix_buffer, (float *) device->work_buffer, br);
                     }
+                    ClampFloat32Audio(mix_buffer, work_buffer_size / sizeof (float));  // clamp once, after every stream is in.
                 }
 
                 if (logdev->iteration_end) {
@@ -1240,7 +1462,7 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                 if (postmix) {
                     SDL_assert(mix_buffer == device->postmix_buffer);
                     postmix(logdev->postmix_userdata, &outspec, mix_buffer, work_buffer_size);
-                    MixFloat32Audio(final_mix_buffer, mix_buffer, work_buffer_size);
+                    MixFloat32Audio(final_mix_buffer, mix_buffer, work_buffer_size / sizeof (float));
                 }
             }
 
@@ -1252,6 +1474,8 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
             }
         }
 
+        TrackPlaybackIterationTime(device, buffer_size, SDL_GetTicksNS() - iteration_start_ns);
+
         // PlayDevice SHOULD NOT BLOCK, as we are holding a lock right now. Block in WaitDevice instead!
         if (!device->PlayDevice(device, device_buffer, buffer_size)) {
             failed = true;
@@ -1602,6 +1826,22 @@ int *SDL_GetAudioDeviceChannelMap(SDL_AudioDeviceID devid, int *count)
     return result;
 }
 
+SDL_PropertiesID SDL_GetAudioDeviceProperties(SDL_AudioDeviceID devid)
+{
+    SDL_PropertiesID result = 0;
+    SDL_AudioDevice *device = ObtainPhysicalAudioDeviceDefaultAllowed(devid);
+    if (device) {
+        if (device->props == 0) {
+            device->props = SDL_CreateProperties();
+        }
+        result = device->props;
+    }
+    ReleaseAudioDevice(device);
+
+    return result;
+}
+
+
 
 // this is awkward, but this makes sure we can release the device lock
 //  so the device thread can terminate but also not have two things
@@ -1637,6 +1877,8 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
         device->hidden = NULL;  // just in case.
     }
 
+    StopAudioMixWorkers(device);
+
     SDL_LockMutex(device->lock);
     SDL_SetAtomicInt(&device->shutdown, 0);  // ready to go again.
     SDL_BroadcastCondition(device->close_cond);  // release anyone waiting in SerializePhysicalDeviceClose; they'll still block until we release device->lock, though.
@@ -1800,6 +2042,10 @@ static bool OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
         }
     }
 
+    device->max_iteration_ns = 0;
+    device->num_overruns = 0;
+    StartAudioMixWorkers(device);
+
     // Start the audio thread if necessary
     if (!current_audio.impl.ProvidesOwnCallbackThread) {
         char threadname[64];
@@ -2020,6 +2266,8 @@ bool SDL_BindAudioStreams(SDL_AudioDeviceID devid, SDL_AudioStream * const *stre
                     result = SDL_SetError("Stream #%d is already bound to a device", i);
                 } else if (stream->simplified) {  // You can get here if you closed the device instead of destroying the stream.
                     result = SDL_SetError("Cannot change binding on a stream created with SDL_OpenAudioDeviceStream");
+                } else if (stream->input_ring && device->recording) {  // the device would need to change the stream's input format.
+                    result = SDL_SetError("Cannot bind a stream with an input ring to a recording device");
                 }
             }
 
@@ -399,9 +399,14 @@ static int CalculateMaxFrameSize(SDL_AudioFormat src_format, int src_channels, S
     return max_format_size * max_channels;
 }
 
+static int GetAudioStreamResampleSrcFreq(SDL_AudioStream *stream, int src_freq)
+{
+    return (int)((float)src_freq * stream->freq_ratio);
+}
+
 static Sint64 GetAudioStreamResampleRate(SDL_AudioStream* stream, int src_freq, Sint64 resample_offset)
 {
-    src_freq = (int)((float)src_freq * stream->freq_ratio);
+    src_freq = GetAudioStreamResampleSrcFreq(stream, src_freq);
 
     Sint64 resample_rate = SDL_GetResampleRate(src_freq, stream->dst_spec.freq);
 
@@ -436,8 +441,37 @@ static bool UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioS
     return true;
 }
 
+// Decide if SDL_PutAudioStreamData may use the input ring without the lock: only once the stream has
+//  both formats, and never while it has a put callback (which has to run with the lock held).
+// You MUST hold `stream->lock` when calling this.
+void UpdateAudioStreamInputRing(SDL_AudioStream *stream)
+{
+    const bool enabled = stream->input_ring && !stream->put_callback &&
+                         (stream->src_spec.format != SDL_AUDIO_UNKNOWN) && (stream->dst_spec.format != SDL_AUDIO_UNKNOWN);
+    SDL_SetAtomicInt(&stream->input_ring_enabled, enabled ? 1 : 0);
+}
+
+// The largest input ring we'll allocate, so the free-running 32-bit ring positions can't get confused.
+#define MAX_INPUT_RING_SIZE (1 << 30)
+
 SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec)
 {
+    return SDL_CreateAudioStreamWithProperties(src_spec, dst_spec, 0);
+}
+
+SDL_AudioStream *SDL_CreateAudioStreamWithProperties(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec, SDL_PropertiesID props)
+{
+    const Sint64 input_ring_size = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_INPUT_RING_SIZE_NUMBER, 0);
+    if (input_ring_size > 0) {
+        if (!src_spec) {
+            SDL_SetError("An input ring requires a source format");
+            return NULL;
+        } else if (input_ring_size > MAX_INPUT_RING_SIZE) {
+            SDL_InvalidParamError("SDL_PROP_AUDIOSTREAM_CREATE_INPUT_RING_SIZE_NUMBER");
+            return NULL;
+        }
+    }
+
     SDL_ChooseAudioConverters();
     SDL_SetupAudioResampler();
 
@@ -447,6 +481,7 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
     }
 
     result->freq_ratio = 1.0f;
+    result->resample_quality = SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM;
     result->gain = 1.0f;
     result->queue = SDL_CreateAudioQueue(8192);
 
@@ -469,9 +504,74 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
         return NULL;
     }
 
+    if (input_ring_size > 0) {
+        result->input_ring_size = (Uint32) SDL_powerof2((int) input_ring_size);
+        result->input_ring_frame_size = SDL_AUDIO_FRAMESIZE(result->src_spec);
+        result->input_ring = (Uint8 *) SDL_malloc(result->input_ring_size);
+        if (!result->input_ring) {
+            SDL_DestroyAudioStream(result);
+            return NULL;
+        }
+        SDL_LockMutex(result->lock);
+        UpdateAudioStreamInputRing(result);
+        SDL_UnlockMutex(result->lock);
+    }
+
     return result;
 }
 
+// Producer side of the input ring: never blocks. Returns false if there isn't room for all of `buf`.
+static bool PutAudioStreamInputRing(SDL_AudioStream *stream, const Uint8 *buf, int len)
+{
+    const Uint32 mask = stream->input_ring_size - 1;
+    const Uint32 head = SDL_GetAtomicU32(&stream->input_ring_head);
+    const Uint32 tail = SDL_GetAtomicU32(&stream->input_ring_tail);
+    const Uint32 ulen = (Uint32) len;
+
+    if ((stream->input_ring_size - (head - tail)) < ulen) {
+        return false;
+    }
+
+    const Uint32 offset = head & mask;
+    const Uint32 first = SDL_min(ulen, stream->input_ring_size - offset);
+    SDL_memcpy(stream->input_ring + offset, buf, first);
+    SDL_memcpy(stream->input_ring, buf + first, ulen - first);
+
+    // make sure the data is visible before the consumer can see the new head.
+    SDL_MemoryBarrierRelease();
+    SDL_SetAtomicU32(&stream->input_ring_head, head + ulen);
+    return true;
+}
+
+// Consumer side of the input ring: moves everything the producer has finished writing into the queue.
+// You MUST hold `stream->lock` when calling this.
+static bool DrainAudioStreamInputRing(SDL_AudioStream *stream)
+{
+    if (!stream->input_ring) {
+        return true;
+    }
+
+    const Uint32 mask = stream->input_ring_size - 1;
+    const Uint32 tail = SDL_GetAtomicU32(&stream->input_ring_tail);
+    const Uint32 head = SDL_GetAtomicU32(&stream->input_ring_head);
+    SDL_MemoryBarrierAcquire();
+
+    const Uint32 available = head - tail;
+    if (available == 0) {
+        return true;
+    }
+
+    const Uint32 offset = tail & mask;
+    const Uint32 first = SDL_min(available, stream->input_ring_size - offset);
+    if (!SDL_WriteToAudioQueue(stream->queue, &stream->src_spec, stream->src_chmap, stream->input_ring + offset, first) ||
+        !SDL_WriteToAudioQueue(stream->queue, &stream->src_spec, stream->src_chmap, stream->input_ring, available - first)) {
+        return false;
+    }
+
+    SDL_SetAtomicU32(&stream->input_ring_tail, head);
+    return true;
+}
+
 SDL_PropertiesID SDL_GetAudioStreamProperties(SDL_AudioStream *stream)
 {
     if (!stream) {
@@ -506,6 +606,7 @@ bool SDL_SetAudioStreamPutCallback(SDL_AudioStream *stream, SDL_AudioStreamCallb
     SDL_LockMutex(stream->lock);
     stream->put_callback = callback;
     stream->put_callback_userdata = userdata;
+    UpdateAudioStreamInputRing(stream);
     SDL_UnlockMutex(stream->lock);
     return true;
 }
@@ -593,6 +694,11 @@ bool SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_
         }
     }
 
+    if (src_spec && stream->input_ring && !SDL_AudioSpecsEqual(src_spec, &stream->src_spec, NULL, NULL)) {
+        SDL_UnlockMutex(stream->lock);
+        return SDL_SetError("Can't change the input format of a stream with an input ring");
+    }
+
     if (src_spec) {
         if (src_spec->channels != stream->src_spec.channels) {
             SDL_free(stream->src_chmap);
@@ -609,6 +715,9 @@ bool SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_
         SDL_copyp(&stream->dst_spec, dst_spec);
     }
 
+    UpdateAudioStreamInputRing(stream);
+    UpdateAudioStreamResamplePlans(stream);
+
     SDL_UnlockMutex(stream->lock);
 
     return true;
@@ -626,6 +735,8 @@ bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec
 
     if (channels != spec->channels) {
         result = SDL_SetError("Wrong number of channels");
+    } else if ((isinput == 1) && stream->input_ring) {
+        result = SDL_SetError("Can't change the input channel map of a stream with an input ring");
     } else if (!*stream_chmap && !chmap) {
         // already at default, we're good.
     } else if (*stream_chmap && chmap && (SDL_memcmp(*stream_chmap, chmap, sizeof (*chmap) * channels) == 0)) {
@@ -732,6 +843,7 @@ bool SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float freq_ratio)
 
     SDL_LockMutex(stream->lock);
     stream->freq_ratio = freq_ratio;
+    UpdateAudioStreamResamplePlans(stream);
     SDL_UnlockMutex(stream->lock);
 
     return true;
@@ -782,6 +894,11 @@ static bool PutAudioStreamBufferInternal(SDL_AudioStream *stream, const SDL_Audi
 {
     SDL_AudioTrack* track = NULL;
 
+    // anything still sitting in the input ring was put before this, so it has to go first.
+    if (!DrainAudioStreamInputRing(stream)) {
+        return false;
+    }
+
     if (callback) {
         track = SDL_CreateAudioTrack(stream->queue, spec, chmap, (Uint8 *)buf, len, len, callback, userdata);
         if (!track) {
@@ -851,6 +968,16 @@ bool SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
         return true; // nothing to do.
     }
 
+    // Lock-free fast path: copy into the input ring if there's room. This is only enabled once the
+    //  stream is fully set up and has no put callback, otherwise the locked path reports the problem.
+    if (SDL_GetAtomicInt(&stream->input_ring_enabled)) {
+        if ((len % stream->input_ring_frame_size) != 0) {
+            return SDL_SetError("Can't add partial sample frames");
+        } else if (PutAudioStreamInputRing(stream, (const Uint8 *) buf, len)) {
+            return true;
+        }
+    }
+
     // When copying in large amounts of data, try and do as much work as possible
     // outside of the stream lock, otherwise the output device is likely to be starved.
     const int large_input_thresh = 64 * 1024;
@@ -1056,10 +1183,11 @@ bool SDL_FlushAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
+    const bool result = DrainAudioStreamInputRing(stream);
     SDL_FlushAudioQueue(stream->queue);
     SDL_UnlockMutex(stream->lock);
 
-    return true;
+    return result;
 }
 
 /* this does not save the previous contents of stream->work_buffer. It's a work buffer!!
@@ -1081,6 +1209,48 @@ static Uint8 *EnsureAudioStreamWorkBufferSize(SDL_AudioStream *stream, size_t ne
     return ptr;
 }
 
+// This runs when the sample rates or frequency ratio change, never while getting data, because building a plan allocates.
+// The resample quality can change whenever the app likes, so get the plans for every quality that uses them.
+// You must hold stream->lock when calling this.
+void UpdateAudioStreamResamplePlans(SDL_AudioStream *stream)
+{
+    const int src_freq = GetAudioStreamResampleSrcFreq(stream, stream->src_spec.freq);
+    const int dst_freq = stream->dst_spec.freq;
+
+    if ((src_freq <= 0) || (dst_freq <= 0)) {
+        return;  // not set up yet.
+    } else if ((stream->resample_plan_src_freq == src_freq) && (stream->resample_plan_dst_freq == dst_freq)) {
+        return;  // still good (even if that means there's no plan for these rates).
+    }
+
+    for (int i = 0; i < SDL_arraysize(stream->resample_plans); i++) {
+        SDL_ReleaseResamplePlan(stream->resample_plans[i]);
+        stream->resample_plans[i] = SDL_AcquireResamplePlan(src_freq, dst_freq, (SDL_AudioResampleQuality) (SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM + i));
+    }
+    stream->resample_plan_src_freq = src_freq;
+    stream->resample_plan_dst_freq = dst_freq;
+}
+
+// SDL_ResampleAudio ignores a plan for other rates, like for data that was queued before the format changed.
+static const SDL_ResamplePlan *GetAudioStreamResamplePlan(const SDL_AudioStream *stream)
+{
+    if (stream->resample_quality < SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM) {
+        return NULL;
+    }
+    return stream->resample_plans[stream->resample_quality - SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM];
+}
+
+// You must hold stream->lock when calling this.
+static void UpdateAudioStreamResampleQuality(SDL_AudioStream *stream)
+{
+    if (stream->props) {
+        const Sint64 quality = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM);
+        if ((quality >= SDL_AUDIO_RESAMPLE_QUALITY_FAST) && (quality <= SDL_AUDIO_RESAMPLE_QUALITY_HIGH)) {
+            stream->resample_quality = (SDL_AudioResampleQuality) quality;
+        }
+    }
+}
+
 static Sint64 NextAudioStreamIter(SDL_AudioStream* stream, void** inout_iter,
     Sint64* inout_resample_offset, SDL_AudioSpec* out_spec, int **out_chmap, bool* out_flushed)
 {
@@ -1117,7 +1287,7 @@ static Sint64 NextAudioStreamIter(SDL_AudioStream* stream, void** inout_iter,
         // Past the end of the track, the right padding is filled with silence.
         // But we only want to do that if the track is actually finished (flushed).
         if (!flushed) {
-            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate);
+            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate, stream->resample_quality);
         }
 
         output_frames = SDL_GetResamplerOutputFrames(output_frames, resample_rate, &resample_offset);
@@ -1224,7 +1394,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // In fact, input_frames can sometimes even be zero when upsampling.
     const int input_frames = (int) SDL_GetResamplerInputFrames(output_frames, resample_rate, stream->resample_offset);
 
-    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate);
+    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate, stream->resample_quality);
 
     const SDL_AudioFormat resample_format = SDL_AUDIO_F32;
 
@@ -1297,7 +1467,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     SDL_ResampleAudio(resample_channels,
                   (const float *) input_buffer, input_frames,
                   (float*) resample_buffer, output_frames,
-                  resample_rate, &stream->resample_offset);
+                  resample_rate, &stream->resample_offset, stream->resample_quality, GetAudioStreamResamplePlan(stream));
 
     // Convert to the final format, if necessary (src channel map is NULL because SDL_ReadFromAudioQueue already handled this).
     ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, NULL, buf, dst_format, dst_channels, dst_map, work_buffer, postresample_gain);
@@ -1334,6 +1504,13 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         return -1;
     }
 
+    if (!DrainAudioStreamInputRing(stream)) {
+        SDL_UnlockMutex(stream->lock);
+        return -1;
+    }
+
+    UpdateAudioStreamResampleQuality(stream);
+
     const float gain = stream->gain * extra_gain;
     const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
 
@@ -1433,6 +1610,9 @@ int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
         return 0;
     }
 
+    DrainAudioStreamInputRing(stream);  // if this fails, we just report what made it into the queue.
+    UpdateAudioStreamResampleQuality(stream);
+
     Sint64 count = GetAudioStreamAvailableFrames(stream, NULL);
 
     // convert from sample frames to bytes in destination format.
@@ -1454,6 +1634,8 @@ int SDL_GetAudioStreamQueued(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    DrainAudioStreamInputRing(stream);  // if this fails, we just report what made it into the queue.
+
     size_t total = SDL_GetAudioQueueQueued(stream->queue);
 
     SDL_UnlockMutex(stream->lock);
@@ -1470,6 +1652,7 @@ bool SDL_ClearAudioStream(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    SDL_SetAtomicU32(&stream->input_ring_tail, SDL_GetAtomicU32(&stream->input_ring_head));  // throw away anything in the input ring, too.
     SDL_ClearAudioQueue(stream->queue);
     SDL_zero(stream->input_spec);
     stream->input_chmap = NULL;
@@ -1500,6 +1683,10 @@ void SDL_DestroyAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_aligned_free(stream->work_buffer);
+    SDL_free(stream->input_ring);
+    for (int i = 0; i < SDL_arraysize(stream->resample_plans); i++) {
+        SDL_ReleaseResamplePlan(stream->resample_plans[i]);
+    }
     SDL_DestroyAudioQueue(stream->queue);
     SDL_DestroyMutex(stream->lock);
 
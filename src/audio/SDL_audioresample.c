@@ -42,6 +42,18 @@
 // Note, when upsampling, it is also possible to start sampling from `srcpos = -1`.
 #define RESAMPLER_MAX_PADDING_FRAMES (RESAMPLER_ZERO_CROSSINGS + 1)
 
+// The high quality tier uses a longer polyphase filter, linearly interpolated between neighbouring phases.
+#define RESAMPLER_HQ_ZERO_CROSSINGS        16
+#define RESAMPLER_HQ_SAMPLES_PER_FRAME     (RESAMPLER_HQ_ZERO_CROSSINGS * 2)
+#define RESAMPLER_HQ_MAX_PADDING_FRAMES    (RESAMPLER_HQ_ZERO_CROSSINGS + 1)
+#define RESAMPLER_HQ_PHASE_BITS            7
+#define RESAMPLER_HQ_PHASES                (1 << RESAMPLER_HQ_PHASE_BITS)
+#define RESAMPLER_HQ_PHASE_INTERP_BITS     (32 - RESAMPLER_HQ_PHASE_BITS)
+#define RESAMPLER_HQ_PHASE_INTERP_RANGE    (1 << RESAMPLER_HQ_PHASE_INTERP_BITS)
+
+// The fast tier just interpolates linearly between two input frames.
+#define RESAMPLER_LINEAR_MAX_PADDING_FRAMES 2
+
 // More bits gives more precision, at the cost of a larger table.
 #define RESAMPLER_BITS_PER_ZERO_CROSSING    3
 #define RESAMPLER_SAMPLES_PER_ZERO_CROSSING (1 << RESAMPLER_BITS_PER_ZERO_CROSSING)
@@ -452,6 +464,7 @@ static float Sinc(const float *table, int x, int y)
 }
 
 static Cubic ResamplerFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING][RESAMPLER_SAMPLES_PER_FRAME];
+static bool ResamplerFilterTransposed = false;
 
 static void GenerateResamplerFilter(void)
 {
@@ -513,9 +526,282 @@ static void GenerateResamplerFilter(void)
     }
 }
 
+// Each phase stores the filter taps, and the difference to the next phase's taps, so the
+// coefficients for any position are just `coeffs + (deltas * t)`.
+typedef struct PolyphaseFilter
+{
+    float coeffs[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+    float deltas[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+} PolyphaseFilter;
+
+static PolyphaseFilter ResamplerPolyphaseFilter[RESAMPLER_HQ_PHASES];
+
+static void GeneratePolyphaseFilter(void)
+{
+    const float dB = 100.0f;
+    const float beta = 0.1102f * (dB - 8.7f);
+    const float bessel_beta = BesselI0(beta);
+
+    float taps[RESAMPLER_HQ_PHASES + 1][RESAMPLER_HQ_SAMPLES_PER_FRAME];
+    int i, j;
+
+    for (i = 0; i <= RESAMPLER_HQ_PHASES; ++i) {
+        const float frac = (float)i / RESAMPLER_HQ_PHASES;
+        float sum = 0.0f;
+
+        for (j = 0; j < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++j) {
+            // Distance from the output position to the input frame this tap applies to.
+            const float x = (float)(j - (RESAMPLER_HQ_ZERO_CROSSINGS - 1)) - frac;
+            const float w = x / RESAMPLER_HQ_ZERO_CROSSINGS;
+            float tap = 0.0f;
+
+            if (w > -1.0f && w < 1.0f) {
+                const float window = BesselI0(beta * SDL_sqrtf(1.0f - (w * w))) / bessel_beta;
+                const float sinc = (x == 0.0f) ? 1.0f : (float)(SDL_sin(SDL_PI_D * x) / (SDL_PI_D * x));
+                tap = window * sinc;
+            }
+
+            taps[i][j] = tap;
+            sum += tap;
+        }
+
+        // Normalize each phase, so a constant signal comes out unchanged.
+        for (j = 0; j < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++j) {
+            taps[i][j] /= sum;
+        }
+    }
+
+    for (i = 0; i < RESAMPLER_HQ_PHASES; ++i) {
+        for (j = 0; j < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++j) {
+            ResamplerPolyphaseFilter[i].coeffs[j] = taps[i][j];
+            ResamplerPolyphaseFilter[i].deltas[j] = taps[i + 1][j] - taps[i][j];
+        }
+    }
+}
+
 typedef void (*ResampleFrameFunc)(const float *src, float *dst, const Cubic *filter, float frac, int chans);
 static ResampleFrameFunc ResampleFrame[8];
 
+// Block kernels produce `outframes` frames, starting at `srcpos` and stepping by `resample_rate`.
+typedef void (*ResampleBlockFunc)(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans);
+static ResampleBlockFunc ResampleBlock[SDL_AUDIO_RESAMPLE_QUALITY_HIGH + 1];
+
+static void ResampleBlock_Linear(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *frame = &src[(int)(Sint32)(srcpos >> 32) * chans];
+        const float frac = (float)(Uint32)(srcpos & 0xFFFFFFFF) * (1.0f / 4294967296.0f);
+
+        for (chan = 0; chan < chans; ++chan) {
+            dst[chan] = frame[chan] + ((frame[chan + chans] - frame[chan]) * frac);
+        }
+    }
+}
+
+static void ResampleBlock_Cubic(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    const ResampleFrameFunc resample_frame = ResampleFrame[chans - 1];
+    int i;
+
+    src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const int srcindex = (int)(Sint32)(srcpos >> 32);
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+
+        const Cubic *filter = ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
+        const float frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+
+        resample_frame(&src[srcindex * chans], dst, filter, frac, chans);
+    }
+}
+
+static void ResampleBlock_Polyphase(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    float coeffs[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+    int i, j, chan;
+
+    src -= (RESAMPLER_HQ_ZERO_CROSSINGS - 1) * chans;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *frame = &src[(int)(Sint32)(srcpos >> 32) * chans];
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const PolyphaseFilter *filter = &ResamplerPolyphaseFilter[srcfraction >> RESAMPLER_HQ_PHASE_INTERP_BITS];
+        const float t = (float)(srcfraction & (RESAMPLER_HQ_PHASE_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_HQ_PHASE_INTERP_RANGE);
+
+        for (j = 0; j < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++j) {
+            coeffs[j] = filter->coeffs[j] + (filter->deltas[j] * t);
+        }
+
+        for (chan = 0; chan < chans; ++chan) {
+            float out = 0.0f;
+
+            for (j = 0; j < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++j) {
+                out += frame[j * chans + chan] * coeffs[j];
+            }
+
+            dst[chan] = out;
+        }
+    }
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2") ResampleBlock_Polyphase_AVX2(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+#if RESAMPLER_HQ_SAMPLES_PER_FRAME != 32
+#error Invalid samples per frame
+#endif
+
+    float coeffs[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+    int i, j, chan;
+
+    src -= (RESAMPLER_HQ_ZERO_CROSSINGS - 1) * chans;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *frame = &src[(int)(Sint32)(srcpos >> 32) * chans];
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const PolyphaseFilter *filter = &ResamplerPolyphaseFilter[srcfraction >> RESAMPLER_HQ_PHASE_INTERP_BITS];
+        const __m256 t = _mm256_set1_ps((float)(srcfraction & (RESAMPLER_HQ_PHASE_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_HQ_PHASE_INTERP_RANGE));
+
+#define X(n) _mm256_add_ps(_mm256_loadu_ps(&filter->coeffs[(n) * 8]), _mm256_mul_ps(_mm256_loadu_ps(&filter->deltas[(n) * 8]), t))
+        const __m256 f0 = X(0);
+        const __m256 f1 = X(1);
+        const __m256 f2 = X(2);
+        const __m256 f3 = X(3);
+#undef X
+
+        if (chans == 1) {
+            // Use two accumulators to improve throughput
+            __m256 out0 = _mm256_mul_ps(f0, _mm256_loadu_ps(frame + 0));
+            __m256 out1 = _mm256_mul_ps(f1, _mm256_loadu_ps(frame + 8));
+            out0 = _mm256_add_ps(out0, _mm256_mul_ps(f2, _mm256_loadu_ps(frame + 16)));
+            out1 = _mm256_add_ps(out1, _mm256_mul_ps(f3, _mm256_loadu_ps(frame + 24)));
+            const __m256 out = _mm256_add_ps(out0, out1);
+
+            // Horizontal sum
+            __m128 sum = _mm_add_ps(_mm256_castps256_ps128(out), _mm256_extractf128_ps(out, 1));
+            sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+            sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+            _mm_store_ss(dst, sum);
+            continue;
+        }
+
+        if (chans == 2) {
+            __m256 out0 = _mm256_setzero_ps();
+            __m256 out1 = _mm256_setzero_ps();
+
+            const __m256 f[4] = { f0, f1, f2, f3 };
+
+            // Duplicate each of the filter elements, in order, and multiply by the input
+            for (j = 0; j < 4; ++j) {
+                const __m256 lo = _mm256_unpacklo_ps(f[j], f[j]);
+                const __m256 hi = _mm256_unpackhi_ps(f[j], f[j]);
+                out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permute2f128_ps(lo, hi, 0x20), _mm256_loadu_ps(frame + j * 16)));
+                out1 = _mm256_add_ps(out1, _mm256_mul_ps(_mm256_permute2f128_ps(lo, hi, 0x31), _mm256_loadu_ps(frame + j * 16 + 8)));
+            }
+
+            // Add the accumulators and the lanes together, then the lower and upper pairs
+            const __m256 out = _mm256_add_ps(out0, out1);
+            __m128 sum = _mm_add_ps(_mm256_castps256_ps128(out), _mm256_extractf128_ps(out, 1));
+            sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+            _mm_storel_pi((__m64 *)dst, sum);
+            continue;
+        }
+
+        _mm256_storeu_ps(&coeffs[0], f0);
+        _mm256_storeu_ps(&coeffs[8], f1);
+        _mm256_storeu_ps(&coeffs[16], f2);
+        _mm256_storeu_ps(&coeffs[24], f3);
+
+        for (chan = 0; chan < chans; ++chan) {
+            float out = 0.0f;
+
+            for (j = 0; j < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++j) {
+                out += frame[j * chans + chan] * coeffs[j];
+            }
+
+            dst[chan] = out;
+        }
+    }
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void ResampleBlock_Polyphase_NEON(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+#if RESAMPLER_HQ_SAMPLES_PER_FRAME != 32
+#error Invalid samples per frame
+#endif
+
+    float coeffs[RESAMPLER_HQ_SAMPLES_PER_FRAME];
+    int i, j, chan;
+
+    src -= (RESAMPLER_HQ_ZERO_CROSSINGS - 1) * chans;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *frame = &src[(int)(Sint32)(srcpos >> 32) * chans];
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const PolyphaseFilter *filter = &ResamplerPolyphaseFilter[srcfraction >> RESAMPLER_HQ_PHASE_INTERP_BITS];
+        const float32x4_t t = vdupq_n_f32((float)(srcfraction & (RESAMPLER_HQ_PHASE_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_HQ_PHASE_INTERP_RANGE));
+        float32x4_t f[8];
+
+        for (j = 0; j < 8; ++j) {
+            f[j] = vmlaq_f32(vld1q_f32(&filter->coeffs[j * 4]), vld1q_f32(&filter->deltas[j * 4]), t);
+        }
+
+        if (chans == 1) {
+            // Use two accumulators to improve throughput
+            float32x4_t out0 = vmulq_f32(f[0], vld1q_f32(frame + 0));
+            float32x4_t out1 = vmulq_f32(f[1], vld1q_f32(frame + 4));
+            for (j = 2; j < 8; j += 2) {
+                out0 = vmlaq_f32(out0, f[j], vld1q_f32(frame + j * 4));
+                out1 = vmlaq_f32(out1, f[j + 1], vld1q_f32(frame + j * 4 + 4));
+            }
+            out0 = vaddq_f32(out0, out1);
+
+            // Horizontal sum
+            float32x2_t sum = vadd_f32(vget_low_f32(out0), vget_high_f32(out0));
+            sum = vpadd_f32(sum, sum);
+            vst1_lane_f32(dst, sum, 0);
+            continue;
+        }
+
+        if (chans == 2) {
+            float32x4_t out0 = vdupq_n_f32(0);
+            float32x4_t out1 = vdupq_n_f32(0);
+
+            // Duplicate each of the filter elements and multiply by the input
+            for (j = 0; j < 8; ++j) {
+                const float32x4x2_t g = vzipq_f32(f[j], f[j]);
+                out0 = vmlaq_f32(out0, vld1q_f32(frame + j * 8), g.val[0]);
+                out1 = vmlaq_f32(out1, vld1q_f32(frame + j * 8 + 4), g.val[1]);
+            }
+            out0 = vaddq_f32(out0, out1);
+
+            // Add the lower and upper pairs together
+            vst1_f32(dst, vadd_f32(vget_low_f32(out0), vget_high_f32(out0)));
+            continue;
+        }
+
+        for (j = 0; j < 8; ++j) {
+            vst1q_f32(&coeffs[j * 4], f[j]);
+        }
+
+        for (chan = 0; chan < chans; ++chan) {
+            float out = 0.0f;
+
+            for (j = 0; j < RESAMPLER_HQ_SAMPLES_PER_FRAME; ++j) {
+                out += frame[j * chans + chan] * coeffs[j];
+            }
+
+            dst[chan] = out;
+        }
+    }
+}
+#endif
+
 // Transpose 4x4 floats
 static void Transpose4x4(Cubic *data)
 {
@@ -536,6 +822,25 @@ static void SetupAudioResampler(void)
     bool transpose = false;
 
     GenerateResamplerFilter();
+    GeneratePolyphaseFilter();
+
+    ResampleBlock[SDL_AUDIO_RESAMPLE_QUALITY_FAST] = ResampleBlock_Linear;
+    ResampleBlock[SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM] = ResampleBlock_Cubic;
+    ResampleBlock[SDL_AUDIO_RESAMPLE_QUALITY_HIGH] = ResampleBlock_Polyphase;
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        ResampleBlock[SDL_AUDIO_RESAMPLE_QUALITY_HIGH] = ResampleBlock_Polyphase_AVX2;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        ResampleBlock[SDL_AUDIO_RESAMPLE_QUALITY_HIGH] = ResampleBlock_Polyphase_NEON;
+    } else
+#endif
+    {
+        // just use the generic polyphase kernel.
+    }
 
 #ifdef SDL_SSE_INTRINSICS
     if (SDL_HasSSE()) {
@@ -562,6 +867,8 @@ static void SetupAudioResampler(void)
         ResampleFrame[1] = ResampleFrame_Stereo;
     }
 
+    ResamplerFilterTransposed = transpose;
+
     if (transpose) {
         // Transpose each set of 4 coefficients, to reduce work when resampling
         for (i = 0; i < RESAMPLER_SAMPLES_PER_ZERO_CROSSING; ++i) {
@@ -608,14 +915,25 @@ int SDL_GetResamplerHistoryFrames(void)
 {
     // Even if we aren't currently resampling, make sure to keep enough history in case we need to later.
 
-    return RESAMPLER_MAX_PADDING_FRAMES;
+    return RESAMPLER_HQ_MAX_PADDING_FRAMES;
 }
 
-int SDL_GetResamplerPaddingFrames(Sint64 resample_rate)
+int SDL_GetResamplerPaddingFrames(Sint64 resample_rate, SDL_AudioResampleQuality quality)
 {
     // This must always be <= SDL_GetResamplerHistoryFrames()
 
-    return resample_rate ? RESAMPLER_MAX_PADDING_FRAMES : 0;
+    if (!resample_rate) {
+        return 0;
+    }
+
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLE_QUALITY_FAST:
+        return RESAMPLER_LINEAR_MAX_PADDING_FRAMES;
+    case SDL_AUDIO_RESAMPLE_QUALITY_HIGH:
+        return RESAMPLER_HQ_MAX_PADDING_FRAMES;
+    default:
+        return RESAMPLER_MAX_PADDING_FRAMES;
+    }
 }
 
 // These are not general purpose. They do not check for all possible underflow/overflow
@@ -675,32 +993,450 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
     return output_frames;
 }
 
-void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+// When the rate ratio reduces to M:L with a small L, output frame n always lands `n * M / L` frames
+// into the input, so there are only L distinct filter positions. A plan holds the filter for each of
+// those positions, and is shared by every stream resampling with that ratio and quality.
+#define RESAMPLER_MAX_PLAN_PHASES 512
+
+// Dot products of one frame of mono or stereo input with a phase's coefficients. `taps` is always even;
+// the SIMD versions are only used when it's also a multiple of their vector width.
+typedef void (*ResamplePlannedFrameFunc)(const float *frame, const float *coeffs, int taps, float *dst);
+
+static void ResamplePlannedFrame_Mono(const float *frame, const float *coeffs, int taps, float *dst)
 {
+    float out0 = 0.0f;
+    float out1 = 0.0f;
     int i;
-    Sint64 srcpos = *inout_resample_offset;
-    ResampleFrameFunc resample_frame = ResampleFrame[chans - 1];
 
-    SDL_assert(resample_rate > 0);
+    // Use two accumulators to improve throughput
+    for (i = 0; i < taps; i += 2) {
+        out0 += frame[i] * coeffs[i];
+        out1 += frame[i + 1] * coeffs[i + 1];
+    }
 
-    src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
+    dst[0] = out0 + out1;
+}
 
-    for (i = 0; i < outframes; ++i) {
-        int srcindex = (int)(Sint32)(srcpos >> 32);
-        Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
-        srcpos += resample_rate;
+static void ResamplePlannedFrame_Stereo(const float *frame, const float *coeffs, int taps, float *dst)
+{
+    float out0 = 0.0f;
+    float out1 = 0.0f;
+    int i;
 
-        SDL_assert(srcindex >= -1 && srcindex < inframes);
+    for (i = 0; i < taps; ++i) {
+        out0 += frame[i * 2 + 0] * coeffs[i];
+        out1 += frame[i * 2 + 1] * coeffs[i];
+    }
 
-        const Cubic *filter = ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
-        const float frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+    dst[0] = out0;
+    dst[1] = out1;
+}
 
-        const float *frame = &src[srcindex * chans];
-        resample_frame(frame, dst, filter, frac, chans);
+#ifdef SDL_SSE_INTRINSICS
+static void SDL_TARGETING("sse") ResamplePlannedFrame_Mono_SSE(const float *frame, const float *coeffs, int taps, float *dst)
+{
+    __m128 out = _mm_setzero_ps();
+    int i;
+
+    for (i = 0; i < taps; i += 4) {
+        out = _mm_add_ps(out, _mm_mul_ps(_mm_loadu_ps(frame + i), _mm_loadu_ps(coeffs + i)));
+    }
+
+    // Horizontal sum
+    __m128 shuf = _mm_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1));
+    out = _mm_add_ps(out, shuf);
+    out = _mm_add_ss(out, _mm_movehl_ps(shuf, out));
+    _mm_store_ss(dst, out);
+}
+
+static void SDL_TARGETING("sse") ResamplePlannedFrame_Stereo_SSE(const float *frame, const float *coeffs, int taps, float *dst)
+{
+    __m128 out0 = _mm_setzero_ps();
+    __m128 out1 = _mm_setzero_ps();
+    int i;
+
+    // Duplicate each of the coefficients and multiply by the input
+    for (i = 0; i < taps; i += 4) {
+        const __m128 c = _mm_loadu_ps(coeffs + i);
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_loadu_ps(frame + i * 2), _mm_unpacklo_ps(c, c)));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_loadu_ps(frame + i * 2 + 4), _mm_unpackhi_ps(c, c)));
+    }
+
+    // Add the accumulators together, then the lower and upper pairs
+    __m128 out = _mm_add_ps(out0, out1);
+    out = _mm_add_ps(out, _mm_movehl_ps(out, out));
+    _mm_storel_pi((__m64 *)dst, out);
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+// These need `taps` to be a multiple of 8.
+static void SDL_TARGETING("avx2") ResamplePlannedFrame_Mono_AVX2(const float *frame, const float *coeffs, int taps, float *dst)
+{
+    __m256 out = _mm256_setzero_ps();
+    int i;
+
+    for (i = 0; i < taps; i += 8) {
+        out = _mm256_add_ps(out, _mm256_mul_ps(_mm256_loadu_ps(frame + i), _mm256_loadu_ps(coeffs + i)));
+    }
+
+    // Horizontal sum
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(out), _mm256_extractf128_ps(out, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+    _mm_store_ss(dst, sum);
+}
+
+static void SDL_TARGETING("avx2") ResamplePlannedFrame_Stereo_AVX2(const float *frame, const float *coeffs, int taps, float *dst)
+{
+    __m256 out0 = _mm256_setzero_ps();
+    __m256 out1 = _mm256_setzero_ps();
+    int i;
+
+    // Duplicate each of the coefficients, in order, and multiply by the input
+    for (i = 0; i < taps; i += 8) {
+        const __m256 c = _mm256_loadu_ps(coeffs + i);
+        const __m256 lo = _mm256_unpacklo_ps(c, c);
+        const __m256 hi = _mm256_unpackhi_ps(c, c);
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permute2f128_ps(lo, hi, 0x20), _mm256_loadu_ps(frame + i * 2)));
+        out1 = _mm256_add_ps(out1, _mm256_mul_ps(_mm256_permute2f128_ps(lo, hi, 0x31), _mm256_loadu_ps(frame + i * 2 + 8)));
+    }
+
+    // Add the accumulators and the lanes together, then the lower and upper pairs
+    const __m256 out = _mm256_add_ps(out0, out1);
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(out), _mm256_extractf128_ps(out, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    _mm_storel_pi((__m64 *)dst, sum);
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void ResamplePlannedFrame_Mono_NEON(const float *frame, const float *coeffs, int taps, float *dst)
+{
+    float32x4_t out = vdupq_n_f32(0);
+    int i;
+
+    for (i = 0; i < taps; i += 4) {
+        out = vmlaq_f32(out, vld1q_f32(frame + i), vld1q_f32(coeffs + i));
+    }
+
+    // Horizontal sum
+    float32x2_t sum = vadd_f32(vget_low_f32(out), vget_high_f32(out));
+    sum = vpadd_f32(sum, sum);
+    vst1_lane_f32(dst, sum, 0);
+}
+
+static void ResamplePlannedFrame_Stereo_NEON(const float *frame, const float *coeffs, int taps, float *dst)
+{
+    float32x4_t out0 = vdupq_n_f32(0);
+    float32x4_t out1 = vdupq_n_f32(0);
+    int i;
+
+    // Duplicate each of the coefficients and multiply by the input
+    for (i = 0; i < taps; i += 4) {
+        const float32x4_t c = vld1q_f32(coeffs + i);
+        const float32x4x2_t g = vzipq_f32(c, c);
+        out0 = vmlaq_f32(out0, vld1q_f32(frame + i * 2), g.val[0]);
+        out1 = vmlaq_f32(out1, vld1q_f32(frame + i * 2 + 4), g.val[1]);
+    }
+
+    // Add the accumulators together, then the lower and upper pairs
+    out0 = vaddq_f32(out0, out1);
+    vst1_f32(dst, vadd_f32(vget_low_f32(out0), vget_high_f32(out0)));
+}
+#endif
+
+struct SDL_ResamplePlan
+{
+    Sint64 resample_rate;
+    SDL_AudioResampleQuality quality;
+    int src_step;        // M: input frames per L output frames.
+    int num_phases;      // L: number of distinct filter positions.
+    int zero_crossings;
+    int taps;
+    int refcount;
+    float *coeffs;       // `taps` coefficients for each phase.
+    ResamplePlannedFrameFunc mono_func;
+    ResamplePlannedFrameFunc stereo_func;
+    SDL_ResamplePlan *next;
+};
+
+static SDL_SpinLock ResamplePlanLock;
+static SDL_ResamplePlan *ResamplePlans = NULL;
+
+static int GreatestCommonDivisor(int a, int b)
+{
+    while (b != 0) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Evaluate one tap of the cubic filter, in whatever layout SetupAudioResampler left it.
+static float EvaluateCubicTap(const Cubic *filter, int tap, float frac)
+{
+    float v[4];
+    int i;
+
+    if (ResamplerFilterTransposed) {
+        const Cubic *block = &filter[tap & ~3];
+        for (i = 0; i < 4; ++i) {
+            v[i] = block[i].v[tap & 3];
+        }
+    } else {
+        for (i = 0; i < 4; ++i) {
+            v[i] = filter[tap].v[i];
+        }
+    }
+
+    return v[0] + (v[1] * frac) + (v[2] * frac * frac) + (v[3] * frac * frac * frac);
+}
+
+static SDL_ResamplePlan *CreateResamplePlan(int src_step, int num_phases, SDL_AudioResampleQuality quality)
+{
+    SDL_ResamplePlan *plan = (SDL_ResamplePlan *)SDL_calloc(1, sizeof(*plan));
+    if (!plan) {
+        return NULL;
+    }
+
+    plan->resample_rate = SDL_GetResampleRate(src_step, num_phases);
+    plan->quality = quality;
+    plan->src_step = src_step;
+    plan->num_phases = num_phases;
+    plan->zero_crossings = (quality == SDL_AUDIO_RESAMPLE_QUALITY_HIGH) ? RESAMPLER_HQ_ZERO_CROSSINGS : RESAMPLER_ZERO_CROSSINGS;
+    plan->taps = plan->zero_crossings * 2;
+    plan->refcount = 1;
+
+    // The SIMD versions need the taps to fill whole vectors. RESAMPLER_ZERO_CROSSINGS is odd without SSE or NEON, so check rather than assume.
+    SDL_assert((plan->taps % 2) == 0);
+    plan->mono_func = ResamplePlannedFrame_Mono;
+    plan->stereo_func = ResamplePlannedFrame_Stereo;
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2() && ((plan->taps % 8) == 0)) {
+        plan->mono_func = ResamplePlannedFrame_Mono_AVX2;
+        plan->stereo_func = ResamplePlannedFrame_Stereo_AVX2;
+    } else
+#endif
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE() && ((plan->taps % 4) == 0)) {
+        plan->mono_func = ResamplePlannedFrame_Mono_SSE;
+        plan->stereo_func = ResamplePlannedFrame_Stereo_SSE;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON() && ((plan->taps % 4) == 0)) {
+        plan->mono_func = ResamplePlannedFrame_Mono_NEON;
+        plan->stereo_func = ResamplePlannedFrame_Stereo_NEON;
+    } else
+#endif
+    {
+        // just use the generic versions.
+    }
+
+    plan->coeffs = (float *)SDL_malloc(sizeof(float) * num_phases * plan->taps);
+    if (!plan->coeffs) {
+        SDL_free(plan);
+        return NULL;
+    }
+
+    for (int phase = 0; phase < num_phases; ++phase) {
+        const Uint32 srcfraction = (Uint32)(((Uint64)phase << 32) / (Uint64)num_phases);
+        float *coeffs = &plan->coeffs[phase * plan->taps];
 
-        dst += chans;
+        if (quality == SDL_AUDIO_RESAMPLE_QUALITY_HIGH) {
+            const PolyphaseFilter *filter = &ResamplerPolyphaseFilter[srcfraction >> RESAMPLER_HQ_PHASE_INTERP_BITS];
+            const float t = (float)(srcfraction & (RESAMPLER_HQ_PHASE_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_HQ_PHASE_INTERP_RANGE);
+            for (int i = 0; i < plan->taps; ++i) {
+                coeffs[i] = filter->coeffs[i] + (filter->deltas[i] * t);
+            }
+        } else {
+            const Cubic *filter = ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
+            const float frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+            for (int i = 0; i < plan->taps; ++i) {
+                coeffs[i] = EvaluateCubicTap(filter, i, frac);
+            }
+        }
     }
 
-    *inout_resample_offset = srcpos - ((Sint64)inframes << 32);
+    return plan;
+}
+
+static void DestroyResamplePlan(SDL_ResamplePlan *plan)
+{
+    if (plan) {
+        SDL_free(plan->coeffs);
+        SDL_free(plan);
+    }
+}
+
+static SDL_ResamplePlan *FindResamplePlan(int src_step, int num_phases, SDL_AudioResampleQuality quality)
+{
+    for (SDL_ResamplePlan *plan = ResamplePlans; plan; plan = plan->next) {
+        if ((plan->src_step == src_step) && (plan->num_phases == num_phases) && (plan->quality == quality)) {
+            return plan;
+        }
+    }
+    return NULL;
+}
+
+SDL_ResamplePlan *SDL_AcquireResamplePlan(int src_rate, int dst_rate, SDL_AudioResampleQuality quality)
+{
+    SDL_assert(src_rate > 0);
+    SDL_assert(dst_rate > 0);
+
+    // Linear interpolation is cheap enough already.
+    if (quality == SDL_AUDIO_RESAMPLE_QUALITY_FAST) {
+        return NULL;
+    } else if (!SDL_GetHintBoolean(SDL_HINT_AUDIO_RESAMPLER_EXACT_RATIOS, true)) {
+        return NULL;
+    }
+
+    const int gcd = GreatestCommonDivisor(src_rate, dst_rate);
+    const int src_step = src_rate / gcd;
+    const int num_phases = dst_rate / gcd;
+    if (num_phases > RESAMPLER_MAX_PLAN_PHASES) {
+        return NULL;
+    }
+
+    SDL_LockSpinlock(&ResamplePlanLock);
+    SDL_ResamplePlan *plan = FindResamplePlan(src_step, num_phases, quality);
+    if (plan) {
+        ++plan->refcount;
+    }
+    SDL_UnlockSpinlock(&ResamplePlanLock);
+
+    if (plan) {
+        return plan;
+    }
+
+    // Build it without holding the lock, then check nobody beat us to it.
+    SDL_ResamplePlan *new_plan = CreateResamplePlan(src_step, num_phases, quality);
+    if (!new_plan) {
+        return NULL;
+    }
+
+    SDL_LockSpinlock(&ResamplePlanLock);
+    plan = FindResamplePlan(src_step, num_phases, quality);
+    if (plan) {
+        ++plan->refcount;
+    } else {
+        plan = new_plan;
+        new_plan = NULL;
+        plan->next = ResamplePlans;
+        ResamplePlans = plan;
+    }
+    SDL_UnlockSpinlock(&ResamplePlanLock);
+
+    DestroyResamplePlan(new_plan);
+    return plan;
+}
+
+void SDL_ReleaseResamplePlan(SDL_ResamplePlan *plan)
+{
+    if (!plan) {
+        return;
+    }
+
+    SDL_LockSpinlock(&ResamplePlanLock);
+    if (--plan->refcount == 0) {
+        SDL_ResamplePlan **prev = &ResamplePlans;
+        while (*prev != plan) {
+            prev = &(*prev)->next;
+        }
+        *prev = plan->next;
+    } else {
+        plan = NULL;
+    }
+    SDL_UnlockSpinlock(&ResamplePlanLock);
+
+    DestroyResamplePlan(plan);
+}
+
+// No fractions or filter interpolation here: each frame steps through the plan's phases.
+static void ResampleBlock_Planned(const SDL_ResamplePlan *plan, const float *src, float *dst, int outframes,
+                                  int *inout_srcindex, int *inout_phase, int chans)
+{
+    const int taps = plan->taps;
+    const int num_phases = plan->num_phases;
+    const int step_frames = plan->src_step / num_phases;
+    const int step_phases = plan->src_step % num_phases;
+    int srcindex = *inout_srcindex;
+    int phase = *inout_phase;
+    int i, j, chan;
+
+    src -= (plan->zero_crossings - 1) * chans;
+
+#define NEXT_PHASE()                 \
+    srcindex += step_frames;         \
+    phase += step_phases;            \
+    if (phase >= num_phases) {       \
+        phase -= num_phases;         \
+        ++srcindex;                  \
+    }
+
+    if (chans <= 2) {
+        const ResamplePlannedFrameFunc resample_frame = (chans == 1) ? plan->mono_func : plan->stereo_func;
+
+        for (i = 0; i < outframes; ++i) {
+            resample_frame(&src[srcindex * chans], &plan->coeffs[phase * taps], taps, &dst[i * chans]);
+            NEXT_PHASE();
+        }
+    } else {
+        for (i = 0; i < outframes; ++i) {
+            const float *coeffs = &plan->coeffs[phase * taps];
+            const float *frame = &src[srcindex * chans];
+
+            for (chan = 0; chan < chans; ++chan) {
+                float out = 0.0f;
+
+                for (j = 0; j < taps; ++j) {
+                    out += frame[j * chans + chan] * coeffs[j];
+                }
+
+                dst[i * chans + chan] = out;
+            }
+            NEXT_PHASE();
+        }
+    }
+
+#undef NEXT_PHASE
+
+    *inout_srcindex = srcindex;
+    *inout_phase = phase;
+}
+
+void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
+                       Sint64 resample_rate, Sint64 *inout_resample_offset, SDL_AudioResampleQuality quality,
+                       const SDL_ResamplePlan *plan)
+{
+    const Sint64 srcpos = *inout_resample_offset;
+
+    SDL_assert(resample_rate > 0);
+    SDL_assert((quality >= SDL_AUDIO_RESAMPLE_QUALITY_FAST) && (quality <= SDL_AUDIO_RESAMPLE_QUALITY_HIGH));
+    SDL_assert((outframes == 0) || ((srcpos >> 32) >= -1));
+    SDL_assert((outframes == 0) || (((srcpos + ((Sint64)(outframes - 1) * resample_rate)) >> 32) < inframes));
+
+    if (plan && (plan->resample_rate == resample_rate) && (plan->quality == quality)) {
+        // Start from the first phase at or after srcpos. That's at most 1/L of a frame away, and once
+        // we've been through here, the position is already on a phase. The padding has a frame to
+        // spare on either side, which covers the phases not quite lining up with resample_rate.
+        int srcindex = (int)(Sint32)(srcpos >> 32);
+        int phase = (int)((((Uint64)(srcpos & 0xFFFFFFFF) * (Uint64)plan->num_phases) + 0xFFFFFFFF) >> 32);
+        if (phase == plan->num_phases) {
+            phase = 0;
+            ++srcindex;
+        }
+
+        ResampleBlock_Planned(plan, src, dst, outframes, &srcindex, &phase, chans);
+
+        // Store the position on the phase it stopped at, so resample_rate's rounding can't build up.
+        *inout_resample_offset = ((Sint64)(srcindex - inframes) * 0x100000000) + (Sint64)(((Uint64)phase << 32) / (Uint64)plan->num_phases);
+        return;
+    }
+
+    ResampleBlock[quality](src, dst, outframes, srcpos, resample_rate, chans);
+
+    *inout_resample_offset = srcpos + ((Sint64)outframes * resample_rate) - ((Sint64)inframes << 32);
 }
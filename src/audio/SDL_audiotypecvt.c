@@ -829,6 +829,178 @@ static void SDL_Convert_Swap32_NEON(Uint32* dst, const Uint32* src, int num_samp
 #undef CONVERT_16_FWD
 #undef CONVERT_16_REV
 
+// Mixers: sum `src` into `dst`, clamping to [-1.0, 1.0], exactly like SDL_MixAudio() does for SDL_AUDIO_F32 at full volume.
+
+static void SDL_Mix_F32_Scalar(float *dst, const float *src, int num_samples)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        const float sample = dst[i] + src[i];
+        dst[i] = SDL_clamp(sample, -1.0f, 1.0f);
+    }
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+static void SDL_TARGETING("sse2") SDL_Mix_F32_SSE2(float *dst, const float *src, int num_samples)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 neg_one = _mm_set1_ps(-1.0f);
+    int i = 0;
+
+    for (; (i + 8) <= num_samples; i += 8) {
+        const __m128 sum0 = _mm_add_ps(_mm_loadu_ps(&dst[i]), _mm_loadu_ps(&src[i]));
+        const __m128 sum1 = _mm_add_ps(_mm_loadu_ps(&dst[i + 4]), _mm_loadu_ps(&src[i + 4]));
+        _mm_storeu_ps(&dst[i], _mm_min_ps(_mm_max_ps(sum0, neg_one), one));
+        _mm_storeu_ps(&dst[i + 4], _mm_min_ps(_mm_max_ps(sum1, neg_one), one));
+    }
+
+    SDL_Mix_F32_Scalar(&dst[i], &src[i], num_samples - i);
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2") SDL_Mix_F32_AVX2(float *dst, const float *src, int num_samples)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 neg_one = _mm256_set1_ps(-1.0f);
+    int i = 0;
+
+    for (; (i + 16) <= num_samples; i += 16) {
+        const __m256 sum0 = _mm256_add_ps(_mm256_loadu_ps(&dst[i]), _mm256_loadu_ps(&src[i]));
+        const __m256 sum1 = _mm256_add_ps(_mm256_loadu_ps(&dst[i + 8]), _mm256_loadu_ps(&src[i + 8]));
+        _mm256_storeu_ps(&dst[i], _mm256_min_ps(_mm256_max_ps(sum0, neg_one), one));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_min_ps(_mm256_max_ps(sum1, neg_one), one));
+    }
+
+    SDL_Mix_F32_Scalar(&dst[i], &src[i], num_samples - i);
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void SDL_Mix_F32_NEON(float *dst, const float *src, int num_samples)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t neg_one = vdupq_n_f32(-1.0f);
+    int i = 0;
+
+    for (; (i + 8) <= num_samples; i += 8) {
+        const float32x4_t sum0 = vaddq_f32(vld1q_f32(&dst[i]), vld1q_f32(&src[i]));
+        const float32x4_t sum1 = vaddq_f32(vld1q_f32(&dst[i + 4]), vld1q_f32(&src[i + 4]));
+        vst1q_f32(&dst[i], vminq_f32(vmaxq_f32(sum0, neg_one), one));
+        vst1q_f32(&dst[i + 4], vminq_f32(vmaxq_f32(sum1, neg_one), one));
+    }
+
+    SDL_Mix_F32_Scalar(&dst[i], &src[i], num_samples - i);
+}
+#endif
+
+// Accumulators: sum `src` into `dst` without clamping, for partial mixes that get clamped once when they're combined.
+
+static void SDL_Accumulate_F32_Scalar(float *dst, const float *src, int num_samples)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        dst[i] += src[i];
+    }
+}
+
+// Clampers: clamp `buffer` to [-1.0, 1.0] in place, to finish off an accumulated mix.
+
+static void SDL_Clamp_F32_Scalar(float *buffer, int num_samples)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        buffer[i] = SDL_clamp(buffer[i], -1.0f, 1.0f);
+    }
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+static void SDL_TARGETING("sse2") SDL_Accumulate_F32_SSE2(float *dst, const float *src, int num_samples)
+{
+    int i = 0;
+
+    for (; (i + 8) <= num_samples; i += 8) {
+        _mm_storeu_ps(&dst[i], _mm_add_ps(_mm_loadu_ps(&dst[i]), _mm_loadu_ps(&src[i])));
+        _mm_storeu_ps(&dst[i + 4], _mm_add_ps(_mm_loadu_ps(&dst[i + 4]), _mm_loadu_ps(&src[i + 4])));
+    }
+
+    SDL_Accumulate_F32_Scalar(&dst[i], &src[i], num_samples - i);
+}
+
+static void SDL_TARGETING("sse2") SDL_Clamp_F32_SSE2(float *buffer, int num_samples)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 neg_one = _mm_set1_ps(-1.0f);
+    int i = 0;
+
+    for (; (i + 8) <= num_samples; i += 8) {
+        _mm_storeu_ps(&buffer[i], _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&buffer[i]), neg_one), one));
+        _mm_storeu_ps(&buffer[i + 4], _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&buffer[i + 4]), neg_one), one));
+    }
+
+    SDL_Clamp_F32_Scalar(&buffer[i], num_samples - i);
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2") SDL_Accumulate_F32_AVX2(float *dst, const float *src, int num_samples)
+{
+    int i = 0;
+
+    for (; (i + 16) <= num_samples; i += 16) {
+        _mm256_storeu_ps(&dst[i], _mm256_add_ps(_mm256_loadu_ps(&dst[i]), _mm256_loadu_ps(&src[i])));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_add_ps(_mm256_loadu_ps(&dst[i + 8]), _mm256_loadu_ps(&src[i + 8])));
+    }
+
+    SDL_Accumulate_F32_Scalar(&dst[i], &src[i], num_samples - i);
+}
+
+static void SDL_TARGETING("avx2") SDL_Clamp_F32_AVX2(float *buffer, int num_samples)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 neg_one = _mm256_set1_ps(-1.0f);
+    int i = 0;
+
+    for (; (i + 16) <= num_samples; i += 16) {
+        _mm256_storeu_ps(&buffer[i], _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&buffer[i]), neg_one), one));
+        _mm256_storeu_ps(&buffer[i + 8], _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&buffer[i + 8]), neg_one), one));
+    }
+
+    SDL_Clamp_F32_Scalar(&buffer[i], num_samples - i);
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void SDL_Accumulate_F32_NEON(float *dst, const float *src, int num_samples)
+{
+    int i = 0;
+
+    for (; (i + 8) <= num_samples; i += 8) {
+        vst1q_f32(&dst[i], vaddq_f32(vld1q_f32(&dst[i]), vld1q_f32(&src[i])));
+        vst1q_f32(&dst[i + 4], vaddq_f32(vld1q_f32(&dst[i + 4]), vld1q_f32(&src[i + 4])));
+    }
+
+    SDL_Accumulate_F32_Scalar(&dst[i], &src[i], num_samples - i);
+}
+
+static void SDL_Clamp_F32_NEON(float *buffer, int num_samples)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t neg_one = vdupq_n_f32(-1.0f);
+    int i = 0;
+
+    for (; (i + 8) <= num_samples; i += 8) {
+        vst1q_f32(&buffer[i], vminq_f32(vmaxq_f32(vld1q_f32(&buffer[i]), neg_one), one));
+        vst1q_f32(&buffer[i + 4], vminq_f32(vmaxq_f32(vld1q_f32(&buffer[i + 4]), neg_one), one));
+    }
+
+    SDL_Clamp_F32_Scalar(&buffer[i], num_samples - i);
+}
+#endif
+
 // Function pointers set to a CPU-specific implementation.
 static void (*SDL_Convert_S8_to_F32)(float *dst, const Sint8 *src, int num_samples) = NULL;
 static void (*SDL_Convert_U8_to_F32)(float *dst, const Uint8 *src, int num_samples) = NULL;
@@ -842,6 +1014,10 @@ static void (*SDL_Convert_F32_to_S32)(Sint32 *dst, const float *src, int num_sam
 static void (*SDL_Convert_Swap16)(Uint16* dst, const Uint16* src, int num_samples) = NULL;
 static void (*SDL_Convert_Swap32)(Uint32* dst, const Uint32* src, int num_samples) = NULL;
 
+static void (*SDL_Mix_F32)(float *dst, const float *src, int num_samples) = NULL;
+static void (*SDL_Accumulate_F32)(float *dst, const float *src, int num_samples) = NULL;
+static void (*SDL_Clamp_F32)(float *buffer, int num_samples) = NULL;
+
 void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SDL_AudioFormat src_fmt)
 {
     switch (src_fmt) {
@@ -916,6 +1092,21 @@ void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_Aud
     }
 }
 
+void MixFloat32Audio(float *dst, const float *src, int num_samples)
+{
+    SDL_Mix_F32(dst, src, num_samples);
+}
+
+void AccumulateFloat32Audio(float *dst, const float *src, int num_samples)
+{
+    SDL_Accumulate_F32(dst, src, num_samples);
+}
+
+void ClampFloat32Audio(float *buffer, int num_samples)
+{
+    SDL_Clamp_F32(buffer, num_samples);
+}
+
 void ConvertAudioSwapEndian(void* dst, const void* src, int num_samples, int bitsize)
 {
     switch (bitsize) {
@@ -978,5 +1169,32 @@ void SDL_ChooseAudioConverters(void)
 
 #undef SET_CONVERTER_FUNCS
 
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SDL_Mix_F32 = SDL_Mix_F32_AVX2;
+        SDL_Accumulate_F32 = SDL_Accumulate_F32_AVX2;
+        SDL_Clamp_F32 = SDL_Clamp_F32_AVX2;
+    } else
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SDL_Mix_F32 = SDL_Mix_F32_SSE2;
+        SDL_Accumulate_F32 = SDL_Accumulate_F32_SSE2;
+        SDL_Clamp_F32 = SDL_Clamp_F32_SSE2;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_Mix_F32 = SDL_Mix_F32_NEON;
+        SDL_Accumulate_F32 = SDL_Accumulate_F32_NEON;
+        SDL_Clamp_F32 = SDL_Clamp_F32_NEON;
+    } else
+#endif
+    {
+        SDL_Mix_F32 = SDL_Mix_F32_Scalar;
+        SDL_Accumulate_F32 = SDL_Accumulate_F32_Scalar;
+        SDL_Clamp_F32 = SDL_Clamp_F32_Scalar;
+    }
+
     converters_chosen = true;
 }
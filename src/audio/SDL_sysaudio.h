@@ -48,6 +48,8 @@
 
 #define SDL_MAX_CHANNELMAP_CHANNELS 8  // !!! FIXME: if SDL ever supports more channels, clean this out and make those parts dynamic.
 
+#define SDL_MAX_AUDIO_MIX_THREADS 64  // upper limit for SDL_HINT_AUDIO_DEVICE_MIX_THREADS, to keep a typo from spawning thousands of threads.
+
 typedef struct SDL_AudioDevice SDL_AudioDevice;
 typedef struct SDL_LogicalAudioDevice SDL_LogicalAudioDevice;
 
@@ -114,6 +116,15 @@ extern void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SD
 extern void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_AudioFormat dst_fmt);
 extern void ConvertAudioSwapEndian(void* dst, const void* src, int num_samples, int bitsize);
 
+// Sum `num_samples` floats from `src` into `dst`, clamping the result to [-1.0, 1.0].
+extern void MixFloat32Audio(float *dst, const float *src, int num_samples);
+
+// Sum `num_samples` floats from `src` into `dst` without clamping. Finish the mix with ClampFloat32Audio().
+extern void AccumulateFloat32Audio(float *dst, const float *src, int num_samples);
+
+// Clamp `num_samples` floats in `buffer` to [-1.0, 1.0].
+extern void ClampFloat32Audio(float *buffer, int num_samples);
+
 extern bool SDL_ChannelMapIsDefault(const int *map, int channels);
 extern bool SDL_ChannelMapIsBogus(const int *map, int channels);
 
@@ -145,6 +156,12 @@ extern int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidb
 // This is the bulk of `SDL_SetAudioStream*putChannelMap`'s work, but it lets you skip the check about changing the device end of a stream if isinput==-1.
 extern bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec, int **stream_chmap, const int *chmap, int channels, int isinput);
 
+// Turns the lock-free input ring on or off to match the stream's current formats and put callback. You must hold the stream's lock.
+extern void UpdateAudioStreamInputRing(SDL_AudioStream *stream);
+
+// Gets the precalculated resampling filters for the stream's current sample rates. Call this whenever they change. You must hold the stream's lock.
+extern void UpdateAudioStreamResamplePlans(SDL_AudioStream *stream);
+
 
 typedef struct SDL_AudioDriverImpl
 {
@@ -223,10 +240,25 @@ struct SDL_AudioStream
     int *input_chmap;
     int input_chmap_storage[SDL_MAX_CHANNELMAP_CHANNELS];  // !!! FIXME: this needs to grow if SDL ever supports more channels. But if it grows, we should probably be more clever about allocations.
     Sint64 resample_offset;
+    SDL_AudioResampleQuality resample_quality;  // cached from SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER when data is read.
+    struct SDL_ResamplePlan *resample_plans[2];  // shared filters for the current rates at MEDIUM and HIGH quality, if the ratio is simple. May be NULL.
+    int resample_plan_src_freq;
+    int resample_plan_dst_freq;
 
     Uint8 *work_buffer;    // used for scratch space during data conversion/resampling.
     size_t work_buffer_allocation;
 
+    // Optional lock-free ring that SDL_PutAudioStreamData writes into without taking `lock` (single producer).
+    // It's emptied into `queue` by whoever holds `lock` next, so only the producer touches `input_ring_head`,
+    // and `input_ring_tail` only changes while `lock` is held. The producer only uses the ring while
+    // `input_ring_enabled` is nonzero, which is only changed while `lock` is held.
+    Uint8 *input_ring;
+    Uint32 input_ring_size;  // always a power of two.
+    int input_ring_frame_size;
+    SDL_AtomicU32 input_ring_head;
+    SDL_AtomicU32 input_ring_tail;
+    SDL_AtomicInt input_ring_enabled;
+
     bool simplified;  // true if created via SDL_OpenAudioDeviceStream
 
     SDL_LogicalAudioDevice *bound_device;
@@ -282,6 +314,32 @@ struct SDL_LogicalAudioDevice
     SDL_LogicalAudioDevice *prev;
 };
 
+// A helper thread that converts a share of a logical device's bound streams when mixing in parallel.
+typedef struct SDL_AudioMixWorker
+{
+    // The physical device this worker mixes for.
+    SDL_AudioDevice *device;
+
+    // The worker thread itself.
+    SDL_Thread *thread;
+
+    // A partial mix, summed into the final mix by the device thread. The buffers here belong to mix slot (index + 1), whichever
+    //  worker thread ends up claiming that slot, so the mix doesn't depend on which thread wakes first.
+    float *mix_buffer;
+
+    // Scratch space for stream conversion.
+    Uint8 *work_buffer;
+
+    // Size of mix_buffer (and work_buffer) in bytes.
+    int buffer_size;
+
+    // true if mix_buffer received any data during the current iteration.
+    bool mixed;
+
+    // true if getting data from a stream failed during the current iteration.
+    bool failed;
+} SDL_AudioMixWorker;
+
 struct SDL_AudioDevice
 {
     // A mutex for locking access to this struct
@@ -359,6 +417,30 @@ struct SDL_AudioDevice
 
     // All logical devices associated with this physical device.
     SDL_LogicalAudioDevice *logical_devices;
+
+    // Properties for this physical device, created on demand by SDL_GetAudioDeviceProperties().
+    SDL_PropertiesID props;
+
+    // Optional pool of threads that convert bound streams in parallel (see SDL_HINT_AUDIO_DEVICE_MIX_THREADS).
+    SDL_AudioMixWorker *mix_workers;
+    int num_mix_workers;
+    SDL_Semaphore *mix_start_sem;
+    SDL_Semaphore *mix_done_sem;
+    SDL_AtomicInt mix_workers_quit;
+
+    // The streams being mixed this round. Slot N mixes every stream whose index modulo num_mix_slots is N. The device thread
+    //  takes slot 0, and workers claim the others by incrementing mix_next_slot.
+    SDL_AudioStream **mix_streams;
+    int num_mix_streams;
+    int mix_streams_allocation;
+    int num_mix_slots;
+    SDL_AtomicInt mix_next_slot;
+    float mix_gain;
+    int mix_buffer_size;
+
+    // Timing of playback iterations, for the SDL_PROP_AUDIO_DEVICE_ITERATION_* properties.
+    Uint64 max_iteration_ns;
+    Sint64 num_overruns;
 };
 
 typedef struct AudioBootStrap
@@ -229,6 +229,29 @@ static void ZombieReleaseFrame(SDL_Camera *device, SDL_Surface *frame) // Reclai
     // we just leave zombie_pixels alone, as we'll reuse it for every new frame until the camera is closed.
 }
 
+static void DestroyCameraSurfaces(SDL_Camera *device)
+{
+    SDL_DestroySurface(device->acquire_surface);
+    device->acquire_surface = NULL;
+    SDL_DestroySurface(device->conversion_surface);
+    device->conversion_surface = NULL;
+    SDL_DestroySurface(device->scaling_surface);
+    device->scaling_surface = NULL;
+
+    for (int i = 0; i < device->num_output_surfaces; i++) {
+        SDL_DestroySurface(device->output_surfaces[i].surface);
+        SDL_DestroySurface(device->output_surfaces[i].frame);
+    }
+    SDL_free(device->output_surfaces);
+    device->output_surfaces = NULL;
+    device->num_output_surfaces = 0;
+
+    device->filled_output_surfaces.next = NULL;
+    device->empty_output_surfaces.next = NULL;
+    device->app_held_output_surfaces.next = NULL;
+    device->pending_output_surfaces.next = NULL;
+}
+
 static void ClosePhysicalCamera(SDL_Camera *device)
 {
     if (!device) {
@@ -244,6 +267,14 @@ static void ClosePhysicalCamera(SDL_Camera *device)
         device->thread = NULL;
     }
 
+    if (device->conversion_thread != NULL) {
+        SDL_LockMutex(device->lock);
+        SDL_BroadcastCondition(device->conversion_cond);
+        SDL_UnlockMutex(device->lock);
+        SDL_WaitThread(device->conversion_thread, NULL);
+        device->conversion_thread = NULL;
+    }
+
     // release frames that are queued up somewhere...
     if (!device->needs_conversion && !device->needs_scaling) {
         for (SurfaceList *i = device->filled_output_surfaces.next; i != NULL; i = i->next) {
@@ -253,32 +284,34 @@ static void ClosePhysicalCamera(SDL_Camera *device)
             device->ReleaseFrame(device, i->surface);
         }
     }
+    for (SurfaceList *i = device->pending_output_surfaces.next; i != NULL; i = i->next) {
+        device->ReleaseFrame(device, i->frame);
+    }
 
     camera_driver.impl.CloseDevice(device);
 
     SDL_DestroyProperties(device->props);
+    device->props = 0;
 
-    SDL_DestroySurface(device->acquire_surface);
-    device->acquire_surface = NULL;
-    SDL_DestroySurface(device->conversion_surface);
-    device->conversion_surface = NULL;
+    SDL_DestroyCondition(device->conversion_cond);
+    device->conversion_cond = NULL;
 
-    for (int i = 0; i < SDL_arraysize(device->output_surfaces); i++) {
-        SDL_DestroySurface(device->output_surfaces[i].surface);
-    }
-    SDL_zeroa(device->output_surfaces);
+    DestroyCameraSurfaces(device);
 
     SDL_aligned_free(device->zombie_pixels);
 
     device->permission = 0;
     device->zombie_pixels = NULL;
-    device->filled_output_surfaces.next = NULL;
-    device->empty_output_surfaces.next = NULL;
-    device->app_held_output_surfaces.next = NULL;
 
     device->base_timestamp = 0;
     device->adjust_timestamp = 0;
 
+    device->dropped_frames = 0;
+    device->converted_frames = 0;
+    device->conversion_time_ns = 0;
+
+    device->reuses_frame_memory = false;
+
     SDL_zero(device->spec);
 }
 
@@ -798,6 +831,107 @@ void SDL_CameraThreadSetup(SDL_Camera *device)
 #endif
 }
 
+// Publish the frame statistics in the camera's properties. The device lock must be held.
+static void UpdateCameraStats(SDL_Camera *device)
+{
+    if (device->props == 0) {
+        device->props = SDL_CreateProperties();
+        if (device->props == 0) {
+            return;
+        }
+    }
+
+    SDL_SetNumberProperty(device->props, SDL_PROP_CAMERA_FRAME_BUFFERS_NUMBER, device->num_output_surfaces);
+    SDL_SetNumberProperty(device->props, SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER, (Sint64) device->dropped_frames);
+    SDL_SetNumberProperty(device->props, SDL_PROP_CAMERA_CONVERTED_FRAMES_NUMBER, (Sint64) device->converted_frames);
+    SDL_SetNumberProperty(device->props, SDL_PROP_CAMERA_CONVERSION_TIME_NS_NUMBER, (Sint64) device->conversion_time_ns);
+}
+
+// Scale and/or convert a frame from the hardware's format to the app's format.
+static bool ConvertCameraFrame(SDL_Camera *device, SDL_Surface *src, SDL_Surface *dst)
+{
+    if (!device->needs_scaling) {
+        return SDL_ConvertPixels(src->w, src->h, src->format, src->pixels, src->pitch, dst->format, dst->pixels, dst->pitch);
+    }
+
+    // the blitter converts and scales in one pass, but it can't read or write YUV, so go through RGB at the YUV side's size for those.
+    if (SDL_ISPIXELFORMAT_FOURCC(src->format)) {
+        SDL_Surface *rgb = device->conversion_surface;
+        if (!SDL_ConvertPixels(src->w, src->h, src->format, src->pixels, src->pitch, rgb->format, rgb->pixels, rgb->pitch)) {
+            return false;
+        }
+        src = rgb;
+    }
+
+    if (SDL_ISPIXELFORMAT_FOURCC(dst->format)) {
+        SDL_Surface *rgb = device->scaling_surface;
+        if (!SDL_BlitSurfaceScaled(src, NULL, rgb, NULL, SDL_SCALEMODE_LINEAR)) {  // !!! FIXME: letterboxing?
+            return false;
+        }
+        return SDL_ConvertPixels(rgb->w, rgb->h, rgb->format, rgb->pixels, rgb->pitch, dst->format, dst->pixels, dst->pitch);
+    }
+
+    return SDL_BlitSurfaceScaled(src, NULL, dst, NULL, SDL_SCALEMODE_LINEAR);  // !!! FIXME: letterboxing?
+}
+
+// Convert a frame, give the driver back its resources, and queue the frame for the app. Don't hold the device lock when calling this.
+static void ConvertAndQueueCameraFrame(SDL_Camera *device, SurfaceList *slist, SDL_Surface *acquired)
+{
+    #if DEBUG_CAMERA
+    SDL_Log("CAMERA: Frame is getting converted!");
+    #endif
+
+    const Uint64 start = SDL_GetTicksNS();
+    ConvertCameraFrame(device, acquired, slist->surface);
+    const Uint64 elapsed = SDL_GetTicksNS() - start;
+
+    SDL_LockMutex(device->lock);
+
+    // we made a copy, so we can give the driver back its resources.
+    device->ReleaseFrame(device, acquired);
+    acquired->pixels = NULL;
+    acquired->pitch = 0;
+
+    // make the filled output surface available to the app.
+    slist->next = device->filled_output_surfaces.next;
+    device->filled_output_surfaces.next = slist;
+
+    device->converted_frames++;
+    device->conversion_time_ns += elapsed;
+    UpdateCameraStats(device);
+
+    SDL_UnlockMutex(device->lock);
+}
+
+// Conversion thread entry point, so the camera thread can go back to waiting on the hardware while we chew up the CPU.
+static int SDLCALL CameraConversionThread(void *devicep)
+{
+    SDL_Camera *device = (SDL_Camera *) devicep;
+
+    SDL_LockMutex(device->lock);
+    while (!SDL_GetAtomicInt(&device->shutdown)) {
+        // frames are in this list from newest to oldest, so find the end of the list...
+        SurfaceList *slistprev = &device->pending_output_surfaces;
+        SurfaceList *slist = slistprev->next;
+        if (!slist) {
+            SDL_WaitCondition(device->conversion_cond, device->lock);
+            continue;
+        }
+        while (slist->next) {
+            slistprev = slist;
+            slist = slist->next;
+        }
+        slistprev->next = NULL;  // remove from pending list.
+
+        SDL_UnlockMutex(device->lock);
+        ConvertAndQueueCameraFrame(device, slist, slist->frame);
+        SDL_LockMutex(device->lock);
+    }
+    SDL_UnlockMutex(device->lock);
+
+    return 0;
+}
+
 bool SDL_CameraThreadIterate(SDL_Camera *device)
 {
     SDL_LockMutex(device->lock);
@@ -815,7 +949,6 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
 
     bool failed = false;  // set to true if disaster worthy of treating the device as lost has happened.
     SDL_Surface *acquired = NULL;
-    SDL_Surface *output_surface = NULL;
     SurfaceList *slist = NULL;
     Uint64 timestampNS = 0;
 
@@ -843,6 +976,8 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             device->ReleaseFrame(device, device->acquire_surface);
             device->acquire_surface->pixels = NULL;
             device->acquire_surface->pitch = 0;
+            device->dropped_frames++;
+            UpdateCameraStats(device);
         } else {
             if (!device->adjust_timestamp) {
                 device->adjust_timestamp = SDL_GetTicksNS();
@@ -851,10 +986,21 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             timestampNS = (timestampNS - device->base_timestamp) + device->adjust_timestamp;
 
             slist = device->empty_output_surfaces.next;
-            output_surface = slist->surface;
             device->empty_output_surfaces.next = slist->next;
-            acquired = device->acquire_surface;
             slist->timestampNS = timestampNS;
+
+            if (device->conversion_thread) {
+                // hand the frame to the conversion thread, and swap in its spare surface to acquire the next frame into.
+                SDL_Surface *spare = slist->frame;
+                slist->frame = device->acquire_surface;
+                device->acquire_surface = spare;
+                slist->next = device->pending_output_surfaces.next;
+                device->pending_output_surfaces.next = slist;
+                SDL_SignalCondition(device->conversion_cond);
+                slist = NULL;
+            } else {
+                acquired = device->acquire_surface;
+            }
         }
     } else if (rc == SDL_CAMERA_FRAME_SKIP) {  // no frame available yet; not an error.
         #if 0 //DEBUG_CAMERA
@@ -881,44 +1027,24 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             #if DEBUG_CAMERA
             SDL_Log("CAMERA: Frame is going through without conversion!");
             #endif
+            SDL_Surface *output_surface = slist->surface;
             output_surface->w = acquired->w;
             output_surface->h = acquired->h;
             output_surface->pixels = acquired->pixels;
             output_surface->pitch = acquired->pitch;
-        } else {  // convert/scale into a different surface.
-            #if DEBUG_CAMERA
-            SDL_Log("CAMERA: Frame is getting converted!");
-            #endif
-            SDL_Surface *srcsurf = acquired;
-            if (device->needs_scaling == -1) {  // downscaling? Do it first.  -1: downscale, 0: no scaling, 1: upscale
-                SDL_Surface *dstsurf = device->needs_conversion ? device->conversion_surface : output_surface;
-                SDL_StretchSurface(srcsurf, NULL, dstsurf, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
-                srcsurf = dstsurf;
-            }
-            if (device->needs_conversion) {
-                SDL_Surface *dstsurf = (device->needs_scaling == 1) ? device->conversion_surface : output_surface;
-                SDL_ConvertPixels(srcsurf->w, srcsurf->h,
-                                  srcsurf->format, srcsurf->pixels, srcsurf->pitch,
-                                  dstsurf->format, dstsurf->pixels, dstsurf->pitch);
-                srcsurf = dstsurf;
-            }
-            if (device->needs_scaling == 1) {  // upscaling? Do it last.  -1: downscale, 0: no scaling, 1: upscale
-                SDL_StretchSurface(srcsurf, NULL, output_surface, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
-            }
 
-            // we made a copy, so we can give the driver back its resources.
-            device->ReleaseFrame(device, acquired);
+            // the pointer was migrated to output_surface.
+            acquired->pixels = NULL;
+            acquired->pitch = 0;
+
+            // make the filled output surface available to the app.
+            SDL_LockMutex(device->lock);
+            slist->next = device->filled_output_surfaces.next;
+            device->filled_output_surfaces.next = slist;
+            SDL_UnlockMutex(device->lock);
+        } else {  // no conversion thread, convert/scale into a different surface right here.
+            ConvertAndQueueCameraFrame(device, slist, acquired);
         }
-
-        // we either released these already after we copied the data, or the pointer was migrated to output_surface.
-        acquired->pixels = NULL;
-        acquired->pitch = 0;
-
-        // make the filled output surface available to the app.
-        SDL_LockMutex(device->lock);
-        slist->next = device->filled_output_surfaces.next;
-        device->filled_output_surfaces.next = slist;
-        SDL_UnlockMutex(device->lock);
     }
 
     return true;  // always go on if not shutting down, even if device failed.
@@ -958,6 +1084,32 @@ static int SDLCALL CameraThread(void *devicep)
     return 0;
 }
 
+// The format to scale in, when the other side of the conversion is `format`.
+static SDL_PixelFormat GetCameraScalingFormat(SDL_PixelFormat format)
+{
+    // linear scaling between two surfaces of the same 32-bit RGB format is the blitter's fast path.
+    if (!SDL_ISPIXELFORMAT_FOURCC(format) && SDL_BYTESPERPIXEL(format) == 4 && format != SDL_PIXELFORMAT_ARGB2101010) {
+        return format;
+    }
+    return SDL_PIXELFORMAT_XRGB8888;
+}
+
+// Create a surface for the camera's frames to flow through. The blitter reads these, so they must not blend.
+static SDL_Surface *CreateCameraSurface(int width, int height, SDL_PixelFormat format, SDL_Colorspace colorspace, bool allocate_pixels)
+{
+    SDL_Surface *surf;
+    if (allocate_pixels) {
+        surf = SDL_CreateSurface(width, height, format);
+    } else {
+        surf = SDL_CreateSurfaceFrom(width, height, format, NULL, 0);
+    }
+    if (surf) {
+        SDL_SetSurfaceColorspace(surf, colorspace);
+        SDL_SetSurfaceBlendMode(surf, SDL_BLENDMODE_NONE);
+    }
+    return surf;
+}
+
 bool SDL_PrepareCameraSurfaces(SDL_Camera *device)
 {
     SDL_CameraSpec *appspec = &device->spec;           // the app wants this format.
@@ -996,68 +1148,81 @@ bool SDL_PrepareCameraSurfaces(SDL_Camera *device)
 
     device->needs_conversion = (devspec->format != appspec->format);
 
-    device->acquire_surface = SDL_CreateSurfaceFrom(devspec->width, devspec->height, devspec->format, NULL, 0);
+    const bool converting = (device->needs_scaling || device->needs_conversion);
+
+    device->acquire_surface = CreateCameraSurface(devspec->width, devspec->height, devspec->format, devspec->colorspace, false);
     if (!device->acquire_surface) {
         goto failed;
     }
-    SDL_SetSurfaceColorspace(device->acquire_surface, devspec->colorspace);
 
-    // if we have to scale _and_ convert, we need a middleman surface, since we can't do both changes at once.
-    if (device->needs_scaling && device->needs_conversion) {
-        const bool downscaling_first = (device->needs_scaling < 0);
-        const SDL_CameraSpec *s = downscaling_first ? appspec : devspec;
-        const SDL_PixelFormat fmt = downscaling_first ? devspec->format : appspec->format;
-        device->conversion_surface = SDL_CreateSurface(s->width, s->height, fmt);
+    // the blitter scales in RGB, so YUV needs to go through an RGB middleman surface on its way in or out.
+    if (device->needs_scaling && SDL_ISPIXELFORMAT_FOURCC(devspec->format)) {
+        const SDL_PixelFormat fmt = GetCameraScalingFormat(appspec->format);
+        device->conversion_surface = CreateCameraSurface(devspec->width, devspec->height, fmt, devspec->colorspace, true);
         if (!device->conversion_surface) {
             goto failed;
         }
-        SDL_SetSurfaceColorspace(device->conversion_surface, devspec->colorspace);
+    }
+    if (device->needs_scaling && SDL_ISPIXELFORMAT_FOURCC(appspec->format)) {
+        const SDL_PixelFormat fmt = device->conversion_surface ? device->conversion_surface->format : GetCameraScalingFormat(devspec->format);
+        device->scaling_surface = CreateCameraSurface(appspec->width, appspec->height, fmt, devspec->colorspace, true);
+        if (!device->scaling_surface) {
+            goto failed;
+        }
     }
 
     // output surfaces are in the app-requested format. If no conversion is necessary, we'll just use the pointers
     // the backend fills into acquired_surface, and you can get all the way from DMA access in the camera hardware
     // to the app without a single copy. Otherwise, these will be full surfaces that hold converted/scaled copies.
 
-    for (int i = 0; i < (SDL_arraysize(device->output_surfaces) - 1); i++) {
+    const char *hint = SDL_GetHint(SDL_HINT_CAMERA_FRAME_BUFFERS);
+    const int num_output_surfaces = (hint && *hint) ? SDL_clamp(SDL_atoi(hint), 1, 64) : 8;
+
+    device->output_surfaces = (SurfaceList *) SDL_calloc(num_output_surfaces, sizeof (SurfaceList));
+    if (!device->output_surfaces) {
+        goto failed;
+    }
+    device->num_output_surfaces = num_output_surfaces;
+
+    for (int i = 0; i < (num_output_surfaces - 1); i++) {
         device->output_surfaces[i].next = &device->output_surfaces[i + 1];
     }
     device->empty_output_surfaces.next = device->output_surfaces;
 
-    for (int i = 0; i < SDL_arraysize(device->output_surfaces); i++) {
-        SDL_Surface *surf;
-        if (device->needs_scaling || device->needs_conversion) {
-            surf = SDL_CreateSurface(appspec->width, appspec->height, appspec->format);
-        } else {
-            surf = SDL_CreateSurfaceFrom(appspec->width, appspec->height, appspec->format, NULL, 0);
-        }
+    for (int i = 0; i < num_output_surfaces; i++) {
+        SDL_Surface *surf = CreateCameraSurface(appspec->width, appspec->height, appspec->format, devspec->colorspace, converting);
         if (!surf) {
             goto failed;
         }
-        SDL_SetSurfaceColorspace(surf, devspec->colorspace);
-
         device->output_surfaces[i].surface = surf;
-    }
-
-    return true;
-
-failed:
-    if (device->acquire_surface) {
-        SDL_DestroySurface(device->acquire_surface);
-        device->acquire_surface = NULL;
-    }
 
-    if (device->conversion_surface) {
-        SDL_DestroySurface(device->conversion_surface);
-        device->conversion_surface = NULL;
+        // each frame waiting to be converted needs its own surface, so the driver can fill in the next one meanwhile.
+        if (converting) {
+            surf = CreateCameraSurface(devspec->width, devspec->height, devspec->format, devspec->colorspace, false);
+            if (!surf) {
+                goto failed;
+            }
+            device->output_surfaces[i].frame = surf;
+        }
     }
 
-    for (int i = 0; i < SDL_arraysize(device->output_surfaces); i++) {
-        SDL_Surface *surf = device->output_surfaces[i].surface;
-        if (surf) {
-            SDL_DestroySurface(surf);
+    // if the driver reads every frame into the same memory, the next frame would overwrite one waiting for the conversion thread, so convert on the camera thread.
+    if (converting && !device->reuses_frame_memory) {
+        // if we can't get a thread, we'll just convert on the camera thread instead.
+        device->conversion_cond = SDL_CreateCondition();
+        if (device->conversion_cond) {
+            char threadname[64];
+            (void)SDL_snprintf(threadname, sizeof (threadname), "SDLCameraConv%d", (int) device->instance_id);
+            device->conversion_thread = SDL_CreateThread(CameraConversionThread, threadname, device);
         }
     }
-    SDL_zeroa(device->output_surfaces);
+
+    UpdateCameraStats(device);
+
+    return true;
+
+failed:
+    DestroyCameraSurfaces(device);
 
     return false;
 }
@@ -78,6 +78,7 @@ typedef enum SDL_CameraFrameResult
 typedef struct SurfaceList
 {
     SDL_Surface *surface;
+    SDL_Surface *frame;  // the driver's frame that converts into `surface`, if converting.
     Uint64 timestampNS;
     struct SurfaceList *next;
 } SurfaceList;
@@ -132,14 +133,19 @@ struct SDL_Camera
     // Pixel data flows from the driver into these, then gets converted for the app if necessary.
     SDL_Surface *acquire_surface;
 
-    // acquire_surface converts or scales to this surface before landing in output_surfaces, if necessary.
+    // YUV frames convert to this RGB surface before scaling, if necessary.
     SDL_Surface *conversion_surface;
 
+    // Frames scale to this RGB surface before converting to a YUV output format, if necessary.
+    SDL_Surface *scaling_surface;
+
     // A queue of surfaces that buffer converted/scaled frames of video until the app claims them.
-    SurfaceList output_surfaces[8];
+    SurfaceList *output_surfaces;
+    int num_output_surfaces;
     SurfaceList filled_output_surfaces;        // this is FIFO
     SurfaceList empty_output_surfaces;         // this is LIFO
     SurfaceList app_held_output_surfaces;
+    SurfaceList pending_output_surfaces;       // this is FIFO, waiting for conversion_thread.
 
     // A fake video frame we allocate if the camera fails/disconnects.
     Uint8 *zombie_pixels;
@@ -150,6 +156,9 @@ struct SDL_Camera
     // true if acquire_surface needs to be converted for final output.
     bool needs_conversion;
 
+    // Backends set this in OpenDevice if every frame they acquire lands in the same memory, so a frame can't wait to be converted while the next one is read.
+    bool reuses_frame_memory;
+
     // Current state flags
     SDL_AtomicInt shutdown;
     SDL_AtomicInt zombie;
@@ -157,6 +166,15 @@ struct SDL_Camera
     // A thread to feed the camera device
     SDL_Thread *thread;
 
+    // A thread that converts/scales frames, so the camera thread can get back to the hardware. Waits on conversion_cond with `lock`.
+    SDL_Thread *conversion_thread;
+    SDL_Condition *conversion_cond;
+
+    // Statistics, published in `props`. Protected by `lock`.
+    Uint64 dropped_frames;
+    Uint64 converted_frames;
+    Uint64 conversion_time_ns;
+
     // Optional properties.
     SDL_PropertiesID props;
 
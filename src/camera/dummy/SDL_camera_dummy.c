@@ -24,32 +24,99 @@
 
 #include "../SDL_syscamera.h"
 
+// The dummy driver has one fake camera that produces a changing solid color, so the camera pipeline can be tested without hardware.
+
+#define DUMMYCAMERA_WIDTH 320
+#define DUMMYCAMERA_HEIGHT 240
+#define DUMMYCAMERA_FPS 60
+
+struct SDL_PrivateCameraData
+{
+    Uint64 next_frame_ns;
+    Uint64 frame_interval_ns;
+    Uint8 frame_count;
+};
+
+static int dummy_camera_handle;  // just something non-NULL to hand to SDL_AddCamera.
+
 static bool DUMMYCAMERA_OpenDevice(SDL_Camera *device, const SDL_CameraSpec *spec)
 {
-    return SDL_Unsupported();
+    device->hidden = (struct SDL_PrivateCameraData *) SDL_calloc(1, sizeof (struct SDL_PrivateCameraData));
+    if (!device->hidden) {
+        return false;
+    }
+
+    device->hidden->frame_interval_ns = SDL_NS_PER_SECOND * (Uint64) spec->framerate_denominator / (Uint64) spec->framerate_numerator;
+    device->hidden->next_frame_ns = SDL_GetTicksNS();
+
+    SDL_CameraPermissionOutcome(device, true);  // there's nobody to ask.
+    return true;
 }
 
 static void DUMMYCAMERA_CloseDevice(SDL_Camera *device)
 {
+    if (device) {
+        SDL_free(device->hidden);
+        device->hidden = NULL;
+    }
 }
 
 static bool DUMMYCAMERA_WaitDevice(SDL_Camera *device)
 {
-    return SDL_Unsupported();
+    // sleep in small steps until the next frame is due, so we notice a shutdown request quickly.
+    for (;;) {
+        const Uint64 now = SDL_GetTicksNS();
+        if ((now >= device->hidden->next_frame_ns) || SDL_GetAtomicInt(&device->shutdown)) {
+            break;
+        }
+        SDL_DelayNS(SDL_min(device->hidden->next_frame_ns - now, SDL_MS_TO_NS(10)));
+    }
+    return true;
 }
 
 static SDL_CameraFrameResult DUMMYCAMERA_AcquireFrame(SDL_Camera *device, SDL_Surface *frame, Uint64 *timestampNS)
 {
-    SDL_Unsupported();
-    return SDL_CAMERA_FRAME_ERROR;
+    const Uint64 now = SDL_GetTicksNS();
+    size_t size, pitch;
+
+    if (now < device->hidden->next_frame_ns) {
+        return SDL_CAMERA_FRAME_SKIP;
+    }
+
+    // if we fell behind, don't try to catch up with a burst of frames.
+    device->hidden->next_frame_ns = SDL_max(device->hidden->next_frame_ns + device->hidden->frame_interval_ns, now);
+
+    if (!SDL_CalculateSurfaceSize(device->actual_spec.format, device->actual_spec.width, device->actual_spec.height, &size, &pitch, false)) {
+        return SDL_CAMERA_FRAME_ERROR;
+    }
+
+    // every frame gets its own memory, like a driver with a ring of DMA buffers.
+    frame->pixels = SDL_aligned_alloc(SDL_GetSIMDAlignment(), size);
+    if (!frame->pixels) {
+        return SDL_CAMERA_FRAME_ERROR;
+    }
+    frame->pitch = (int) pitch;
+    SDL_memset(frame->pixels, device->hidden->frame_count++, size);
+
+    *timestampNS = now;
+    return SDL_CAMERA_FRAME_READY;
 }
 
 static void DUMMYCAMERA_ReleaseFrame(SDL_Camera *device, SDL_Surface *frame)
 {
+    SDL_aligned_free(frame->pixels);
 }
 
 static void DUMMYCAMERA_DetectDevices(void)
 {
+    CameraFormatAddData add_data;
+    SDL_zero(add_data);
+
+    if (SDL_AddCameraFormat(&add_data, SDL_PIXELFORMAT_YUY2, SDL_COLORSPACE_BT709_LIMITED, DUMMYCAMERA_WIDTH, DUMMYCAMERA_HEIGHT, DUMMYCAMERA_FPS, 1) &&
+        SDL_AddCameraFormat(&add_data, SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_SRGB, DUMMYCAMERA_WIDTH, DUMMYCAMERA_HEIGHT, DUMMYCAMERA_FPS, 1)) {
+        SDL_AddCamera("Dummy camera", SDL_CAMERA_POSITION_UNKNOWN, add_data.num_specs, add_data.specs, &dummy_camera_handle);
+    }
+    SDL_free(add_data.specs);
 }
 
 static void DUMMYCAMERA_FreeDeviceHandle(SDL_Camera *device)
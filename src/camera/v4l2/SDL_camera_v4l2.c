@@ -620,6 +620,7 @@ static bool V4L2_OpenDevice(SDL_Camera *device, const SDL_CameraSpec *spec)
     }
 
     device->hidden->io = io;
+    device->reuses_frame_memory = (io == IO_METHOD_READ);  // read() fills the same buffer every time.
 
     device->hidden->buffers = SDL_calloc(device->hidden->nb_buffers, sizeof(*device->hidden->buffers));
     if (!device->hidden->buffers) {
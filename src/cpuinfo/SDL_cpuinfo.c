@@ -110,6 +110,7 @@
 #define CPU_HAS_ARM_SIMD (1 << 11)
 #define CPU_HAS_LSX      (1 << 12)
 #define CPU_HAS_LASX     (1 << 13)
+#define CPU_HAS_AVX512BW (1 << 14)
 
 #define CPU_CFG2      0x2
 #define CPU_CFG2_LSX  (1 << 6)
@@ -636,6 +637,28 @@ static int CPU_haveAVX512F(void)
 }
 #endif
 
+#ifdef __e2k__
+inline int
+CPU_haveAVX512BW(void)
+{
+    return 0;
+}
+#else
+static int CPU_haveAVX512BW(void)
+{
+    if (CPU_OSSavesZMM && (CPU_CPUIDMaxFunction >= 7)) {
+        int a, b, c, d;
+        (void)a;
+        (void)b;
+        (void)c;
+        (void)d; // compiler warnings...
+        cpuid(7, a, b, c, d);
+        return b & 0x40000000;
+    }
+    return 0;
+}
+#endif
+
 static int SDL_NumLogicalCPUCores = 0;
 
 int SDL_GetNumLogicalCPUCores(void)
@@ -965,6 +988,8 @@ static Uint32 SDLCALL SDL_CPUFeatureMaskFromHint(void)
                 spot_mask = CPU_HAS_AVX2;
             } else if (ref_string_equals("avx512f", spot, end)) {
                 spot_mask = CPU_HAS_AVX512F;
+            } else if (ref_string_equals("avx512bw", spot, end)) {
+                spot_mask = CPU_HAS_AVX512BW;
             } else if (ref_string_equals("arm-simd", spot, end)) {
                 spot_mask = CPU_HAS_ARM_SIMD;
             } else if (ref_string_equals("neon", spot, end)) {
@@ -1033,6 +1058,9 @@ static Uint32 SDL_GetCPUFeatures(void)
             SDL_CPUFeatures |= CPU_HAS_AVX512F;
             SDL_SIMDAlignment = SDL_max(SDL_SIMDAlignment, 64);
         }
+        if (CPU_haveAVX512BW()) {
+            SDL_CPUFeatures |= CPU_HAS_AVX512BW;
+        }
         if (CPU_haveARMSIMD()) {
             SDL_CPUFeatures |= CPU_HAS_ARM_SIMD;
             SDL_SIMDAlignment = SDL_max(SDL_SIMDAlignment, 16);
@@ -1110,6 +1138,11 @@ bool SDL_HasAVX512F(void)
     return CPU_FEATURE_AVAILABLE(CPU_HAS_AVX512F);
 }
 
+bool SDL_HasAVX512BW(void)
+{
+    return CPU_FEATURE_AVAILABLE(CPU_HAS_AVX512BW);
+}
+
 bool SDL_HasARMSIMD(void)
 {
     return CPU_FEATURE_AVAILABLE(CPU_HAS_ARM_SIMD);
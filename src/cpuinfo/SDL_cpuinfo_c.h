@@ -24,4 +24,7 @@
 
 extern void SDL_QuitCPUInfo(void);
 
+// AVX-512BW isn't part of the public API yet, the blitters use it internally
+extern bool SDL_HasAVX512BW(void);
+
 #endif // SDL_cpuinfo_c_h_
@@ -1279,3 +1279,25 @@
 #define SDL_SetAudioIterationCallbacks SDL_SetAudioIterationCallbacks_REAL
 #define SDL_GetEventDescription SDL_GetEventDescription_REAL
 #define SDL_PutAudioStreamDataNoCopy SDL_PutAudioStreamDataNoCopy_REAL
+#define SDL_GetAudioDeviceProperties SDL_GetAudioDeviceProperties_REAL
+#define SDL_CreateAudioStreamWithProperties SDL_CreateAudioStreamWithProperties_REAL
+#define SDL_GetTimerProperties SDL_GetTimerProperties_REAL
+#define SDL_AcquireEvents SDL_AcquireEvents_REAL
+#define SDL_ReleaseEvents SDL_ReleaseEvents_REAL
+#define SDL_SetEventCoalescingEnabled SDL_SetEventCoalescingEnabled_REAL
+#define SDL_EventCoalescingEnabled SDL_EventCoalescingEnabled_REAL
+#define SDL_GetCoalescedEventCount SDL_GetCoalescedEventCount_REAL
+#define SDL_GetGPUPipelineCacheData SDL_GetGPUPipelineCacheData_REAL
+#define SDL_GetGamepadState SDL_GetGamepadState_REAL
+#define SDL_BeginAsyncIOBatch SDL_BeginAsyncIOBatch_REAL
+#define SDL_EndAsyncIOBatch SDL_EndAsyncIOBatch_REAL
+#define SDL_SetAsyncIOQueueBuffers SDL_SetAsyncIOQueueBuffers_REAL
+#define SDL_GetAsyncIOQueueProperties SDL_GetAsyncIOQueueProperties_REAL
+#define SDL_OpenAsyncIO SDL_OpenAsyncIO_REAL
+#define SDL_StatAsyncIO SDL_StatAsyncIO_REAL
+#define SDL_CreateJobCounter SDL_CreateJobCounter_REAL
+#define SDL_DestroyJobCounter SDL_DestroyJobCounter_REAL
+#define SDL_SubmitJob SDL_SubmitJob_REAL
+#define SDL_WaitJobCounter SDL_WaitJobCounter_REAL
+#define SDL_ParallelFor SDL_ParallelFor_REAL
+#define SDL_GetNumJobThreads SDL_GetNumJobThreads_REAL
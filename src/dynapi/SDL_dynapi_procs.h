@@ -1287,3 +1287,25 @@ SDL_DYNAPI_PROC(bool,SDL_PutAudioStreamPlanarData,(SDL_AudioStream *a,const void
 SDL_DYNAPI_PROC(bool,SDL_SetAudioIterationCallbacks,(SDL_AudioDeviceID a,SDL_AudioIterationCallback b,SDL_AudioIterationCallback c,void *d),(a,b,c,d),return)
 SDL_DYNAPI_PROC(int,SDL_GetEventDescription,(const SDL_Event *a,char *b,int c),(a,b,c),return)
 SDL_DYNAPI_PROC(bool,SDL_PutAudioStreamDataNoCopy,(SDL_AudioStream *a,const void *b,int c,SDL_AudioStreamDataCompleteCallback d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_GetAudioDeviceProperties,(SDL_AudioDeviceID a),(a),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_CreateAudioStreamWithProperties,(const SDL_AudioSpec *a,const SDL_AudioSpec *b,SDL_PropertiesID c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_GetTimerProperties,(void),(),return)
+SDL_DYNAPI_PROC(const SDL_Event*,SDL_AcquireEvents,(int *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_ReleaseEvents,(const SDL_Event *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_SetEventCoalescingEnabled,(Uint32 a,bool b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_EventCoalescingEnabled,(Uint32 a),(a),return)
+SDL_DYNAPI_PROC(Uint64,SDL_GetCoalescedEventCount,(Uint32 a),(a),return)
+SDL_DYNAPI_PROC(void*,SDL_GetGPUPipelineCacheData,(SDL_GPUDevice *a,size_t *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_GetGamepadState,(SDL_Gamepad *a,SDL_GamepadState *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_BeginAsyncIOBatch,(SDL_AsyncIOQueue *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_EndAsyncIOBatch,(SDL_AsyncIOQueue *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetAsyncIOQueueBuffers,(SDL_AsyncIOQueue *a,void * const*b,const size_t *c,int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_GetAsyncIOQueueProperties,(SDL_AsyncIOQueue *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_OpenAsyncIO,(const char *a,const char *b,SDL_AsyncIOQueue *c,void *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_StatAsyncIO,(SDL_AsyncIO *a,SDL_AsyncIOQueue *b,void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_JobCounter*,SDL_CreateJobCounter,(void),(),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobCounter,(SDL_JobCounter *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_SubmitJob,(SDL_JobFunction a,void *b,SDL_JobCounter *c,SDL_JobCounter *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_WaitJobCounter,(SDL_JobCounter *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_ParallelFor,(int a,int b,int c,SDL_ParallelForFunction d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(int,SDL_GetNumJobThreads,(void),(),return)
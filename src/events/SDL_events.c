@@ -135,6 +135,21 @@ typedef struct SDL_EventEntry
     struct SDL_EventEntry *next;
 } SDL_EventEntry;
 
+/* Events are pushed into a bounded lock-free ring, which any thread can add
+   to without taking the queue lock. Whoever holds the lock moves them from
+   the ring to the end of the linked list before looking at the queue, so the
+   list is always older than anything in the ring. If the ring fills up, the
+   event goes through the lock instead.
+ */
+#define SDL_EVENT_RING_SIZE 1024 // must be a power of two
+#define SDL_EVENT_RING_CLOSED 0x40000000
+
+typedef struct SDL_EventRingCell
+{
+    SDL_AtomicU32 sequence;
+    SDL_EventEntry entry;
+} SDL_EventRingCell;
+
 static struct
 {
     SDL_Mutex *lock;
@@ -144,7 +159,35 @@ static struct
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
-} SDL_EventQ = { NULL, false, { 0 }, 0, NULL, NULL, NULL };
+
+    // Lock-free producer side
+    SDL_AtomicInt producers; // threads adding events, plus SDL_EVENT_RING_CLOSED once we've shut down
+    SDL_EventRingCell *ring;
+    SDL_AtomicU32 ring_head;
+    Uint32 ring_tail; // only touched with the queue locked
+
+    // Events handed out by SDL_AcquireEvents()
+    SDL_Event *batch;
+    int batch_size;
+    bool batch_acquired;
+} SDL_EventQ = { NULL, false, { 0 }, 0, NULL, NULL, NULL, { SDL_EVENT_RING_CLOSED }, NULL, { 0 }, 0, NULL, 0, false };
+
+static void SDL_DrainEventRing(bool wait);
+
+// Event types that can be merged in the queue, see SDL_SetEventCoalescingEnabled()
+static const Uint32 SDL_coalescing_types[] = {
+    SDL_EVENT_MOUSE_MOTION,
+    SDL_EVENT_PEN_MOTION,
+    SDL_EVENT_FINGER_MOTION,
+    SDL_EVENT_JOYSTICK_AXIS_MOTION,
+    SDL_EVENT_GAMEPAD_AXIS_MOTION
+};
+static SDL_AtomicInt SDL_coalescing_enabled; // bitmask of SDL_coalescing_types
+static Uint64 SDL_coalesced_counts[SDL_arraysize(SDL_coalescing_types)]; // protected by the queue lock
+
+// How far back through a run of events of the same type we look for one to merge with
+#define SDL_MAX_COALESCING_LOOKBACK 16
+#define SDL_MIN_EVENT_BATCH_SIZE 128
 
 
 static void SDL_CleanupTemporaryMemory(void *data)
@@ -919,8 +962,18 @@ void SDL_StopEventLoop(void)
     int i;
     SDL_EventEntry *entry;
 
+    // Stop taking new events, and wait for anyone in the middle of adding one
+    if (!(SDL_GetAtomicInt(&SDL_EventQ.producers) & SDL_EVENT_RING_CLOSED)) {
+        SDL_AddAtomicInt(&SDL_EventQ.producers, SDL_EVENT_RING_CLOSED);
+    }
+    while (SDL_GetAtomicInt(&SDL_EventQ.producers) != SDL_EVENT_RING_CLOSED) {
+        SDL_DelayNS(0);
+    }
+
     SDL_LockMutex(SDL_EventQ.lock);
 
+    SDL_DrainEventRing(true);
+
     SDL_EventQ.active = false;
 
     if (report && SDL_atoi(report)) {
@@ -946,6 +999,14 @@ void SDL_StopEventLoop(void)
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
+    SDL_free(SDL_EventQ.ring);
+    SDL_EventQ.ring = NULL;
+    SDL_free(SDL_EventQ.batch);
+    SDL_EventQ.batch = NULL;
+    SDL_EventQ.batch_size = 0;
+    SDL_EventQ.batch_acquired = false;
+    SDL_SetAtomicInt(&SDL_coalescing_enabled, 0);
+    SDL_zeroa(SDL_coalesced_counts);
     SDL_SetAtomicInt(&SDL_sentinel_pending, 0);
 
     // Clear disabled event state
@@ -997,7 +1058,27 @@ bool SDL_StartEventLoop(void)
 
     SDL_InitWindowEventWatch();
 
+    if (!SDL_EventQ.ring) {
+        Uint32 i;
+
+        SDL_EventQ.ring = (SDL_EventRingCell *)SDL_calloc(SDL_EVENT_RING_SIZE, sizeof(*SDL_EventQ.ring));
+        if (!SDL_EventQ.ring) {
+#ifndef SDL_THREADS_DISABLED
+            SDL_UnlockMutex(SDL_EventQ.lock);
+#endif
+            return false;
+        }
+        for (i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+            SDL_SetAtomicU32(&SDL_EventQ.ring[i].sequence, i);
+        }
+        SDL_SetAtomicU32(&SDL_EventQ.ring_head, 0);
+        SDL_EventQ.ring_tail = 0;
+    }
+
     SDL_EventQ.active = true;
+    if (SDL_GetAtomicInt(&SDL_EventQ.producers) & SDL_EVENT_RING_CLOSED) {
+        SDL_AddAtomicInt(&SDL_EventQ.producers, -SDL_EVENT_RING_CLOSED);
+    }
 
 #ifndef SDL_THREADS_DISABLED
     SDL_UnlockMutex(SDL_EventQ.lock);
@@ -1005,58 +1086,289 @@ bool SDL_StartEventLoop(void)
     return true;
 }
 
-// Add an event to the event queue -- called with the queue locked
-static int SDL_AddEvent(SDL_Event *event)
+// Link an entry onto the end of the event list -- called with the queue locked
+static void SDL_AppendEventEntry(SDL_EventEntry *entry)
 {
-    SDL_EventEntry *entry;
-    const int initial_count = SDL_GetAtomicInt(&SDL_EventQ.count);
-    int final_count;
-
-    if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
-        SDL_SetError("Event queue is full (%d events)", initial_count);
-        return 0;
+    if (SDL_EventQ.tail) {
+        SDL_EventQ.tail->next = entry;
+        entry->prev = SDL_EventQ.tail;
+        SDL_EventQ.tail = entry;
+        entry->next = NULL;
+    } else {
+        SDL_assert(!SDL_EventQ.head);
+        SDL_EventQ.head = entry;
+        SDL_EventQ.tail = entry;
+        entry->prev = NULL;
+        entry->next = NULL;
     }
 
+    ++SDL_last_event_id;
+}
+
+static SDL_EventEntry *SDL_AllocEventEntry(void)
+{
+    SDL_EventEntry *entry;
+
     if (SDL_EventQ.free == NULL) {
         entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
-        if (entry == NULL) {
-            return 0;
-        }
     } else {
         entry = SDL_EventQ.free;
         SDL_EventQ.free = entry->next;
     }
+    return entry;
+}
+
+static int SDL_GetCoalescingIndex(Uint32 type)
+{
+    int i;
+
+    for (i = 0; i < SDL_arraysize(SDL_coalescing_types); ++i) {
+        if (SDL_coalescing_types[i] == type) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Returns the coalescing index for an event if events of its type are being merged, or -1
+static int SDL_ShouldCoalesceEvent(const SDL_Event *event)
+{
+    const int enabled = SDL_GetAtomicInt(&SDL_coalescing_enabled);
+    int index;
+
+    if (!enabled) {
+        return -1;
+    }
+    index = SDL_GetCoalescingIndex(event->type);
+    if (index < 0 || !(enabled & (1 << index))) {
+        return -1;
+    }
+    return index;
+}
+
+// Merge `event` into `queued` if they came from the same source
+static bool SDL_MergeEvent(SDL_Event *queued, const SDL_Event *event)
+{
+    switch (event->type) {
+    case SDL_EVENT_MOUSE_MOTION:
+        if (queued->motion.windowID != event->motion.windowID ||
+            queued->motion.which != event->motion.which ||
+            queued->motion.state != event->motion.state) {
+            return false;
+        }
+        queued->motion.x = event->motion.x;
+        queued->motion.y = event->motion.y;
+        queued->motion.xrel += event->motion.xrel;
+        queued->motion.yrel += event->motion.yrel;
+        break;
+    case SDL_EVENT_PEN_MOTION:
+        if (queued->pmotion.windowID != event->pmotion.windowID ||
+            queued->pmotion.which != event->pmotion.which ||
+            queued->pmotion.pen_state != event->pmotion.pen_state) {
+            return false;
+        }
+        queued->pmotion.x = event->pmotion.x;
+        queued->pmotion.y = event->pmotion.y;
+        break;
+    case SDL_EVENT_FINGER_MOTION:
+        if (queued->tfinger.windowID != event->tfinger.windowID ||
+            queued->tfinger.touchID != event->tfinger.touchID ||
+            queued->tfinger.fingerID != event->tfinger.fingerID) {
+            return false;
+        }
+        queued->tfinger.x = event->tfinger.x;
+        queued->tfinger.y = event->tfinger.y;
+        queued->tfinger.dx += event->tfinger.dx;
+        queued->tfinger.dy += event->tfinger.dy;
+        queued->tfinger.pressure = event->tfinger.pressure;
+        break;
+    case SDL_EVENT_JOYSTICK_AXIS_MOTION:
+        if (queued->jaxis.which != event->jaxis.which ||
+            queued->jaxis.axis != event->jaxis.axis) {
+            return false;
+        }
+        queued->jaxis.value = event->jaxis.value;
+        break;
+    case SDL_EVENT_GAMEPAD_AXIS_MOTION:
+        if (queued->gaxis.which != event->gaxis.which ||
+            queued->gaxis.axis != event->gaxis.axis) {
+            return false;
+        }
+        queued->gaxis.value = event->gaxis.value;
+        break;
+    default:
+        return false;
+    }
+
+    queued->common.timestamp = event->common.timestamp;
+    return true;
+}
+
+// Try to merge an event into the end of the event list -- called with the queue locked
+static bool SDL_CoalesceIntoList(const SDL_Event *event)
+{
+    const int index = SDL_ShouldCoalesceEvent(event);
+    SDL_EventEntry *entry;
+    int i;
+
+    if (index < 0) {
+        return false;
+    }
+
+    for (entry = SDL_EventQ.tail, i = 0; entry && entry->event.type == event->type && i < SDL_MAX_COALESCING_LOOKBACK; entry = entry->prev, ++i) {
+        if (SDL_MergeEvent(&entry->event, event)) {
+            ++SDL_coalesced_counts[index];
+            return true;
+        }
+    }
+    return false;
+}
+
+// Try to merge an event into the end of the SDL_AcquireEvents() batch -- called with the queue locked
+static bool SDL_CoalesceIntoBatch(const SDL_Event *event, int used)
+{
+    const int index = SDL_ShouldCoalesceEvent(event);
+    int i;
+
+    if (index < 0) {
+        return false;
+    }
+
+    for (i = used - 1; i >= 0 && SDL_EventQ.batch[i].type == event->type && i >= (used - SDL_MAX_COALESCING_LOOKBACK); --i) {
+        if (SDL_MergeEvent(&SDL_EventQ.batch[i], event)) {
+            ++SDL_coalesced_counts[index];
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Move events from the ring onto the end of the event list -- called with the queue locked
+
+   If `wait` is true, this waits for any events that other threads have
+   started adding, otherwise it stops at the first one that isn't finished.
+   While waiting it lets go of the queue lock, so nobody else has to wait
+   along with it, and the queue may have changed by the time it returns.
+ */
+static void SDL_DrainEventRing(bool wait)
+{
+    SDL_EventRingCell *ring = SDL_EventQ.ring;
+    const Uint32 head = SDL_GetAtomicU32(&SDL_EventQ.ring_head);
+    Uint32 tail = SDL_EventQ.ring_tail;
+    int count;
+
+    if (!ring) {
+        return;
+    }
+
+    while ((Sint32)(head - tail) > 0) {
+        SDL_EventRingCell *cell = &ring[tail & (SDL_EVENT_RING_SIZE - 1)];
+        SDL_EventEntry *entry;
+
+        if (SDL_GetAtomicU32(&cell->sequence) != (tail + 1)) {
+            // Another thread is still filling this in
+            if (!wait) {
+                break;
+            }
+            SDL_EventQ.ring_tail = tail;
+            SDL_UnlockMutex(SDL_EventQ.lock);
+            SDL_DelayNS(0);
+            SDL_LockMutex(SDL_EventQ.lock);
+            if (!SDL_EventQ.active || (SDL_EventQ.ring != ring)) {
+                return;  // the event loop stopped while we weren't looking
+            }
+            tail = SDL_EventQ.ring_tail;  // someone else might have drained the ring in the meantime
+            continue;
+        }
+
+        if (SDL_CoalesceIntoList(&cell->entry.event)) {
+            // Motion events don't carry any temporary memory, so there's nothing else to clean up
+            SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+        } else if ((entry = SDL_AllocEventEntry()) != NULL) {
+            SDL_copyp(&entry->event, &cell->entry.event);
+            entry->memory = cell->entry.memory;
+            SDL_AppendEventEntry(entry);
+        } else {
+            // Nowhere to put it, drop the event
+            SDL_TransferTemporaryMemoryFromEvent(&cell->entry);
+            if (cell->entry.event.type == SDL_EVENT_POLL_SENTINEL) {
+                SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
+            }
+            SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+        }
+
+        SDL_SetAtomicU32(&cell->sequence, tail + SDL_EVENT_RING_SIZE);
+        ++tail;
+    }
+    SDL_EventQ.ring_tail = tail;
+
+    count = SDL_GetAtomicInt(&SDL_EventQ.count);
+    if (count > SDL_EventQ.max_events_seen) {
+        SDL_EventQ.max_events_seen = count;
+    }
+}
+
+// Claim a slot in the ring, returns NULL if it's full
+static SDL_EventRingCell *SDL_ClaimEventRingCell(Uint32 *position)
+{
+    SDL_EventRingCell *ring = SDL_EventQ.ring;
+    Uint32 head = SDL_GetAtomicU32(&SDL_EventQ.ring_head);
+
+    for (;;) {
+        SDL_EventRingCell *cell = &ring[head & (SDL_EVENT_RING_SIZE - 1)];
+        const Sint32 diff = (Sint32)(SDL_GetAtomicU32(&cell->sequence) - head);
+
+        if (diff == 0) {
+            if (SDL_CompareAndSwapAtomicU32(&SDL_EventQ.ring_head, head, head + 1)) {
+                *position = head;
+                return cell;
+            }
+        } else if (diff < 0) {
+            return NULL;
+        }
+        head = SDL_GetAtomicU32(&SDL_EventQ.ring_head);
+    }
+}
+
+// Add an event to the event queue, returns -1 if the event queue has been shut down
+static int SDL_AddEvent(SDL_Event *event)
+{
+    SDL_EventRingCell *cell;
+    Uint32 position;
+
+    if (SDL_AddAtomicInt(&SDL_EventQ.producers, 1) & SDL_EVENT_RING_CLOSED) {
+        SDL_AddAtomicInt(&SDL_EventQ.producers, -1);
+        return -1;
+    }
+
+    if (SDL_AddAtomicInt(&SDL_EventQ.count, 1) >= SDL_MAX_QUEUED_EVENTS) {
+        const int count = SDL_AddAtomicInt(&SDL_EventQ.count, -1) - 1;
+        SDL_AddAtomicInt(&SDL_EventQ.producers, -1);
+        SDL_SetError("Event queue is full (%d events)", count);
+        return 0;
+    }
 
     if (SDL_EventLoggingVerbosity > 0) {
         SDL_LogEvent(event);
     }
 
-    SDL_copyp(&entry->event, event);
     if (event->type == SDL_EVENT_POLL_SENTINEL) {
         SDL_AddAtomicInt(&SDL_sentinel_pending, 1);
     }
-    entry->memory = NULL;
-    SDL_TransferTemporaryMemoryToEvent(entry);
 
-    if (SDL_EventQ.tail) {
-        SDL_EventQ.tail->next = entry;
-        entry->prev = SDL_EventQ.tail;
-        SDL_EventQ.tail = entry;
-        entry->next = NULL;
-    } else {
-        SDL_assert(!SDL_EventQ.head);
-        SDL_EventQ.head = entry;
-        SDL_EventQ.tail = entry;
-        entry->prev = NULL;
-        entry->next = NULL;
+    while ((cell = SDL_ClaimEventRingCell(&position)) == NULL) {
+        // The ring is full, move everything in it onto the event list to make room
+        SDL_LockMutex(SDL_EventQ.lock);
+        SDL_DrainEventRing(true);
+        SDL_UnlockMutex(SDL_EventQ.lock);
     }
 
-    final_count = SDL_AddAtomicInt(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
-    }
+    SDL_copyp(&cell->entry.event, event);
+    cell->entry.memory = NULL;
+    SDL_TransferTemporaryMemoryToEvent(&cell->entry);
+    SDL_SetAtomicU32(&cell->sequence, position + 1);
 
-    ++SDL_last_event_id;
+    SDL_AddAtomicInt(&SDL_EventQ.producers, -1);
 
     return 1;
 }
@@ -1116,9 +1428,30 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
 {
     int i, used, sentinels_expected = 0;
 
-    // Lock the event queue
     used = 0;
 
+    // Adding events doesn't need the lock
+    if (action == SDL_ADDEVENT) {
+        if (!events) {
+            return SDL_InvalidParamError("events");
+        }
+        for (i = 0; i < numevents; ++i) {
+            const int added = SDL_AddEvent(&events[i]);
+            if (added < 0) {
+                if (used == 0) {
+                    return -1;
+                }
+                break;
+            }
+            used += added;
+        }
+        if (used > 0) {
+            SDL_SendWakeupEvent();
+        }
+        return used;
+    }
+
+    // Lock the event queue
     SDL_LockMutex(SDL_EventQ.lock);
     {
         // Don't look after we've quit
@@ -1130,15 +1463,8 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
             SDL_UnlockMutex(SDL_EventQ.lock);
             return -1;
         }
-        if (action == SDL_ADDEVENT) {
-            if (!events) {
-                SDL_UnlockMutex(SDL_EventQ.lock);
-                return SDL_InvalidParamError("events");
-            }
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
-            }
-        } else {
+        SDL_DrainEventRing(false);
+        {
             SDL_EventEntry *entry, *next;
             Uint32 type;
 
@@ -1174,10 +1500,6 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
     }
     SDL_UnlockMutex(SDL_EventQ.lock);
 
-    if (used > 0 && action == SDL_ADDEVENT) {
-        SDL_SendWakeupEvent();
-    }
-
     return used;
 }
 int SDL_PeepEvents(SDL_Event *events, int numevents, SDL_EventAction action,
@@ -1198,6 +1520,7 @@ bool SDL_HasEvents(Uint32 minType, Uint32 maxType)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         if (SDL_EventQ.active) {
+            SDL_DrainEventRing(false);
             for (SDL_EventEntry *entry = SDL_EventQ.head; entry; entry = entry->next) {
                 const Uint32 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
@@ -1238,6 +1561,7 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
             SDL_UnlockMutex(SDL_EventQ.lock);
             return;
         }
+        SDL_DrainEventRing(true);
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -1501,6 +1825,151 @@ bool SDL_PollEvent(SDL_Event *event)
     return SDL_WaitEventTimeoutNS(event, 0);
 }
 
+// Make sure there's room for another event in the batch -- called with the queue locked
+static bool SDL_ReserveEventBatch(int used)
+{
+    if (used == SDL_EventQ.batch_size) {
+        const int batch_size = SDL_max(SDL_EventQ.batch_size * 2, SDL_MIN_EVENT_BATCH_SIZE);
+        SDL_Event *batch = (SDL_Event *)SDL_realloc(SDL_EventQ.batch, batch_size * sizeof(*batch));
+        if (!batch) {
+            return false;
+        }
+        SDL_EventQ.batch = batch;
+        SDL_EventQ.batch_size = batch_size;
+    }
+    return true;
+}
+
+// Give back the memory from a burst of events once the queue drains -- called with the queue locked
+static void SDL_ShrinkEventBatch(int used)
+{
+    int batch_size = SDL_EventQ.batch_size;
+
+    while (batch_size > SDL_MIN_EVENT_BATCH_SIZE && used < (batch_size / 4)) {
+        batch_size /= 2;
+    }
+    if (batch_size < SDL_EventQ.batch_size) {
+        SDL_Event *batch = (SDL_Event *)SDL_realloc(SDL_EventQ.batch, batch_size * sizeof(*batch));
+        if (batch) {
+            SDL_EventQ.batch = batch;
+            SDL_EventQ.batch_size = batch_size;
+        }
+    }
+}
+
+const SDL_Event *SDL_AcquireEvents(int *count)
+{
+    SDL_Event *events = NULL;
+    int used = 0;
+
+    if (!count) {
+        SDL_InvalidParamError("count");
+        return NULL;
+    }
+    *count = 0;
+
+    SDL_PumpEventsInternal(false);
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    {
+        SDL_EventEntry *entry, *next;
+        int taken;
+
+        if (!SDL_EventQ.active) {
+            SDL_SetError("The event system has been shut down");
+            goto done;
+        }
+        if (SDL_EventQ.batch_acquired) {
+            SDL_SetError("Events have already been acquired");
+            goto done;
+        }
+
+        /* Everything on the event list is older than the ring, so take that first.
+           We always take from the front, so unlink them all at once at the end. */
+        taken = 0;
+        for (entry = SDL_EventQ.head; entry; entry = next) {
+            next = entry->next;
+
+            if (entry->event.type == SDL_EVENT_POLL_SENTINEL) {
+                SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
+            } else {
+                if (!SDL_ReserveEventBatch(used)) {
+                    // Leave the rest for next time
+                    break;
+                }
+                SDL_copyp(&SDL_EventQ.batch[used], &entry->event);
+                ++used;
+            }
+            SDL_TransferTemporaryMemoryFromEvent(entry);
+
+            entry->next = SDL_EventQ.free;
+            SDL_EventQ.free = entry;
+            ++taken;
+        }
+        SDL_EventQ.head = entry;
+        if (entry) {
+            entry->prev = NULL;
+        } else {
+            SDL_EventQ.tail = NULL;
+        }
+
+        // Then copy finished events straight out of the ring, skipping the list
+        if (!entry && SDL_EventQ.ring) {
+            const Uint32 head = SDL_GetAtomicU32(&SDL_EventQ.ring_head);
+            Uint32 tail = SDL_EventQ.ring_tail;
+
+            while (tail != head) {
+                SDL_EventRingCell *cell = &SDL_EventQ.ring[tail & (SDL_EVENT_RING_SIZE - 1)];
+
+                if (SDL_GetAtomicU32(&cell->sequence) != (tail + 1)) {
+                    break;
+                }
+                if (cell->entry.event.type == SDL_EVENT_POLL_SENTINEL) {
+                    SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
+                } else if (!SDL_CoalesceIntoBatch(&cell->entry.event, used)) {
+                    if (!SDL_ReserveEventBatch(used)) {
+                        break;
+                    }
+                    SDL_copyp(&SDL_EventQ.batch[used], &cell->entry.event);
+                    ++used;
+                }
+                SDL_TransferTemporaryMemoryFromEvent(&cell->entry);
+
+                SDL_SetAtomicU32(&cell->sequence, tail + SDL_EVENT_RING_SIZE);
+                ++tail;
+                ++taken;
+            }
+            SDL_EventQ.ring_tail = tail;
+        }
+        SDL_AddAtomicInt(&SDL_EventQ.count, -taken);
+
+        SDL_ShrinkEventBatch(used);
+
+        if (used > 0) {
+            SDL_EventQ.batch_acquired = true;
+            events = SDL_EventQ.batch;
+        }
+    }
+done:
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    *count = used;
+    return events;
+}
+
+void SDL_ReleaseEvents(const SDL_Event *events)
+{
+    if (!events) {
+        return;
+    }
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    if (events == SDL_EventQ.batch) {
+        SDL_EventQ.batch_acquired = false;
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+}
+
 #ifndef SDL_PLATFORM_ANDROID
 
 static Sint64 SDL_events_get_polling_interval(void)
@@ -1765,6 +2234,7 @@ void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
             // Cut all events not accepted by the filter
             SDL_LockMutex(SDL_EventQ.lock);
             {
+                SDL_DrainEventRing(true);
                 for (event = SDL_EventQ.head; event; event = next) {
                     next = event->next;
                     if (!filter(userdata, &event->event)) {
@@ -1812,6 +2282,7 @@ void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing(true);
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -1895,6 +2366,48 @@ bool SDL_EventEnabled(Uint32 type)
     }
 }
 
+bool SDL_SetEventCoalescingEnabled(Uint32 type, bool enabled)
+{
+    const int index = SDL_GetCoalescingIndex(type);
+    int mask;
+
+    if (index < 0) {
+        return SDL_SetError("Events of type 0x%x can't be coalesced", type);
+    }
+
+    do {
+        mask = SDL_GetAtomicInt(&SDL_coalescing_enabled);
+    } while (!SDL_CompareAndSwapAtomicInt(&SDL_coalescing_enabled, mask, enabled ? (mask | (1 << index)) : (mask & ~(1 << index))));
+
+    return true;
+}
+
+bool SDL_EventCoalescingEnabled(Uint32 type)
+{
+    const int index = SDL_GetCoalescingIndex(type);
+
+    if (index < 0) {
+        return false;
+    }
+    return (SDL_GetAtomicInt(&SDL_coalescing_enabled) & (1 << index)) != 0;
+}
+
+Uint64 SDL_GetCoalescedEventCount(Uint32 type)
+{
+    const int index = SDL_GetCoalescingIndex(type);
+    Uint64 count;
+
+    if (index < 0) {
+        return 0;
+    }
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    count = SDL_coalesced_counts[index];
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    return count;
+}
+
 Uint32 SDL_RegisterEvents(int numevents)
 {
     Uint32 event_base = 0;
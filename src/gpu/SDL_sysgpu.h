@@ -624,6 +624,9 @@ struct SDL_GPUDevice
 
     SDL_PropertiesID (*GetDeviceProperties)(SDL_GPUDevice *device);
 
+    // Optional, NULL if the backend has no pipeline cache to share
+    void *(*GetPipelineCacheData)(SDL_GPURenderer *driverData, size_t *size);
+
     // State Creation
 
     SDL_GPUComputePipeline *(*CreateComputePipeline)(
@@ -58,6 +58,8 @@ typedef struct VulkanExtensions
     Uint8 KHR_portability_subset;
     // Only required for decoding HDR ASTC textures
     Uint8 EXT_texture_compression_astc_hdr;
+    // Core since 1.3, only used to count pipeline cache hits
+    Uint8 EXT_pipeline_creation_feedback;
 } VulkanExtensions;
 
 // Defines
@@ -1110,6 +1112,12 @@ struct VulkanRenderer
     VkPhysicalDeviceMemoryProperties memoryProperties;
     bool checkEmptyAllocations;
 
+    VkPipelineCache pipelineCache;
+    char *pipelineCacheFilename;
+    SDL_AtomicInt pipelinesCreated;
+    SDL_AtomicInt pipelineCacheHits;
+    SDL_AtomicInt pipelineCacheMisses;
+
     WindowData **claimedWindows;
     Uint32 claimedWindowCount;
     Uint32 claimedWindowCapacity;
@@ -4851,6 +4859,204 @@ static bool VULKAN_INTERNAL_EndCommandBuffer(
     return true;
 }
 
+// Pipeline cache
+
+static bool VULKAN_INTERNAL_IsPipelineCacheCompatible(
+    VulkanRenderer *renderer,
+    const void *data,
+    size_t size)
+{
+    const VkPhysicalDeviceProperties *properties = &renderer->physicalDeviceProperties.properties;
+    VkPipelineCacheHeaderVersionOne header;
+
+    if (size < sizeof(header)) {
+        return false;
+    }
+
+    // The header is always stored least significant byte first
+    SDL_memcpy(&header, data, sizeof(header));
+    header.headerSize = SDL_Swap32LE(header.headerSize);
+    header.headerVersion = (VkPipelineCacheHeaderVersion)SDL_Swap32LE((Uint32)header.headerVersion);
+    header.vendorID = SDL_Swap32LE(header.vendorID);
+    header.deviceID = SDL_Swap32LE(header.deviceID);
+
+    return header.headerSize >= sizeof(header) &&
+           header.headerSize <= size &&
+           header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           header.vendorID == properties->vendorID &&
+           header.deviceID == properties->deviceID &&
+           SDL_memcmp(header.pipelineCacheUUID, properties->pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+static void VULKAN_INTERNAL_CreatePipelineCache(
+    VulkanRenderer *renderer,
+    SDL_PropertiesID props)
+{
+    VkPipelineCacheCreateInfo createInfo;
+    const void *data;
+    void *fileData = NULL;
+    size_t size = 0;
+    VkResult vulkanResult;
+
+    const char *filename = SDL_GetStringProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_FILENAME_STRING, NULL);
+    if (filename && *filename) {
+        renderer->pipelineCacheFilename = SDL_strdup(filename);
+    }
+
+    data = SDL_GetPointerProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_DATA_POINTER, NULL);
+    if (data) {
+        size = (size_t)SDL_GetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_SIZE_NUMBER, 0);
+    } else if (renderer->pipelineCacheFilename) {
+        // A missing file just means there is nothing cached yet
+        fileData = SDL_LoadFile(renderer->pipelineCacheFilename, &size);
+        data = fileData;
+    }
+
+    if (data && !VULKAN_INTERNAL_IsPipelineCacheCompatible(renderer, data, size)) {
+        SDL_LogInfo(SDL_LOG_CATEGORY_GPU, "Vulkan: Pipeline cache data was created for a different device or driver, ignoring it");
+        data = NULL;
+    }
+
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.pNext = NULL;
+    createInfo.flags = 0;
+    createInfo.initialDataSize = data ? size : 0;
+    createInfo.pInitialData = data;
+
+    vulkanResult = renderer->vkCreatePipelineCache(
+        renderer->logicalDevice,
+        &createInfo,
+        NULL,
+        &renderer->pipelineCache);
+
+    if (vulkanResult != VK_SUCCESS && data) {
+        // The driver rejected the data after all, start with an empty cache
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = NULL;
+        vulkanResult = renderer->vkCreatePipelineCache(
+            renderer->logicalDevice,
+            &createInfo,
+            NULL,
+            &renderer->pipelineCache);
+    }
+
+    if (vulkanResult != VK_SUCCESS) {
+        // Pipelines can still be created without a cache
+        SDL_LogWarn(SDL_LOG_CATEGORY_GPU, "vkCreatePipelineCache %s", VkErrorMessages(vulkanResult));
+        renderer->pipelineCache = VK_NULL_HANDLE;
+    }
+
+    SDL_free(fileData);
+}
+
+static void *VULKAN_GetPipelineCacheData(
+    SDL_GPURenderer *driverData,
+    size_t *size)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VkResult vulkanResult;
+    size_t dataSize = 0;
+    void *data;
+
+    if (renderer->pipelineCache == VK_NULL_HANDLE) {
+        SET_STRING_ERROR_AND_RETURN("No pipeline cache available", NULL);
+    }
+
+    // The cache may grow between querying its size and copying it, which yields VK_INCOMPLETE, so ask again
+    for (;;) {
+        vulkanResult = renderer->vkGetPipelineCacheData(
+            renderer->logicalDevice,
+            renderer->pipelineCache,
+            &dataSize,
+            NULL);
+        CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkGetPipelineCacheData, NULL);
+
+        data = SDL_malloc(SDL_max(dataSize, 1));
+        if (!data) {
+            return NULL;
+        }
+
+        vulkanResult = renderer->vkGetPipelineCacheData(
+            renderer->logicalDevice,
+            renderer->pipelineCache,
+            &dataSize,
+            data);
+        if (vulkanResult == VK_SUCCESS) {
+            break;
+        }
+        SDL_free(data);
+        if (vulkanResult != VK_INCOMPLETE) {
+            CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkGetPipelineCacheData, NULL);
+        }
+    }
+
+    *size = dataSize;
+    return data;
+}
+
+static void VULKAN_INTERNAL_DestroyPipelineCache(
+    VulkanRenderer *renderer)
+{
+    if (renderer->pipelineCache != VK_NULL_HANDLE && renderer->pipelineCacheFilename) {
+        size_t size = 0;
+        void *data = VULKAN_GetPipelineCacheData((SDL_GPURenderer *)renderer, &size);
+        if (!data || !SDL_SaveFile(renderer->pipelineCacheFilename, data, size)) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_GPU, "Vulkan: Couldn't save pipeline cache to %s: %s", renderer->pipelineCacheFilename, SDL_GetError());
+        }
+        SDL_free(data);
+    }
+
+    if (renderer->pipelineCache != VK_NULL_HANDLE) {
+        renderer->vkDestroyPipelineCache(
+            renderer->logicalDevice,
+            renderer->pipelineCache,
+            NULL);
+    }
+    SDL_free(renderer->pipelineCacheFilename);
+}
+
+static void VULKAN_INTERNAL_InitPipelineCreationFeedback(
+    VulkanRenderer *renderer,
+    VkPipelineCreationFeedbackCreateInfoEXT *feedbackInfo,
+    VkPipelineCreationFeedbackEXT *feedback)
+{
+    feedback->flags = 0;
+    feedback->duration = 0;
+
+    feedbackInfo->sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT;
+    feedbackInfo->pNext = NULL;
+    feedbackInfo->pPipelineCreationFeedback = feedback;
+    feedbackInfo->pipelineStageCreationFeedbackCount = 0;
+    feedbackInfo->pPipelineStageCreationFeedbacks = NULL;
+}
+
+static void VULKAN_INTERNAL_RecordPipelineCreation(
+    VulkanRenderer *renderer,
+    const VkPipelineCreationFeedbackEXT *feedback)
+{
+    SDL_SetNumberProperty(
+        renderer->props,
+        SDL_PROP_GPU_DEVICE_PIPELINES_CREATED_NUMBER,
+        SDL_AtomicIncRef(&renderer->pipelinesCreated) + 1);
+
+    if (!renderer->supports.EXT_pipeline_creation_feedback ||
+        !(feedback->flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT)) {
+        return;
+    }
+
+    if (feedback->flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT) {
+        SDL_SetNumberProperty(
+            renderer->props,
+            SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_HITS_NUMBER,
+            SDL_AtomicIncRef(&renderer->pipelineCacheHits) + 1);
+    } else {
+        SDL_SetNumberProperty(
+            renderer->props,
+            SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_MISSES_NUMBER,
+            SDL_AtomicIncRef(&renderer->pipelineCacheMisses) + 1);
+    }
+}
+
 static void VULKAN_DestroyDevice(
     SDL_GPUDevice *device)
 {
@@ -4949,6 +5155,8 @@ static void VULKAN_DestroyDevice(
     SDL_DestroyMutex(renderer->descriptorSetLayoutFetchLock);
     SDL_DestroyMutex(renderer->windowLock);
 
+    VULKAN_INTERNAL_DestroyPipelineCache(renderer);
+
     renderer->vkDestroyDevice(renderer->logicalDevice, NULL);
     renderer->vkDestroyInstance(renderer->instance, NULL);
 
@@ -6228,6 +6436,8 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
 
     VulkanGraphicsPipeline *graphicsPipeline = (VulkanGraphicsPipeline *)SDL_malloc(sizeof(VulkanGraphicsPipeline));
     VkGraphicsPipelineCreateInfo vkPipelineCreateInfo;
+    VkPipelineCreationFeedbackCreateInfoEXT feedbackCreateInfo;
+    VkPipelineCreationFeedbackEXT feedback;
 
     VkPipelineShaderStageCreateInfo shaderStageCreateInfos[2];
 
@@ -6483,8 +6693,10 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
 
     // Pipeline
 
+    VULKAN_INTERNAL_InitPipelineCreationFeedback(renderer, &feedbackCreateInfo, &feedback);
+
     vkPipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    vkPipelineCreateInfo.pNext = NULL;
+    vkPipelineCreateInfo.pNext = renderer->supports.EXT_pipeline_creation_feedback ? &feedbackCreateInfo : NULL;
     vkPipelineCreateInfo.flags = 0;
     vkPipelineCreateInfo.stageCount = 2;
     vkPipelineCreateInfo.pStages = shaderStageCreateInfos;
@@ -6503,10 +6715,9 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
     vkPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
     vkPipelineCreateInfo.basePipelineIndex = 0;
 
-    // TODO: enable pipeline caching
     vulkanResult = renderer->vkCreateGraphicsPipelines(
         renderer->logicalDevice,
-        VK_NULL_HANDLE,
+        renderer->pipelineCache,
         1,
         &vkPipelineCreateInfo,
         NULL,
@@ -6526,6 +6737,8 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
         CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreateGraphicsPipelines, NULL);
     }
 
+    VULKAN_INTERNAL_RecordPipelineCreation(renderer, &feedback);
+
     SDL_SetAtomicInt(&graphicsPipeline->referenceCount, 0);
 
     if (renderer->debugMode && renderer->supportsDebugUtils && SDL_HasProperty(createinfo->props, SDL_PROP_GPU_GRAPHICSPIPELINE_CREATE_NAME_STRING)) {
@@ -6569,6 +6782,8 @@ static SDL_GPUComputePipeline *VULKAN_CreateComputePipeline(
 {
     VkShaderModuleCreateInfo shaderModuleCreateInfo;
     VkComputePipelineCreateInfo vkShaderCreateInfo;
+    VkPipelineCreationFeedbackCreateInfoEXT feedbackCreateInfo;
+    VkPipelineCreationFeedbackEXT feedback;
     VkPipelineShaderStageCreateInfo pipelineShaderStageCreateInfo;
     VkResult vulkanResult;
     VulkanRenderer *renderer = (VulkanRenderer *)driverData;
@@ -6621,8 +6836,10 @@ static SDL_GPUComputePipeline *VULKAN_CreateComputePipeline(
         return NULL;
     }
 
+    VULKAN_INTERNAL_InitPipelineCreationFeedback(renderer, &feedbackCreateInfo, &feedback);
+
     vkShaderCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
-    vkShaderCreateInfo.pNext = NULL;
+    vkShaderCreateInfo.pNext = renderer->supports.EXT_pipeline_creation_feedback ? &feedbackCreateInfo : NULL;
     vkShaderCreateInfo.flags = 0;
     vkShaderCreateInfo.stage = pipelineShaderStageCreateInfo;
     vkShaderCreateInfo.layout = vulkanComputePipeline->resourceLayout->pipelineLayout;
@@ -6631,7 +6848,7 @@ static SDL_GPUComputePipeline *VULKAN_CreateComputePipeline(
 
     vulkanResult = renderer->vkCreateComputePipelines(
         renderer->logicalDevice,
-        (VkPipelineCache)VK_NULL_HANDLE,
+        renderer->pipelineCache,
         1,
         &vkShaderCreateInfo,
         NULL,
@@ -6643,6 +6860,8 @@ static SDL_GPUComputePipeline *VULKAN_CreateComputePipeline(
         return NULL;
     }
 
+    VULKAN_INTERNAL_RecordPipelineCreation(renderer, &feedback);
+
     SDL_SetAtomicInt(&vulkanComputePipeline->referenceCount, 0);
 
     if (renderer->debugMode && renderer->supportsDebugUtils && SDL_HasProperty(createinfo->props, SDL_PROP_GPU_COMPUTEPIPELINE_CREATE_NAME_STRING)) {
@@ -10911,7 +11130,7 @@ static inline Uint8 CheckDeviceExtensions(
         supports->ext = 1;                   \
     }
         CHECK(KHR_swapchain)
-        else CHECK(KHR_maintenance1) else CHECK(KHR_driver_properties) else CHECK(KHR_portability_subset) else CHECK(EXT_texture_compression_astc_hdr)
+        else CHECK(KHR_maintenance1) else CHECK(KHR_driver_properties) else CHECK(KHR_portability_subset) else CHECK(EXT_texture_compression_astc_hdr) else CHECK(EXT_pipeline_creation_feedback)
 #undef CHECK
     }
 
@@ -10926,7 +11145,8 @@ static inline Uint32 GetDeviceExtensionCount(VulkanExtensions *supports)
         supports->KHR_maintenance1 +
         supports->KHR_driver_properties +
         supports->KHR_portability_subset +
-        supports->EXT_texture_compression_astc_hdr);
+        supports->EXT_texture_compression_astc_hdr +
+        supports->EXT_pipeline_creation_feedback);
 }
 
 static inline void CreateDeviceExtensionArray(
@@ -10943,6 +11163,7 @@ static inline void CreateDeviceExtensionArray(
     CHECK(KHR_driver_properties)
     CHECK(KHR_portability_subset)
     CHECK(EXT_texture_compression_astc_hdr)
+    CHECK(EXT_pipeline_creation_feedback)
 #undef CHECK
 }
 
@@ -11792,9 +12013,12 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
         SET_STRING_ERROR_AND_RETURN("Failed to create logical device!", NULL);
     }
 
+    VULKAN_INTERNAL_CreatePipelineCache(renderer, props);
+
     // FIXME: just move this into this function
-    result = (SDL_GPUDevice *)SDL_malloc(sizeof(SDL_GPUDevice));
+    result = (SDL_GPUDevice *)SDL_calloc(1, sizeof(SDL_GPUDevice));
     ASSIGN_DRIVER(VULKAN)
+    result->GetPipelineCacheData = VULKAN_GetPipelineCacheData;
 
     result->driverData = (SDL_GPURenderer *)renderer;
     result->shader_formats = SDL_GPU_SHADERFORMAT_SPIRV;
@@ -40,6 +40,37 @@ static const char *AsyncFileModeValid(const char *mode)
     return NULL;
 }
 
+static SDL_AsyncIO *CreateAsyncIO(void)
+{
+    SDL_AsyncIO *asyncio = (SDL_AsyncIO *)SDL_calloc(1, sizeof(*asyncio));
+    if (!asyncio) {
+        return NULL;
+    }
+
+    asyncio->lock = SDL_CreateMutex();
+    if (!asyncio->lock) {
+        SDL_free(asyncio);
+        return NULL;
+    }
+
+    return asyncio;
+}
+
+static void DestroyAsyncIO(SDL_AsyncIO *asyncio)
+{
+    if (asyncio->iface.destroy) {  // this is NULL if an async open failed.
+        asyncio->iface.destroy(asyncio->userdata);
+    }
+    SDL_DestroyMutex(asyncio->lock);
+    SDL_free(asyncio);
+}
+
+static void FreeAsyncIOTask(SDL_AsyncIOTask *task)
+{
+    SDL_free(task->file);
+    SDL_free(task);
+}
+
 SDL_AsyncIO *SDL_AsyncIOFromFile(const char *file, const char *mode)
 {
     if (!file) {
@@ -56,57 +87,90 @@ SDL_AsyncIO *SDL_AsyncIOFromFile(const char *file, const char *mode)
         return NULL;
     }
 
-    SDL_AsyncIO *asyncio = (SDL_AsyncIO *)SDL_calloc(1, sizeof(*asyncio));
+    SDL_AsyncIO *asyncio = CreateAsyncIO();
     if (!asyncio) {
         return NULL;
     }
 
-    asyncio->lock = SDL_CreateMutex();
-    if (!asyncio->lock) {
-        SDL_free(asyncio);
-        return NULL;
-    }
-
     if (!SDL_SYS_AsyncIOFromFile(file, binary_mode, asyncio)) {
-        SDL_DestroyMutex(asyncio->lock);
-        SDL_free(asyncio);
+        DestroyAsyncIO(asyncio);
         return NULL;
     }
 
     return asyncio;
 }
 
-Sint64 SDL_GetAsyncIOSize(SDL_AsyncIO *asyncio)
+static bool StartAsyncOpen(const char *file, const char *binary_mode, bool oneshot, SDL_AsyncIOQueue *queue, void *userdata)
 {
+    SDL_AsyncIO *asyncio = CreateAsyncIO();
     if (!asyncio) {
-        SDL_InvalidParamError("asyncio");
-        return -1;
-    }
-    return asyncio->iface.size(asyncio->userdata);
-}
-
-static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
-{
-    if (!asyncio) {
-        return SDL_InvalidParamError("asyncio");
-    } else if (!ptr) {
-        return SDL_InvalidParamError("ptr");
-    } else if (!queue) {
-        return SDL_InvalidParamError("queue");
+        return false;
     }
+    asyncio->oneshot = oneshot;
 
     SDL_AsyncIOTask *task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task));
     if (!task) {
+        DestroyAsyncIO(asyncio);
         return false;
     }
 
     task->asyncio = asyncio;
-    task->type = reading ? SDL_ASYNCIO_TASK_READ : SDL_ASYNCIO_TASK_WRITE;
-    task->offset = offset;
-    task->buffer = ptr;
-    task->requested_size = size;
+    task->type = SDL_ASYNCIO_TASK_OPEN;
+    task->file = SDL_strdup(file);  // the backend might need this after the app's string is gone.
+    task->mode = binary_mode;
     task->app_userdata = userdata;
     task->queue = queue;
+    if (!task->file) {
+        FreeAsyncIOTask(task);
+        DestroyAsyncIO(asyncio);
+        return false;
+    }
+
+    // nothing else can see this SDL_AsyncIO until the open completes, so no need to lock it here.
+    LINKED_LIST_PREPEND(task, asyncio->tasks, asyncio);
+    SDL_AddAtomicInt(&queue->tasks_inflight, 1);
+
+    if (!SDL_SYS_OpenAsyncIO(task)) {
+        SDL_AddAtomicInt(&queue->tasks_inflight, -1);
+        LINKED_LIST_UNLINK(task, asyncio);
+        FreeAsyncIOTask(task);
+        DestroyAsyncIO(asyncio);
+        return false;
+    }
+
+    return true;
+}
+
+bool SDL_OpenAsyncIO(const char *file, const char *mode, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    if (!file) {
+        return SDL_InvalidParamError("file");
+    } else if (!mode) {
+        return SDL_InvalidParamError("mode");
+    } else if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    const char *binary_mode = AsyncFileModeValid(mode);
+    if (!binary_mode) {
+        return SDL_SetError("Unsupported file mode");
+    }
+
+    return StartAsyncOpen(file, binary_mode, false, queue, userdata);
+}
+
+Sint64 SDL_GetAsyncIOSize(SDL_AsyncIO *asyncio)
+{
+    if (!asyncio) {
+        SDL_InvalidParamError("asyncio");
+        return -1;
+    }
+    return asyncio->iface.size(asyncio->userdata);
+}
+
+static bool QueueAsyncIOTask(SDL_AsyncIO *asyncio, SDL_AsyncIOTask *task)
+{
+    SDL_AsyncIOQueue *queue = task->queue;
 
     SDL_LockMutex(asyncio->lock);
     if (asyncio->closing) {
@@ -118,7 +182,14 @@ static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64
     SDL_AddAtomicInt(&queue->tasks_inflight, 1);
     SDL_UnlockMutex(asyncio->lock);
 
-    const bool queued = reading ? asyncio->iface.read(asyncio->userdata, task) : asyncio->iface.write(asyncio->userdata, task);
+    bool queued;
+    switch (task->type) {
+    case SDL_ASYNCIO_TASK_READ: queued = asyncio->iface.read(asyncio->userdata, task); break;
+    case SDL_ASYNCIO_TASK_WRITE: queued = asyncio->iface.write(asyncio->userdata, task); break;
+    case SDL_ASYNCIO_TASK_STAT: queued = asyncio->iface.stat(asyncio->userdata, task); break;
+    default: SDL_assert(!"Unexpected task type"); queued = SDL_SetError("Unexpected task type"); break;
+    }
+
     if (!queued) {
         SDL_AddAtomicInt(&queue->tasks_inflight, -1);
         SDL_LockMutex(asyncio->lock);
@@ -131,6 +202,32 @@ static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64
     return (task != NULL);
 }
 
+static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    if (!asyncio) {
+        return SDL_InvalidParamError("asyncio");
+    } else if (!ptr) {
+        return SDL_InvalidParamError("ptr");
+    } else if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    SDL_AsyncIOTask *task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task));
+    if (!task) {
+        return false;
+    }
+
+    task->asyncio = asyncio;
+    task->type = reading ? SDL_ASYNCIO_TASK_READ : SDL_ASYNCIO_TASK_WRITE;
+    task->offset = offset;
+    task->buffer = ptr;
+    task->requested_size = size;
+    task->app_userdata = userdata;
+    task->queue = queue;
+
+    return QueueAsyncIOTask(asyncio, task);
+}
+
 bool SDL_ReadAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
 {
     return RequestAsyncIO(true, asyncio, ptr, offset, size, queue, userdata);
@@ -141,6 +238,27 @@ bool SDL_WriteAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 siz
     return RequestAsyncIO(false, asyncio, ptr, offset, size, queue, userdata);
 }
 
+bool SDL_StatAsyncIO(SDL_AsyncIO *asyncio, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    if (!asyncio) {
+        return SDL_InvalidParamError("asyncio");
+    } else if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    SDL_AsyncIOTask *task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task));
+    if (!task) {
+        return false;
+    }
+
+    task->asyncio = asyncio;
+    task->type = SDL_ASYNCIO_TASK_STAT;
+    task->app_userdata = userdata;
+    task->queue = queue;
+
+    return QueueAsyncIOTask(asyncio, task);
+}
+
 bool SDL_CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue, void *userdata)
 {
     if (!asyncio) {
@@ -188,6 +306,7 @@ SDL_AsyncIOQueue *SDL_CreateAsyncIOQueue(void)
     SDL_AsyncIOQueue *queue = SDL_calloc(1, sizeof (*queue));
     if (queue) {
         SDL_SetAtomicInt(&queue->tasks_inflight, 0);
+        SDL_SetAtomicInt(&queue->batch_depth, 0);
         if (!SDL_SYS_CreateAsyncIOQueue(queue)) {
             SDL_free(queue);
             return NULL;
@@ -196,6 +315,50 @@ SDL_AsyncIOQueue *SDL_CreateAsyncIOQueue(void)
     return queue;
 }
 
+// SDL_LoadFileAsync runs as a chain of open, stat, read and close tasks, and only the read is reported to the app.
+// This starts the next step after an open or stat completes. Returns true if the load failed and `outcome` now reports that as its read.
+static bool ContinueLoadFileAsync(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *outcome)
+{
+    SDL_AsyncIO *asyncio = task->asyncio;
+    SDL_AsyncIOQueue *queue = task->queue;
+    void *userdata = task->app_userdata;
+
+    if (task->result == SDL_ASYNCIO_COMPLETE) {
+        if (task->type == SDL_ASYNCIO_TASK_OPEN) {
+            if (SDL_StatAsyncIO(asyncio, queue, userdata)) {
+                return false;
+            }
+        } else {
+            const Uint64 flen = task->result_size;
+            // !!! FIXME: check if flen > address space, since it'll truncate and we'll just end up with an incomplete buffer or a crash.
+            Uint8 *ptr = (Uint8 *) SDL_malloc((size_t) (flen + 1));  // over-allocate by one so we can add a null-terminator.
+            if (ptr) {
+                ptr[flen] = '\0';
+                if (SDL_ReadAsyncIO(asyncio, ptr, 0, flen, queue, userdata)) {
+                    SDL_CloseAsyncIO(asyncio, false, queue, userdata);  // this waits for the read to finish. If it fails, we'll have a resource leak, but this would already be a dramatic system failure.
+                    return false;
+                }
+                SDL_free(ptr);
+            }
+        }
+    }
+
+    outcome->asyncio = NULL;
+    outcome->type = SDL_ASYNCIO_TASK_READ;
+    outcome->result = (task->result == SDL_ASYNCIO_CANCELED) ? SDL_ASYNCIO_CANCELED : SDL_ASYNCIO_FAILURE;
+    outcome->buffer = NULL;
+    outcome->offset = 0;
+    outcome->bytes_requested = 0;
+    outcome->bytes_transferred = 0;
+    outcome->userdata = userdata;
+
+    if ((task->type == SDL_ASYNCIO_TASK_STAT) || (task->result == SDL_ASYNCIO_COMPLETE)) {
+        // the file did open (even if the stat after it couldn't be queued), so close it. This task isn't reported to the app either.
+        SDL_CloseAsyncIO(asyncio, false, queue, userdata);
+    }
+    return true;
+}
+
 static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *outcome)
 {
     if (!task || !outcome) {
@@ -203,9 +366,14 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     }
 
     SDL_AsyncIO *asyncio = task->asyncio;
+    const bool opened = (task->type == SDL_ASYNCIO_TASK_OPEN) && (task->result == SDL_ASYNCIO_COMPLETE);
 
     SDL_zerop(outcome);
-    outcome->asyncio = asyncio->oneshot ? NULL : asyncio;
+    if (task->type == SDL_ASYNCIO_TASK_OPEN) {
+        outcome->asyncio = (opened && !asyncio->oneshot) ? asyncio : NULL;
+    } else {
+        outcome->asyncio = asyncio->oneshot ? NULL : asyncio;
+    }
     outcome->result = task->result;
     outcome->type = task->type;
     outcome->buffer = task->buffer;
@@ -230,19 +398,21 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     }
     SDL_UnlockMutex(task->asyncio->lock);
 
-    // was this the result of a closing task? Finally destroy the asyncio.
     bool retval = true;
-    if (closing && (task == closing)) {
-        if (asyncio->oneshot) {
+    if (asyncio->oneshot && ((task->type == SDL_ASYNCIO_TASK_OPEN) || (task->type == SDL_ASYNCIO_TASK_STAT))) {
+        retval = ContinueLoadFileAsync(task, outcome);
+    }
+
+    // was this the result of a closing task, or a failed open? Finally destroy the asyncio.
+    if ((closing && (task == closing)) || ((task->type == SDL_ASYNCIO_TASK_OPEN) && !opened)) {
+        if (asyncio->oneshot && (task == closing)) {
             retval = false;  // don't send the close task results on to the app, just the read task for these.
         }
-        asyncio->iface.destroy(asyncio->userdata);
-        SDL_DestroyMutex(asyncio->lock);
-        SDL_free(asyncio);
+        DestroyAsyncIO(asyncio);
     }
 
     SDL_AddAtomicInt(&task->queue->tasks_inflight, -1);
-    SDL_free(task);
+    FreeAsyncIOTask(task);
 
     return retval;
 }
@@ -252,7 +422,15 @@ bool SDL_GetAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
     if (!queue || !outcome) {
         return false;
     }
-    return GetAsyncIOTaskOutcome(queue->iface.get_results(queue->userdata), outcome);
+
+    // keep going past tasks that aren't reported to the app, like the steps of SDL_LoadFileAsync.
+    SDL_AsyncIOTask *task;
+    while ((task = queue->iface.get_results(queue->userdata)) != NULL) {
+        if (GetAsyncIOTaskOutcome(task, outcome)) {
+            return true;
+        }
+    }
+    return false;
 }
 
 bool SDL_WaitAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome, Sint32 timeoutMS)
@@ -260,7 +438,23 @@ bool SDL_WaitAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome,
     if (!queue || !outcome) {
         return false;
     }
-    return GetAsyncIOTaskOutcome(queue->iface.wait_results(queue->userdata, timeoutMS), outcome);
+
+    // keep waiting past tasks that aren't reported to the app, like the steps of SDL_LoadFileAsync, until the timeout runs out.
+    const Uint64 start = SDL_GetTicks();
+    Sint32 remaining = timeoutMS;
+    for (;;) {
+        SDL_AsyncIOTask *task = queue->iface.wait_results(queue->userdata, remaining);
+        if (!task) {
+            return false;
+        } else if (GetAsyncIOTaskOutcome(task, outcome)) {
+            return true;
+        }
+
+        if (timeoutMS > 0) {
+            const Uint64 elapsed = SDL_GetTicks() - start;
+            remaining = (elapsed >= (Uint64) timeoutMS) ? 0 : (Sint32) (timeoutMS - elapsed);
+        }
+    }
 }
 
 void SDL_SignalAsyncIOQueue(SDL_AsyncIOQueue *queue)
@@ -270,6 +464,73 @@ void SDL_SignalAsyncIOQueue(SDL_AsyncIOQueue *queue)
     }
 }
 
+// batch nesting is tracked here, so every backend rejects an unmatched end the same way, and backends only hear about the outermost batch ending.
+bool SDL_BeginAsyncIOBatch(SDL_AsyncIOQueue *queue)
+{
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+    SDL_AddAtomicInt(&queue->batch_depth, 1);
+    return true;
+}
+
+bool SDL_EndAsyncIOBatch(SDL_AsyncIOQueue *queue)
+{
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    int depth;
+    do {
+        depth = SDL_GetAtomicInt(&queue->batch_depth);
+        if (depth <= 0) {
+            return SDL_SetError("No async I/O batch in progress");
+        }
+    } while (!SDL_CompareAndSwapAtomicInt(&queue->batch_depth, depth, depth - 1));
+
+    if (depth > 1) {
+        return true;  // still inside an outer batch.
+    }
+    return queue->iface.end_batch ? queue->iface.end_batch(queue->userdata) : true;
+}
+
+bool SDL_SetAsyncIOQueueBuffers(SDL_AsyncIOQueue *queue, void * const *buffers, const size_t *sizes, int num_buffers)
+{
+    if (!queue) {
+        return SDL_InvalidParamError("queue");
+    } else if (num_buffers < 0) {
+        return SDL_InvalidParamError("num_buffers");
+    } else if (num_buffers > 0 && !buffers) {
+        return SDL_InvalidParamError("buffers");
+    } else if (num_buffers > 0 && !sizes) {
+        return SDL_InvalidParamError("sizes");
+    }
+    return queue->iface.set_buffers ? queue->iface.set_buffers(queue->userdata, buffers, sizes, num_buffers) : true;
+}
+
+SDL_PropertiesID SDL_GetAsyncIOQueueProperties(SDL_AsyncIOQueue *queue)
+{
+    if (!queue) {
+        SDL_InvalidParamError("queue");
+        return 0;
+    }
+
+    SDL_PropertiesID props = SDL_GetAtomicU32(&queue->props);
+    if (!props) {
+        props = SDL_CreateProperties();
+        if (!SDL_CompareAndSwapAtomicU32(&queue->props, 0, props)) {
+            // another thread got here first, use its properties.
+            SDL_DestroyProperties(props);
+            props = SDL_GetAtomicU32(&queue->props);
+        }
+    }
+
+    if (props && queue->iface.update_properties) {
+        queue->iface.update_properties(queue->userdata, props);
+    }
+    return props;
+}
+
 void SDL_DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue)
 {
     if (queue) {
@@ -287,6 +548,7 @@ void SDL_DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue)
         }
 
         queue->iface.destroy(queue->userdata);
+        SDL_DestroyProperties(SDL_GetAtomicU32(&queue->props));
         SDL_free(queue);
     }
 }
@@ -304,28 +566,7 @@ bool SDL_LoadFileAsync(const char *file, SDL_AsyncIOQueue *queue, void *userdata
         return SDL_InvalidParamError("queue");
     }
 
-    bool retval = false;
-    SDL_AsyncIO *asyncio = SDL_AsyncIOFromFile(file, "r");
-    if (asyncio) {
-        asyncio->oneshot = true;
-
-        Uint8 *ptr = NULL;
-        const Sint64 flen = SDL_GetAsyncIOSize(asyncio);
-        if (flen >= 0) {
-            // !!! FIXME: check if flen > address space, since it'll truncate and we'll just end up with an incomplete buffer or a crash.
-            ptr = (Uint8 *) SDL_malloc((size_t) (flen + 1));  // over-allocate by one so we can add a null-terminator.
-            if (ptr) {
-                ptr[flen] = '\0';
-                retval = SDL_ReadAsyncIO(asyncio, ptr, 0, (Uint64) flen, queue, userdata);
-                if (!retval) {
-                    SDL_free(ptr);
-                }
-            }
-        }
-
-        SDL_CloseAsyncIO(asyncio, false, queue, userdata);  // if this fails, we'll have a resource leak, but this would already be a dramatic system failure.
-    }
-
-    return retval;
+    // this only starts the open; GetAsyncIOTaskOutcome starts the stat, read and close as each step completes.
+    return StartAsyncOpen(file, AsyncFileModeValid("r"), true, queue, userdata);
 }
 
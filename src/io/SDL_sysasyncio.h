@@ -81,6 +81,11 @@ struct SDL_AsyncIOTask
     Uint64 requested_size;
     Uint64 result_size;
     void *app_userdata;
+    int pending_chunks;  // the io_uring backend splits huge reads and writes into several operations, and counts them here.
+    char *file;  // the path to open, for SDL_ASYNCIO_TASK_OPEN tasks. Freed with the task.
+    const char *mode;  // the open mode for SDL_ASYNCIO_TASK_OPEN tasks, always one of the "binary" strings from AsyncFileModeValid.
+    void *sysdata;  // backends can keep memory the operating system writes to here, like a stat buffer. The backend frees it.
+    void (*threadpool_work)(SDL_AsyncIOTask *task);  // set by SDL_SYS_QueueThreadpoolTask_Generic, for a task another backend gave to the generic threadpool.
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, asyncio);
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, queue);      // the generic backend uses this, so I've added it here to avoid the extra allocation.
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, threadpool); // the generic backend uses this, so I've added it here to avoid the extra allocation.
@@ -94,6 +99,10 @@ typedef struct SDL_AsyncIOQueueInterface
     SDL_AsyncIOTask * (*wait_results)(void *userdata, Sint32 timeoutMS);
     void (*signal)(void *userdata);
     void (*destroy)(void *userdata);
+    // these are optional, and can be NULL if the backend can't batch, use preregistered buffers, or count its syscalls.
+    bool (*end_batch)(void *userdata);  // called when the outermost batch ends; backends that hold tasks back check SDL_AsyncIOQueue::batch_depth.
+    bool (*set_buffers)(void *userdata, void * const *buffers, const size_t *sizes, int num_buffers);
+    void (*update_properties)(void *userdata, SDL_PropertiesID props);
 } SDL_AsyncIOQueueInterface;
 
 struct SDL_AsyncIOQueue
@@ -101,6 +110,8 @@ struct SDL_AsyncIOQueue
     SDL_AsyncIOQueueInterface iface;
     void *userdata;
     SDL_AtomicInt tasks_inflight;
+    SDL_AtomicInt batch_depth;  // nesting level of SDL_BeginAsyncIOBatch; tasks may be held back while this is > 0.
+    SDL_AtomicU32 props;
 };
 
 // this interface is kept per-object, even though generally it's going to decide
@@ -114,6 +125,7 @@ typedef struct SDL_AsyncIOInterface
     bool (*write)(void *userdata, SDL_AsyncIOTask *task);
     bool (*close)(void *userdata, SDL_AsyncIOTask *task);
     void (*destroy)(void *userdata);
+    bool (*stat)(void *userdata, SDL_AsyncIOTask *task);  // completes with the file size in task->result_size.
 } SDL_AsyncIOInterface;
 
 struct SDL_AsyncIO
@@ -129,6 +141,10 @@ struct SDL_AsyncIO
 // This is implemented for various platforms; param validation is done before calling this. Open file, fill in iface and userdata.
 extern bool SDL_SYS_AsyncIOFromFile(const char *file, const char *mode, SDL_AsyncIO *asyncio);
 
+// This is implemented for various platforms. Start opening task->file in the background; when the task lands in task->queue, task->asyncio's iface
+// and userdata are filled in if task->result is SDL_ASYNCIO_COMPLETE, and left zeroed otherwise.
+extern bool SDL_SYS_OpenAsyncIO(SDL_AsyncIOTask *task);
+
 // This is implemented for various platforms. Call SDL_OpenAsyncIOQueue from in here.
 extern bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue);
 
@@ -137,8 +153,14 @@ extern void SDL_SYS_QuitAsyncIO(void);
 
 // the "generic" version is always available, since it is almost always needed as a fallback even on platforms that might offer something better.
 extern bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_AsyncIO *asyncio);
+extern bool SDL_SYS_OpenAsyncIO_Generic(SDL_AsyncIOTask *task);
 extern bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue);
 extern void SDL_SYS_QuitAsyncIO_Generic(void);
 
+// Backends can hand tasks they can't do themselves (like opening a file) to the generic backend's threadpool. `work` runs on a
+// threadpool thread, does the task, and delivers it to the task's queue. If the task's result isn't SDL_ASYNCIO_COMPLETE when
+// `work` is called, the task was canceled or couldn't run, and `work` should only deliver it.
+extern bool SDL_SYS_QueueThreadpoolTask_Generic(SDL_AsyncIOTask *task, void (*work)(SDL_AsyncIOTask *task));
+
 #endif
 
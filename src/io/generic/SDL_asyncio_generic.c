@@ -52,6 +52,11 @@ typedef struct GenericAsyncIOData
 
 static void AsyncIOTaskComplete(SDL_AsyncIOTask *task)
 {
+    if (task->threadpool_work) {  // another backend's task; it gets to that backend's queue its own way.
+        task->threadpool_work(task);
+        return;
+    }
+
     SDL_assert(task->queue);
     GenericAsyncIOQueueData *data = (GenericAsyncIOQueueData *) task->queue->userdata;
     SDL_LockMutex(data->lock);
@@ -62,10 +67,23 @@ static void AsyncIOTaskComplete(SDL_AsyncIOTask *task)
 
 // synchronous i/o is offloaded onto the threadpool. This function does the threaded work.
 // This is called directly, without a threadpool, if !SDL_ASYNCIO_USE_THREADPOOL.
+static bool OpenGenericAsyncIO(const char *file, const char *mode, SDL_AsyncIO *asyncio);
+
 static void SynchronousIO(SDL_AsyncIOTask *task)
 {
     SDL_assert(task->result != SDL_ASYNCIO_CANCELED);  // shouldn't have gotten in here if canceled!
 
+    if (task->threadpool_work) {  // another backend's task, which knows how to do its own work.
+        task->threadpool_work(task);
+        return;
+    }
+
+    if (task->type == SDL_ASYNCIO_TASK_OPEN) {  // there's no file to lock yet, this creates it.
+        task->result = OpenGenericAsyncIO(task->file, task->mode, task->asyncio) ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+        AsyncIOTaskComplete(task);
+        return;
+    }
+
     GenericAsyncIOData *data = (GenericAsyncIOData *) task->asyncio->userdata;
     SDL_IOStream *io = data->io;
     const size_t size = (size_t) task->requested_size;
@@ -82,6 +100,14 @@ static void SynchronousIO(SDL_AsyncIOTask *task)
         }
         okay = SDL_CloseIO(data->io) && okay;
         task->result = okay ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+    } else if (task->type == SDL_ASYNCIO_TASK_STAT) {
+        const Sint64 len = SDL_GetIOSize(io);
+        if (len < 0) {
+            task->result = SDL_ASYNCIO_FAILURE;
+        } else {
+            task->result_size = (Uint64) len;
+            task->result = SDL_ASYNCIO_COMPLETE;
+        }
     } else if (SDL_SeekIO(io, (Sint64) task->offset, SDL_IO_SEEK_SET) < 0) {
         task->result = SDL_ASYNCIO_FAILURE;
     } else {
@@ -106,52 +132,132 @@ static void SynchronousIO(SDL_AsyncIOTask *task)
 }
 
 #if SDL_ASYNCIO_USE_THREADPOOL
+// Each worker thread has its own list of pending tasks, so starting a task only locks one worker, and a worker that runs out
+// of tasks steals from the others before it goes to sleep. Tasks run oldest first, from a worker's own list and when stolen,
+// so a burst of new work can't starve older requests. Each worker sleeps on its own semaphore, so a new task wakes one thread.
+typedef struct AsyncIOWorker
+{
+    SDL_Mutex *lock;  // protects `tasks`, `last_task` and `running`.
+    SDL_AsyncIOTask tasks;  // pending tasks, oldest first.
+    SDL_AsyncIOTask *last_task;  // the newest pending task, so new ones can go after it. NULL if there are none.
+    bool running;  // false if no thread is using this worker right now.
+    SDL_AtomicInt idle;  // 1 while the thread sleeps. Whoever changes it back to 0 must signal `wakeup`.
+    SDL_Semaphore *wakeup;
+} AsyncIOWorker;
+
 static SDL_InitState threadpool_init;
-static SDL_Mutex *threadpool_lock = NULL;
-static bool stop_threadpool = false;
-static SDL_AsyncIOTask threadpool_tasks;
+static SDL_Mutex *threadpool_lock = NULL;  // this is only for starting and stopping threads, not for starting tasks.
 static SDL_Condition *threadpool_condition = NULL;
+static AsyncIOWorker *threadpool_workers = NULL;
+static SDL_AtomicInt stop_threadpool;
+static SDL_AtomicInt next_threadpool_worker;  // new tasks go to each worker in turn.
 static int max_threadpool_threads = 0;
 static int running_threadpool_threads = 0;
-static int idle_threadpool_threads = 0;
 static int threadpool_threads_spun = 0;
 
-static int SDLCALL AsyncIOThreadpoolWorker(void *data)
+// you must hold worker->lock when calling this!
+static void AppendWorkerTask(AsyncIOWorker *worker, SDL_AsyncIOTask *task)
 {
-    SDL_LockMutex(threadpool_lock);
+    SDL_AsyncIOTask *last = worker->last_task ? worker->last_task : &worker->tasks;
+    task->threadpoolprev = last;
+    task->threadpoolnext = NULL;
+    last->threadpoolnext = task;
+    worker->last_task = task;
+}
 
-    while (!stop_threadpool) {
-        SDL_AsyncIOTask *task = LINKED_LIST_START(threadpool_tasks, threadpool);
-        if (!task) {
-            // if we go 30 seconds without a new task, terminate unless we're the only thread left.
-            idle_threadpool_threads++;
-            const bool rc = SDL_WaitConditionTimeout(threadpool_condition, threadpool_lock, 30000);
-            idle_threadpool_threads--;
-
-            if (!rc) {
-                // decide if we have too many idle threads, and if so, quit to let thread pool shrink when not busy.
-                if (idle_threadpool_threads) {
-                    break;
-                }
-            }
+// you must hold worker->lock when calling this!
+static void RemoveWorkerTask(AsyncIOWorker *worker, SDL_AsyncIOTask *task)
+{
+    if (worker->last_task == task) {
+        worker->last_task = (task->threadpoolprev == &worker->tasks) ? NULL : task->threadpoolprev;
+    }
+    LINKED_LIST_UNLINK(task, threadpool);
+}
 
-            continue;
+static SDL_AsyncIOTask *TakeOldestWorkerTask(AsyncIOWorker *worker)
+{
+    SDL_LockMutex(worker->lock);
+    SDL_AsyncIOTask *task = LINKED_LIST_START(worker->tasks, threadpool);
+    if (task) {
+        RemoveWorkerTask(worker, task);
+    }
+    SDL_UnlockMutex(worker->lock);
+    return task;
+}
+
+// check our own tasks first, then steal from the other workers.
+static SDL_AsyncIOTask *FindThreadpoolTask(int index)
+{
+    for (int i = 0; i < max_threadpool_threads; i++) {
+        SDL_AsyncIOTask *task = TakeOldestWorkerTask(&threadpool_workers[(index + i) % max_threadpool_threads]);
+        if (task) {
+            return task;
         }
+    }
+    return NULL;
+}
 
-        LINKED_LIST_UNLINK(task, threadpool);
+// call this after marking a worker idle but before sleeping; it returns false if something else is already waking the worker.
+static bool StopIdling(AsyncIOWorker *worker)
+{
+    if (!SDL_CompareAndSwapAtomicInt(&worker->idle, 1, 0)) {
+        SDL_WaitSemaphore(worker->wakeup);  // someone changed `idle` first, so a signal is coming. Eat it so the next sleep doesn't end early.
+        return false;
+    }
+    return true;
+}
 
-        SDL_UnlockMutex(threadpool_lock);
+static int SDLCALL AsyncIOThreadpoolWorker(void *data)
+{
+    const int index = (int) (intptr_t) data;
+    AsyncIOWorker *worker = &threadpool_workers[index];
 
-        // bookkeeping is done, so we drop the mutex and fire the work.
-        SynchronousIO(task);
+    while (!SDL_GetAtomicInt(&stop_threadpool)) {
+        SDL_AsyncIOTask *task = FindThreadpoolTask(index);
+        if (!task) {
+            // mark ourselves idle _before_ looking one last time, so anything that starts a task after this look will see we need waking.
+            SDL_CompareAndSwapAtomicInt(&worker->idle, 0, 1);
+            task = FindThreadpoolTask(index);
+            if (task || SDL_GetAtomicInt(&stop_threadpool)) {
+                StopIdling(worker);
+            } else if (SDL_WaitSemaphoreTimeout(worker->wakeup, 30000)) {
+                continue;  // whoever woke us already cleared `idle`. Go look for the new task.
+            } else if (StopIdling(worker)) {
+                // if we go 30 seconds without a new task, terminate unless we're the only thread left.
+                // we stop counting ourselves in the same critical section that decides to quit, so threads timing out together can't all see someone else left running.
+                bool quit = false;
+                SDL_LockMutex(threadpool_lock);
+                if (running_threadpool_threads > 1) {
+                    SDL_LockMutex(worker->lock);
+                    if (LINKED_LIST_START(worker->tasks, threadpool) == NULL) {
+                        worker->running = false;  // nothing adds tasks to a worker that isn't running, so we can go.
+                        quit = true;
+                    }
+                    SDL_UnlockMutex(worker->lock);
+                }
+                if (quit) {
+                    running_threadpool_threads--;
+                    if (SDL_GetAtomicInt(&stop_threadpool)) {
+                        SDL_BroadcastCondition(threadpool_condition);
+                    }
+                }
+                SDL_UnlockMutex(threadpool_lock);
+                if (quit) {
+                    return 0;  // don't touch anything else; once we're uncounted, shutdown won't wait for us.
+                }
+            }
+        }
 
-        SDL_LockMutex(threadpool_lock);  // take the lock again and see if there's another task (if not, we'll wait on the Condition).
+        if (task) {
+            SynchronousIO(task);
+        }
     }
 
+    SDL_LockMutex(threadpool_lock);
     running_threadpool_threads--;
 
     // this is kind of a hack, but this lets us reuse threadpool_condition to block on shutdown until all threads have exited.
-    if (stop_threadpool) {
+    if (SDL_GetAtomicInt(&stop_threadpool)) {
         SDL_BroadcastCondition(threadpool_condition);
     }
 
@@ -160,44 +266,136 @@ static int SDLCALL AsyncIOThreadpoolWorker(void *data)
     return 0;
 }
 
-static bool MaybeSpinNewWorkerThread(void)
+// you must hold threadpool_lock when calling this! Returns the index of the new thread's worker, or -1.
+static int SpinNewWorkerThread(void)
 {
-    // if all existing threads are busy and the pool of threads isn't maxed out, make a new one.
-    if ((idle_threadpool_threads == 0) && (running_threadpool_threads < max_threadpool_threads)) {
-        char threadname[32];
-        SDL_snprintf(threadname, sizeof (threadname), "SDLasyncio%d", threadpool_threads_spun);
-        SDL_Thread *thread = SDL_CreateThread(AsyncIOThreadpoolWorker, threadname, NULL);
-        if (thread == NULL) {
-            return false;
+    if (running_threadpool_threads >= max_threadpool_threads) {
+        return -1;
+    }
+
+    for (int i = 0; i < max_threadpool_threads; i++) {
+        AsyncIOWorker *worker = &threadpool_workers[i];
+        SDL_LockMutex(worker->lock);
+        const bool available = !worker->running;
+        worker->running = true;
+        SDL_UnlockMutex(worker->lock);
+
+        if (available) {
+            char threadname[32];
+            SDL_snprintf(threadname, sizeof (threadname), "SDLasyncio%d", threadpool_threads_spun);
+            SDL_Thread *thread = SDL_CreateThread(AsyncIOThreadpoolWorker, threadname, (void *) (intptr_t) i);
+            if (thread == NULL) {
+                SDL_LockMutex(worker->lock);
+                worker->running = false;  // anything added in the meantime will be stolen by another worker.
+                SDL_UnlockMutex(worker->lock);
+                return -1;
+            }
+            SDL_DetachThread(thread);  // these terminate themselves when idle too long, so we never WaitThread.
+            running_threadpool_threads++;
+            threadpool_threads_spun++;
+            return i;
         }
-        SDL_DetachThread(thread);  // these terminate themselves when idle too long, so we never WaitThread.
-        running_threadpool_threads++;
-        threadpool_threads_spun++;
     }
-    return true;
+    return -1;
+}
+
+// Wake one sleeping worker, trying `first` before the others. Returns false if none were asleep.
+static bool WakeIdleWorker(int first)
+{
+    for (int i = 0; i < max_threadpool_threads; i++) {
+        AsyncIOWorker *worker = &threadpool_workers[(first + i) % max_threadpool_threads];
+        if (SDL_CompareAndSwapAtomicInt(&worker->idle, 1, 0)) {
+            SDL_SignalSemaphore(worker->wakeup);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns the index of the worker that got the task, or -1 if no worker is running.
+static int AppendToRunningWorker(SDL_AsyncIOTask *task, int first)
+{
+    for (int i = 0; i < max_threadpool_threads; i++) {
+        const int index = (first + i) % max_threadpool_threads;
+        AsyncIOWorker *worker = &threadpool_workers[index];
+        SDL_LockMutex(worker->lock);
+        const bool running = worker->running;
+        if (running) {
+            AppendWorkerTask(worker, task);
+        }
+        SDL_UnlockMutex(worker->lock);
+        if (running) {
+            return index;
+        }
+    }
+    return -1;
 }
 
 static void QueueAsyncIOTask(SDL_AsyncIOTask *task)
 {
     SDL_assert(task != NULL);
 
-    SDL_LockMutex(threadpool_lock);
-
-    if (stop_threadpool) {  // just in case.
+    if (SDL_GetAtomicInt(&stop_threadpool)) {  // just in case.
         task->result = SDL_ASYNCIO_CANCELED;
         AsyncIOTaskComplete(task);
-    } else {
-        LINKED_LIST_PREPEND(task, threadpool_tasks, threadpool);
-        MaybeSpinNewWorkerThread();  // okay if this fails or the thread pool is maxed out. Something will get there eventually.
+        return;
+    }
 
-        // tell idle threads to get to work.
-        // This is a broadcast because we want someone from the thread pool to wake up, but
-        // also shutdown might also be blocking on this. One of the threads will grab
-        // it, the others will go back to sleep.
-        SDL_BroadcastCondition(threadpool_condition);
+    const int first = (int) (((Uint32) SDL_AddAtomicInt(&next_threadpool_worker, 1)) % (Uint32) max_threadpool_threads);
+    const int index = AppendToRunningWorker(task, first);
+    if ((index >= 0) && WakeIdleWorker(index)) {
+        return;  // a sleeping worker will pick it up (or steal it).
     }
 
+    // if all existing threads are busy and the pool of threads isn't maxed out, make a new one.
+    SDL_LockMutex(threadpool_lock);
+    const int new_index = SpinNewWorkerThread();  // okay if this fails or the thread pool is maxed out. Something will get there eventually.
     SDL_UnlockMutex(threadpool_lock);
+
+    if (index < 0) {  // no thread was running at all, so the new one has to take it.
+        if (new_index < 0) {
+            task->result = SDL_ASYNCIO_FAILURE;
+            AsyncIOTaskComplete(task);
+            return;
+        }
+        AsyncIOWorker *worker = &threadpool_workers[new_index];
+        SDL_LockMutex(worker->lock);
+        AppendWorkerTask(worker, task);
+        SDL_UnlockMutex(worker->lock);
+        WakeIdleWorker(new_index);
+    }
+}
+
+static bool CancelThreadpoolTask(SDL_AsyncIOTask *task)
+{
+    // tasks move between workers when stolen, so look through all of them. This is rare enough that it doesn't need to be fast.
+    for (int i = 0; i < max_threadpool_threads; i++) {
+        AsyncIOWorker *worker = &threadpool_workers[i];
+        bool found = false;
+        SDL_LockMutex(worker->lock);
+        for (SDL_AsyncIOTask *i_task = LINKED_LIST_START(worker->tasks, threadpool); i_task; i_task = LINKED_LIST_NEXT(i_task, threadpool)) {
+            if (i_task == task) {
+                RemoveWorkerTask(worker, task);
+                found = true;
+                break;
+            }
+        }
+        SDL_UnlockMutex(worker->lock);
+        if (found) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void DestroyThreadpoolWorkers(void)
+{
+    for (int i = 0; i < max_threadpool_threads; i++) {
+        SDL_DestroyMutex(threadpool_workers[i].lock);
+        SDL_DestroySemaphore(threadpool_workers[i].wakeup);
+    }
+    SDL_free(threadpool_workers);
+    threadpool_workers = NULL;
 }
 
 // We don't initialize async i/o at all until it's used, so
@@ -207,12 +405,31 @@ static bool PrepareThreadpool(void)
 {
     bool okay = true;
     if (SDL_ShouldInit(&threadpool_init)) {
-        max_threadpool_threads = (SDL_GetNumLogicalCPUCores() * 2) + 1;  // !!! FIXME: this should probably have a hint to override.
-        max_threadpool_threads = SDL_clamp(max_threadpool_threads, 1, 8);  // 8 is probably more than enough.
+        const char *hint = SDL_GetHint(SDL_HINT_ASYNCIO_MAX_THREADS);
+        if (hint && *hint) {
+            max_threadpool_threads = SDL_max(SDL_atoi(hint), 1);
+        } else {
+            max_threadpool_threads = (SDL_GetNumLogicalCPUCores() * 2) + 1;
+            max_threadpool_threads = SDL_clamp(max_threadpool_threads, 1, 8);  // 8 is probably more than enough.
+        }
+
+        SDL_SetAtomicInt(&stop_threadpool, 0);
+        SDL_SetAtomicInt(&next_threadpool_worker, 0);
 
+        okay = (okay && ((threadpool_workers = (AsyncIOWorker *) SDL_calloc(max_threadpool_threads, sizeof (AsyncIOWorker))) != NULL));
+        for (int i = 0; okay && (i < max_threadpool_threads); i++) {
+            AsyncIOWorker *worker = &threadpool_workers[i];
+            SDL_SetAtomicInt(&worker->idle, 0);
+            okay = (okay && ((worker->lock = SDL_CreateMutex()) != NULL));
+            okay = (okay && ((worker->wakeup = SDL_CreateSemaphore(0)) != NULL));
+        }
         okay = (okay && ((threadpool_lock = SDL_CreateMutex()) != NULL));
         okay = (okay && ((threadpool_condition = SDL_CreateCondition()) != NULL));
-        okay = (okay && MaybeSpinNewWorkerThread());  // make sure at least one thread is going, since we'll need it.
+        if (okay) {
+            SDL_LockMutex(threadpool_lock);
+            okay = (SpinNewWorkerThread() >= 0);  // make sure at least one thread is going, since we'll need it.
+            SDL_UnlockMutex(threadpool_lock);
+        }
 
         if (!okay) {
             if (threadpool_condition) {
@@ -223,6 +440,9 @@ static bool PrepareThreadpool(void)
                 SDL_DestroyMutex(threadpool_lock);
                 threadpool_lock = NULL;
             }
+            if (threadpool_workers) {
+                DestroyThreadpoolWorkers();
+            }
         }
 
         SDL_SetInitialized(&threadpool_init, okay);
@@ -233,35 +453,37 @@ static bool PrepareThreadpool(void)
 static void ShutdownThreadpool(void)
 {
     if (SDL_ShouldQuit(&threadpool_init)) {
-        SDL_LockMutex(threadpool_lock);
+        SDL_SetAtomicInt(&stop_threadpool, 1);
 
         // cancel anything that's still pending.
-        SDL_AsyncIOTask *task;
-        while ((task = LINKED_LIST_START(threadpool_tasks, threadpool)) != NULL) {
-            LINKED_LIST_UNLINK(task, threadpool);
-            task->result = SDL_ASYNCIO_CANCELED;
-            AsyncIOTaskComplete(task);
+        for (int i = 0; i < max_threadpool_threads; i++) {
+            SDL_AsyncIOTask *task;
+            while ((task = TakeOldestWorkerTask(&threadpool_workers[i])) != NULL) {
+                task->result = SDL_ASYNCIO_CANCELED;
+                AsyncIOTaskComplete(task);
+            }
         }
 
-        stop_threadpool = true;
-        SDL_BroadcastCondition(threadpool_condition);  // tell the whole threadpool to wake up and quit.
+        // tell the whole threadpool to wake up and quit.
+        while (WakeIdleWorker(0)) {}
 
+        SDL_LockMutex(threadpool_lock);
         while (running_threadpool_threads > 0) {
             // each threadpool thread will broadcast this condition before it terminates if stop_threadpool is set.
             // we can't just join the threads because they are detached, so the thread pool can automatically shrink as necessary.
             SDL_WaitCondition(threadpool_condition, threadpool_lock);
         }
-
         SDL_UnlockMutex(threadpool_lock);
 
         SDL_DestroyMutex(threadpool_lock);
         threadpool_lock = NULL;
         SDL_DestroyCondition(threadpool_condition);
         threadpool_condition = NULL;
+        DestroyThreadpoolWorkers();
 
-        max_threadpool_threads = running_threadpool_threads = idle_threadpool_threads = threadpool_threads_spun = 0;
+        max_threadpool_threads = running_threadpool_threads = threadpool_threads_spun = 0;
 
-        stop_threadpool = false;
+        SDL_SetAtomicInt(&stop_threadpool, 0);
         SDL_SetInitialized(&threadpool_init, false);
     }
 }
@@ -304,13 +526,10 @@ static void generic_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *ta
     AsyncIOTaskComplete(task);
     #else
     // we can't stop i/o that's in-flight, but we _can_ just refuse to start it if the threadpool hadn't picked it up yet.
-    SDL_LockMutex(threadpool_lock);
-    if (LINKED_LIST_PREV(task, threadpool) != NULL) {  // still in the queue waiting to be run? Take it out.
-        LINKED_LIST_UNLINK(task, threadpool);
+    if (CancelThreadpoolTask(task)) {  // still waiting to be run? It's out of the threadpool now.
         task->result = SDL_ASYNCIO_CANCELED;
         AsyncIOTaskComplete(task);
     }
-    SDL_UnlockMutex(threadpool_lock);
     #endif
 }
 
@@ -390,7 +609,10 @@ bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue)
         generic_asyncioqueue_get_results,
         generic_asyncioqueue_wait_results,
         generic_asyncioqueue_signal,
-        generic_asyncioqueue_destroy
+        generic_asyncioqueue_destroy,
+        NULL,  // end_batch
+        NULL,  // set_buffers
+        NULL   // update_properties
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_Generic);
@@ -399,14 +621,8 @@ bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue)
 }
 
 
-bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_AsyncIO *asyncio)
+static bool OpenGenericAsyncIO(const char *file, const char *mode, SDL_AsyncIO *asyncio)
 {
-    #if SDL_ASYNCIO_USE_THREADPOOL
-    if (!PrepareThreadpool()) {
-        return false;
-    }
-    #endif
-
     GenericAsyncIOData *data = (GenericAsyncIOData *) SDL_calloc(1, sizeof (*data));
     if (!data) {
         return false;
@@ -430,7 +646,8 @@ bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_Asy
         generic_asyncio_io,
         generic_asyncio_io,
         generic_asyncio_io,
-        generic_asyncio_destroy
+        generic_asyncio_destroy,
+        generic_asyncio_io
     };
 
     SDL_copyp(&asyncio->iface, &SDL_AsyncIOFile_Generic);
@@ -438,6 +655,45 @@ bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_Asy
     return true;
 }
 
+bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_AsyncIO *asyncio)
+{
+    #if SDL_ASYNCIO_USE_THREADPOOL
+    if (!PrepareThreadpool()) {
+        return false;
+    }
+    #endif
+
+    return OpenGenericAsyncIO(file, mode, asyncio);
+}
+
+bool SDL_SYS_OpenAsyncIO_Generic(SDL_AsyncIOTask *task)
+{
+    #if SDL_ASYNCIO_USE_THREADPOOL
+    if (!PrepareThreadpool()) {
+        return false;
+    }
+    #endif
+
+    // the threadpool opens the file, so a slow disk doesn't block the caller.
+    return task->queue->iface.queue_task(task->queue->userdata, task);
+}
+
+bool SDL_SYS_QueueThreadpoolTask_Generic(SDL_AsyncIOTask *task, void (*work)(SDL_AsyncIOTask *task))
+{
+    task->threadpool_work = work;
+
+    #if SDL_ASYNCIO_USE_THREADPOOL
+    if (!PrepareThreadpool()) {
+        task->threadpool_work = NULL;
+        return false;
+    }
+    QueueAsyncIOTask(task);
+    #else
+    SynchronousIO(task);
+    #endif
+    return true;
+}
+
 void SDL_SYS_QuitAsyncIO_Generic(void)
 {
     #if SDL_ASYNCIO_USE_THREADPOOL
@@ -452,6 +708,11 @@ bool SDL_SYS_AsyncIOFromFile(const char *file, const char *mode, SDL_AsyncIO *as
     return SDL_SYS_AsyncIOFromFile_Generic(file, mode, asyncio);
 }
 
+bool SDL_SYS_OpenAsyncIO(SDL_AsyncIOTask *task)
+{
+    return SDL_SYS_OpenAsyncIO_Generic(task);
+}
+
 bool SDL_SYS_CreateAsyncIOQueue(SDL_AsyncIOQueue *queue)
 {
     return SDL_SYS_CreateAsyncIOQueue_Generic(queue);
@@ -40,6 +40,7 @@ static SDL_InitState liburing_init;
 static bool (*CreateAsyncIOQueue)(SDL_AsyncIOQueue *queue);
 static void (*QuitAsyncIO)(void);
 static bool (*AsyncIOFromFile)(const char *file, const char *mode, SDL_AsyncIO *asyncio);
+static bool (*OpenAsyncIO)(SDL_AsyncIOTask *task);
 
 // we never link directly to liburing.
 // (this says "-ffi" which sounds like a scripting language binding thing, but the non-ffi version
@@ -55,7 +56,11 @@ static void *liburing_handle = NULL;
     SDL_LIBURING_FUNC(struct io_uring_sqe *, io_uring_get_sqe, (struct io_uring *ring)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_read,(struct io_uring_sqe *sqe, int fd, void *buf, unsigned nbytes, __u64 offset)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_write,(struct io_uring_sqe *sqe, int fd, const void *buf, unsigned nbytes, __u64 offset)) \
+    SDL_LIBURING_FUNC(void, io_uring_prep_read_fixed,(struct io_uring_sqe *sqe, int fd, void *buf, unsigned nbytes, __u64 offset, int buf_index)) \
+    SDL_LIBURING_FUNC(void, io_uring_prep_write_fixed,(struct io_uring_sqe *sqe, int fd, const void *buf, unsigned nbytes, __u64 offset, int buf_index)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_close, (struct io_uring_sqe *sqe, int fd)) \
+    SDL_LIBURING_FUNC(void, io_uring_prep_openat, (struct io_uring_sqe *sqe, int dfd, const char *path, int flags, mode_t mode)) \
+    SDL_LIBURING_FUNC(void, io_uring_prep_statx, (struct io_uring_sqe *sqe, int dfd, const char *path, int flags, unsigned mask, struct statx *statxbuf)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_fsync, (struct io_uring_sqe *sqe, int fd, unsigned fsync_flags)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_cancel, (struct io_uring_sqe *sqe, void *user_data, int flags)) \
     SDL_LIBURING_FUNC(void, io_uring_prep_timeout, (struct io_uring_sqe *sqe, struct __kernel_timespec *ts, unsigned count, unsigned flags)) \
@@ -67,6 +72,13 @@ static void *liburing_handle = NULL;
     SDL_LIBURING_FUNC(int, io_uring_wait_cqe, (struct io_uring *ring, struct io_uring_cqe **cqe_ptr)) \
     SDL_LIBURING_FUNC(int, io_uring_wait_cqe_timeout, (struct io_uring *ring, struct io_uring_cqe **cqe_ptr, struct __kernel_timespec *ts)) \
     SDL_LIBURING_FUNC(void, io_uring_cqe_seen, (struct io_uring *ring, struct io_uring_cqe *cqe)) \
+    SDL_LIBURING_FUNC(unsigned, io_uring_sq_space_left, (const struct io_uring *ring)) \
+    SDL_LIBURING_FUNC(unsigned, io_uring_sq_ready, (const struct io_uring *ring)) \
+    SDL_LIBURING_FUNC(unsigned, io_uring_cq_ready, (const struct io_uring *ring)) \
+    SDL_LIBURING_FUNC(int, io_uring_register_files, (struct io_uring *ring, const int *files, unsigned nr_files)) \
+    SDL_LIBURING_FUNC(int, io_uring_register_files_update, (struct io_uring *ring, unsigned off, const int *files, unsigned nr_files)) \
+    SDL_LIBURING_FUNC(int, io_uring_register_buffers, (struct io_uring *ring, const struct iovec *iovecs, unsigned nr_iovecs)) \
+    SDL_LIBURING_FUNC(int, io_uring_unregister_buffers, (struct io_uring *ring)) \
     SDL_LIBURING_FUNC(void, io_uring_queue_exit, (struct io_uring *ring)) \
 
 
@@ -84,14 +96,28 @@ typedef struct SDL_LibUringFunctions
 static SDL_LibUringFunctions liburing;
 
 
+// Linux never transfers more than this in a single read or write, so larger tasks are split into a chain of linked operations.
+#define LIBURING_MAX_IO_CHUNK 0x7FFFF000
+
 typedef struct LibUringAsyncIOQueueData
 {
     SDL_Mutex *sqe_lock;
     SDL_Mutex *cqe_lock;
     struct io_uring ring;
     SDL_AtomicInt num_waiting;
+    SDL_AtomicInt num_unsubmitted;  // tasks that are set up in the ring but not handed to the kernel yet.
+    Uint64 num_syscalls;  // protected by sqe_lock.
+    int *fixed_files;  // the file descriptor registered in each slot, or -1. Protected by sqe_lock.
+    int num_fixed_files;
+    struct iovec *fixed_buffers;  // memory registered through SDL_SetAsyncIOQueueBuffers. Protected by sqe_lock.
+    int num_fixed_buffers;
+    struct LibUringAsyncIOQueueData *next_with_fixed_files;  // protected by fixed_files_lock.
 } LibUringAsyncIOQueueData;
 
+// every queue that registers files is in this list, so a closing file can be taken out of all of them.
+static SDL_Mutex *fixed_files_lock = NULL;
+static LibUringAsyncIOQueueData *fixed_files_queues = NULL;
+
 
 static void UnloadLibUringLibrary(void)
 {
@@ -137,7 +163,9 @@ static bool LoadLibUring(void)
                     IORING_OP_CLOSE,
                     IORING_OP_READ,
                     IORING_OP_WRITE,
-                    IORING_OP_ASYNC_CANCEL
+                    IORING_OP_ASYNC_CANCEL,
+                    IORING_OP_OPENAT,
+                    IORING_OP_STATX
                 };
 
                 struct io_uring_probe *probe = liburing.io_uring_get_probe();
@@ -179,12 +207,57 @@ static Sint64 liburing_asyncio_size(void *userdata)
     return ((Sint64) statbuf.st_size);
 }
 
-// you must hold sqe_lock when calling this!
+// you must hold sqe_lock when calling this! Returns what io_uring_submit did, or zero if there was nothing to submit.
+// If this fails, everything is still in the ring, and the next submit tries again; it doesn't set an error, since most callers can't fail.
+static int SubmitSQEs(LibUringAsyncIOQueueData *queuedata)
+{
+    if (SDL_GetAtomicInt(&queuedata->num_unsubmitted) == 0) {
+        return 0;  // nothing to do.
+    }
+    queuedata->num_syscalls++;
+    const int rc = liburing.io_uring_submit(&queuedata->ring);
+    // the kernel can take fewer sqes than we gave it. num_unsubmitted counts tasks, not sqes, so only clear it once the ring has none left.
+    if ((rc >= 0) && (liburing.io_uring_sq_ready(&queuedata->ring) == 0)) {
+        SDL_SetAtomicInt(&queuedata->num_unsubmitted, 0);
+    }
+    return rc;
+}
+
+// you must hold sqe_lock when calling this! If the ring doesn't have room for `count` more sqes, this submits the held-back ones to make some.
+// Returns false and sets the error if there still isn't room.
+static bool ReserveSQEs(LibUringAsyncIOQueueData *queuedata, Uint64 count)
+{
+    if (liburing.io_uring_sq_space_left(&queuedata->ring) < count) {
+        const int rc = SubmitSQEs(queuedata);
+        if (rc < 0) {
+            return liburing_SetError("io_uring_submit", rc);
+        } else if (liburing.io_uring_sq_space_left(&queuedata->ring) < count) {
+            return SDL_SetError("io_uring: submission queue doesn't have room for %u entries", (unsigned int) count);
+        }
+    }
+    return true;
+}
+
+// hand held-back tasks to the kernel before checking for results, so nobody waits on work that never started.
+static void SubmitHeldBackSQEs(LibUringAsyncIOQueueData *queuedata)
+{
+    if (SDL_GetAtomicInt(&queuedata->num_unsubmitted) > 0) {
+        SDL_LockMutex(queuedata->sqe_lock);
+        SubmitSQEs(queuedata);
+        SDL_UnlockMutex(queuedata->sqe_lock);
+    }
+}
+
+// you must hold sqe_lock when calling this, after putting the task's sqes in the ring! This can't fail: once the sqes are in the ring,
+// the kernel will get them on the next submit no matter what, so the task has to stay alive until its results come back.
 static bool liburing_asyncioqueue_queue_task(void *userdata, SDL_AsyncIOTask *task)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
-    const int rc = liburing.io_uring_submit(&queuedata->ring);
-    return (rc < 0) ? liburing_SetError("io_uring_submit", rc) : true;
+    SDL_AddAtomicInt(&queuedata->num_unsubmitted, 1);
+    if (SDL_GetAtomicInt(&task->queue->batch_depth) == 0) {
+        SubmitSQEs(queuedata);  // if this fails, the task is held back, like in a batch, until the next submit.
+    }
+    return true;  // in a batch, we'll submit this when it ends, or when someone checks for results, or when the ring fills up.
 }
 
 static void liburing_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *task)
@@ -198,7 +271,7 @@ static void liburing_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *t
 
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = ReserveSQEs(queuedata, 1) ? liburing.io_uring_get_sqe(&queuedata->ring) : NULL;
     if (!sqe) {
         SDL_UnlockMutex(queuedata->sqe_lock);
         SDL_free(cancel_task);  // oh well, the task can just finish on its own.
@@ -212,6 +285,14 @@ static void liburing_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *t
     SDL_UnlockMutex(queuedata->sqe_lock);
 }
 
+static Uint64 GetNumChunks(Uint64 size)
+{
+    return (size == 0) ? 1 : (((size - 1) / LIBURING_MAX_IO_CHUNK) + 1);
+}
+
+static void liburing_asyncio_setup(SDL_AsyncIO *asyncio, int fd);
+
+// you must hold cqe_lock when calling this, since several CQEs for the same task might be processed at once otherwise.
 static SDL_AsyncIOTask *ProcessCQE(LibUringAsyncIOQueueData *queuedata, struct io_uring_cqe *cqe)
 {
     if (!cqe) {
@@ -229,24 +310,55 @@ static SDL_AsyncIOTask *ProcessCQE(LibUringAsyncIOQueueData *queuedata, struct i
             } else {
                 task = NULL; // it already finished or was too far along to cancel, so we'll pick up the actual results later.
             }
-        } else if (cqe->res < 0) {
-            task->result = SDL_ASYNCIO_FAILURE;
-            // !!! FIXME: fill in task->error.
-        } else {
-            if ((task->type == SDL_ASYNCIO_TASK_WRITE) && (((Uint64) cqe->res) < task->requested_size)) {
-                task->result = SDL_ASYNCIO_FAILURE;  // it's always a failure on short writes.
+        } else if ((task->type == SDL_ASYNCIO_TASK_READ) || (task->type == SDL_ASYNCIO_TASK_WRITE)) {
+            // the chunks of a split task finish in order, so this tells us which one this is.
+            const Uint64 chunk = GetNumChunks(task->requested_size) - task->pending_chunks;
+            task->pending_chunks--;
+
+            if (cqe->res < 0) {
+                // when a chunk fails or comes up short, io_uring cancels the chunks linked after it. The earlier chunk already decided the result.
+                const bool chain_broken = (cqe->res == -ECANCELED) && (task->result_size < (chunk * LIBURING_MAX_IO_CHUNK));
+                if (!chain_broken) {
+                    task->result = SDL_ASYNCIO_FAILURE;
+                    // !!! FIXME: fill in task->error.
+                }
+            } else {
+                // don't explicitly mark it as COMPLETE; that's the default value and an earlier chunk might have failed and this would overwrite it.
+                task->result_size += (Uint64) cqe->res;
             }
 
-            // don't explicitly mark it as COMPLETE; that's the default value and a linked task might have failed in an earlier operation and this would overwrite it.
-
-            if ((task->type == SDL_ASYNCIO_TASK_READ) || (task->type == SDL_ASYNCIO_TASK_WRITE)) {
-                task->result_size = (Uint64) cqe->res;
+            if (task->pending_chunks > 0) {
+                task = NULL;  // don't return this one yet, the rest of its chunks will arrive in later CQEs.
+            } else if ((task->type == SDL_ASYNCIO_TASK_WRITE) && (task->result_size < task->requested_size)) {
+                task->result = SDL_ASYNCIO_FAILURE;  // it's always a failure on short writes.
+            }
+        } else if (task->type == SDL_ASYNCIO_TASK_OPEN) {
+            if (cqe->res < 0) {
+                task->result = SDL_ASYNCIO_FAILURE;
+                // !!! FIXME: fill in task->error.
+            } else {
+                liburing_asyncio_setup(task->asyncio, cqe->res);  // the result is the new file descriptor.
+            }
+        } else if (task->type == SDL_ASYNCIO_TASK_STAT) {
+            struct statx *statxbuf = (struct statx *) task->sysdata;
+            if (cqe->res < 0) {
+                task->result = SDL_ASYNCIO_FAILURE;
+                // !!! FIXME: fill in task->error.
+            } else {
+                task->result_size = (Uint64) statxbuf->stx_size;
+            }
+            SDL_free(statxbuf);
+            task->sysdata = NULL;
+        } else {
+            if (cqe->res < 0) {
+                task->result = SDL_ASYNCIO_FAILURE;
+                // !!! FIXME: fill in task->error.
             }
-        }
 
-        if ((task->type == SDL_ASYNCIO_TASK_CLOSE) && task->flush) {
-            task->flush = false;
-            task = NULL;  // don't return this one, it's a linked task, so it'll arrive in a later CQE.
+            if ((task->type == SDL_ASYNCIO_TASK_CLOSE) && task->flush) {
+                task->flush = false;
+                task = NULL;  // don't return this one, it's a linked task, so it'll arrive in a later CQE.
+            }
         }
     }
 
@@ -257,6 +369,8 @@ static SDL_AsyncIOTask *liburing_asyncioqueue_get_results(void *userdata)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
 
+    SubmitHeldBackSQEs(queuedata);
+
     // have to hold a lock because otherwise two threads will get the same cqe until we mark it "seen". Copy and mark it right away, then process further.
     SDL_LockMutex(queuedata->cqe_lock);
     struct io_uring_cqe *cqe = NULL;
@@ -270,30 +384,61 @@ static SDL_AsyncIOTask *liburing_asyncioqueue_get_results(void *userdata)
     struct io_uring_cqe cqe_copy;
     SDL_copyp(&cqe_copy, cqe);  // this is only a few bytes.
     liburing.io_uring_cqe_seen(&queuedata->ring, cqe);  // let io_uring use this slot again.
+    SDL_AsyncIOTask *task = ProcessCQE(queuedata, &cqe_copy);
     SDL_UnlockMutex(queuedata->cqe_lock);
 
-    return ProcessCQE(queuedata, &cqe_copy);
+    return task;
 }
 
+// how long to sleep at a time while the kernel won't take held-back tasks, before trying to submit them again.
+#define LIBURING_RESUBMIT_WAIT_MS 1
+
 static SDL_AsyncIOTask *liburing_asyncioqueue_wait_results(void *userdata, Sint32 timeoutMS)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
-    struct io_uring_cqe *cqe = NULL;
+    const Uint64 start = SDL_GetTicks();
 
-    SDL_AddAtomicInt(&queuedata->num_waiting, 1);
-    if (timeoutMS < 0) {
-        liburing.io_uring_wait_cqe(&queuedata->ring, &cqe);
-    } else {
-        struct __kernel_timespec ts = { (Sint64) timeoutMS / SDL_MS_PER_SECOND, (Sint64) SDL_MS_TO_NS(timeoutMS % SDL_MS_PER_SECOND) };
-        liburing.io_uring_wait_cqe_timeout(&queuedata->ring, &cqe, &ts);
-    }
-    SDL_AddAtomicInt(&queuedata->num_waiting, -1);
+    for (;;) {
+        struct io_uring_cqe *cqe = NULL;
 
-    // (we don't care if the wait failed for any reason, as the upcoming peek_cqe will report valid information. We just wanted the wait operation to block.)
+        SubmitHeldBackSQEs(queuedata);
+
+        // if the kernel didn't take everything, nothing might complete until it does, so don't sleep long before trying again.
+        const bool held_back = (SDL_GetAtomicInt(&queuedata->num_unsubmitted) > 0);
+        Sint32 waitMS = timeoutMS;
+        if (timeoutMS > 0) {
+            const Uint64 elapsed = SDL_GetTicks() - start;
+            waitMS = (elapsed >= (Uint64) timeoutMS) ? 0 : (Sint32) (timeoutMS - elapsed);
+        }
+        if (held_back && ((waitMS < 0) || (waitMS > LIBURING_RESUBMIT_WAIT_MS))) {
+            waitMS = LIBURING_RESUBMIT_WAIT_MS;
+        }
 
-    // each thing that peeks or waits for a completion _gets the same cqe_ until we mark it as seen. So when we wake up from the wait, lock the mutex and
-    // then use peek to make sure we have a unique cqe, and other competing threads either get their own or nothing.
-    return liburing_asyncioqueue_get_results(userdata);  // this just happens to do all those things.
+        // the wait only goes into the kernel if nothing has completed yet.
+        if (liburing.io_uring_cq_ready(&queuedata->ring) == 0) {
+            SDL_LockMutex(queuedata->sqe_lock);
+            queuedata->num_syscalls++;
+            SDL_UnlockMutex(queuedata->sqe_lock);
+        }
+
+        SDL_AddAtomicInt(&queuedata->num_waiting, 1);
+        if (waitMS < 0) {
+            liburing.io_uring_wait_cqe(&queuedata->ring, &cqe);
+        } else {
+            struct __kernel_timespec ts = { (Sint64) waitMS / SDL_MS_PER_SECOND, (Sint64) SDL_MS_TO_NS(waitMS % SDL_MS_PER_SECOND) };
+            liburing.io_uring_wait_cqe_timeout(&queuedata->ring, &cqe, &ts);
+        }
+        SDL_AddAtomicInt(&queuedata->num_waiting, -1);
+
+        // (we don't care if the wait failed for any reason, as the upcoming peek_cqe will report valid information. We just wanted the wait operation to block.)
+
+        // each thing that peeks or waits for a completion _gets the same cqe_ until we mark it as seen. So when we wake up from the wait, lock the mutex and
+        // then use peek to make sure we have a unique cqe, and other competing threads either get their own or nothing.
+        SDL_AsyncIOTask *task = liburing_asyncioqueue_get_results(userdata);  // this just happens to do all those things.
+        if (task || !held_back || (timeoutMS == 0) || ((timeoutMS > 0) && ((SDL_GetTicks() - start) >= (Uint64) timeoutMS))) {
+            return task;
+        }
+    }
 }
 
 static void liburing_asyncioqueue_signal(void *userdata)
@@ -303,27 +448,135 @@ static void liburing_asyncioqueue_signal(void *userdata)
 
     SDL_LockMutex(queuedata->sqe_lock);
     for (int i = 0; i < num_waiting; i++) {  // !!! FIXME: is there a better way to do this than pushing a zero-timeout request for everything waiting?
-        struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+        struct io_uring_sqe *sqe = ReserveSQEs(queuedata, 1) ? liburing.io_uring_get_sqe(&queuedata->ring) : NULL;
         if (sqe) {
             static struct __kernel_timespec ts;   // no wait, just wake a thread as fast as this can land in the completion queue.
             liburing.io_uring_prep_timeout(sqe, &ts, 0, 0);
             liburing.io_uring_sqe_set_data(sqe, NULL);
+            SDL_AddAtomicInt(&queuedata->num_unsubmitted, 1);
         }
     }
-    liburing.io_uring_submit(&queuedata->ring);
+    SubmitSQEs(queuedata);  // this doesn't wait for the batch to end, the waiting threads need to wake up now.
+
+    SDL_UnlockMutex(queuedata->sqe_lock);
+}
 
+static bool liburing_asyncioqueue_end_batch(void *userdata)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+    SDL_LockMutex(queuedata->sqe_lock);
+    const int rc = SubmitSQEs(queuedata);
     SDL_UnlockMutex(queuedata->sqe_lock);
+    return (rc < 0) ? liburing_SetError("io_uring_submit", rc) : true;  // the tasks are still held back, so they'll be submitted later.
+}
+
+static bool liburing_asyncioqueue_set_buffers(void *userdata, void * const *buffers, const size_t *sizes, int num_buffers)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+    struct iovec *iovecs = NULL;
+
+    if (num_buffers > 0) {
+        iovecs = (struct iovec *) SDL_malloc(num_buffers * sizeof (*iovecs));
+        if (!iovecs) {
+            return false;
+        }
+        for (int i = 0; i < num_buffers; i++) {
+            iovecs[i].iov_base = buffers[i];
+            iovecs[i].iov_len = sizes[i];
+        }
+    }
+
+    SDL_LockMutex(queuedata->sqe_lock);
+    if (queuedata->num_fixed_buffers > 0) {
+        liburing.io_uring_unregister_buffers(&queuedata->ring);
+        queuedata->num_syscalls++;
+    }
+    SDL_free(queuedata->fixed_buffers);
+    queuedata->fixed_buffers = NULL;
+    queuedata->num_fixed_buffers = 0;
+
+    bool retval = true;
+    if (num_buffers > 0) {
+        const int rc = liburing.io_uring_register_buffers(&queuedata->ring, iovecs, (unsigned) num_buffers);
+        queuedata->num_syscalls++;
+        if (rc < 0) {
+            SDL_free(iovecs);
+            retval = liburing_SetError("io_uring_register_buffers", rc);
+        } else {
+            queuedata->fixed_buffers = iovecs;
+            queuedata->num_fixed_buffers = num_buffers;
+        }
+    }
+    SDL_UnlockMutex(queuedata->sqe_lock);
+
+    return retval;
+}
+
+static void liburing_asyncioqueue_update_properties(void *userdata, SDL_PropertiesID props)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+
+    SDL_LockMutex(queuedata->sqe_lock);
+    const Uint64 num_syscalls = queuedata->num_syscalls;
+    SDL_UnlockMutex(queuedata->sqe_lock);
+
+    SDL_SetNumberProperty(props, SDL_PROP_ASYNCIO_QUEUE_SYSCALLS_NUMBER, (Sint64) num_syscalls);
 }
 
 static void liburing_asyncioqueue_destroy(void *userdata)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
-    liburing.io_uring_queue_exit(&queuedata->ring);
+
+    if (queuedata->fixed_files) {
+        SDL_LockMutex(fixed_files_lock);
+        LibUringAsyncIOQueueData **prev = &fixed_files_queues;
+        while (*prev != queuedata) {
+            prev = &(*prev)->next_with_fixed_files;
+        }
+        *prev = queuedata->next_with_fixed_files;
+        SDL_UnlockMutex(fixed_files_lock);
+    }
+
+    liburing.io_uring_queue_exit(&queuedata->ring);  // this drops the registered files and buffers, too.
     SDL_DestroyMutex(queuedata->sqe_lock);
     SDL_DestroyMutex(queuedata->cqe_lock);
+    SDL_free(queuedata->fixed_files);
+    SDL_free(queuedata->fixed_buffers);
     SDL_free(queuedata);
 }
 
+// registering files is optional, so if this fails, we just use plain file descriptors.
+static void RegisterFixedFiles(LibUringAsyncIOQueueData *queuedata)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_ASYNCIO_FIXED_FILES);
+    const int num_fixed_files = (hint && *hint) ? SDL_atoi(hint) : 0;
+    if ((num_fixed_files <= 0) || !fixed_files_lock) {
+        return;
+    }
+
+    int *fixed_files = (int *) SDL_malloc(num_fixed_files * sizeof (int));
+    if (!fixed_files) {
+        return;
+    }
+    for (int i = 0; i < num_fixed_files; i++) {
+        fixed_files[i] = -1;  // an empty slot, filled in when a task first uses a file on this queue.
+    }
+
+    queuedata->num_syscalls++;
+    if (liburing.io_uring_register_files(&queuedata->ring, fixed_files, (unsigned) num_fixed_files) != 0) {
+        SDL_free(fixed_files);
+        return;
+    }
+
+    queuedata->fixed_files = fixed_files;
+    queuedata->num_fixed_files = num_fixed_files;
+
+    SDL_LockMutex(fixed_files_lock);
+    queuedata->next_with_fixed_files = fixed_files_queues;
+    fixed_files_queues = queuedata;
+    SDL_UnlockMutex(fixed_files_lock);
+}
+
 static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) SDL_calloc(1, sizeof (*queuedata));
@@ -332,6 +585,7 @@ static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
     }
 
     SDL_SetAtomicInt(&queuedata->num_waiting, 0);
+    SDL_SetAtomicInt(&queuedata->num_unsubmitted, 0);
 
     queuedata->sqe_lock = SDL_CreateMutex();
     if (!queuedata->sqe_lock) {
@@ -346,8 +600,10 @@ static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
         return false;
     }
 
-    // !!! FIXME: no idea how large the queue should be. Is 128 overkill or too small?
-    const int rc = liburing.io_uring_queue_init(128, &queuedata->ring, 0);
+    // the kernel rounds this up to a power of two, and won't go over 32768.
+    const char *hint = SDL_GetHint(SDL_HINT_ASYNCIO_QUEUE_ENTRIES);
+    const int entries = (hint && *hint) ? SDL_clamp(SDL_atoi(hint), 1, 32768) : 128;
+    const int rc = liburing.io_uring_queue_init((unsigned) entries, &queuedata->ring, 0);
     if (rc != 0) {
         SDL_DestroyMutex(queuedata->sqe_lock);
         SDL_DestroyMutex(queuedata->cqe_lock);
@@ -355,13 +611,18 @@ static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
         return liburing_SetError("io_uring_queue_init", rc);
     }
 
+    RegisterFixedFiles(queuedata);
+
     static const SDL_AsyncIOQueueInterface SDL_AsyncIOQueue_liburing = {
         liburing_asyncioqueue_queue_task,
         liburing_asyncioqueue_cancel_task,
         liburing_asyncioqueue_get_results,
         liburing_asyncioqueue_wait_results,
         liburing_asyncioqueue_signal,
-        liburing_asyncioqueue_destroy
+        liburing_asyncioqueue_destroy,
+        liburing_asyncioqueue_end_batch,
+        liburing_asyncioqueue_set_buffers,
+        liburing_asyncioqueue_update_properties
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_liburing);
@@ -370,51 +631,152 @@ static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
 }
 
 
-static bool liburing_asyncio_read(void *userdata, SDL_AsyncIOTask *task)
+// you must hold sqe_lock when calling this! Returns the registered file slot to use for `fd`, or -1 to use `fd` itself.
+static int GetFixedFile(LibUringAsyncIOQueueData *queuedata, int fd)
 {
-    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) task->queue->userdata;
-    const int fd = (int) (intptr_t) userdata;
+    int available = -1;
+    for (int i = 0; i < queuedata->num_fixed_files; i++) {
+        if (queuedata->fixed_files[i] == fd) {
+            return i;
+        } else if ((available < 0) && (queuedata->fixed_files[i] == -1)) {
+            available = i;
+        }
+    }
 
-    // !!! FIXME: `unsigned` is likely smaller than requested_size's Uint64. If we overflow it, we could try submitting multiple SQEs
-    // !!! FIXME:  and make a note in the task that there are several in sequence.
-    if (task->requested_size > ((Uint64) ~((unsigned) 0))) {
-        return SDL_SetError("io_uring: i/o task is too large");
+    if (available >= 0) {
+        queuedata->num_syscalls++;
+        if (liburing.io_uring_register_files_update(&queuedata->ring, (unsigned) available, &fd, 1) == 1) {
+            queuedata->fixed_files[available] = fd;
+            return available;
+        }
     }
+    return -1;
+}
+
+// The file is about to close, and the kernel might give its number to the next file that opens, so take it out of every queue that registered it.
+static void ForgetFixedFile(int fd)
+{
+    SDL_LockMutex(fixed_files_lock);
+    for (LibUringAsyncIOQueueData *queuedata = fixed_files_queues; queuedata != NULL; queuedata = queuedata->next_with_fixed_files) {
+        SDL_LockMutex(queuedata->sqe_lock);
+        for (int i = 0; i < queuedata->num_fixed_files; i++) {
+            if (queuedata->fixed_files[i] == fd) {
+                static const int empty_slot = -1;
+                queuedata->num_syscalls++;
+                liburing.io_uring_register_files_update(&queuedata->ring, (unsigned) i, &empty_slot, 1);
+                queuedata->fixed_files[i] = -1;
+                break;
+            }
+        }
+        SDL_UnlockMutex(queuedata->sqe_lock);
+    }
+    SDL_UnlockMutex(fixed_files_lock);
+}
+
+// you must hold sqe_lock when calling this! Returns the registered buffer that holds all of the task's memory, or -1.
+static int GetFixedBuffer(LibUringAsyncIOQueueData *queuedata, const void *ptr, Uint64 size)
+{
+    const uintptr_t start = (uintptr_t) ptr;
+    for (int i = 0; i < queuedata->num_fixed_buffers; i++) {
+        const uintptr_t base = (uintptr_t) queuedata->fixed_buffers[i].iov_base;
+        const Uint64 len = (Uint64) queuedata->fixed_buffers[i].iov_len;
+        if ((start >= base) && (size <= len) && ((Uint64) (start - base) <= (len - size))) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool liburing_asyncio_io(void *userdata, SDL_AsyncIOTask *task, bool writing)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) task->queue->userdata;
+    const int fd = (int) (intptr_t) userdata;
+    const Uint64 num_chunks = GetNumChunks(task->requested_size);
 
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
-    if (!sqe) {
-        retval = SDL_SetError("io_uring: submission queue is full");
+    if (!ReserveSQEs(queuedata, num_chunks)) {
+        retval = false;  // ReserveSQEs set the error.
     } else {
-        liburing.io_uring_prep_read(sqe, fd, task->buffer, (unsigned) task->requested_size, task->offset);
-        liburing.io_uring_sqe_set_data(sqe, task);
+        const int fixed_file = GetFixedFile(queuedata, fd);
+        const int fixed_buffer = GetFixedBuffer(queuedata, task->buffer, task->requested_size);
+        Uint8 *ptr = (Uint8 *) task->buffer;
+        Uint64 offset = task->offset;
+        Uint64 remaining = task->requested_size;
+
+        task->pending_chunks = (int) num_chunks;  // ReserveSQEs makes sure this fits in the ring, so it's small.
+
+        for (Uint64 i = 0; i < num_chunks; i++) {
+            const unsigned nbytes = (unsigned) SDL_min(remaining, LIBURING_MAX_IO_CHUNK);
+            const int sqefd = (fixed_file >= 0) ? fixed_file : fd;
+            struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);  // can't fail, we reserved these.
+            unsigned flags = 0;
+
+            if (fixed_buffer >= 0) {
+                if (writing) {
+                    liburing.io_uring_prep_write_fixed(sqe, sqefd, ptr, nbytes, offset, fixed_buffer);
+                } else {
+                    liburing.io_uring_prep_read_fixed(sqe, sqefd, ptr, nbytes, offset, fixed_buffer);
+                }
+            } else if (writing) {
+                liburing.io_uring_prep_write(sqe, sqefd, ptr, nbytes, offset);
+            } else {
+                liburing.io_uring_prep_read(sqe, sqefd, ptr, nbytes, offset);
+            }
+            liburing.io_uring_sqe_set_data(sqe, task);
+
+            if (fixed_file >= 0) {
+                flags |= IOSQE_FIXED_FILE;
+            }
+            if (i < (num_chunks - 1)) {
+                flags |= IOSQE_IO_LINK;  // the next chunk must wait for this one, and is canceled if this one fails or comes up short.
+            }
+            if (flags) {
+                liburing.io_uring_sqe_set_flags(sqe, flags);
+            }
+
+            ptr += nbytes;
+            offset += nbytes;
+            remaining -= nbytes;
+        }
+
         retval = task->queue->iface.queue_task(task->queue->userdata, task);
     }
     SDL_UnlockMutex(queuedata->sqe_lock);
     return retval;
 }
 
+static bool liburing_asyncio_read(void *userdata, SDL_AsyncIOTask *task)
+{
+    return liburing_asyncio_io(userdata, task, false);
+}
+
 static bool liburing_asyncio_write(void *userdata, SDL_AsyncIOTask *task)
+{
+    return liburing_asyncio_io(userdata, task, true);
+}
+
+static bool liburing_asyncio_stat(void *userdata, SDL_AsyncIOTask *task)
 {
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) task->queue->userdata;
     const int fd = (int) (intptr_t) userdata;
 
-    // !!! FIXME: `unsigned` is likely smaller than requested_size's Uint64. If we overflow it, we could try submitting multiple SQEs
-    // !!! FIXME:  and make a note in the task that there are several in sequence.
-    if (task->requested_size > ((Uint64) ~((unsigned) 0))) {
-        return SDL_SetError("io_uring: i/o task is too large");
+    struct statx *statxbuf = (struct statx *) SDL_calloc(1, sizeof (*statxbuf));  // the kernel writes here, so it has to outlive this function.
+    if (!statxbuf) {
+        return false;
     }
 
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+    struct io_uring_sqe *sqe = ReserveSQEs(queuedata, 1) ? liburing.io_uring_get_sqe(&queuedata->ring) : NULL;
     if (!sqe) {
-        retval = SDL_SetError("io_uring: submission queue is full");
+        SDL_free(statxbuf);
+        retval = false;  // ReserveSQEs set the error.
     } else {
-        liburing.io_uring_prep_write(sqe, fd, task->buffer, (unsigned) task->requested_size, task->offset);
+        task->sysdata = statxbuf;  // ProcessCQE frees this once the kernel is done with it.
+        liburing.io_uring_prep_statx(sqe, fd, "", AT_EMPTY_PATH, STATX_SIZE, statxbuf);  // an empty path with AT_EMPTY_PATH means the fd itself.
         liburing.io_uring_sqe_set_data(sqe, task);
         retval = task->queue->iface.queue_task(task->queue->userdata, task);
     }
@@ -427,23 +789,18 @@ static bool liburing_asyncio_close(void *userdata, SDL_AsyncIOTask *task)
     LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) task->queue->userdata;
     const int fd = (int) (intptr_t) userdata;
 
+    ForgetFixedFile(fd);  // this is safe, as the close task only runs once no other tasks are pending for this file.
+
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
-    if (!sqe) {
-        retval = SDL_SetError("io_uring: submission queue is full");
+    if (!ReserveSQEs(queuedata, task->flush ? 2 : 1)) {
+        retval = false;  // ReserveSQEs set the error.
     } else {
+        struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
         if (task->flush) {
             struct io_uring_sqe *flush_sqe = sqe;
             sqe = liburing.io_uring_get_sqe(&queuedata->ring);  // this will be our actual close task.
-            if (!sqe) {
-                liburing.io_uring_prep_nop(flush_sqe);  // we already have the first sqe, just make it a NOP.
-                liburing.io_uring_sqe_set_data(flush_sqe, NULL);
-                task->queue->iface.queue_task(task->queue->userdata, task);
-                SDL_UnlockMutex(queuedata->sqe_lock);
-                return SDL_SetError("io_uring: submission queue is full");
-            }
             liburing.io_uring_prep_fsync(flush_sqe, fd, IORING_FSYNC_DATASYNC);
             liburing.io_uring_sqe_set_data(flush_sqe, task);
             liburing.io_uring_sqe_set_flags(flush_sqe, IOSQE_IO_HARDLINK);  // must complete before next sqe starts, and next sqe should run even if this fails.
@@ -483,28 +840,56 @@ static int PosixOpenModeFromString(const char *mode)
     return 0;
 }
 
-static bool SDL_SYS_AsyncIOFromFile_liburing(const char *file, const char *mode, SDL_AsyncIO *asyncio)
+static void liburing_asyncio_setup(SDL_AsyncIO *asyncio, int fd)
 {
-    const int fd = open(file, PosixOpenModeFromString(mode), 0644);
-    if (fd == -1) {
-        return SDL_SetError("open failed: %s", strerror(errno));
-    }
-
     static const SDL_AsyncIOInterface SDL_AsyncIOFile_liburing = {
         liburing_asyncio_size,
         liburing_asyncio_read,
         liburing_asyncio_write,
         liburing_asyncio_close,
-        liburing_asyncio_destroy
+        liburing_asyncio_destroy,
+        liburing_asyncio_stat
     };
 
     SDL_copyp(&asyncio->iface, &SDL_AsyncIOFile_liburing);
     asyncio->userdata = (void *) (intptr_t) fd;
+}
+
+static bool SDL_SYS_AsyncIOFromFile_liburing(const char *file, const char *mode, SDL_AsyncIO *asyncio)
+{
+    const int fd = open(file, PosixOpenModeFromString(mode), 0644);
+    if (fd == -1) {
+        return SDL_SetError("open failed: %s", strerror(errno));
+    }
+
+    liburing_asyncio_setup(asyncio, fd);
     return true;
 }
 
+static bool SDL_SYS_OpenAsyncIO_liburing(SDL_AsyncIOTask *task)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) task->queue->userdata;
+
+    // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
+    SDL_LockMutex(queuedata->sqe_lock);
+    bool retval;
+    struct io_uring_sqe *sqe = ReserveSQEs(queuedata, 1) ? liburing.io_uring_get_sqe(&queuedata->ring) : NULL;
+    if (!sqe) {
+        retval = false;  // ReserveSQEs set the error.
+    } else {
+        liburing.io_uring_prep_openat(sqe, AT_FDCWD, task->file, PosixOpenModeFromString(task->mode), 0644);  // task->file lives as long as the task.
+        liburing.io_uring_sqe_set_data(sqe, task);
+        retval = task->queue->iface.queue_task(task->queue->userdata, task);
+    }
+    SDL_UnlockMutex(queuedata->sqe_lock);
+    return retval;
+}
+
 static void SDL_SYS_QuitAsyncIO_liburing(void)
 {
+    SDL_assert(fixed_files_queues == NULL);  // every queue should be destroyed by now.
+    SDL_DestroyMutex(fixed_files_lock);
+    fixed_files_lock = NULL;
     UnloadLibUringLibrary();
 }
 
@@ -512,13 +897,16 @@ static void MaybeInitializeLibUring(void)
 {
     if (SDL_ShouldInit(&liburing_init)) {
         if (LoadLibUring()) {
+            fixed_files_lock = SDL_CreateMutex();  // if this fails, queues just won't register files.
             CreateAsyncIOQueue = SDL_SYS_CreateAsyncIOQueue_liburing;
             QuitAsyncIO = SDL_SYS_QuitAsyncIO_liburing;
             AsyncIOFromFile = SDL_SYS_AsyncIOFromFile_liburing;
+            OpenAsyncIO = SDL_SYS_OpenAsyncIO_liburing;
         } else {  // can't use liburing? Use the "generic" threadpool implementation instead.
             CreateAsyncIOQueue = SDL_SYS_CreateAsyncIOQueue_Generic;
             QuitAsyncIO = SDL_SYS_QuitAsyncIO_Generic;
             AsyncIOFromFile = SDL_SYS_AsyncIOFromFile_Generic;
+            OpenAsyncIO = SDL_SYS_OpenAsyncIO_Generic;
         }
         SDL_SetInitialized(&liburing_init, true);
     }
@@ -536,6 +924,12 @@ bool SDL_SYS_AsyncIOFromFile(const char *file, const char *mode, SDL_AsyncIO *as
     return AsyncIOFromFile(file, mode, asyncio);
 }
 
+bool SDL_SYS_OpenAsyncIO(SDL_AsyncIOTask *task)
+{
+    MaybeInitializeLibUring();
+    return OpenAsyncIO(task);
+}
+
 void SDL_SYS_QuitAsyncIO(void)
 {
     if (SDL_ShouldQuit(&liburing_init)) {
@@ -543,6 +937,7 @@ void SDL_SYS_QuitAsyncIO(void)
         CreateAsyncIOQueue = NULL;
         QuitAsyncIO = NULL;
         AsyncIOFromFile = NULL;
+        OpenAsyncIO = NULL;
         SDL_SetInitialized(&liburing_init, false);
     }
 }
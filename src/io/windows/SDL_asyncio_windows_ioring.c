@@ -40,6 +40,7 @@ static SDL_InitState ioring_init;
 static bool (*CreateAsyncIOQueue)(SDL_AsyncIOQueue *queue);
 static void (*QuitAsyncIO)(void);
 static bool (*AsyncIOFromFile)(const char *file, const char *mode, SDL_AsyncIO *asyncio);
+static bool (*OpenAsyncIO)(SDL_AsyncIOTask *task);
 
 // we never link directly to ioring.
 static const char *ioring_library = "KernelBase.dll";
@@ -80,6 +81,7 @@ typedef struct WinIoRingAsyncIOQueueData
     HANDLE event;
     HIORING ring;
     SDL_AtomicInt num_waiting;
+    SDL_AsyncIOTask completed_tasks;  // tasks that ran on the generic threadpool instead of the ring. Protected by cqe_lock.
 } WinIoRingAsyncIOQueueData;
 
 
@@ -235,6 +237,12 @@ static SDL_AsyncIOTask *ioring_asyncioqueue_get_results(void *userdata)
 
     // unlike liburing's io_uring_peek_cqe(), it's possible PopIoRingCompletion() is thread safe, but for now we wrap it in a mutex just in case.
     SDL_LockMutex(queuedata->cqe_lock);
+    SDL_AsyncIOTask *task = LINKED_LIST_START(queuedata->completed_tasks, queue);
+    if (task) {  // something finished on the threadpool, it doesn't need anything else.
+        LINKED_LIST_UNLINK(task, queue);
+        SDL_UnlockMutex(queuedata->cqe_lock);
+        return task;
+    }
     IORING_CQE cqe;
     const HRESULT hr = ioring.PopIoRingCompletion(queuedata->ring, &cqe);
     SDL_UnlockMutex(queuedata->cqe_lock);
@@ -250,7 +258,7 @@ static SDL_AsyncIOTask *ioring_asyncioqueue_wait_results(void *userdata, Sint32
 {
     WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) userdata;
 
-    // the event only signals when the IoRing moves from empty to non-empty, so you have to try a (non-blocking) get_results first or risk eternal hangs.
+    // the event only signals when the IoRing moves from empty to non-empty (or a threadpool task finishes), so you have to try a (non-blocking) get_results first or risk eternal hangs.
     SDL_AsyncIOTask *task = ioring_asyncioqueue_get_results(userdata);
     if (!task) {
         SDL_AddAtomicInt(&queuedata->num_waiting, 1);
@@ -347,7 +355,10 @@ static bool SDL_SYS_CreateAsyncIOQueue_ioring(SDL_AsyncIOQueue *queue)
         ioring_asyncioqueue_get_results,
         ioring_asyncioqueue_wait_results,
         ioring_asyncioqueue_signal,
-        ioring_asyncioqueue_destroy
+        ioring_asyncioqueue_destroy,
+        NULL,  // end_batch
+        NULL,  // set_buffers
+        NULL   // update_properties
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_ioring);
@@ -423,6 +434,41 @@ static bool ioring_asyncio_write(void *userdata, SDL_AsyncIOTask *task)
     return retval;
 }
 
+static bool SDL_SYS_AsyncIOFromFile_ioring(const char *file, const char *mode, SDL_AsyncIO *asyncio);
+
+// IoRing has no operations to open or query files, so those run on the generic backend's threadpool, and this is called there.
+// The finished task goes straight to the queue's list of completed tasks, and the completion event wakes anyone waiting.
+static void IoRingThreadpoolWork(SDL_AsyncIOTask *task)
+{
+    WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) task->queue->userdata;
+
+    if (task->result == SDL_ASYNCIO_COMPLETE) {  // otherwise it was canceled or the threadpool couldn't run it, so just report it.
+        if (task->type == SDL_ASYNCIO_TASK_OPEN) {
+            if (!SDL_SYS_AsyncIOFromFile_ioring(task->file, task->mode, task->asyncio)) {
+                task->result = SDL_ASYNCIO_FAILURE;
+            }
+        } else {
+            SDL_assert(task->type == SDL_ASYNCIO_TASK_STAT);
+            LARGE_INTEGER size;
+            if (GetFileSizeEx((HANDLE) task->asyncio->userdata, &size)) {
+                task->result_size = (Uint64) size.QuadPart;
+            } else {
+                task->result = SDL_ASYNCIO_FAILURE;
+            }
+        }
+    }
+
+    SDL_LockMutex(queuedata->cqe_lock);
+    LINKED_LIST_PREPEND(task, queuedata->completed_tasks, queue);
+    SDL_UnlockMutex(queuedata->cqe_lock);
+    SetEvent(queuedata->event);
+}
+
+static bool ioring_asyncio_stat(void *userdata, SDL_AsyncIOTask *task)
+{
+    return SDL_SYS_QueueThreadpoolTask_Generic(task, IoRingThreadpoolWork);
+}
+
 static bool ioring_asyncio_close(void *userdata, SDL_AsyncIOTask *task)
 {
     // current IoRing operations don't offer asynchronous closing, but let's assume most of the potential work is flushing to disk, so just do it for everything, explicit flush or not. We'll close when it finishes.
@@ -484,7 +530,7 @@ static bool SDL_SYS_AsyncIOFromFile_ioring(const char *file, const char *mode, S
 
     HANDLE handle = CreateFileW(wstr, access_mode, FILE_SHARE_READ, NULL, create_mode, FILE_ATTRIBUTE_NORMAL, NULL);
     SDL_free(wstr);
-    if (!handle) {
+    if (handle == INVALID_HANDLE_VALUE) {
         return WIN_SetError("CreateFileW");
     }
 
@@ -493,7 +539,8 @@ static bool SDL_SYS_AsyncIOFromFile_ioring(const char *file, const char *mode, S
         ioring_asyncio_read,
         ioring_asyncio_write,
         ioring_asyncio_close,
-        ioring_asyncio_destroy
+        ioring_asyncio_destroy,
+        ioring_asyncio_stat
     };
 
     SDL_copyp(&asyncio->iface, &SDL_AsyncIOFile_ioring);
@@ -502,8 +549,16 @@ static bool SDL_SYS_AsyncIOFromFile_ioring(const char *file, const char *mode, S
     return true;
 }
 
+static bool SDL_SYS_OpenAsyncIO_ioring(SDL_AsyncIOTask *task)
+{
+    // IoRing can't open files, so the generic threadpool does it, and a slow disk doesn't block the caller.
+    // !!! FIXME: if IoRing ever gets an open operation, use it here.
+    return SDL_SYS_QueueThreadpoolTask_Generic(task, IoRingThreadpoolWork);
+}
+
 static void SDL_SYS_QuitAsyncIO_ioring(void)
 {
+    SDL_SYS_QuitAsyncIO_Generic();  // opens and stats used its threadpool.
     UnloadWinIoRingLibrary();
 }
 
@@ -514,10 +569,12 @@ static void MaybeInitializeWinIoRing(void)
             CreateAsyncIOQueue = SDL_SYS_CreateAsyncIOQueue_ioring;
             QuitAsyncIO = SDL_SYS_QuitAsyncIO_ioring;
             AsyncIOFromFile = SDL_SYS_AsyncIOFromFile_ioring;
+            OpenAsyncIO = SDL_SYS_OpenAsyncIO_ioring;
         } else {  // can't use ioring? Use the "generic" threadpool implementation instead.
             CreateAsyncIOQueue = SDL_SYS_CreateAsyncIOQueue_Generic;
             QuitAsyncIO = SDL_SYS_QuitAsyncIO_Generic;
             AsyncIOFromFile = SDL_SYS_AsyncIOFromFile_Generic;
+            OpenAsyncIO = SDL_SYS_OpenAsyncIO_Generic;
         }
         SDL_SetInitialized(&ioring_init, true);
     }
@@ -535,6 +592,12 @@ bool SDL_SYS_AsyncIOFromFile(const char *file, const char *mode, SDL_AsyncIO *as
     return AsyncIOFromFile(file, mode, asyncio);
 }
 
+bool SDL_SYS_OpenAsyncIO(SDL_AsyncIOTask *task)
+{
+    MaybeInitializeWinIoRing();
+    return OpenAsyncIO(task);
+}
+
 void SDL_SYS_QuitAsyncIO(void)
 {
     if (SDL_ShouldQuit(&ioring_init)) {
@@ -542,6 +605,7 @@ void SDL_SYS_QuitAsyncIO(void)
         CreateAsyncIOQueue = NULL;
         QuitAsyncIO = NULL;
         AsyncIOFromFile = NULL;
+        OpenAsyncIO = NULL;
         SDL_SetInitialized(&ioring_init, false);
     }
 }
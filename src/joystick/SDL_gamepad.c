@@ -80,10 +80,14 @@ typedef enum
 typedef struct GamepadMapping_t
 {
     SDL_GUID guid _guarded;
+    SDL_GUID match_guid _guarded; // guid without the version, the key in s_gamepadMappingsByGUID
     char *name _guarded;
     char *mapping _guarded;
+    bool has_crc _guarded;        // the mapping string has a CRC field
+    Uint16 crc _guarded;          // the CRC from the mapping string
     SDL_GamepadMappingPriority priority _guarded;
     struct GamepadMapping_t *next _guarded;
+    struct GamepadMapping_t *next_match _guarded; // the next mapping with the same match_guid
 } GamepadMapping_t;
 
 typedef struct
@@ -101,6 +105,8 @@ typedef struct
 
 static SDL_GUID s_zeroGUID;
 static GamepadMapping_t *s_pSupportedGamepads SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static GamepadMapping_t *s_pLastSupportedGamepad SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static SDL_HashTable *s_gamepadMappingsByGUID SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static GamepadMapping_t *s_pDefaultMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static GamepadMapping_t *s_pXInputMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static MappingChangeTracker *s_mappingChangeTracker SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
@@ -124,6 +130,10 @@ struct SDL_Gamepad
     Uint8 *last_hat_mask _guarded;
     Uint64 guide_button_down _guarded;
 
+    // The state published for SDL_GetGamepadState(), odd while it's being written
+    SDL_AtomicInt state_sequence;
+    SDL_GamepadState state;
+
     struct SDL_Gamepad *next _guarded; // pointer to next gamepad we have allocated
 };
 
@@ -152,6 +162,7 @@ static SDL_vidpid_list SDL_ignored_gamepads = {
 
 static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char *mappingString, bool *existing, SDL_GamepadMappingPriority priority);
 static void SDL_PrivateLoadButtonMapping(SDL_Gamepad *gamepad, GamepadMapping_t *pGamepadMapping);
+static void SDL_PrivatePublishGamepadState(SDL_Gamepad *gamepad);
 static GamepadMapping_t *SDL_PrivateGetGamepadMapping(SDL_JoystickID instance_id, bool create_mapping);
 static void SDL_SendGamepadAxis(Uint64 timestamp, SDL_Gamepad *gamepad, SDL_GamepadAxis axis, Sint16 value);
 static void SDL_SendGamepadButton(Uint64 timestamp, SDL_Gamepad *gamepad, SDL_GamepadButton button, bool down);
@@ -915,12 +926,85 @@ static GamepadMapping_t *SDL_CreateMappingForWGIGamepad(SDL_GUID guid)
     return SDL_PrivateAddMappingForGUID(guid, mapping_string, &existing, SDL_GAMEPAD_MAPPING_PRIORITY_DEFAULT);
 }
 
+static Uint32 SDLCALL SDL_HashGamepadGUID(void *unused, const void *key)
+{
+    (void)unused;
+    return SDL_murmur3_32(key, sizeof(SDL_GUID), 0);
+}
+
+static bool SDLCALL SDL_KeyMatchGamepadGUID(void *unused, const void *a, const void *b)
+{
+    (void)unused;
+    return SDL_memcmp(a, b, sizeof(SDL_GUID)) == 0;
+}
+
+/*
+ * Helper function to cache the CRC field of a mapping string, so lookups don't have to parse it
+ */
+static void SDL_PrivateUpdateMappingCRC(GamepadMapping_t *mapping)
+{
+    const char *crc_string = SDL_strstr(mapping->mapping, SDL_GAMEPAD_CRC_FIELD);
+    if (crc_string) {
+        mapping->has_crc = true;
+        mapping->crc = (Uint16)SDL_strtol(crc_string + SDL_GAMEPAD_CRC_FIELD_SIZE, NULL, 16);
+    } else {
+        mapping->has_crc = false;
+        mapping->crc = 0;
+    }
+}
+
+/*
+ * Helper function to add a new mapping to the end of the mappings database
+ */
+static bool SDL_PrivateAppendGamepadMapping(GamepadMapping_t *mapping)
+{
+    const void *value;
+
+    SDL_AssertJoysticksLocked();
+
+    mapping->match_guid = mapping->guid;
+    SDL_SetJoystickGUIDVersion(&mapping->match_guid, 0);
+    mapping->next_match = NULL;
+
+    // Mappings without a GUID are never matched, so they aren't indexed
+    if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) != 0) {
+        if (!s_gamepadMappingsByGUID) {
+            s_gamepadMappingsByGUID = SDL_CreateHashTable(0, false, SDL_HashGamepadGUID, SDL_KeyMatchGamepadGUID, NULL, NULL);
+            if (!s_gamepadMappingsByGUID) {
+                return false;
+            }
+        }
+
+        if (SDL_FindInHashTable(s_gamepadMappingsByGUID, &mapping->match_guid, &value)) {
+            // Keep the chain in database order, earlier mappings take precedence
+            GamepadMapping_t *match = (GamepadMapping_t *)value;
+            while (match->next_match) {
+                match = match->next_match;
+            }
+            match->next_match = mapping;
+        } else if (!SDL_InsertIntoHashTable(s_gamepadMappingsByGUID, &mapping->match_guid, mapping, false)) {
+            return false;
+        }
+    }
+
+    if (s_pLastSupportedGamepad) {
+        s_pLastSupportedGamepad->next = mapping;
+    } else {
+        s_pSupportedGamepads = mapping;
+    }
+    s_pLastSupportedGamepad = mapping;
+
+    return true;
+}
+
 /*
  * Helper function to scan the mappings database for a gamepad with the specified GUID
  */
 static GamepadMapping_t *SDL_PrivateMatchGamepadMappingForGUID(SDL_GUID guid, bool match_version, bool exact_match_crc)
 {
     GamepadMapping_t *mapping, *best_match = NULL;
+    SDL_GUID match_guid;
+    const void *value;
     Uint16 crc = 0;
 
     SDL_AssertJoysticksLocked();
@@ -930,40 +1014,34 @@ static GamepadMapping_t *SDL_PrivateMatchGamepadMappingForGUID(SDL_GUID guid, bo
     // Clear the CRC from the GUID for matching, the mappings never include it in the GUID
     SDL_SetJoystickGUIDCRC(&guid, 0);
 
-    if (!match_version) {
-        SDL_SetJoystickGUIDVersion(&guid, 0);
-    }
+    // All the mappings that differ only by version share an entry in the index
+    match_guid = guid;
+    SDL_SetJoystickGUIDVersion(&match_guid, 0);
 
-    for (mapping = s_pSupportedGamepads; mapping; mapping = mapping->next) {
-        SDL_GUID mapping_guid;
+    if (!s_gamepadMappingsByGUID ||
+        !SDL_FindInHashTable(s_gamepadMappingsByGUID, &match_guid, &value)) {
+        return NULL;
+    }
 
-        if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
+    for (mapping = (GamepadMapping_t *)value; mapping; mapping = mapping->next_match) {
+        if (match_version && SDL_memcmp(&guid, &mapping->guid, sizeof(guid)) != 0) {
             continue;
         }
 
-        SDL_memcpy(&mapping_guid, &mapping->guid, sizeof(mapping_guid));
-        if (!match_version) {
-            SDL_SetJoystickGUIDVersion(&mapping_guid, 0);
-        }
-
-        if (SDL_memcmp(&guid, &mapping_guid, sizeof(guid)) == 0) {
-            const char *crc_string = SDL_strstr(mapping->mapping, SDL_GAMEPAD_CRC_FIELD);
-            if (crc_string) {
-                Uint16 mapping_crc = (Uint16)SDL_strtol(crc_string + SDL_GAMEPAD_CRC_FIELD_SIZE, NULL, 16);
-                if (mapping_crc != crc) {
-                    // This mapping specified a CRC and they don't match
-                    continue;
-                }
-
-                // An exact match, including CRC
-                return mapping;
-            } else if (crc && exact_match_crc) {
-                return NULL;
+        if (mapping->has_crc) {
+            if (mapping->crc != crc) {
+                // This mapping specified a CRC and they don't match
+                continue;
             }
 
-            if (!best_match) {
-                best_match = mapping;
-            }
+            // An exact match, including CRC
+            return mapping;
+        } else if (crc && exact_match_crc) {
+            return NULL;
+        }
+
+        if (!best_match) {
+            best_match = mapping;
         }
     }
     return best_match;
@@ -1741,6 +1819,7 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
             SDL_free(pGamepadMapping->mapping);
             pGamepadMapping->mapping = pchMapping;
             pGamepadMapping->priority = priority;
+            SDL_PrivateUpdateMappingCRC(pGamepadMapping);
         } else {
             SDL_free(pchName);
             SDL_free(pchMapping);
@@ -1766,19 +1845,14 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
         pGamepadMapping->mapping = pchMapping;
         pGamepadMapping->next = NULL;
         pGamepadMapping->priority = priority;
+        SDL_PrivateUpdateMappingCRC(pGamepadMapping);
 
-        if (s_pSupportedGamepads) {
-            // Add the mapping to the end of the list
-            GamepadMapping_t *pCurrMapping, *pPrevMapping;
-
-            for (pPrevMapping = s_pSupportedGamepads, pCurrMapping = pPrevMapping->next;
-                 pCurrMapping;
-                 pPrevMapping = pCurrMapping, pCurrMapping = pCurrMapping->next) {
-                // continue;
-            }
-            pPrevMapping->next = pGamepadMapping;
-        } else {
-            s_pSupportedGamepads = pGamepadMapping;
+        if (!SDL_PrivateAppendGamepadMapping(pGamepadMapping)) {
+            PopMappingChangeTracking();
+            SDL_free(pchName);
+            SDL_free(pchMapping);
+            SDL_free(pGamepadMapping);
+            return NULL;
         }
         if (existing) {
             *existing = false;
@@ -2904,6 +2978,7 @@ SDL_Gamepad *SDL_OpenGamepad(SDL_JoystickID instance_id)
     }
 
     SDL_PrivateLoadButtonMapping(gamepad, pSupportedGamepad);
+    SDL_PrivatePublishGamepadState(gamepad);
 
     // Add the gamepad to list
     ++gamepad->ref_count;
@@ -2952,64 +3027,76 @@ bool SDL_GamepadHasAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis)
 }
 
 /*
- * Get the current state of an axis control on a gamepad
+ * Helper function to get the current state of an axis control on a gamepad
  */
-Sint16 SDL_GetGamepadAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis)
+static Sint16 SDL_PrivateGetGamepadAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis)
 {
     Sint16 result = 0;
+    int i;
 
-    SDL_LockJoysticks();
-    {
-        int i;
-
-        CHECK_GAMEPAD_MAGIC(gamepad, 0);
-
-        for (i = 0; i < gamepad->num_bindings; ++i) {
-            const SDL_GamepadBinding *binding = &gamepad->bindings[i];
-            if (binding->output_type == SDL_GAMEPAD_BINDTYPE_AXIS && binding->output.axis.axis == axis) {
-                int value = 0;
-                bool valid_input_range;
-                bool valid_output_range;
+    SDL_AssertJoysticksLocked();
 
-                if (binding->input_type == SDL_GAMEPAD_BINDTYPE_AXIS) {
-                    value = SDL_GetJoystickAxis(gamepad->joystick, binding->input.axis.axis);
-                    if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
-                        valid_input_range = (value >= binding->input.axis.axis_min && value <= binding->input.axis.axis_max);
-                    } else {
-                        valid_input_range = (value >= binding->input.axis.axis_max && value <= binding->input.axis.axis_min);
-                    }
-                    if (valid_input_range) {
-                        if (binding->input.axis.axis_min != binding->output.axis.axis_min || binding->input.axis.axis_max != binding->output.axis.axis_max) {
-                            float normalized_value = (float)(value - binding->input.axis.axis_min) / (binding->input.axis.axis_max - binding->input.axis.axis_min);
-                            value = binding->output.axis.axis_min + (int)(normalized_value * (binding->output.axis.axis_max - binding->output.axis.axis_min));
-                        }
-                    } else {
-                        value = 0;
-                    }
-                } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_BUTTON) {
-                    if (SDL_GetJoystickButton(gamepad->joystick, binding->input.button)) {
-                        value = binding->output.axis.axis_max;
-                    }
-                } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_HAT) {
-                    int hat_mask = SDL_GetJoystickHat(gamepad->joystick, binding->input.hat.hat);
-                    if (hat_mask & binding->input.hat.hat_mask) {
-                        value = binding->output.axis.axis_max;
-                    }
+    for (i = 0; i < gamepad->num_bindings; ++i) {
+        const SDL_GamepadBinding *binding = &gamepad->bindings[i];
+        if (binding->output_type == SDL_GAMEPAD_BINDTYPE_AXIS && binding->output.axis.axis == axis) {
+            int value = 0;
+            bool valid_input_range;
+            bool valid_output_range;
+
+            if (binding->input_type == SDL_GAMEPAD_BINDTYPE_AXIS) {
+                value = SDL_GetJoystickAxis(gamepad->joystick, binding->input.axis.axis);
+                if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
+                    valid_input_range = (value >= binding->input.axis.axis_min && value <= binding->input.axis.axis_max);
+                } else {
+                    valid_input_range = (value >= binding->input.axis.axis_max && value <= binding->input.axis.axis_min);
                 }
-
-                if (binding->output.axis.axis_min < binding->output.axis.axis_max) {
-                    valid_output_range = (value >= binding->output.axis.axis_min && value <= binding->output.axis.axis_max);
+                if (valid_input_range) {
+                    if (binding->input.axis.axis_min != binding->output.axis.axis_min || binding->input.axis.axis_max != binding->output.axis.axis_max) {
+                        float normalized_value = (float)(value - binding->input.axis.axis_min) / (binding->input.axis.axis_max - binding->input.axis.axis_min);
+                        value = binding->output.axis.axis_min + (int)(normalized_value * (binding->output.axis.axis_max - binding->output.axis.axis_min));
+                    }
                 } else {
-                    valid_output_range = (value >= binding->output.axis.axis_max && value <= binding->output.axis.axis_min);
+                    value = 0;
                 }
-                // If the value is zero, there might be another binding that makes it non-zero
-                if (value != 0 && valid_output_range) {
-                    result = (Sint16)value;
-                    break;
+            } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_BUTTON) {
+                if (SDL_GetJoystickButton(gamepad->joystick, binding->input.button)) {
+                    value = binding->output.axis.axis_max;
+                }
+            } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_HAT) {
+                int hat_mask = SDL_GetJoystickHat(gamepad->joystick, binding->input.hat.hat);
+                if (hat_mask & binding->input.hat.hat_mask) {
+                    value = binding->output.axis.axis_max;
                 }
             }
+
+            if (binding->output.axis.axis_min < binding->output.axis.axis_max) {
+                valid_output_range = (value >= binding->output.axis.axis_min && value <= binding->output.axis.axis_max);
+            } else {
+                valid_output_range = (value >= binding->output.axis.axis_max && value <= binding->output.axis.axis_min);
+            }
+            // If the value is zero, there might be another binding that makes it non-zero
+            if (value != 0 && valid_output_range) {
+                result = (Sint16)value;
+                break;
+            }
         }
     }
+    return result;
+}
+
+/*
+ * Get the current state of an axis control on a gamepad
+ */
+Sint16 SDL_GetGamepadAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis)
+{
+    Sint16 result;
+
+    SDL_LockJoysticks();
+    {
+        CHECK_GAMEPAD_MAGIC(gamepad, 0);
+
+        result = SDL_PrivateGetGamepadAxis(gamepad, axis);
+    }
     SDL_UnlockJoysticks();
 
     return result;
@@ -3042,46 +3129,58 @@ bool SDL_GamepadHasButton(SDL_Gamepad *gamepad, SDL_GamepadButton button)
 }
 
 /*
- * Get the current state of a button on a gamepad
+ * Helper function to get the current state of a button on a gamepad
  */
-bool SDL_GetGamepadButton(SDL_Gamepad *gamepad, SDL_GamepadButton button)
+static bool SDL_PrivateGetGamepadButton(SDL_Gamepad *gamepad, SDL_GamepadButton button)
 {
     bool result = false;
+    int i;
 
-    SDL_LockJoysticks();
-    {
-        int i;
+    SDL_AssertJoysticksLocked();
 
-        CHECK_GAMEPAD_MAGIC(gamepad, false);
+    for (i = 0; i < gamepad->num_bindings; ++i) {
+        const SDL_GamepadBinding *binding = &gamepad->bindings[i];
+        if (binding->output_type == SDL_GAMEPAD_BINDTYPE_BUTTON && binding->output.button == button) {
+            if (binding->input_type == SDL_GAMEPAD_BINDTYPE_AXIS) {
+                bool valid_input_range;
 
-        for (i = 0; i < gamepad->num_bindings; ++i) {
-            const SDL_GamepadBinding *binding = &gamepad->bindings[i];
-            if (binding->output_type == SDL_GAMEPAD_BINDTYPE_BUTTON && binding->output.button == button) {
-                if (binding->input_type == SDL_GAMEPAD_BINDTYPE_AXIS) {
-                    bool valid_input_range;
-
-                    int value = SDL_GetJoystickAxis(gamepad->joystick, binding->input.axis.axis);
-                    int threshold = binding->input.axis.axis_min + (binding->input.axis.axis_max - binding->input.axis.axis_min) / 2;
-                    if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
-                        valid_input_range = (value >= binding->input.axis.axis_min && value <= binding->input.axis.axis_max);
-                        if (valid_input_range) {
-                            result |= (value >= threshold);
-                        }
-                    } else {
-                        valid_input_range = (value >= binding->input.axis.axis_max && value <= binding->input.axis.axis_min);
-                        if (valid_input_range) {
-                            result |= (value <= threshold);
-                        }
+                int value = SDL_GetJoystickAxis(gamepad->joystick, binding->input.axis.axis);
+                int threshold = binding->input.axis.axis_min + (binding->input.axis.axis_max - binding->input.axis.axis_min) / 2;
+                if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
+                    valid_input_range = (value >= binding->input.axis.axis_min && value <= binding->input.axis.axis_max);
+                    if (valid_input_range) {
+                        result |= (value >= threshold);
+                    }
+                } else {
+                    valid_input_range = (value >= binding->input.axis.axis_max && value <= binding->input.axis.axis_min);
+                    if (valid_input_range) {
+                        result |= (value <= threshold);
                     }
-                } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_BUTTON) {
-                    result |= SDL_GetJoystickButton(gamepad->joystick, binding->input.button);
-                } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_HAT) {
-                    int hat_mask = SDL_GetJoystickHat(gamepad->joystick, binding->input.hat.hat);
-                    result |= ((hat_mask & binding->input.hat.hat_mask) != 0);
                 }
+            } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_BUTTON) {
+                result |= SDL_GetJoystickButton(gamepad->joystick, binding->input.button);
+            } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_HAT) {
+                int hat_mask = SDL_GetJoystickHat(gamepad->joystick, binding->input.hat.hat);
+                result |= ((hat_mask & binding->input.hat.hat_mask) != 0);
             }
         }
     }
+    return result;
+}
+
+/*
+ * Get the current state of a button on a gamepad
+ */
+bool SDL_GetGamepadButton(SDL_Gamepad *gamepad, SDL_GamepadButton button)
+{
+    bool result;
+
+    SDL_LockJoysticks();
+    {
+        CHECK_GAMEPAD_MAGIC(gamepad, false);
+
+        result = SDL_PrivateGetGamepadButton(gamepad, button);
+    }
     SDL_UnlockJoysticks();
 
     return result;
@@ -3462,6 +3561,99 @@ bool SDL_GetGamepadSensorData(SDL_Gamepad *gamepad, SDL_SensorType type, float *
     return SDL_Unsupported();
 }
 
+/*
+ * Helper function to publish the current state of a gamepad for SDL_GetGamepadState()
+ */
+static void SDL_PrivatePublishGamepadState(SDL_Gamepad *gamepad)
+{
+    SDL_Joystick *joystick = gamepad->joystick;
+    SDL_GamepadState state;
+    int i, j;
+
+    SDL_AssertJoysticksLocked();
+
+    // Gather the state first, so readers only have to retry during the copy
+    SDL_zero(state);
+    state.timestamp = SDL_GetTicksNS();
+    for (i = 0; i < SDL_GAMEPAD_AXIS_COUNT; ++i) {
+        state.axes[i] = SDL_PrivateGetGamepadAxis(gamepad, (SDL_GamepadAxis)i);
+    }
+    for (i = 0; i < SDL_GAMEPAD_BUTTON_COUNT; ++i) {
+        state.buttons[i] = SDL_PrivateGetGamepadButton(gamepad, (SDL_GamepadButton)i);
+    }
+    state.num_touchpads = SDL_min(joystick->ntouchpads, SDL_GAMEPAD_STATE_MAX_TOUCHPADS);
+    for (i = 0; i < state.num_touchpads; ++i) {
+        const SDL_JoystickTouchpadInfo *touchpad = &joystick->touchpads[i];
+
+        state.num_fingers[i] = SDL_min(touchpad->nfingers, SDL_GAMEPAD_STATE_MAX_FINGERS);
+        for (j = 0; j < state.num_fingers[i]; ++j) {
+            const SDL_JoystickTouchpadFingerInfo *info = &touchpad->fingers[j];
+            SDL_GamepadFingerState *finger = &state.fingers[i][j];
+
+            finger->down = info->down;
+            finger->x = info->x;
+            finger->y = info->y;
+            finger->pressure = info->pressure;
+        }
+    }
+    state.num_sensors = SDL_min(joystick->nsensors, SDL_GAMEPAD_STATE_MAX_SENSORS);
+    for (i = 0; i < state.num_sensors; ++i) {
+        const SDL_JoystickSensorInfo *info = &joystick->sensors[i];
+        SDL_GamepadSensorState *sensor = &state.sensors[i];
+
+        sensor->type = info->type;
+        sensor->enabled = info->enabled;
+        SDL_memcpy(sensor->data, info->data, sizeof(sensor->data));
+    }
+
+    // This is a sequence lock, there is only one writer since we hold the joystick lock
+    SDL_AddAtomicInt(&gamepad->state_sequence, 1);
+    SDL_MemoryBarrierRelease();
+    SDL_copyp(&gamepad->state, &state);
+    SDL_MemoryBarrierRelease();
+    SDL_AddAtomicInt(&gamepad->state_sequence, 1);
+}
+
+void SDL_UpdateGamepadStates(void)
+{
+    SDL_Gamepad *gamepad;
+
+    SDL_AssertJoysticksLocked();
+
+    for (gamepad = SDL_gamepads; gamepad; gamepad = gamepad->next) {
+        if (SDL_IsJoystickValid(gamepad->joystick)) {
+            SDL_PrivatePublishGamepadState(gamepad);
+        }
+    }
+}
+
+bool SDL_GetGamepadState(SDL_Gamepad *gamepad, SDL_GamepadState *state)
+{
+    // This doesn't take the joystick lock, the state is published by SDL_UpdateGamepadStates()
+    if (!SDL_ObjectValid(gamepad, SDL_OBJECT_TYPE_GAMEPAD)) {
+        return SDL_InvalidParamError("gamepad");
+    }
+    if (!state) {
+        return SDL_InvalidParamError("state");
+    }
+
+    for (;;) {
+        const int sequence = SDL_GetAtomicInt(&gamepad->state_sequence);
+        if (sequence & 1) {
+            // The state is being written, wait for it to finish
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+
+        SDL_copyp(state, &gamepad->state);
+        SDL_MemoryBarrierAcquire();
+
+        if (SDL_GetAtomicInt(&gamepad->state_sequence) == sequence) {
+            return true;
+        }
+    }
+}
+
 SDL_JoystickID SDL_GetGamepadID(SDL_Gamepad *gamepad)
 {
     SDL_Joystick *joystick = SDL_GetGamepadJoystick(gamepad);
@@ -3891,6 +4083,12 @@ void SDL_QuitGamepadMappings(void)
         SDL_free(pGamepadMap->mapping);
         SDL_free(pGamepadMap);
     }
+    s_pLastSupportedGamepad = NULL;
+
+    if (s_gamepadMappingsByGUID) {
+        SDL_DestroyHashTable(s_gamepadMappingsByGUID);
+        s_gamepadMappingsByGUID = NULL;
+    }
 
     SDL_FreeVIDPIDList(&SDL_allowed_gamepads);
     SDL_FreeVIDPIDList(&SDL_ignored_gamepads);
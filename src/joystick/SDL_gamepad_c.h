@@ -44,6 +44,9 @@ extern bool SDL_ShouldIgnoreGamepad(Uint16 vendor_id, Uint16 product_id, Uint16
 // Handle delayed guide button on a gamepad
 extern void SDL_GamepadHandleDelayedGuideButton(SDL_Joystick *joystick);
 
+// Publish the state of all open gamepads for SDL_GetGamepadState()
+extern void SDL_UpdateGamepadStates(void);
+
 // Handle system sensor data
 extern void SDL_GamepadSensorWatcher(Uint64 timestamp, SDL_SensorID sensor, Uint64 sensor_timestamp, float *data, int num_values);
 
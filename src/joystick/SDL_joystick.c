@@ -2721,6 +2721,8 @@ void SDL_UpdateJoysticks(void)
         }
     }
 
+    SDL_UpdateGamepadStates();
+
     if (SDL_EventEnabled(SDL_EVENT_JOYSTICK_UPDATE_COMPLETE)) {
         for (joystick = SDL_joysticks; joystick; joystick = joystick->next) {
             if (joystick->update_complete) {
@@ -36,7 +36,12 @@
 #include <sys/inotify.h>
 #include <string.h> // strerror
 #endif
+#ifdef HAVE_EPOLL
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
 #include <sys/ioctl.h>
+#include <time.h>
 #include <unistd.h>
 #include <dirent.h>
 #include <linux/joystick.h>
@@ -144,6 +149,9 @@ static EnumerationMethod enumeration_method = ENUMERATION_UNSET;
 static bool IsJoystickJSNode(const char *node);
 static void MaybeAddDevice(const char *path);
 static void MaybeRemoveDevice(const char *path);
+#ifdef HAVE_EPOLL
+static void LINUX_StartInputThread(void);
+#endif
 
 // A linked list of available joysticks
 typedef struct SDL_joylist_item
@@ -177,9 +185,53 @@ static int numjoysticks SDL_GUARDED_BY(SDL_joystick_lock) = 0;
 static SDL_sensorlist_item *SDL_sensorlist SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static int inotify_fd = -1;
 
+#ifdef HAVE_EPOLL
+// The optional input thread, see SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD
+typedef enum
+{
+    INPUT_THREAD_WAKEUP,
+    INPUT_THREAD_INOTIFY,
+    INPUT_THREAD_JOYSTICK,
+    INPUT_THREAD_SENSOR
+} InputThreadSource;
+
+static SDL_Thread *input_thread;
+static SDL_AtomicInt input_thread_quit;
+static int input_epoll_fd = -1;
+static int input_wakeup_fd = -1;
+#endif
+
 static Uint64 last_joy_detect_time;
 static time_t last_input_dir_mtime;
 
+#ifdef HAVE_EPOLL
+/* Wake the input thread when fd is readable. The instance ID is looked up
+   again by the thread, since the joystick may be closed in the meantime. */
+static void AddInputThreadFd(int fd, InputThreadSource source, SDL_JoystickID instance_id)
+{
+    struct epoll_event event;
+
+    if (input_epoll_fd < 0 || fd < 0) {
+        return;
+    }
+
+    SDL_zero(event);
+    event.events = EPOLLIN;
+    event.data.u64 = ((Uint64)source << 32) | instance_id;
+    if (epoll_ctl(input_epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        // The input will still be read when events are pumped
+        SDL_LogWarn(SDL_LOG_CATEGORY_INPUT, "Couldn't add device to the joystick input thread: %s", strerror(errno));
+    }
+}
+
+static void RemoveInputThreadFd(int fd)
+{
+    if (input_epoll_fd >= 0 && fd >= 0) {
+        (void)epoll_ctl(input_epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+    }
+}
+#endif // HAVE_EPOLL
+
 static void FixupDeviceInfoForMapping(int fd, struct input_id *inpid)
 {
     if (inpid->vendor == 0x045e && inpid->product == 0x0b05 && inpid->version == 0x0903) {
@@ -1069,6 +1121,12 @@ static bool LINUX_JoystickInit(void)
 #endif // HAVE_INOTIFY
     }
 
+#ifdef HAVE_EPOLL
+    if (SDL_GetHintBoolean(SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD, false)) {
+        LINUX_StartInputThread();
+    }
+#endif
+
     return true;
 }
 
@@ -1605,6 +1663,13 @@ static bool LINUX_JoystickOpen(SDL_Joystick *joystick, int device_index)
     if (joystick->hwdata->ff_rumble || joystick->hwdata->ff_sine) {
         SDL_SetBooleanProperty(SDL_GetJoystickProperties(joystick), SDL_PROP_JOYSTICK_CAP_RUMBLE_BOOLEAN, true);
     }
+    if (!joystick->hwdata->classic) {
+        SDL_SetPointerProperty(SDL_GetJoystickProperties(joystick), SDL_PROP_JOYSTICK_LATENCY_HISTOGRAM_POINTER, joystick->hwdata->latency_histogram);
+    }
+
+#ifdef HAVE_EPOLL
+    AddInputThreadFd(joystick->hwdata->fd, INPUT_THREAD_JOYSTICK, joystick->instance_id);
+#endif
     return true;
 }
 
@@ -1686,8 +1751,14 @@ static bool LINUX_JoystickSetSensorsEnabled(SDL_Joystick *joystick, bool enabled
             return SDL_SetError("Couldn't open sensor file %s.", joystick->hwdata->item_sensor->path);
         }
         fcntl(joystick->hwdata->fd_sensor, F_SETFL, O_NONBLOCK);
+#ifdef HAVE_EPOLL
+        AddInputThreadFd(joystick->hwdata->fd_sensor, INPUT_THREAD_SENSOR, joystick->instance_id);
+#endif
     } else {
         SDL_assert(joystick->hwdata->fd_sensor >= 0);
+#ifdef HAVE_EPOLL
+        RemoveInputThreadFd(joystick->hwdata->fd_sensor);
+#endif
         close(joystick->hwdata->fd_sensor);
         joystick->hwdata->fd_sensor = -1;
     }
@@ -1879,6 +1950,26 @@ static void PollAllSensors(Uint64 timestamp, SDL_Joystick *joystick)
     }
 }
 
+// Count an input report by how long it took from the kernel to here
+static void RecordInputLatency(SDL_Joystick *joystick, const struct input_event *event)
+{
+    struct timespec now;
+    Sint64 latency;
+    int bucket = 0;
+
+    // evdev timestamps use CLOCK_REALTIME unless the clock is changed with EVIOCSCLOCKID
+    if (clock_gettime(CLOCK_REALTIME, &now) < 0) {
+        return;
+    }
+
+    latency = ((Sint64)now.tv_sec - event->input_event_sec) * SDL_US_PER_SECOND;
+    latency += (Sint64)SDL_NS_TO_US(now.tv_nsec) - event->input_event_usec;
+    while (bucket < (SDL_JOYSTICK_LATENCY_HISTOGRAM_BUCKETS - 1) && latency >= ((Sint64)64 << bucket)) {
+        ++bucket;
+    }
+    ++joystick->hwdata->latency_histogram[bucket];
+}
+
 static void HandleInputEvents(SDL_Joystick *joystick)
 {
     struct input_event events[32];
@@ -1973,6 +2064,8 @@ static void HandleInputEvents(SDL_Joystick *joystick)
                     if (joystick->hwdata->recovering_from_dropped) {
                         joystick->hwdata->recovering_from_dropped = false;
                         PollAllValues(SDL_GetTicksNS(), joystick); // try to sync up to current state now
+                    } else {
+                        RecordInputLatency(joystick, event);
                     }
                     break;
                 default:
@@ -2156,6 +2249,116 @@ static void LINUX_JoystickUpdate(SDL_Joystick *joystick)
     }
 }
 
+#ifdef HAVE_EPOLL
+static int SDLCALL LINUX_JoystickInputThread(void *data)
+{
+    struct epoll_event events[16];
+    int i, count;
+
+    while (!SDL_GetAtomicInt(&input_thread_quit)) {
+        count = epoll_wait(input_epoll_fd, events, SDL_arraysize(events), -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            SDL_LogError(SDL_LOG_CATEGORY_INPUT, "Joystick input thread couldn't wait for input: %s", strerror(errno));
+            break;
+        }
+
+        SDL_LockJoysticks();
+        if (SDL_GetAtomicInt(&input_thread_quit)) {
+            // LINUX_StopInputThread() is waiting for us with the joysticks closed
+            SDL_UnlockJoysticks();
+            break;
+        }
+        for (i = 0; i < count; ++i) {
+            const InputThreadSource source = (InputThreadSource)(events[i].data.u64 >> 32);
+            SDL_Joystick *joystick;
+
+            switch (source) {
+            case INPUT_THREAD_WAKEUP:
+            {
+                eventfd_t value;
+                (void)eventfd_read(input_wakeup_fd, &value);
+                break;
+            }
+            case INPUT_THREAD_INOTIFY:
+#ifdef HAVE_INOTIFY
+                LINUX_InotifyJoystickDetect();
+                HandlePendingRemovals();
+#endif
+                break;
+            case INPUT_THREAD_JOYSTICK:
+            case INPUT_THREAD_SENSOR:
+                joystick = SDL_GetJoystickFromID((SDL_JoystickID)events[i].data.u64);
+                if (!joystick || joystick->driver != &SDL_LINUX_JoystickDriver || !joystick->hwdata) {
+                    break;
+                }
+                if (joystick->hwdata->classic) {
+                    HandleClassicEvents(joystick);
+                } else {
+                    HandleInputEvents(joystick);
+                }
+
+                // Stop waiting on unplugged devices, they are removed during detection
+                if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                    RemoveInputThreadFd((source == INPUT_THREAD_SENSOR) ? joystick->hwdata->fd_sensor : joystick->hwdata->fd);
+                }
+                break;
+            }
+        }
+        SDL_UnlockJoysticks();
+    }
+    return 0;
+}
+
+static void LINUX_StopInputThread(void)
+{
+    SDL_AssertJoysticksLocked();
+
+    if (input_thread) {
+        SDL_SetAtomicInt(&input_thread_quit, 1);
+        (void)eventfd_write(input_wakeup_fd, 1);
+
+        // Unlock joysticks while the input thread finishes applying events
+        SDL_UnlockJoysticks();
+        SDL_WaitThread(input_thread, NULL);
+        SDL_LockJoysticks();
+        input_thread = NULL;
+    }
+    if (input_wakeup_fd >= 0) {
+        close(input_wakeup_fd);
+        input_wakeup_fd = -1;
+    }
+    if (input_epoll_fd >= 0) {
+        close(input_epoll_fd);
+        input_epoll_fd = -1;
+    }
+}
+
+static void LINUX_StartInputThread(void)
+{
+    SDL_AssertJoysticksLocked();
+
+    input_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    input_wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (input_epoll_fd < 0 || input_wakeup_fd < 0) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_INPUT, "Couldn't create joystick input thread: %s", strerror(errno));
+        LINUX_StopInputThread();
+        return;
+    }
+    AddInputThreadFd(input_wakeup_fd, INPUT_THREAD_WAKEUP, 0);
+    AddInputThreadFd(inotify_fd, INPUT_THREAD_INOTIFY, 0);
+
+    SDL_SetAtomicInt(&input_thread_quit, 0);
+    input_thread = SDL_CreateThread(LINUX_JoystickInputThread, "SDL_joystick", NULL);
+    if (!input_thread) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_INPUT, "Couldn't create joystick input thread: %s", SDL_GetError());
+        LINUX_StopInputThread();
+    }
+}
+#endif // HAVE_EPOLL
+
 // Function to close a joystick after use
 static void LINUX_JoystickClose(SDL_Joystick *joystick)
 {
@@ -2166,6 +2369,10 @@ static void LINUX_JoystickClose(SDL_Joystick *joystick)
             ioctl(joystick->hwdata->fd, EVIOCRMFF, joystick->hwdata->effect.id);
             joystick->hwdata->effect.id = -1;
         }
+#ifdef HAVE_EPOLL
+        RemoveInputThreadFd(joystick->hwdata->fd);
+        RemoveInputThreadFd(joystick->hwdata->fd_sensor);
+#endif
         if (joystick->hwdata->fd >= 0) {
             close(joystick->hwdata->fd);
         }
@@ -2197,6 +2404,10 @@ static void LINUX_JoystickQuit(void)
 
     SDL_AssertJoysticksLocked();
 
+#ifdef HAVE_EPOLL
+    LINUX_StopInputThread();
+#endif
+
     if (inotify_fd >= 0) {
         close(inotify_fd);
         inotify_fd = -1;
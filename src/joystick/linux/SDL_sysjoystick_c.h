@@ -112,6 +112,9 @@ struct joystick_hwdata
     // Set when gamepad is pending removal due to ENODEV read error
     bool gone;
     bool sensor_gone;
+
+    // Input reports by latency, see SDL_PROP_JOYSTICK_LATENCY_HISTOGRAM_POINTER
+    Uint64 latency_histogram[SDL_JOYSTICK_LATENCY_HISTOGRAM_BUCKETS];
 };
 
 #endif // SDL_sysjoystick_c_h_
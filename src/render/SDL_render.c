@@ -322,6 +322,11 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
 
     result = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
 
+    renderer->num_vertex_bytes += renderer->vertex_data_used;
+    SDL_SetNumberProperty(renderer->props, SDL_PROP_RENDERER_COMMANDS_NUMBER, (Sint64)renderer->num_render_commands);
+    SDL_SetNumberProperty(renderer->props, SDL_PROP_RENDERER_MERGED_COMMANDS_NUMBER, (Sint64)renderer->num_merged_commands);
+    SDL_SetNumberProperty(renderer->props, SDL_PROP_RENDERER_VERTEX_BYTES_NUMBER, (Sint64)renderer->num_vertex_bytes);
+
     // Move the whole render command queue to the unused pool so we can reuse them next time.
     if (renderer->render_commands_tail) {
         renderer->render_commands_tail->next = renderer->render_commands_pool;
@@ -330,6 +335,7 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
         renderer->render_commands = NULL;
     }
     renderer->vertex_data_used = 0;
+    renderer->merge_command = NULL;
     renderer->render_command_generation++;
     renderer->color_queued = false;
     renderer->viewport_queued = false;
@@ -422,6 +428,7 @@ static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
         renderer->render_commands = result;
     }
     renderer->render_commands_tail = result;
+    ++renderer->num_render_commands;
 
     return result;
 }
@@ -598,6 +605,52 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
     return cmd;
 }
 
+static bool CanMergeRenderCommands(SDL_Renderer *renderer, const SDL_RenderCommand *prev, const SDL_RenderCommand *cmd)
+{
+    if (cmd->command == SDL_RENDERCMD_COPY && !renderer->mergeable_copies) {
+        return false;
+    }
+    return prev->command == cmd->command &&
+           prev->data.draw.texture == cmd->data.draw.texture &&
+           prev->data.draw.blend == cmd->data.draw.blend &&
+           prev->data.draw.color.r == cmd->data.draw.color.r &&
+           prev->data.draw.color.g == cmd->data.draw.color.g &&
+           prev->data.draw.color.b == cmd->data.draw.color.b &&
+           prev->data.draw.color.a == cmd->data.draw.color.a &&
+           prev->data.draw.color_scale == cmd->data.draw.color_scale &&
+           prev->data.draw.texture_scale_mode == cmd->data.draw.texture_scale_mode &&
+           prev->data.draw.texture_address_mode_u == cmd->data.draw.texture_address_mode_u &&
+           prev->data.draw.texture_address_mode_v == cmd->data.draw.texture_address_mode_v &&
+           prev->data.draw.gpu_render_state == cmd->data.draw.gpu_render_state;
+}
+
+/* Append a newly queued COPY or GEOMETRY command to the previous draw, if
+ * nothing was queued in between and the backend put its vertices directly
+ * after the previous ones. */
+static void MergeRenderCommand(SDL_Renderer *renderer, SDL_RenderCommand *cmd, size_t vertex_start)
+{
+    SDL_RenderCommand *prev = renderer->merge_command;
+
+    if (prev && prev->next == cmd &&
+        renderer->merge_vertex_end == vertex_start &&
+        cmd->data.draw.first == vertex_start &&
+        renderer->vertex_data_used > vertex_start &&
+        CanMergeRenderCommands(renderer, prev, cmd)) {
+        prev->data.draw.count += cmd->data.draw.count;
+
+        // The new command is the tail of the queue, put it back in the pool
+        prev->next = NULL;
+        renderer->render_commands_tail = prev;
+        cmd->next = renderer->render_commands_pool;
+        renderer->render_commands_pool = cmd;
+        --renderer->num_render_commands;
+        ++renderer->num_merged_commands;
+        cmd = prev;
+    }
+    renderer->merge_command = cmd;
+    renderer->merge_vertex_end = renderer->vertex_data_used;
+}
+
 static bool QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points, const int count)
 {
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_POINTS, NULL);
@@ -702,9 +755,12 @@ static bool QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_COPY, texture);
     bool result = false;
     if (cmd) {
+        const size_t vertex_start = renderer->vertex_data_used;
         result = renderer->QueueCopy(renderer, cmd, texture, srcrect, dstrect);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            MergeRenderCommand(renderer, cmd, vertex_start);
         }
     }
     return result;
@@ -738,6 +794,7 @@ static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
     bool result = false;
     cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_GEOMETRY, texture);
     if (cmd) {
+        const size_t vertex_start = renderer->vertex_data_used;
         cmd->data.draw.texture_address_mode_u = texture_address_mode_u;
         cmd->data.draw.texture_address_mode_v = texture_address_mode_v;
         result = renderer->QueueGeometry(renderer, cmd, texture,
@@ -747,6 +804,8 @@ static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
                                          scale_x, scale_y);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            MergeRenderCommand(renderer, cmd, vertex_start);
         }
     }
     return result;
@@ -5482,6 +5541,7 @@ static void SDL_DiscardAllCommands(SDL_Renderer *renderer)
     renderer->render_commands_tail = NULL;
     renderer->render_commands = NULL;
     renderer->vertex_data_used = 0;
+    renderer->merge_command = NULL;
 
     while (cmd) {
         SDL_RenderCommand *next = cmd->next;
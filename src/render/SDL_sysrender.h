@@ -269,6 +269,7 @@ struct SDL_Renderer
     SDL_PixelFormat *texture_formats;
     int num_texture_formats;
     bool software;
+    bool mergeable_copies; // COPY commands with a count greater than one draw that many copies from consecutive vertices
 
     // The window associated with the renderer
     SDL_Window *window;
@@ -326,6 +327,15 @@ struct SDL_Renderer
     size_t vertex_data_used;
     size_t vertex_data_allocation;
 
+    // The last draw command that later draws with the same state can be appended to
+    SDL_RenderCommand *merge_command;
+    size_t merge_vertex_end;
+
+    // Statistics reported in the renderer properties
+    Uint64 num_render_commands;
+    Uint64 num_merged_commands;
+    Uint64 num_vertex_bytes;
+
     // Shaped window support
     bool transparent_window;
     SDL_Surface *shape_surface;
@@ -45,10 +45,50 @@ typedef struct
     SDL_Color color;
 } SW_DrawStateCache;
 
-typedef struct
+/* When rendering with multiple threads the target is split into horizontal
+ * bands. Each band has its own view of the target pixels and is clipped to
+ * its rows, so the commands that clip exactly per pixel can be replayed in
+ * every band in parallel and produce the same output as a single thread.
+ */
+#define SW_MAX_RENDER_BANDS 64
+#define SW_MIN_BAND_HEIGHT  16
+
+typedef struct SW_TileCommand
+{
+    SDL_RenderCommandType command;
+    SDL_Rect clip;      // the clip rectangle of the command on the whole target
+    SDL_Rect bounds;    // the area touched by the command, used to skip bands
+    SDL_BlendMode blend;
+    SDL_Color color;
+    Uint32 pixel;
+    const void *verts;
+    int count;
+    SDL_Surface **views; // per band views of the source texture
+} SW_TileCommand;
+
+typedef struct SW_RenderBand
+{
+    struct SW_RenderData *data;
+    SDL_Thread *thread;
+    SDL_Semaphore *start;
+    SDL_Surface *target;
+    SDL_Rect rect;
+} SW_RenderBand;
+
+typedef struct SW_RenderData
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    int num_bands;
+    int active_bands;
+    SW_RenderBand *bands;
+    SDL_Semaphore *done;
+    bool quit;
+    SW_TileCommand *tiles;
+    int num_tiles;
+    int max_tiles;
+    SDL_HashTable *texture_views;
 } SW_RenderData;
 
 static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
@@ -667,293 +707,691 @@ static void SW_InvalidateCachedState(SDL_Renderer *renderer)
 }
 
 
-static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+static void SW_RenderCopy(SDL_Surface *surface, const SDL_RenderCommand *cmd, const SDL_Rect *srcrect, SDL_Rect *dstrect, SW_DrawStateCache *drawstate)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SW_DrawStateCache drawstate;
+    SDL_Texture *texture = cmd->data.draw.texture;
+    SDL_Surface *src = (SDL_Surface *)texture->internal;
 
-    if (!SDL_SurfaceValid(surface)) {
-        return false;
+    PrepTextureForCopy(cmd, drawstate);
+
+    // Apply viewport
+    if (drawstate->viewport && (drawstate->viewport->x || drawstate->viewport->y)) {
+        dstrect->x += drawstate->viewport->x;
+        dstrect->y += drawstate->viewport->y;
     }
 
-    drawstate.viewport = NULL;
-    drawstate.cliprect = NULL;
-    drawstate.surface_cliprect_dirty = true;
-    drawstate.color.r = 0;
-    drawstate.color.g = 0;
-    drawstate.color.b = 0;
-    drawstate.color.a = 0;
+    if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
+        SDL_BlitSurface(src, srcrect, surface, dstrect);
+    } else {
+        /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
+         * to avoid potentially frequent RLE encoding/decoding.
+         */
+        SDL_SetSurfaceRLE(surface, 0);
 
-    while (cmd) {
-        switch (cmd->command) {
-        case SDL_RENDERCMD_SETDRAWCOLOR:
-        {
-            drawstate.color.r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            drawstate.color.g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            drawstate.color.b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            drawstate.color.a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
-            break;
+        // Prevent to do scaling + clipping on viewport boundaries as it may lose proportion
+        if (dstrect->x < 0 || dstrect->y < 0 || dstrect->x + dstrect->w > surface->w || dstrect->y + dstrect->h > surface->h) {
+            SDL_Surface *tmp = SDL_CreateSurface(dstrect->w, dstrect->h, src->format);
+            // Scale to an intermediate surface, then blit
+            if (tmp) {
+                SDL_Rect r;
+                SDL_BlendMode blendmode;
+                Uint8 alphaMod, rMod, gMod, bMod;
+
+                SDL_GetSurfaceBlendMode(src, &blendmode);
+                SDL_GetSurfaceAlphaMod(src, &alphaMod);
+                SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
+
+                r.x = 0;
+                r.y = 0;
+                r.w = dstrect->w;
+                r.h = dstrect->h;
+
+                SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+                SDL_SetSurfaceColorMod(src, 255, 255, 255);
+                SDL_SetSurfaceAlphaMod(src, 255);
+
+                SDL_BlitSurfaceScaled(src, srcrect, tmp, &r, cmd->data.draw.texture_scale_mode);
+
+                SDL_SetSurfaceColorMod(tmp, rMod, gMod, bMod);
+                SDL_SetSurfaceAlphaMod(tmp, alphaMod);
+                SDL_SetSurfaceBlendMode(tmp, blendmode);
+
+                SDL_BlitSurface(tmp, NULL, surface, dstrect);
+                SDL_DestroySurface(tmp);
+                // No need to set back r/g/b/a/blendmode to 'src' since it's done in PrepTextureForCopy()
+            }
+        } else {
+            SDL_BlitSurfaceScaled(src, srcrect, surface, dstrect, cmd->data.draw.texture_scale_mode);
         }
+    }
+}
 
-        case SDL_RENDERCMD_SETVIEWPORT:
-        {
-            drawstate.viewport = &cmd->data.viewport.rect;
-            drawstate.surface_cliprect_dirty = true;
-            break;
+static void SW_RunCommand(SDL_Renderer *renderer, SDL_Surface *surface, SDL_RenderCommand *cmd, void *vertices, SW_DrawStateCache *drawstate)
+{
+    switch (cmd->command) {
+    case SDL_RENDERCMD_SETDRAWCOLOR:
+    {
+        drawstate->color.r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        drawstate->color.g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        drawstate->color.b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        drawstate->color.a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
+        break;
+    }
+
+    case SDL_RENDERCMD_SETVIEWPORT:
+    {
+        drawstate->viewport = &cmd->data.viewport.rect;
+        drawstate->surface_cliprect_dirty = true;
+        break;
+    }
+
+    case SDL_RENDERCMD_SETCLIPRECT:
+    {
+        drawstate->cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+        drawstate->surface_cliprect_dirty = true;
+        break;
+    }
+
+    case SDL_RENDERCMD_CLEAR:
+    {
+        const Uint8 r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
+        // By definition the clear ignores the clip rect
+        SDL_SetSurfaceClipRect(surface, NULL);
+        SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        drawstate->surface_cliprect_dirty = true;
+        break;
+    }
+
+    case SDL_RENDERCMD_DRAW_POINTS:
+    {
+        const Uint8 r = drawstate->color.r;
+        const Uint8 g = drawstate->color.g;
+        const Uint8 b = drawstate->color.b;
+        const Uint8 a = drawstate->color.a;
+        const int count = (int)cmd->data.draw.count;
+        SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const SDL_BlendMode blend = cmd->data.draw.blend;
+        SetDrawState(surface, drawstate);
+
+        // Apply viewport
+        if (drawstate->viewport && (drawstate->viewport->x || drawstate->viewport->y)) {
+            int i;
+            for (i = 0; i < count; i++) {
+                verts[i].x += drawstate->viewport->x;
+                verts[i].y += drawstate->viewport->y;
+            }
         }
 
-        case SDL_RENDERCMD_SETCLIPRECT:
-        {
-            drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
-            drawstate.surface_cliprect_dirty = true;
-            break;
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_DrawPoints(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        } else {
+            SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
         }
+        break;
+    }
 
-        case SDL_RENDERCMD_CLEAR:
-        {
-            const Uint8 r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            const Uint8 g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            const Uint8 b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
-            const Uint8 a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
-            // By definition the clear ignores the clip rect
-            SDL_SetSurfaceClipRect(surface, NULL);
-            SDL_FillSurfaceRect(surface, NULL, SDL_MapSurfaceRGBA(surface, r, g, b, a));
-            drawstate.surface_cliprect_dirty = true;
-            break;
+    case SDL_RENDERCMD_DRAW_LINES:
+    {
+        const Uint8 r = drawstate->color.r;
+        const Uint8 g = drawstate->color.g;
+        const Uint8 b = drawstate->color.b;
+        const Uint8 a = drawstate->color.a;
+        const int count = (int)cmd->data.draw.count;
+        SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const SDL_BlendMode blend = cmd->data.draw.blend;
+        SetDrawState(surface, drawstate);
+
+        // Apply viewport
+        if (drawstate->viewport && (drawstate->viewport->x || drawstate->viewport->y)) {
+            int i;
+            for (i = 0; i < count; i++) {
+                verts[i].x += drawstate->viewport->x;
+                verts[i].y += drawstate->viewport->y;
+            }
         }
 
-        case SDL_RENDERCMD_DRAW_POINTS:
-        {
-            const Uint8 r = drawstate.color.r;
-            const Uint8 g = drawstate.color.g;
-            const Uint8 b = drawstate.color.b;
-            const Uint8 a = drawstate.color.a;
-            const int count = (int)cmd->data.draw.count;
-            SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_BlendMode blend = cmd->data.draw.blend;
-            SetDrawState(surface, &drawstate);
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_DrawLines(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        } else {
+            SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
+        }
+        break;
+    }
 
-            // Apply viewport
-            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                int i;
-                for (i = 0; i < count; i++) {
-                    verts[i].x += drawstate.viewport->x;
-                    verts[i].y += drawstate.viewport->y;
-                }
+    case SDL_RENDERCMD_FILL_RECTS:
+    {
+        const Uint8 r = drawstate->color.r;
+        const Uint8 g = drawstate->color.g;
+        const Uint8 b = drawstate->color.b;
+        const Uint8 a = drawstate->color.a;
+        const int count = (int)cmd->data.draw.count;
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const SDL_BlendMode blend = cmd->data.draw.blend;
+        SetDrawState(surface, drawstate);
+
+        // Apply viewport
+        if (drawstate->viewport && (drawstate->viewport->x || drawstate->viewport->y)) {
+            int i;
+            for (i = 0; i < count; i++) {
+                verts[i].x += drawstate->viewport->x;
+                verts[i].y += drawstate->viewport->y;
             }
+        }
 
-            if (blend == SDL_BLENDMODE_NONE) {
-                SDL_DrawPoints(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
-            } else {
-                SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
-            }
-            break;
+        if (blend == SDL_BLENDMODE_NONE) {
+            SDL_FillSurfaceRects(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
+        } else {
+            SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
         }
+        break;
+    }
 
-        case SDL_RENDERCMD_DRAW_LINES:
-        {
-            const Uint8 r = drawstate.color.r;
-            const Uint8 g = drawstate.color.g;
-            const Uint8 b = drawstate.color.b;
-            const Uint8 a = drawstate.color.a;
-            const int count = (int)cmd->data.draw.count;
-            SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_BlendMode blend = cmd->data.draw.blend;
-            SetDrawState(surface, &drawstate);
+    case SDL_RENDERCMD_COPY:
+    {
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const int count = (int)cmd->data.draw.count;
+        int i;
+
+        SetDrawState(surface, drawstate);
+
+        for (i = 0; i < count; i++, verts += 2) {
+            SW_RenderCopy(surface, cmd, &verts[0], &verts[1], drawstate);
+        }
+        break;
+    }
+
+    case SDL_RENDERCMD_COPY_EX:
+    {
+        CopyExData *copydata = (CopyExData *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        SetDrawState(surface, drawstate);
+        PrepTextureForCopy(cmd, drawstate);
+
+        // Apply viewport
+        if (drawstate->viewport && (drawstate->viewport->x || drawstate->viewport->y)) {
+            copydata->dstrect.x += drawstate->viewport->x;
+            copydata->dstrect.y += drawstate->viewport->y;
+        }
+
+        SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
+                        &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
+                        copydata->scale_x, copydata->scale_y, cmd->data.draw.texture_scale_mode);
+        break;
+    }
+
+    case SDL_RENDERCMD_GEOMETRY:
+    {
+        int i;
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const int count = (int)cmd->data.draw.count;
+        SDL_Texture *texture = cmd->data.draw.texture;
+        const SDL_BlendMode blend = cmd->data.draw.blend;
+
+        SetDrawState(surface, drawstate);
+
+        if (texture) {
+            SDL_Surface *src = (SDL_Surface *)texture->internal;
+
+            GeometryCopyData *ptr = (GeometryCopyData *)verts;
+
+            PrepTextureForCopy(cmd, drawstate);
 
             // Apply viewport
-            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                int i;
+            if (drawstate->viewport && (drawstate->viewport->x || drawstate->viewport->y)) {
+                SDL_Point vp;
+                vp.x = drawstate->viewport->x;
+                vp.y = drawstate->viewport->y;
+                trianglepoint_2_fixedpoint(&vp);
                 for (i = 0; i < count; i++) {
-                    verts[i].x += drawstate.viewport->x;
-                    verts[i].y += drawstate.viewport->y;
+                    ptr[i].dst.x += vp.x;
+                    ptr[i].dst.y += vp.y;
                 }
             }
 
-            if (blend == SDL_BLENDMODE_NONE) {
-                SDL_DrawLines(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
-            } else {
-                SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
+            for (i = 0; i < count; i += 3, ptr += 3) {
+                SDL_SW_BlitTriangle(
+                    src,
+                    &(ptr[0].src), &(ptr[1].src), &(ptr[2].src),
+                    surface,
+                    &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst),
+                    ptr[0].color, ptr[1].color, ptr[2].color,
+                    cmd->data.draw.texture_address_mode_u,
+                    cmd->data.draw.texture_address_mode_v);
             }
-            break;
-        }
-
-        case SDL_RENDERCMD_FILL_RECTS:
-        {
-            const Uint8 r = drawstate.color.r;
-            const Uint8 g = drawstate.color.g;
-            const Uint8 b = drawstate.color.b;
-            const Uint8 a = drawstate.color.a;
-            const int count = (int)cmd->data.draw.count;
-            SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_BlendMode blend = cmd->data.draw.blend;
-            SetDrawState(surface, &drawstate);
+        } else {
+            GeometryFillData *ptr = (GeometryFillData *)verts;
 
             // Apply viewport
-            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                int i;
+            if (drawstate->viewport && (drawstate->viewport->x || drawstate->viewport->y)) {
+                SDL_Point vp;
+                vp.x = drawstate->viewport->x;
+                vp.y = drawstate->viewport->y;
+                trianglepoint_2_fixedpoint(&vp);
                 for (i = 0; i < count; i++) {
-                    verts[i].x += drawstate.viewport->x;
-                    verts[i].y += drawstate.viewport->y;
+                    ptr[i].dst.x += vp.x;
+                    ptr[i].dst.y += vp.y;
                 }
             }
 
-            if (blend == SDL_BLENDMODE_NONE) {
-                SDL_FillSurfaceRects(surface, verts, count, SDL_MapSurfaceRGBA(surface, r, g, b, a));
-            } else {
-                SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
+            for (i = 0; i < count; i += 3, ptr += 3) {
+                SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
             }
-            break;
         }
+        break;
+    }
 
-        case SDL_RENDERCMD_COPY:
-        {
-            SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const SDL_Rect *srcrect = verts;
-            SDL_Rect *dstrect = verts + 1;
-            SDL_Texture *texture = cmd->data.draw.texture;
-            SDL_Surface *src = (SDL_Surface *)texture->internal;
+    case SDL_RENDERCMD_NO_OP:
+        break;
+    }
+}
 
-            SetDrawState(surface, &drawstate);
+static SDL_Surface *SW_CreateSurfaceView(SDL_Surface *surface)
+{
+    SDL_Surface *view = SDL_CreateSurfaceFrom(surface->w, surface->h, surface->format, surface->pixels, surface->pitch);
+    if (!view) {
+        return NULL;
+    }
+    SDL_SetSurfaceColorspace(view, surface->colorspace);
+    if (surface->props) {
+        SDL_CopyProperties(surface->props, SDL_GetSurfaceProperties(view));
+    }
+    if (surface->palette) {
+        SDL_SetSurfacePalette(view, surface->palette);
+    }
+    return view;
+}
 
-            PrepTextureForCopy(cmd, &drawstate);
+static bool SW_SurfaceViewMatches(SDL_Surface *view, SDL_Surface *surface)
+{
+    return view &&
+           view->pixels == surface->pixels &&
+           view->w == surface->w &&
+           view->h == surface->h &&
+           view->pitch == surface->pitch &&
+           view->format == surface->format &&
+           view->colorspace == surface->colorspace &&
+           view->palette == surface->palette;
+}
 
-            // Apply viewport
-            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                dstrect->x += drawstate.viewport->x;
-                dstrect->y += drawstate.viewport->y;
+static void SDLCALL SW_DestroyTextureViews(void *userdata, const void *key, const void *value)
+{
+    SW_RenderData *data = (SW_RenderData *)userdata;
+    SDL_Surface **views = (SDL_Surface **)value;
+    int i;
+
+    for (i = 0; i < data->num_bands; ++i) {
+        SDL_DestroySurface(views[i]);
+    }
+    SDL_free(views);
+}
+
+static SDL_Surface **SW_GetTextureViews(SW_RenderData *data, SDL_Texture *texture)
+{
+    SDL_Surface *surface = (SDL_Surface *)texture->internal;
+    SDL_Surface **views = NULL;
+    int i;
+
+    if (SDL_FindInHashTable(data->texture_views, texture, (const void **)&views)) {
+        return views;
+    }
+
+    views = (SDL_Surface **)SDL_calloc(data->num_bands, sizeof(*views));
+    if (!views) {
+        return NULL;
+    }
+    for (i = 0; i < data->active_bands; ++i) {
+        views[i] = SW_CreateSurfaceView(surface);
+        if (!views[i]) {
+            SW_DestroyTextureViews(data, texture, views);
+            return NULL;
+        }
+    }
+    if (!SDL_InsertIntoHashTable(data->texture_views, texture, views, false)) {
+        SW_DestroyTextureViews(data, texture, views);
+        return NULL;
+    }
+    return views;
+}
+
+static bool SW_PrepareBands(SW_RenderData *data, SDL_Surface *surface)
+{
+    int active_bands;
+    int i;
+
+    if (data->num_bands <= 1 || SDL_MUSTLOCK(surface)) {
+        return false;
+    }
+
+    active_bands = SDL_min(data->num_bands, surface->h / SW_MIN_BAND_HEIGHT);
+    if (active_bands <= 1) {
+        return false;
+    }
+
+    for (i = 0; i < active_bands; ++i) {
+        SW_RenderBand *band = &data->bands[i];
+
+        if (!SW_SurfaceViewMatches(band->target, surface)) {
+            SDL_DestroySurface(band->target);
+            band->target = SW_CreateSurfaceView(surface);
+            if (!band->target) {
+                return false;
+            }
+        }
+        band->rect.x = 0;
+        band->rect.y = (surface->h * i) / active_bands;
+        band->rect.w = surface->w;
+        band->rect.h = (surface->h * (i + 1)) / active_bands - band->rect.y;
+    }
+    data->active_bands = active_bands;
+    return true;
+}
+
+static void SW_RunTiles(SW_RenderData *data, SW_RenderBand *band)
+{
+    SDL_Surface *target = band->target;
+    int i;
+
+    for (i = 0; i < data->num_tiles; ++i) {
+        const SW_TileCommand *tile = &data->tiles[i];
+        SDL_Rect clip;
+
+        if (!SDL_GetRectIntersection(&tile->bounds, &band->rect, &clip)) {
+            continue;
+        }
+        SDL_GetRectIntersection(&tile->clip, &band->rect, &clip);
+        SDL_SetSurfaceClipRect(target, &clip);
+
+        switch (tile->command) {
+        case SDL_RENDERCMD_CLEAR:
+            SDL_FillSurfaceRect(target, NULL, tile->pixel);
+            break;
+
+        case SDL_RENDERCMD_DRAW_POINTS:
+            if (tile->blend == SDL_BLENDMODE_NONE) {
+                SDL_DrawPoints(target, (const SDL_Point *)tile->verts, tile->count, tile->pixel);
+            } else {
+                SDL_BlendPoints(target, (const SDL_Point *)tile->verts, tile->count, tile->blend, tile->color.r, tile->color.g, tile->color.b, tile->color.a);
             }
+            break;
 
-            if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
-                SDL_BlitSurface(src, srcrect, surface, dstrect);
+        case SDL_RENDERCMD_FILL_RECTS:
+            if (tile->blend == SDL_BLENDMODE_NONE) {
+                SDL_FillSurfaceRects(target, (const SDL_Rect *)tile->verts, tile->count, tile->pixel);
             } else {
-                /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
-                 * to avoid potentially frequent RLE encoding/decoding.
-                 */
-                SDL_SetSurfaceRLE(surface, 0);
-
-                // Prevent to do scaling + clipping on viewport boundaries as it may lose proportion
-                if (dstrect->x < 0 || dstrect->y < 0 || dstrect->x + dstrect->w > surface->w || dstrect->y + dstrect->h > surface->h) {
-                    SDL_Surface *tmp = SDL_CreateSurface(dstrect->w, dstrect->h, src->format);
-                    // Scale to an intermediate surface, then blit
-                    if (tmp) {
-                        SDL_Rect r;
-                        SDL_BlendMode blendmode;
-                        Uint8 alphaMod, rMod, gMod, bMod;
-
-                        SDL_GetSurfaceBlendMode(src, &blendmode);
-                        SDL_GetSurfaceAlphaMod(src, &alphaMod);
-                        SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
-
-                        r.x = 0;
-                        r.y = 0;
-                        r.w = dstrect->w;
-                        r.h = dstrect->h;
-
-                        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
-                        SDL_SetSurfaceColorMod(src, 255, 255, 255);
-                        SDL_SetSurfaceAlphaMod(src, 255);
-
-                        SDL_BlitSurfaceScaled(src, srcrect, tmp, &r, cmd->data.draw.texture_scale_mode);
-
-                        SDL_SetSurfaceColorMod(tmp, rMod, gMod, bMod);
-                        SDL_SetSurfaceAlphaMod(tmp, alphaMod);
-                        SDL_SetSurfaceBlendMode(tmp, blendmode);
-
-                        SDL_BlitSurface(tmp, NULL, surface, dstrect);
-                        SDL_DestroySurface(tmp);
-                        // No need to set back r/g/b/a/blendmode to 'src' since it's done in PrepTextureForCopy()
-                    }
-                } else {
-                    SDL_BlitSurfaceScaled(src, srcrect, surface, dstrect, cmd->data.draw.texture_scale_mode);
-                }
+                SDL_BlendFillRects(target, (const SDL_Rect *)tile->verts, tile->count, tile->blend, tile->color.r, tile->color.g, tile->color.b, tile->color.a);
             }
             break;
-        }
 
-        case SDL_RENDERCMD_COPY_EX:
+        case SDL_RENDERCMD_COPY:
         {
-            CopyExData *copydata = (CopyExData *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            SetDrawState(surface, &drawstate);
-            PrepTextureForCopy(cmd, &drawstate);
+            const SDL_Rect *verts = (const SDL_Rect *)tile->verts;
+            SDL_Surface *src = tile->views[band - data->bands];
 
-            // Apply viewport
-            if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                copydata->dstrect.x += drawstate.viewport->x;
-                copydata->dstrect.y += drawstate.viewport->y;
-            }
+            SDL_SetSurfaceColorMod(src, tile->color.r, tile->color.g, tile->color.b);
+            SDL_SetSurfaceAlphaMod(src, tile->color.a);
+            SDL_SetSurfaceBlendMode(src, tile->blend);
+            SDL_BlitSurface(src, &verts[0], target, &verts[1]);
+            break;
+        }
 
-            SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
-                            &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
-                            copydata->scale_x, copydata->scale_y, cmd->data.draw.texture_scale_mode);
+        default:
             break;
         }
+    }
+}
 
-        case SDL_RENDERCMD_GEOMETRY:
-        {
-            int i;
-            SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
-            const int count = (int)cmd->data.draw.count;
-            SDL_Texture *texture = cmd->data.draw.texture;
-            const SDL_BlendMode blend = cmd->data.draw.blend;
+static int SDLCALL SW_RenderThread(void *userdata)
+{
+    SW_RenderBand *band = (SW_RenderBand *)userdata;
+    SW_RenderData *data = band->data;
 
-            SetDrawState(surface, &drawstate);
+    for (;;) {
+        SDL_WaitSemaphore(band->start);
+        if (data->quit) {
+            break;
+        }
+        SW_RunTiles(data, band);
+        SDL_SignalSemaphore(data->done);
+    }
+    return 0;
+}
 
-            if (texture) {
-                SDL_Surface *src = (SDL_Surface *)texture->internal;
+static void SW_FlushTiles(SW_RenderData *data)
+{
+    int i;
 
-                GeometryCopyData *ptr = (GeometryCopyData *)verts;
+    if (data->num_tiles == 0) {
+        return;
+    }
 
-                PrepTextureForCopy(cmd, &drawstate);
+    for (i = 1; i < data->active_bands; ++i) {
+        SDL_SignalSemaphore(data->bands[i].start);
+    }
+    SW_RunTiles(data, &data->bands[0]);
+    for (i = 1; i < data->active_bands; ++i) {
+        SDL_WaitSemaphore(data->done);
+    }
+    data->num_tiles = 0;
+}
 
-                // Apply viewport
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    SDL_Point vp;
-                    vp.x = drawstate.viewport->x;
-                    vp.y = drawstate.viewport->y;
-                    trianglepoint_2_fixedpoint(&vp);
-                    for (i = 0; i < count; i++) {
-                        ptr[i].dst.x += vp.x;
-                        ptr[i].dst.y += vp.y;
-                    }
+static SW_TileCommand *SW_AddTile(SW_RenderData *data, SDL_RenderCommand *cmd, SDL_Surface *surface, const SW_DrawStateCache *drawstate)
+{
+    SW_TileCommand *tile;
+
+    if (data->num_tiles == data->max_tiles) {
+        const int max_tiles = data->max_tiles ? (data->max_tiles * 2) : 256;
+        SW_TileCommand *tiles = (SW_TileCommand *)SDL_realloc(data->tiles, max_tiles * sizeof(*tiles));
+        if (!tiles) {
+            return NULL;
+        }
+        data->tiles = tiles;
+        data->max_tiles = max_tiles;
+    }
+
+    tile = &data->tiles[data->num_tiles];
+    SDL_zerop(tile);
+    tile->command = cmd->command;
+    tile->color = drawstate->color;
+
+    // This matches the clip rectangle SetDrawState() would set on the target
+    tile->clip.x = 0;
+    tile->clip.y = 0;
+    tile->clip.w = surface->w;
+    tile->clip.h = surface->h;
+    if (drawstate->viewport) {
+        SDL_Rect clip_rect;
+        if (drawstate->cliprect) {
+            clip_rect.x = drawstate->cliprect->x + drawstate->viewport->x;
+            clip_rect.y = drawstate->cliprect->y + drawstate->viewport->y;
+            clip_rect.w = drawstate->cliprect->w;
+            clip_rect.h = drawstate->cliprect->h;
+            SDL_GetRectIntersection(drawstate->viewport, &clip_rect, &clip_rect);
+        } else {
+            clip_rect = *drawstate->viewport;
+        }
+        SDL_GetRectIntersection(&clip_rect, &tile->clip, &tile->clip);
+    }
+    return tile;
+}
+
+static void SW_CommitTile(SW_RenderData *data, SW_TileCommand *tile, const SDL_Rect *bounds)
+{
+    if (SDL_GetRectIntersection(bounds, &tile->clip, &tile->bounds)) {
+        ++data->num_tiles;
+    }
+}
+
+// Returns false if the command has to be run on the whole target instead
+static bool SW_BinCommand(SDL_Renderer *renderer, SDL_Surface *surface, SDL_RenderCommand *cmd, void *vertices, SW_DrawStateCache *drawstate)
+{
+    SW_RenderData *data = (SW_RenderData *)renderer->internal;
+    SW_TileCommand *tile;
+    SDL_Rect bounds;
+    int i;
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_SETDRAWCOLOR:
+    case SDL_RENDERCMD_SETVIEWPORT:
+    case SDL_RENDERCMD_SETCLIPRECT:
+    case SDL_RENDERCMD_NO_OP:
+        SW_RunCommand(renderer, surface, cmd, vertices, drawstate);
+        return true;
+
+    case SDL_RENDERCMD_CLEAR:
+    {
+        const Uint8 r = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.r * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 g = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.g * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 b = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.b * cmd->data.color.color_scale, 0.0f, 1.0f) * 255.0f);
+        const Uint8 a = (Uint8)SDL_roundf(SDL_clamp(cmd->data.color.color.a, 0.0f, 1.0f) * 255.0f);
+
+        tile = SW_AddTile(data, cmd, surface, drawstate);
+        if (!tile) {
+            return false;
+        }
+        // By definition the clear ignores the clip rect
+        tile->clip.x = 0;
+        tile->clip.y = 0;
+        tile->clip.w = surface->w;
+        tile->clip.h = surface->h;
+        tile->pixel = SDL_MapSurfaceRGBA(surface, r, g, b, a);
+        SW_CommitTile(data, tile, &tile->clip);
+        return true;
+    }
+
+    case SDL_RENDERCMD_DRAW_POINTS:
+    case SDL_RENDERCMD_FILL_RECTS:
+    {
+        const int count = (int)cmd->data.draw.count;
+
+        tile = SW_AddTile(data, cmd, surface, drawstate);
+        if (!tile) {
+            return false;
+        }
+        tile->blend = cmd->data.draw.blend;
+        tile->verts = ((Uint8 *)vertices) + cmd->data.draw.first;
+        tile->count = count;
+        tile->pixel = SDL_MapSurfaceRGBA(surface, drawstate->color.r, drawstate->color.g, drawstate->color.b, drawstate->color.a);
+
+        if (cmd->command == SDL_RENDERCMD_DRAW_POINTS) {
+            SDL_Point *verts = (SDL_Point *)tile->verts;
+
+            // Apply viewport
+            if (drawstate->viewport && (drawstate->viewport->x || drawstate->viewport->y)) {
+                for (i = 0; i < count; i++) {
+                    verts[i].x += drawstate->viewport->x;
+                    verts[i].y += drawstate->viewport->y;
                 }
+            }
+            if (!SDL_GetRectEnclosingPoints(verts, count, NULL, &bounds)) {
+                return true;
+            }
+        } else {
+            SDL_Rect *verts = (SDL_Rect *)tile->verts;
 
-                for (i = 0; i < count; i += 3, ptr += 3) {
-                    SDL_SW_BlitTriangle(
-                        src,
-                        &(ptr[0].src), &(ptr[1].src), &(ptr[2].src),
-                        surface,
-                        &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst),
-                        ptr[0].color, ptr[1].color, ptr[2].color,
-                        cmd->data.draw.texture_address_mode_u,
-                        cmd->data.draw.texture_address_mode_v);
+            // Apply viewport
+            if (drawstate->viewport && (drawstate->viewport->x || drawstate->viewport->y)) {
+                for (i = 0; i < count; i++) {
+                    verts[i].x += drawstate->viewport->x;
+                    verts[i].y += drawstate->viewport->y;
                 }
-            } else {
-                GeometryFillData *ptr = (GeometryFillData *)verts;
-
-                // Apply viewport
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    SDL_Point vp;
-                    vp.x = drawstate.viewport->x;
-                    vp.y = drawstate.viewport->y;
-                    trianglepoint_2_fixedpoint(&vp);
-                    for (i = 0; i < count; i++) {
-                        ptr[i].dst.x += vp.x;
-                        ptr[i].dst.y += vp.y;
+            }
+            SDL_zero(bounds);
+            for (i = 0; i < count; i++) {
+                SDL_GetRectUnion(&bounds, &verts[i], &bounds);
+            }
+        }
+        SW_CommitTile(data, tile, &bounds);
+        return true;
+    }
+
+    case SDL_RENDERCMD_COPY:
+    {
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const int count = (int)cmd->data.draw.count;
+        SDL_Surface *src = (SDL_Surface *)cmd->data.draw.texture->internal;
+        SDL_Surface **views = NULL;
+
+        for (i = 0; i < count; i++, verts += 2) {
+            // Scaled copies are clipped differently on partial targets
+            tile = NULL;
+            if (verts[0].w == verts[1].w && verts[0].h == verts[1].h) {
+                PrepTextureForCopy(cmd, drawstate);
+                if (!SDL_SurfaceHasRLE(src) && !SDL_SurfaceHasColorKey(src)) {
+                    if (!views) {
+                        views = SW_GetTextureViews(data, cmd->data.draw.texture);
+                    }
+                    if (views) {
+                        tile = SW_AddTile(data, cmd, surface, drawstate);
                     }
                 }
+            }
+            if (!tile) {
+                SW_FlushTiles(data);
+                SetDrawState(surface, drawstate);
+                SW_RenderCopy(surface, cmd, &verts[0], &verts[1], drawstate);
+                continue;
+            }
+            tile->blend = cmd->data.draw.blend;
+            tile->verts = verts;
+            tile->views = views;
 
-                for (i = 0; i < count; i += 3, ptr += 3) {
-                    SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
-                }
+            // Apply viewport
+            if (drawstate->viewport && (drawstate->viewport->x || drawstate->viewport->y)) {
+                verts[1].x += drawstate->viewport->x;
+                verts[1].y += drawstate->viewport->y;
             }
-            break;
+            SW_CommitTile(data, tile, &verts[1]);
         }
+        return true;
+    }
 
-        case SDL_RENDERCMD_NO_OP:
-            break;
+    default:
+        return false;
+    }
+}
+
+static void SW_RunCommandQueueThreaded(SDL_Renderer *renderer, SDL_Surface *surface, SDL_RenderCommand *cmd, void *vertices, SW_DrawStateCache *drawstate)
+{
+    SW_RenderData *data = (SW_RenderData *)renderer->internal;
+
+    while (cmd) {
+        if (!SW_BinCommand(renderer, surface, cmd, vertices, drawstate)) {
+            SW_FlushTiles(data);
+            SW_RunCommand(renderer, surface, cmd, vertices, drawstate);
         }
+        cmd = cmd->next;
+    }
+    SW_FlushTiles(data);
+
+    SDL_ClearHashTable(data->texture_views);
+}
 
+static bool SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+{
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SW_DrawStateCache drawstate;
+
+    if (!SDL_SurfaceValid(surface)) {
+        return false;
+    }
+
+    drawstate.viewport = NULL;
+    drawstate.cliprect = NULL;
+    drawstate.surface_cliprect_dirty = true;
+    drawstate.color.r = 0;
+    drawstate.color.g = 0;
+    drawstate.color.b = 0;
+    drawstate.color.a = 0;
+
+    if (SW_PrepareBands((SW_RenderData *)renderer->internal, surface)) {
+        SW_RunCommandQueueThreaded(renderer, surface, cmd, vertices, &drawstate);
+        return true;
+    }
+
+    while (cmd) {
+        SW_RunCommand(renderer, surface, cmd, vertices, &drawstate);
         cmd = cmd->next;
     }
 
@@ -1003,6 +1441,88 @@ static void SW_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
     SDL_DestroySurface(surface);
 }
 
+static void SW_DestroyRenderThreads(SW_RenderData *data)
+{
+    int i;
+
+    if (!data->bands) {
+        return;
+    }
+
+    data->quit = true;
+    for (i = 1; i < data->num_bands; ++i) {
+        SDL_SignalSemaphore(data->bands[i].start);
+    }
+    for (i = 0; i < data->num_bands; ++i) {
+        SW_RenderBand *band = &data->bands[i];
+        SDL_WaitThread(band->thread, NULL);
+        SDL_DestroySemaphore(band->start);
+        SDL_DestroySurface(band->target);
+    }
+    SDL_DestroySemaphore(data->done);
+    SDL_DestroyHashTable(data->texture_views);
+    SDL_free(data->bands);
+    SDL_free(data->tiles);
+
+    data->bands = NULL;
+    data->num_bands = 0;
+}
+
+static void SW_CreateRenderThreads(SW_RenderData *data)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    int num_bands;
+    int i;
+
+    if (!hint || !*hint) {
+        return;
+    }
+
+    num_bands = SDL_atoi(hint);
+    if (num_bands <= 0) {
+        num_bands = SDL_GetNumLogicalCPUCores();
+    }
+    num_bands = SDL_min(num_bands, SW_MAX_RENDER_BANDS);
+    if (num_bands <= 1) {
+        return;
+    }
+
+    data->bands = (SW_RenderBand *)SDL_calloc(num_bands, sizeof(*data->bands));
+    data->done = SDL_CreateSemaphore(0);
+    data->texture_views = SDL_CreateHashTable(0, false, SDL_HashPointer, SDL_KeyMatchPointer, SW_DestroyTextureViews, data);
+    if (!data->bands || !data->done || !data->texture_views) {
+        SDL_free(data->bands);
+        SDL_DestroySemaphore(data->done);
+        SDL_DestroyHashTable(data->texture_views);
+        data->bands = NULL;
+        data->done = NULL;
+        data->texture_views = NULL;
+        return;
+    }
+
+    // The thread running the command queue renders the first band itself
+    data->bands[0].data = data;
+    data->num_bands = 1;
+    for (i = 1; i < num_bands; ++i) {
+        SW_RenderBand *band = &data->bands[i];
+        char name[32];
+
+        band->data = data;
+        band->start = SDL_CreateSemaphore(0);
+        if (!band->start) {
+            break;
+        }
+        SDL_snprintf(name, sizeof(name), "SDLRenderSW%d", i);
+        band->thread = SDL_CreateThread(SW_RenderThread, name, band);
+        if (!band->thread) {
+            SDL_DestroySemaphore(band->start);
+            band->start = NULL;
+            break;
+        }
+        ++data->num_bands;
+    }
+}
+
 static void SW_DestroyRenderer(SDL_Renderer *renderer)
 {
     SDL_Window *window = renderer->window;
@@ -1011,6 +1531,7 @@ static void SW_DestroyRenderer(SDL_Renderer *renderer)
     if (window) {
         SDL_DestroyWindowSurface(window);
     }
+    SW_DestroyRenderThreads(data);
     SDL_free(data);
 }
 
@@ -1118,6 +1639,7 @@ bool SW_CreateRendererForSurface(SDL_Renderer *renderer, SDL_Surface *surface, S
     }
 
     renderer->software = true;
+    renderer->mergeable_copies = true;
 
     data = (SW_RenderData *)SDL_calloc(1, sizeof(*data));
     if (!data) {
@@ -1125,6 +1647,7 @@ bool SW_CreateRendererForSurface(SDL_Renderer *renderer, SDL_Surface *surface, S
     }
     data->surface = surface;
     data->window = surface;
+    SW_CreateRenderThreads(data);
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
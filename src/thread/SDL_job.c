@@ -0,0 +1,581 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// A pool of worker threads that run jobs, shared by the app and by SDL itself
+
+#include "SDL_thread_c.h"
+
+/* Each worker has its own queue of jobs. A worker takes the newest job from
+ * its own queue, and when that's empty it steals the oldest job from another
+ * worker. Jobs submitted from threads outside the pool go to each worker in
+ * turn. Threads with nothing to do sleep on a single condition variable,
+ * which is only signaled when someone is actually asleep.
+ */
+
+typedef struct SDL_Job
+{
+    SDL_JobFunction function;
+    void *userdata;
+    SDL_JobCounter *counter;
+    struct SDL_Job *prev;
+    struct SDL_Job *next;
+} SDL_Job;
+
+struct SDL_JobCounter
+{
+    SDL_AtomicInt value;
+    SDL_SpinLock lock; // protects `waiting`, and `value` reaching zero
+    SDL_Job *waiting;  // jobs that start when `value` reaches zero
+};
+
+typedef struct SDL_JobWorker
+{
+    SDL_SpinLock lock; // protects the queue
+    SDL_Job *first;    // the oldest job, which other workers steal
+    SDL_Job *last;     // the newest job, which this worker runs next
+    SDL_Thread *thread;
+} SDL_JobWorker;
+
+static struct
+{
+    SDL_InitState init;
+    SDL_JobWorker *workers;
+    int num_workers;
+    SDL_AtomicInt next_worker;  // where the next job from outside the pool goes
+    SDL_AtomicInt num_queued;   // jobs in all the queues, not counting jobs waiting on a dependency
+    SDL_AtomicInt num_sleeping; // threads waiting on `wakeup`
+    SDL_AtomicInt quit;
+    SDL_Mutex *lock;
+    SDL_Condition *wakeup;
+    SDL_AtomicInt num_waiting_for_pieces; // threads in SDL_RunParallelFor() waiting on `pieces_done`
+    SDL_Condition *pieces_done;
+    SDL_TLSID worker_index; // the worker's index plus one, on worker threads
+
+    // Finished jobs are kept for reuse, so submitting a job doesn't usually allocate
+    SDL_SpinLock free_lock;
+    SDL_Job *free_jobs;
+} SDL_jobs;
+
+static SDL_Job *SDL_AllocJob(void)
+{
+    SDL_Job *job;
+
+    SDL_LockSpinlock(&SDL_jobs.free_lock);
+    job = SDL_jobs.free_jobs;
+    if (job) {
+        SDL_jobs.free_jobs = job->next;
+    }
+    SDL_UnlockSpinlock(&SDL_jobs.free_lock);
+
+    if (!job) {
+        job = (SDL_Job *)SDL_malloc(sizeof(*job));
+    }
+    return job;
+}
+
+static void SDL_FreeJob(SDL_Job *job)
+{
+    SDL_LockSpinlock(&SDL_jobs.free_lock);
+    job->next = SDL_jobs.free_jobs;
+    SDL_jobs.free_jobs = job;
+    SDL_UnlockSpinlock(&SDL_jobs.free_lock);
+}
+
+static int SDL_GetJobWorkerIndex(void)
+{
+    return (int)(intptr_t)SDL_GetTLS(&SDL_jobs.worker_index) - 1;
+}
+
+static void SDL_WakeJobThreads(bool all)
+{
+    if (SDL_GetAtomicInt(&SDL_jobs.num_sleeping) > 0) {
+        SDL_LockMutex(SDL_jobs.lock);
+        if (all) {
+            SDL_BroadcastCondition(SDL_jobs.wakeup);
+        } else {
+            SDL_SignalCondition(SDL_jobs.wakeup);
+        }
+        SDL_UnlockMutex(SDL_jobs.lock);
+    }
+}
+
+static void SDL_RunJob(SDL_Job *job);
+
+static void SDL_QueueJob(SDL_Job *job)
+{
+    SDL_JobWorker *worker;
+    int index;
+
+    if (SDL_jobs.num_workers == 0) {
+        // There are no worker threads, so run it here
+        SDL_RunJob(job);
+        return;
+    }
+
+    index = SDL_GetJobWorkerIndex();
+    if (index < 0) {
+        index = (int)((Uint32)SDL_AddAtomicInt(&SDL_jobs.next_worker, 1) % (Uint32)SDL_jobs.num_workers);
+    }
+    worker = &SDL_jobs.workers[index];
+
+    // Count it first, so nothing goes to sleep between it being queued and counted
+    SDL_AtomicIncRef(&SDL_jobs.num_queued);
+
+    job->next = NULL;
+    SDL_LockSpinlock(&worker->lock);
+    job->prev = worker->last;
+    if (worker->last) {
+        worker->last->next = job;
+    } else {
+        worker->first = job;
+    }
+    worker->last = job;
+    SDL_UnlockSpinlock(&worker->lock);
+
+    SDL_WakeJobThreads(false);
+}
+
+static SDL_Job *SDL_TakeJob(SDL_JobWorker *worker, bool newest)
+{
+    SDL_Job *job;
+
+    SDL_LockSpinlock(&worker->lock);
+    job = newest ? worker->last : worker->first;
+    if (job) {
+        if (job->prev) {
+            job->prev->next = job->next;
+        } else {
+            worker->first = job->next;
+        }
+        if (job->next) {
+            job->next->prev = job->prev;
+        } else {
+            worker->last = job->prev;
+        }
+    }
+    SDL_UnlockSpinlock(&worker->lock);
+
+    if (job) {
+        SDL_AtomicDecRef(&SDL_jobs.num_queued);
+    }
+    return job;
+}
+
+static SDL_Job *SDL_FindJob(void)
+{
+    const int num_workers = SDL_jobs.num_workers;
+    int index, i;
+
+    if (SDL_GetAtomicInt(&SDL_jobs.num_queued) <= 0) {
+        return NULL;
+    }
+
+    index = SDL_GetJobWorkerIndex();
+    if (index >= 0) {
+        SDL_Job *job = SDL_TakeJob(&SDL_jobs.workers[index], true);
+        if (job) {
+            return job;
+        }
+    } else {
+        index = (int)((Uint32)SDL_GetAtomicInt(&SDL_jobs.next_worker) % (Uint32)num_workers);
+    }
+
+    for (i = 1; i <= num_workers; ++i) {
+        SDL_Job *job = SDL_TakeJob(&SDL_jobs.workers[(index + i) % num_workers], false);
+        if (job) {
+            return job;
+        }
+    }
+    return NULL;
+}
+
+static void SDL_FinishJobCounter(SDL_JobCounter *counter)
+{
+    SDL_Job *waiting = NULL;
+    bool done;
+
+    SDL_LockSpinlock(&counter->lock);
+    done = SDL_AtomicDecRef(&counter->value);
+    if (done) {
+        waiting = counter->waiting;
+        counter->waiting = NULL;
+    }
+    SDL_UnlockSpinlock(&counter->lock);
+
+    while (waiting) {
+        SDL_Job *next = waiting->next;
+        SDL_QueueJob(waiting);
+        waiting = next;
+    }
+
+    if (done) {
+        // Anyone might be waiting on this counter, so wake everyone
+        SDL_WakeJobThreads(true);
+    }
+}
+
+static void SDL_RunJob(SDL_Job *job)
+{
+    SDL_JobCounter *counter = job->counter;
+
+    job->function(job->userdata);
+    SDL_FreeJob(job);
+
+    if (counter) {
+        SDL_FinishJobCounter(counter);
+    }
+}
+
+static int SDLCALL SDL_JobThread(void *data)
+{
+    SDL_SetTLS(&SDL_jobs.worker_index, data, NULL);
+
+    for (;;) {
+        SDL_Job *job = SDL_FindJob();
+        if (job) {
+            SDL_RunJob(job);
+            continue;
+        }
+
+        // Finish everything that was queued before quitting
+        if (SDL_GetAtomicInt(&SDL_jobs.quit)) {
+            break;
+        }
+
+        SDL_LockMutex(SDL_jobs.lock);
+        SDL_AtomicIncRef(&SDL_jobs.num_sleeping);
+        while (SDL_GetAtomicInt(&SDL_jobs.num_queued) <= 0 && !SDL_GetAtomicInt(&SDL_jobs.quit)) {
+            SDL_WaitCondition(SDL_jobs.wakeup, SDL_jobs.lock);
+        }
+        SDL_AtomicDecRef(&SDL_jobs.num_sleeping);
+        SDL_UnlockMutex(SDL_jobs.lock);
+    }
+    return 0;
+}
+
+static bool SDL_InitJobs(void)
+{
+    if (SDL_ShouldInit(&SDL_jobs.init)) {
+        const char *hint = SDL_GetHint(SDL_HINT_JOB_THREADS);
+        int num_threads = (hint && *hint) ? SDL_atoi(hint) : 0;
+        bool okay = true;
+        int i;
+
+        if (num_threads <= 0) {
+            num_threads = SDL_GetNumLogicalCPUCores();
+        }
+
+        SDL_SetAtomicInt(&SDL_jobs.quit, 0);
+        SDL_jobs.lock = SDL_CreateMutex();
+        SDL_jobs.wakeup = SDL_CreateCondition();
+        SDL_jobs.pieces_done = SDL_CreateCondition();
+        SDL_jobs.workers = (SDL_JobWorker *)SDL_calloc(num_threads, sizeof(*SDL_jobs.workers));
+        if (!SDL_jobs.lock || !SDL_jobs.wakeup || !SDL_jobs.pieces_done || !SDL_jobs.workers) {
+            SDL_DestroyMutex(SDL_jobs.lock);
+            SDL_DestroyCondition(SDL_jobs.wakeup);
+            SDL_DestroyCondition(SDL_jobs.pieces_done);
+            SDL_free(SDL_jobs.workers);
+            SDL_jobs.lock = NULL;
+            SDL_jobs.wakeup = NULL;
+            SDL_jobs.pieces_done = NULL;
+            SDL_jobs.workers = NULL;
+            okay = false;
+        } else {
+            /* If some threads can't be created, use the ones that were. With
+             * none at all, jobs run on the thread that submits them. */
+            for (i = 0; i < num_threads; ++i) {
+                char name[32];
+
+                SDL_snprintf(name, sizeof(name), "SDLJob%d", i + 1);
+                SDL_jobs.workers[i].thread = SDL_CreateThread(SDL_JobThread, name, (void *)(intptr_t)(i + 1));
+                if (!SDL_jobs.workers[i].thread) {
+                    break;
+                }
+            }
+            SDL_jobs.num_workers = i;
+        }
+
+        SDL_SetInitialized(&SDL_jobs.init, okay);
+        return okay;
+    }
+    return true;
+}
+
+void SDL_QuitJobs(void)
+{
+    SDL_Job *job;
+    int i;
+
+    if (!SDL_ShouldQuit(&SDL_jobs.init)) {
+        return;
+    }
+
+    SDL_LockMutex(SDL_jobs.lock);
+    SDL_SetAtomicInt(&SDL_jobs.quit, 1);
+    SDL_BroadcastCondition(SDL_jobs.wakeup);
+    SDL_UnlockMutex(SDL_jobs.lock);
+
+    for (i = 0; i < SDL_jobs.num_workers; ++i) {
+        SDL_WaitThread(SDL_jobs.workers[i].thread, NULL);
+    }
+
+    SDL_DestroyMutex(SDL_jobs.lock);
+    SDL_DestroyCondition(SDL_jobs.wakeup);
+    SDL_DestroyCondition(SDL_jobs.pieces_done);
+    SDL_free(SDL_jobs.workers);
+    SDL_jobs.lock = NULL;
+    SDL_jobs.wakeup = NULL;
+    SDL_jobs.pieces_done = NULL;
+    SDL_jobs.workers = NULL;
+    SDL_jobs.num_workers = 0;
+
+    while ((job = SDL_jobs.free_jobs) != NULL) {
+        SDL_jobs.free_jobs = job->next;
+        SDL_free(job);
+    }
+
+    SDL_SetInitialized(&SDL_jobs.init, false);
+}
+
+SDL_JobCounter *SDL_CreateJobCounter(void)
+{
+    return (SDL_JobCounter *)SDL_calloc(1, sizeof(SDL_JobCounter));
+}
+
+void SDL_DestroyJobCounter(SDL_JobCounter *counter)
+{
+    if (counter) {
+        SDL_assert(SDL_GetAtomicInt(&counter->value) == 0);
+        SDL_free(counter);
+    }
+}
+
+bool SDL_SubmitJob(SDL_JobFunction function, void *userdata, SDL_JobCounter *dependency, SDL_JobCounter *counter)
+{
+    SDL_Job *job;
+
+    if (!function) {
+        return SDL_InvalidParamError("function");
+    } else if (dependency && dependency == counter) {
+        return SDL_SetError("A job can't depend on its own counter");
+    }
+
+    if (!SDL_InitJobs()) {
+        return false;
+    }
+
+    job = SDL_AllocJob();
+    if (!job) {
+        return false;
+    }
+    job->function = function;
+    job->userdata = userdata;
+    job->counter = counter;
+
+    if (counter) {
+        SDL_AtomicIncRef(&counter->value);
+    }
+
+    if (dependency) {
+        SDL_LockSpinlock(&dependency->lock);
+        if (SDL_GetAtomicInt(&dependency->value) > 0) {
+            job->next = dependency->waiting;
+            dependency->waiting = job;
+            job = NULL;
+        }
+        SDL_UnlockSpinlock(&dependency->lock);
+    }
+
+    if (job) {
+        SDL_QueueJob(job);
+    }
+    return true;
+}
+
+void SDL_WaitJobCounter(SDL_JobCounter *counter)
+{
+    if (!counter) {
+        SDL_InvalidParamError("counter");
+        return;
+    }
+
+    while (SDL_GetAtomicInt(&counter->value) > 0) {
+        SDL_Job *job = SDL_FindJob();
+        if (job) {
+            SDL_RunJob(job);
+            continue;
+        }
+
+        SDL_LockMutex(SDL_jobs.lock);
+        SDL_AtomicIncRef(&SDL_jobs.num_sleeping);
+        while (SDL_GetAtomicInt(&counter->value) > 0 && SDL_GetAtomicInt(&SDL_jobs.num_queued) <= 0) {
+            SDL_WaitCondition(SDL_jobs.wakeup, SDL_jobs.lock);
+        }
+        SDL_AtomicDecRef(&SDL_jobs.num_sleeping);
+        SDL_UnlockMutex(SDL_jobs.lock);
+    }
+
+    // The thread that finished the last job might still hold the lock, so wait for it to let go before the counter goes away
+    SDL_LockSpinlock(&counter->lock);
+    SDL_UnlockSpinlock(&counter->lock);
+}
+
+// Use a few pieces per thread, so threads that finish early can take more
+#define SDL_PARALLEL_FOR_PIECES_PER_THREAD 4
+
+/* The calling thread doesn't run other jobs while it waits for a parallel for,
+ * since SDL calls this from places like SDL_BlitSurface() where running an
+ * unrelated app job could take a long time, or try to take a lock the caller
+ * already holds. Instead it waits for just the pieces that other threads have
+ * claimed. Helper jobs that start after every piece is claimed have nothing
+ * to do, so the data is reference counted to let them find that out safely
+ * after the caller has returned.
+ */
+typedef struct SDL_ParallelForData
+{
+    SDL_ParallelForFunction function;
+    void *userdata;
+    int start;
+    int end;
+    int grain_size;
+    int num_pieces;
+    SDL_AtomicInt next_piece;
+    SDL_AtomicInt pieces_done;
+    SDL_AtomicInt refcount;
+} SDL_ParallelForData;
+
+static void SDL_RunParallelForPieces(SDL_ParallelForData *data)
+{
+    for (;;) {
+        const int piece = SDL_AtomicIncRef(&data->next_piece);
+        Sint64 start, end;
+
+        if (piece >= data->num_pieces) {
+            break;
+        }
+        start = data->start + (Sint64)piece * data->grain_size;
+        end = SDL_min(start + data->grain_size, (Sint64)data->end);
+        data->function(data->userdata, (int)start, (int)end);
+
+        if (SDL_AtomicIncRef(&data->pieces_done) + 1 == data->num_pieces &&
+            SDL_GetAtomicInt(&SDL_jobs.num_waiting_for_pieces) > 0) {
+            SDL_LockMutex(SDL_jobs.lock);
+            SDL_BroadcastCondition(SDL_jobs.pieces_done);
+            SDL_UnlockMutex(SDL_jobs.lock);
+        }
+    }
+}
+
+static void SDL_ReleaseParallelForData(SDL_ParallelForData *data)
+{
+    if (SDL_AtomicDecRef(&data->refcount)) {
+        SDL_free(data);
+    }
+}
+
+static void SDLCALL SDL_RunParallelForHelper(void *userdata)
+{
+    SDL_ParallelForData *data = (SDL_ParallelForData *)userdata;
+
+    SDL_RunParallelForPieces(data);
+    SDL_ReleaseParallelForData(data);
+}
+
+bool SDL_RunParallelFor(int start, int end, int grain_size, int max_threads, SDL_ParallelForFunction function, void *userdata)
+{
+    SDL_ParallelForData *data;
+    const Sint64 count = (Sint64)end - start;
+    int num_helpers, num_pieces, i;
+
+    if (!function) {
+        return SDL_InvalidParamError("function");
+    }
+    if (count <= 0) {
+        return true;
+    }
+
+    num_helpers = SDL_InitJobs() ? SDL_jobs.num_workers : 0;
+    if (max_threads > 0) {
+        num_helpers = SDL_min(num_helpers, max_threads - 1);
+    }
+
+    if (grain_size <= 0) {
+        const Sint64 max_pieces = (Sint64)(num_helpers + 1) * SDL_PARALLEL_FOR_PIECES_PER_THREAD;
+        grain_size = (int)SDL_max((count + max_pieces - 1) / max_pieces, 1);
+    }
+    num_pieces = (int)((count + grain_size - 1) / grain_size);
+    num_helpers = SDL_min(num_helpers, num_pieces - 1);
+
+    // If there's no one to help, or no memory to share with them, this thread does all the pieces
+    data = (num_helpers > 0) ? (SDL_ParallelForData *)SDL_calloc(1, sizeof(*data)) : NULL;
+    if (!data) {
+        for (i = 0; i < num_pieces; ++i) {
+            const Sint64 piece_start = start + (Sint64)i * grain_size;
+            function(userdata, (int)piece_start, (int)SDL_min(piece_start + grain_size, (Sint64)end));
+        }
+        return true;
+    }
+
+    data->function = function;
+    data->userdata = userdata;
+    data->start = start;
+    data->end = end;
+    data->grain_size = grain_size;
+    data->num_pieces = num_pieces;
+    SDL_SetAtomicInt(&data->refcount, 1 + num_helpers);
+
+    // If a helper can't be submitted, this thread does its share
+    for (i = 0; i < num_helpers; ++i) {
+        if (!SDL_SubmitJob(SDL_RunParallelForHelper, data, NULL, NULL)) {
+            SDL_AddAtomicInt(&data->refcount, -(num_helpers - i));
+            break;
+        }
+    }
+    SDL_RunParallelForPieces(data);
+
+    // Every piece is claimed now, so just wait for the ones still running elsewhere
+    if (SDL_GetAtomicInt(&data->pieces_done) < num_pieces) {
+        SDL_LockMutex(SDL_jobs.lock);
+        SDL_AtomicIncRef(&SDL_jobs.num_waiting_for_pieces);
+        while (SDL_GetAtomicInt(&data->pieces_done) < num_pieces) {
+            SDL_WaitCondition(SDL_jobs.pieces_done, SDL_jobs.lock);
+        }
+        SDL_AtomicDecRef(&SDL_jobs.num_waiting_for_pieces);
+        SDL_UnlockMutex(SDL_jobs.lock);
+    }
+
+    SDL_ReleaseParallelForData(data);
+    return true;
+}
+
+bool SDL_ParallelFor(int start, int end, int grain_size, SDL_ParallelForFunction function, void *userdata)
+{
+    return SDL_RunParallelFor(start, end, grain_size, 0, function, userdata);
+}
+
+int SDL_GetNumJobThreads(void)
+{
+    if (!SDL_InitJobs()) {
+        return 0;
+    }
+    return SDL_jobs.num_workers;
+}
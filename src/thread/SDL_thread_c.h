@@ -89,4 +89,13 @@ extern SDL_TLSData *SDL_Generic_GetTLSData(void);
 extern bool SDL_Generic_SetTLSData(SDL_TLSData *data);
 extern void SDL_Generic_QuitTLSData(void);
 
+// The job system, in SDL_job.c. max_threads includes the calling thread, and 0 means no limit.
+extern bool SDL_RunParallelFor(int start, int end, int grain_size, int max_threads, SDL_ParallelForFunction function, void *userdata);
+extern void SDL_QuitJobs(void);
+
+#if defined(SDL_THREAD_LINUX_FUTEX) && !defined(NDEBUG)
+// Logs how often each kind of futex-based primitive was contended, in SDL_sysmutex.c
+extern void SDL_LogFutexStats(void);
+#endif
+
 #endif // SDL_thread_c_h_
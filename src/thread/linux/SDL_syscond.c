@@ -0,0 +1,124 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// Condition variables built directly on Linux futexes
+
+#include "SDL_sysmutex_c.h"
+
+struct SDL_Condition
+{
+    int seq;           // bumped on every signal, waiters sleep until it changes
+    SDL_AtomicInt waiters;
+    SDL_Mutex *mutex;  // the mutex the waiters are using, so a broadcast can move them straight over to it
+#ifdef SDL_FUTEX_STATS
+    SDL_FutexStats stats;
+#endif
+};
+
+// Create a condition variable
+SDL_Condition *SDL_CreateCondition(void)
+{
+    SDL_Condition *cond = (SDL_Condition *)SDL_calloc(1, sizeof(*cond));
+    return cond;
+}
+
+// Destroy a condition variable
+void SDL_DestroyCondition(SDL_Condition *cond)
+{
+    if (cond) {
+        SDL_free(cond);
+    }
+}
+
+// Restart one of the threads that are waiting on the condition variable
+void SDL_SignalCondition(SDL_Condition *cond)
+{
+    if (!cond) {
+        return;
+    }
+
+    if (SDL_GetAtomicInt(&cond->waiters) > 0) {
+        __atomic_fetch_add(&cond->seq, 1, __ATOMIC_SEQ_CST);
+        SDL_FutexWake(&cond->seq, 1);
+    }
+}
+
+// Restart all threads that are waiting on the condition variable
+void SDL_BroadcastCondition(SDL_Condition *cond)
+{
+    SDL_Mutex *mutex;
+    int seq;
+
+    if (!cond) {
+        return;
+    }
+
+    if (SDL_GetAtomicInt(&cond->waiters) == 0) {
+        return;
+    }
+
+    seq = __atomic_add_fetch(&cond->seq, 1, __ATOMIC_SEQ_CST);
+
+    /* Waking everyone would just have them all fight over the mutex, so wake one
+       and move the rest onto the mutex, where each unlock will wake the next. */
+    mutex = (SDL_Mutex *)__atomic_load_n(&cond->mutex, __ATOMIC_RELAXED);
+    if (!mutex || !SDL_FutexRequeue(&cond->seq, seq, &mutex->state)) {
+        SDL_FutexWake(&cond->seq, INT_MAX);
+    }
+}
+
+bool SDL_WaitConditionTimeoutNS(SDL_Condition *cond, SDL_Mutex *mutex, Sint64 timeoutNS)
+{
+    bool result;
+    int recursive;
+    int seq;
+
+    if (!cond || !mutex) {
+        return true;
+    }
+
+    SDL_FUTEX_STAT(&cond->stats, SDL_FUTEX_STATS_CONDITION, slept);
+
+    __atomic_store_n(&cond->mutex, mutex, __ATOMIC_RELAXED);
+    SDL_AtomicIncRef(&cond->waiters);
+    seq = __atomic_load_n(&cond->seq, __ATOMIC_SEQ_CST);
+
+    // Let go of the mutex completely, however many times this thread has locked it
+    recursive = mutex->recursive;
+    mutex->recursive = 0;
+    SDL_UnlockMutex(mutex);
+
+    /* A broadcast can move us over to sleep on the mutex, where our timeout keeps
+       running, so a timeout doesn't mean we weren't signaled: check seq to be sure. */
+    result = SDL_FutexWait(&cond->seq, seq, timeoutNS) ||
+             (__atomic_load_n(&cond->seq, __ATOMIC_SEQ_CST) != seq);
+
+    SDL_AtomicDecRef(&cond->waiters);
+
+    /* We might have been moved over to the mutex by a broadcast, along with
+       other waiters, so lock it in a way that makes sure they get woken too. */
+    SDL_LockMutexContended(mutex);
+    mutex->owner = SDL_GetCurrentThreadID();
+    mutex->recursive = recursive;
+
+    return result;
+}
@@ -0,0 +1,122 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifndef SDL_sysfutex_h_
+#define SDL_sysfutex_h_
+
+// Thin wrappers around the Linux futex system call, shared by the mutex, condition, semaphore and spinlock code
+
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#if !defined(SYS_futex) && defined(SYS_futex_time64)
+#define SYS_futex SYS_futex_time64
+#endif
+
+// How many times to spin before going to sleep, at most. Primitives adapt their own count below this.
+#define SDL_FUTEX_MAX_SPINS 100
+
+/* Sleep as long as *addr is val, for up to timeoutNS nanoseconds (or forever if negative).
+   Returns false if the timeout expired. It can also return early for no reason, so check again. */
+static inline bool SDL_FutexWait(int *addr, int val, Sint64 timeoutNS)
+{
+    struct timespec timeout;
+    struct timespec *ptimeout = NULL;
+    const int saved_errno = errno;
+    bool result = true;
+
+    if (timeoutNS >= 0) {
+        timeout.tv_sec = (time_t)(timeoutNS / SDL_NS_PER_SECOND);
+        timeout.tv_nsec = (long)(timeoutNS % SDL_NS_PER_SECOND);
+        ptimeout = &timeout;
+    }
+    if (syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, val, ptimeout, NULL, 0) < 0 && errno == ETIMEDOUT) {
+        result = false;
+    }
+    errno = saved_errno;
+    return result;
+}
+
+static inline void SDL_FutexWake(int *addr, int count)
+{
+    const int saved_errno = errno;
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+    errno = saved_errno;
+}
+
+/* Wake one thread sleeping on addr, and move the rest over to sleep on requeue_addr instead, as long as *addr is still val.
+   Returns false if *addr changed, in which case nothing happened. */
+static inline bool SDL_FutexRequeue(int *addr, int val, int *requeue_addr)
+{
+    const int saved_errno = errno;
+    const bool result = (syscall(SYS_futex, addr, FUTEX_CMP_REQUEUE_PRIVATE, 1, (void *)(intptr_t)INT_MAX, requeue_addr, val) >= 0);
+    errno = saved_errno;
+    return result;
+}
+
+// Spinning is a waste of time if there's only one CPU core to run the thread that would let us go
+static inline bool SDL_FutexCanSpin(void)
+{
+    return SDL_GetNumLogicalCPUCores() > 1;
+}
+
+/* Debug builds count how often each primitive is contended, to help find hot locks.
+   Each primitive has its own counts, which can be looked at in a debugger, and
+   the totals for each kind of primitive are logged by SDL_Quit(). */
+#ifndef NDEBUG
+#define SDL_FUTEX_STATS
+#endif
+
+typedef enum SDL_FutexStatsKind
+{
+    SDL_FUTEX_STATS_MUTEX,
+    SDL_FUTEX_STATS_CONDITION,
+    SDL_FUTEX_STATS_SEMAPHORE,
+    SDL_FUTEX_STATS_SPINLOCK,
+    SDL_FUTEX_STATS_COUNT
+} SDL_FutexStatsKind;
+
+typedef struct SDL_FutexStats
+{
+    SDL_AtomicInt contended; // times a thread couldn't go straight through
+    SDL_AtomicInt spun;      // times it got through by spinning
+    SDL_AtomicInt slept;     // times it went to sleep in the kernel
+} SDL_FutexStats;
+
+#ifdef SDL_FUTEX_STATS
+extern SDL_FutexStats SDL_futex_totals[SDL_FUTEX_STATS_COUNT];
+#define SDL_FUTEX_STAT(stats, kind, field)                    \
+    do {                                                      \
+        SDL_AtomicIncRef(&SDL_futex_totals[kind].field);      \
+        if (stats) {                                          \
+            SDL_AtomicIncRef(&((SDL_FutexStats *)stats)->field); \
+        }                                                     \
+    } while (0)
+#else
+#define SDL_FUTEX_STAT(stats, kind, field)
+#endif
+
+#endif // SDL_sysfutex_h_
@@ -0,0 +1,161 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// Mutexes built directly on Linux futexes: an atomic compare-and-swap when nobody else wants the lock, a short spin when somebody does, then sleep in the kernel.
+
+#include "SDL_sysmutex_c.h"
+
+#ifdef SDL_FUTEX_STATS
+SDL_FutexStats SDL_futex_totals[SDL_FUTEX_STATS_COUNT];
+
+void SDL_LogFutexStats(void)
+{
+    static const char *names[SDL_FUTEX_STATS_COUNT] = { "mutex", "condition", "semaphore", "spinlock" };
+    int i;
+
+    for (i = 0; i < SDL_FUTEX_STATS_COUNT; ++i) {
+        SDL_FutexStats *totals = &SDL_futex_totals[i];
+        const int contended = SDL_GetAtomicInt(&totals->contended);
+        const int slept = SDL_GetAtomicInt(&totals->slept);
+        if (contended > 0 || slept > 0) {
+            SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "%s contention: %d contended, %d got through spinning, %d slept",
+                         names[i], contended, SDL_GetAtomicInt(&totals->spun), slept);
+        }
+    }
+}
+#endif // SDL_FUTEX_STATS
+
+SDL_Mutex *SDL_CreateMutex(void)
+{
+    // Allocate the structure
+    SDL_Mutex *mutex = (SDL_Mutex *)SDL_calloc(1, sizeof(*mutex));
+    return mutex;
+}
+
+void SDL_DestroyMutex(SDL_Mutex *mutex)
+{
+    if (mutex) {
+        SDL_free(mutex);
+    }
+}
+
+void SDL_LockMutexContended(SDL_Mutex *mutex)
+{
+    /* Always mark the mutex as having waiters once we've had to wait for it.
+       We might wake someone needlessly when unlocking, but we'll never miss one. */
+    while (__atomic_exchange_n(&mutex->state, 2, __ATOMIC_ACQUIRE) != 0) {
+        SDL_FutexWait(&mutex->state, 2, -1);
+    }
+}
+
+static void LockMutexSlow(SDL_Mutex *mutex)
+{
+    SDL_FUTEX_STAT(&mutex->stats, SDL_FUTEX_STATS_MUTEX, contended);
+
+    /* The owner is usually about to let go, so try for a little while before paying for a system call.
+       How long we try adapts to how long it has taken to get the lock by spinning lately. */
+    if (SDL_FutexCanSpin()) {
+        const int average = __atomic_load_n(&mutex->spins, __ATOMIC_RELAXED);
+        const int max_spins = SDL_min(average * 2 + 10, SDL_FUTEX_MAX_SPINS);
+        int spins;
+
+        for (spins = 0; spins < max_spins; ++spins) {
+            int expected = 0;
+
+            SDL_CPUPauseInstruction();
+            if (__atomic_load_n(&mutex->state, __ATOMIC_RELAXED) == 0 &&
+                __atomic_compare_exchange_n(&mutex->state, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                __atomic_store_n(&mutex->spins, average + (spins - average) / 8, __ATOMIC_RELAXED);
+                SDL_FUTEX_STAT(&mutex->stats, SDL_FUTEX_STATS_MUTEX, spun);
+                return;
+            }
+        }
+        __atomic_store_n(&mutex->spins, average + (max_spins - average) / 8, __ATOMIC_RELAXED);
+    }
+
+    SDL_FUTEX_STAT(&mutex->stats, SDL_FUTEX_STATS_MUTEX, slept);
+    SDL_LockMutexContended(mutex);
+}
+
+void SDL_LockMutex(SDL_Mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS // clang doesn't know about NULL mutexes
+{
+    if (mutex) {
+        const SDL_ThreadID this_thread = SDL_GetCurrentThreadID();
+        if (mutex->owner == this_thread) {
+            ++mutex->recursive;
+        } else {
+            int expected = 0;
+            if (!__atomic_compare_exchange_n(&mutex->state, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                LockMutexSlow(mutex);
+            }
+            mutex->owner = this_thread;
+            mutex->recursive = 0;
+        }
+    }
+}
+
+bool SDL_TryLockMutex(SDL_Mutex *mutex)
+{
+    bool result = true;
+
+    if (mutex) {
+        const SDL_ThreadID this_thread = SDL_GetCurrentThreadID();
+        if (mutex->owner == this_thread) {
+            ++mutex->recursive;
+        } else {
+            int expected = 0;
+            if (__atomic_compare_exchange_n(&mutex->state, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+                mutex->owner = this_thread;
+                mutex->recursive = 0;
+            } else {
+                result = false;
+            }
+        }
+    }
+
+    return result;
+}
+
+void SDL_UnlockMutex(SDL_Mutex *mutex) SDL_NO_THREAD_SAFETY_ANALYSIS // clang doesn't know about NULL mutexes
+{
+    if (mutex) {
+        // We can only unlock the mutex if we own it
+        if (mutex->owner != SDL_GetCurrentThreadID()) {
+            SDL_SetError("mutex not owned by this thread");
+            return;
+        }
+
+        if (mutex->recursive) {
+            --mutex->recursive;
+        } else {
+            /* The order of operations is important.
+               First reset the owner so another thread doesn't lock
+               the mutex and set the ownership before we reset it,
+               then release the lock and wake a waiter if there might be one.
+             */
+            mutex->owner = 0;
+            if (__atomic_exchange_n(&mutex->state, 0, __ATOMIC_RELEASE) == 2) {
+                SDL_FutexWake(&mutex->state, 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,42 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifndef SDL_mutex_c_h_
+#define SDL_mutex_c_h_
+
+#include "SDL_sysfutex.h"
+
+struct SDL_Mutex
+{
+    int state;         // 0: unlocked, 1: locked, 2: locked and there might be threads asleep waiting for it
+    SDL_ThreadID owner;
+    int recursive;
+    int spins;         // how long spinning has been taking lately, so we know how long to keep trying
+#ifdef SDL_FUTEX_STATS
+    SDL_FutexStats stats;
+#endif
+};
+
+// Locks the mutex, assuming there are other threads waiting on it. Used by conditions, which move their waiters over to the mutex.
+extern void SDL_LockMutexContended(SDL_Mutex *mutex);
+
+#endif // SDL_mutex_c_h_
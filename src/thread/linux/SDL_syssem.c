@@ -0,0 +1,157 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// Semaphores built directly on Linux futexes
+
+#include "SDL_sysfutex.h"
+
+struct SDL_Semaphore
+{
+    int count;
+    SDL_AtomicInt waiters;
+    int spins;  // how long spinning has been taking lately, so we know how long to keep trying
+#ifdef SDL_FUTEX_STATS
+    SDL_FutexStats stats;
+#endif
+};
+
+// Create a semaphore, initialized with value
+SDL_Semaphore *SDL_CreateSemaphore(Uint32 initial_value)
+{
+    SDL_Semaphore *sem;
+
+    if (initial_value > SDL_MAX_SINT32) {
+        SDL_SetError("Semaphore value out of range");
+        return NULL;
+    }
+
+    sem = (SDL_Semaphore *)SDL_calloc(1, sizeof(*sem));
+    if (sem) {
+        sem->count = (int)initial_value;
+    }
+    return sem;
+}
+
+void SDL_DestroySemaphore(SDL_Semaphore *sem)
+{
+    if (sem) {
+        SDL_free(sem);
+    }
+}
+
+static bool TryWaitSemaphore(SDL_Semaphore *sem)
+{
+    int count = __atomic_load_n(&sem->count, __ATOMIC_SEQ_CST);
+
+    while (count > 0) {
+        if (__atomic_compare_exchange_n(&sem->count, &count, count - 1, true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SDL_WaitSemaphoreTimeoutNS(SDL_Semaphore *sem, Sint64 timeoutNS)
+{
+    Uint64 stop_time = 0;
+    bool result = false;
+
+    if (!sem) {
+        return true;
+    }
+
+    // Try the easy cases first
+    if (TryWaitSemaphore(sem)) {
+        return true;
+    }
+    if (timeoutNS == 0) {
+        return false;
+    }
+
+    SDL_FUTEX_STAT(&sem->stats, SDL_FUTEX_STATS_SEMAPHORE, contended);
+
+    // Whoever is going to signal us might be about to, so try for a little while before paying for a system call
+    if (SDL_FutexCanSpin()) {
+        const int average = __atomic_load_n(&sem->spins, __ATOMIC_RELAXED);
+        const int max_spins = SDL_min(average * 2 + 10, SDL_FUTEX_MAX_SPINS);
+        int spins;
+
+        for (spins = 0; spins < max_spins; ++spins) {
+            SDL_CPUPauseInstruction();
+            if (__atomic_load_n(&sem->count, __ATOMIC_RELAXED) > 0 && TryWaitSemaphore(sem)) {
+                __atomic_store_n(&sem->spins, average + (spins - average) / 8, __ATOMIC_RELAXED);
+                SDL_FUTEX_STAT(&sem->stats, SDL_FUTEX_STATS_SEMAPHORE, spun);
+                return true;
+            }
+        }
+        __atomic_store_n(&sem->spins, average + (max_spins - average) / 8, __ATOMIC_RELAXED);
+    }
+
+    SDL_FUTEX_STAT(&sem->stats, SDL_FUTEX_STATS_SEMAPHORE, slept);
+
+    if (timeoutNS > 0) {
+        stop_time = SDL_GetTicksNS() + timeoutNS;
+    }
+
+    // Let SDL_SignalSemaphore() know it has to wake us before we check the count for the last time
+    SDL_AtomicIncRef(&sem->waiters);
+    for (;;) {
+        Sint64 remaining = -1;
+
+        if (TryWaitSemaphore(sem)) {
+            result = true;
+            break;
+        }
+        if (timeoutNS > 0) {
+            const Uint64 now = SDL_GetTicksNS();
+            if (now >= stop_time) {
+                break;
+            }
+            remaining = (Sint64)(stop_time - now);
+        }
+        SDL_FutexWait(&sem->count, 0, remaining);
+    }
+    SDL_AtomicDecRef(&sem->waiters);
+
+    return result;
+}
+
+Uint32 SDL_GetSemaphoreValue(SDL_Semaphore *sem)
+{
+    if (!sem) {
+        return 0;
+    }
+
+    return (Uint32)__atomic_load_n(&sem->count, __ATOMIC_RELAXED);
+}
+
+void SDL_SignalSemaphore(SDL_Semaphore *sem)
+{
+    if (!sem) {
+        return;
+    }
+
+    __atomic_fetch_add(&sem->count, 1, __ATOMIC_SEQ_CST);
+    if (SDL_GetAtomicInt(&sem->waiters) > 0) {
+        SDL_FutexWake(&sem->count, 1);
+    }
+}
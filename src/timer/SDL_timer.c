@@ -35,24 +35,18 @@ typedef struct SDL_Timer
     void *userdata;
     Uint64 interval;
     Uint64 scheduled;
+    Uint64 sequence;    // breaks ties between timers scheduled for the same time, so they fire in the order they were added.
     SDL_AtomicInt canceled;
     struct SDL_Timer *next;
 } SDL_Timer;
 
-typedef struct SDL_TimerMap
-{
-    SDL_TimerID timerID;
-    SDL_Timer *timer;
-    struct SDL_TimerMap *next;
-} SDL_TimerMap;
-
-// The timers are kept in a sorted list
+// The active timers are kept in a 4-ary min-heap, ordered by scheduling time
 typedef struct
 {
     // Data used by the main thread
     SDL_InitState init;
     SDL_Thread *thread;
-    SDL_TimerMap *timermap;
+    SDL_HashTable *timermap;    // SDL_TimerID -> SDL_Timer *
     SDL_Mutex *timermap_lock;
 
     // Padding to separate cache lines between threads
@@ -64,9 +58,24 @@ typedef struct
     SDL_Timer *pending;
     SDL_Timer *freelist;
     SDL_AtomicInt active;
-
-    // List of timers - this is only touched by the timer thread
-    SDL_Timer *timers;
+    SDL_AtomicInt num_canceled;    // timers canceled by SDL_RemoveTimer() that are still waiting to be dropped
+    Uint64 next_deadline;          // earliest deadline the timer thread is sleeping until, 0 if it's awake or about to be
+    Sint64 hint_slack;             // SDL_HINT_TIMER_SLACK, kept up to date by a hint callback
+
+    // Heap of timers - this is only touched by the timer thread
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
+    Uint64 next_sequence;
+    Uint64 slack;              // cached slack, see SDL_GetTimerSlack()
+    Sint64 slack_hint_seen;    // the hint value the cached slack was computed from
+
+    // Statistics, published through the timer properties
+    SDL_PropertiesID props;
+    Uint64 num_wakeups;
+    Uint64 num_callbacks;
+    Uint64 stats_window_start;
+    Uint64 stats_window_wakeups;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
@@ -74,37 +83,166 @@ static SDL_TimerData SDL_timer_data;
 /* The idea here is that any thread might add a timer, but a single
  * thread manages the active timer queue, sorted by scheduling time.
  *
- * Timers are removed by simply setting a canceled flag
+ * Timers are removed by simply setting a canceled flag. They are dropped
+ * when they reach the top of the heap, or when enough of the heap has been
+ * canceled that it's worth sweeping them all out at once.
  */
 
-static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+#define SDL_TIMER_HEAP_ARITY 4
+
+SDL_FORCE_INLINE bool SDL_TimerBefore(const SDL_Timer *a, const SDL_Timer *b)
 {
-    SDL_Timer *prev, *curr;
+    if (a->scheduled != b->scheduled) {
+        return a->scheduled < b->scheduled;
+    }
+    return a->sequence < b->sequence;
+}
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if (curr->scheduled > timer->scheduled) {
+static void SDL_SiftTimerUp(SDL_TimerData *data, int i)
+{
+    SDL_Timer **timers = data->timers;
+    SDL_Timer *timer = timers[i];
+
+    while (i > 0) {
+        const int parent = (i - 1) / SDL_TIMER_HEAP_ARITY;
+        if (!SDL_TimerBefore(timer, timers[parent])) {
             break;
         }
+        timers[i] = timers[parent];
+        i = parent;
     }
+    timers[i] = timer;
+}
 
-    // Insert the timer here!
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+static void SDL_SiftTimerDown(SDL_TimerData *data, int i)
+{
+    SDL_Timer **timers = data->timers;
+    SDL_Timer *timer = timers[i];
+    const int num_timers = data->num_timers;
+
+    for (;;) {
+        const int first_child = (i * SDL_TIMER_HEAP_ARITY) + 1;
+        const int last_child = SDL_min(first_child + SDL_TIMER_HEAP_ARITY, num_timers);
+        int best = -1;
+
+        for (int child = first_child; child < last_child; ++child) {
+            if ((best < 0) || SDL_TimerBefore(timers[child], timers[best])) {
+                best = child;
+            }
+        }
+        if ((best < 0) || !SDL_TimerBefore(timers[best], timer)) {
+            break;
+        }
+        timers[i] = timers[best];
+        i = best;
+    }
+    timers[i] = timer;
+}
+
+static bool SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    if (data->num_timers == data->max_timers) {
+        const int max_timers = data->max_timers ? (data->max_timers * 2) : 64;
+        SDL_Timer **timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+        if (!timers) {
+            return false;
+        }
+        data->timers = timers;
+        data->max_timers = max_timers;
+    }
+
+    timer->sequence = data->next_sequence++;
+    data->timers[data->num_timers++] = timer;
+    SDL_SiftTimerUp(data, data->num_timers - 1);
+    return true;
+}
+
+static SDL_Timer *SDL_PopTimerInternal(SDL_TimerData *data)
+{
+    SDL_Timer *timer = data->timers[0];
+
+    if (--data->num_timers > 0) {
+        data->timers[0] = data->timers[data->num_timers];
+        SDL_SiftTimerDown(data, 0);
+    }
+    return timer;
+}
+
+// Drop every canceled timer from the heap, and rebuild it from what's left.
+static void SDL_SweepTimersInternal(SDL_TimerData *data, SDL_Timer **freelist_head, SDL_Timer **freelist_tail)
+{
+    int i, num_timers = 0;
+
+    for (i = 0; i < data->num_timers; ++i) {
+        SDL_Timer *timer = data->timers[i];
+        if (SDL_GetAtomicInt(&timer->canceled)) {
+            // only SDL_RemoveTimer() cancels timers that are still in the heap, and it counted this one.
+            SDL_AddAtomicInt(&data->num_canceled, -1);
+            timer->next = *freelist_head;
+            *freelist_head = timer;
+            if (!*freelist_tail) {
+                *freelist_tail = timer;
+            }
+        } else {
+            data->timers[num_timers++] = timer;
+        }
+    }
+    data->num_timers = num_timers;
+
+    for (i = (num_timers - 2) / SDL_TIMER_HEAP_ARITY; i >= 0; --i) {
+        SDL_SiftTimerDown(data, i);
+    }
+}
+
+// The slack property overrides the hint, which is cached by SDL_TimerSlackChanged()
+static Uint64 SDL_GetTimerSlack(SDL_TimerData *data)
+{
+    Sint64 slack = SDL_GetNumberProperty(data->props, SDL_PROP_TIMER_SLACK_NS_NUMBER, -1);
+    if (slack < 0) {
+        slack = data->slack_hint_seen;
+    }
+    return (slack > 0) ? (Uint64)slack : 0;
+}
+
+static void SDLCALL SDL_TimerSlackChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_TimerData *data = (SDL_TimerData *)userdata;
+    const Sint64 slack = hint ? SDL_strtoll(hint, NULL, 0) : 0;
+
+    SDL_LockSpinlock(&data->lock);
+    data->hint_slack = slack;
+    SDL_UnlockSpinlock(&data->lock);
+}
+
+// Publishes the statistics once per one-second window, returns true if it did
+static bool SDL_UpdateTimerStats(SDL_TimerData *data, Uint64 now)
+{
+    const Uint64 elapsed = now - data->stats_window_start;
+
+    if (elapsed < SDL_NS_PER_SECOND) {
+        return false;
     }
-    timer->next = curr;
+    SDL_SetNumberProperty(data->props, SDL_PROP_TIMER_WAKEUPS_NUMBER, (Sint64)data->num_wakeups);
+    SDL_SetNumberProperty(data->props, SDL_PROP_TIMER_CALLBACKS_NUMBER, (Sint64)data->num_callbacks);
+    SDL_SetFloatProperty(data->props, SDL_PROP_TIMER_WAKEUPS_PER_SECOND_FLOAT, (float)((double)data->stats_window_wakeups * SDL_NS_PER_SECOND / elapsed));
+    data->stats_window_start = now;
+    data->stats_window_wakeups = 0;
+    return true;
 }
 
 static int SDLCALL SDL_TimerThread(void *_data)
 {
     SDL_TimerData *data = (SDL_TimerData *)_data;
     SDL_Timer *pending;
+    SDL_Timer *deferred = NULL;
     SDL_Timer *current;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
     Uint64 tick, now, interval, delay;
+    Sint64 hint_slack;
+    bool update_slack = true;
+
+    data->stats_window_start = SDL_GetTicksNS();
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
@@ -118,6 +256,14 @@ static int SDLCALL SDL_TimerThread(void *_data)
             // Get any timers ready to be queued
             pending = data->pending;
             data->pending = NULL;
+            if (pending) {
+                update_slack = true;
+            }
+
+            // We're awake, new timers don't need to signal us
+            data->next_deadline = 0;
+
+            hint_slack = data->hint_slack;
 
             // Make any unused timer structures available
             if (freelist_head) {
@@ -126,42 +272,82 @@ static int SDLCALL SDL_TimerThread(void *_data)
             }
         }
         SDL_UnlockSpinlock(&data->lock);
+        freelist_head = NULL;
+        freelist_tail = NULL;
+
+        // Initial delay if there are no timers
+        delay = (Uint64)-1;
+
+        // Pending timers were pushed onto the front of the list, put them back in the order they were added
+        current = NULL;
+        while (pending) {
+            SDL_Timer *next = pending->next;
+            pending->next = current;
+            current = pending;
+            pending = next;
+        }
+        pending = current;
 
-        // Sort the pending timers into our list
+        // Timers we couldn't queue last time go first
+        if (deferred) {
+            current = deferred;
+            while (current->next) {
+                current = current->next;
+            }
+            current->next = pending;
+            pending = deferred;
+            deferred = NULL;
+        }
+
+        // Add the pending timers to our heap
         while (pending) {
             current = pending;
+            if (!SDL_AddTimerInternal(data, current)) {
+                // Out of memory; hang on to the rest and try again in a little while.
+                deferred = current;
+                delay = SDL_NS_PER_MS;
+                break;
+            }
             pending = pending->next;
-            SDL_AddTimerInternal(data, current);
         }
-        freelist_head = NULL;
-        freelist_tail = NULL;
 
         // Check to see if we're still running, after maintenance
         if (!SDL_GetAtomicInt(&data->active)) {
             break;
         }
 
-        // Initial delay if there are no timers
-        delay = (Uint64)-1;
+        // If a lot of the heap has been canceled, clear it out now instead of waiting for each one to come due.
+        if (data->num_timers >= 64 && SDL_GetAtomicInt(&data->num_canceled) >= (data->num_timers / 2)) {
+            SDL_SweepTimersInternal(data, &freelist_head, &freelist_tail);
+        }
 
+        /* Looking up the slack property takes the properties lock, so only do it when
+           new timers come in, the hint changes, or once per stats window.
+         */
+        if (update_slack || hint_slack != data->slack_hint_seen) {
+            data->slack_hint_seen = hint_slack;
+            data->slack = SDL_GetTimerSlack(data);
+            update_slack = false;
+        }
         tick = SDL_GetTicksNS();
 
         // Process all the pending timers for this tick
-        while (data->timers) {
-            current = data->timers;
+        while (data->num_timers > 0) {
+            current = data->timers[0];
 
             if (tick < current->scheduled) {
-                // Scheduled for the future, wait a bit
-                delay = (current->scheduled - tick);
+                // Scheduled for the future, wait a bit, and catch anything else due within the slack while we're up
+                delay = SDL_min(delay, current->scheduled - tick + data->slack);
                 break;
             }
 
             // We're going to do something with this timer
-            data->timers = current->next;
+            SDL_PopTimerInternal(data);
 
             if (SDL_GetAtomicInt(&current->canceled)) {
                 interval = 0;
             } else {
+                ++data->num_callbacks;
                 if (current->callback_ms) {
                     interval = SDL_MS_TO_NS(current->callback_ms(current->userdata, current->timerID, (Uint32)SDL_NS_TO_MS(current->interval)));
                 } else {
@@ -170,7 +356,7 @@ static int SDLCALL SDL_TimerThread(void *_data)
             }
 
             if (interval > 0) {
-                // Reschedule this timer
+                // Reschedule this timer (we just took it off the heap, so there's room for it)
                 current->interval = interval;
                 current->scheduled = tick + interval;
                 SDL_AddTimerInternal(data, current);
@@ -182,8 +368,12 @@ static int SDLCALL SDL_TimerThread(void *_data)
                     freelist_tail->next = current;
                 }
                 freelist_tail = current;
+                current->next = NULL;
 
-                SDL_SetAtomicInt(&current->canceled, 1);
+                // If SDL_RemoveTimer() canceled it first, it's no longer waiting in the heap to be swept.
+                if (SDL_SetAtomicInt(&current->canceled, 1)) {
+                    SDL_AddAtomicInt(&data->num_canceled, -1);
+                }
             }
         }
 
@@ -196,12 +386,35 @@ static int SDLCALL SDL_TimerThread(void *_data)
             delay -= interval;
         }
 
-        /* Note that each time a timer is added, this will return
-           immediately, but we process the timers added all at once.
-           That's okay, it just means we run through the loop a few
-           extra times.
+        if (SDL_UpdateTimerStats(data, now)) {
+            // Pick up any change to the slack property for the timers already queued
+            update_slack = true;
+        }
+
+        /* Let other threads know when we'll be back, so they only wake us
+           up if they add a timer that's due before then. If one came in
+           while we were busy, go around again right away.
          */
+        SDL_LockSpinlock(&data->lock);
+        if (data->pending) {
+            delay = 0;
+        } else if (data->num_timers > 0) {
+            data->next_deadline = data->timers[0]->scheduled;
+        } else {
+            data->next_deadline = (Uint64)-1;
+        }
+        SDL_UnlockSpinlock(&data->lock);
+
         SDL_WaitSemaphoreTimeoutNS(data->sem, delay);
+
+        ++data->num_wakeups;
+        ++data->stats_window_wakeups;
+    }
+
+    while (deferred) {
+        current = deferred;
+        deferred = current->next;
+        SDL_free(current);
     }
     return 0;
 }
@@ -219,11 +432,23 @@ bool SDL_InitTimers(void)
         goto error;
     }
 
+    data->timermap = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    if (!data->timermap) {
+        goto error;
+    }
+
     data->sem = SDL_CreateSemaphore(0);
     if (!data->sem) {
         goto error;
     }
 
+    data->props = SDL_CreateProperties();
+    if (!data->props) {
+        goto error;
+    }
+
+    SDL_AddHintCallback(SDL_HINT_TIMER_SLACK, SDL_TimerSlackChanged, data);
+
     SDL_SetAtomicInt(&data->active, true);
 
     // Timer threads use a callback into the app, so we can't set a limited stack size here.
@@ -245,7 +470,6 @@ void SDL_QuitTimers(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
 
     if (!SDL_ShouldQuit(&data->init)) {
         return;
@@ -265,10 +489,30 @@ void SDL_QuitTimers(void)
         data->sem = NULL;
     }
 
+    SDL_RemoveHintCallback(SDL_HINT_TIMER_SLACK, SDL_TimerSlackChanged, data);
+
+    if (data->props) {
+        SDL_DestroyProperties(data->props);
+        data->props = 0;
+    }
+    data->next_deadline = 0;
+    data->hint_slack = 0;
+    data->slack = 0;
+    data->slack_hint_seen = 0;
+    data->num_wakeups = 0;
+    data->num_callbacks = 0;
+    data->stats_window_wakeups = 0;
+
     // Clean up the timer entries
-    while (data->timers) {
-        timer = data->timers;
-        data->timers = timer->next;
+    while (data->num_timers > 0) {
+        SDL_free(data->timers[--data->num_timers]);
+    }
+    SDL_free(data->timers);
+    data->timers = NULL;
+    data->max_timers = 0;
+    while (data->pending) {
+        timer = data->pending;
+        data->pending = timer->next;
         SDL_free(timer);
     }
     while (data->freelist) {
@@ -276,10 +520,11 @@ void SDL_QuitTimers(void)
         data->freelist = timer->next;
         SDL_free(timer);
     }
-    while (data->timermap) {
-        entry = data->timermap;
-        data->timermap = entry->next;
-        SDL_free(entry);
+    SDL_SetAtomicInt(&data->num_canceled, 0);
+
+    if (data->timermap) {
+        SDL_DestroyHashTable(data->timermap);
+        data->timermap = NULL;
     }
 
     if (data->timermap_lock) {
@@ -299,7 +544,8 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    bool added;
+    bool wakeup;
 
     if (!callback_ms && !callback_ns) {
         SDL_InvalidParamError("callback");
@@ -318,7 +564,10 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     SDL_UnlockSpinlock(&data->lock);
 
     if (timer) {
-        SDL_RemoveTimer(timer->timerID);
+        // Timers that finished on their own are still in the map, take it out before reusing it.
+        SDL_LockMutex(data->timermap_lock);
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID);
+        SDL_UnlockMutex(data->timermap_lock);
     } else {
         timer = (SDL_Timer *)SDL_malloc(sizeof(*timer));
         if (!timer) {
@@ -333,29 +582,31 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     timer->scheduled = SDL_GetTicksNS() + timer->interval;
     SDL_SetAtomicInt(&timer->canceled, 0);
 
-    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
+    SDL_LockMutex(data->timermap_lock);
+    added = SDL_InsertIntoHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID, timer, false);
+    SDL_UnlockMutex(data->timermap_lock);
+    if (!added) {
         SDL_free(timer);
         return 0;
     }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
-
-    SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
-    SDL_UnlockMutex(data->timermap_lock);
 
     // Add the timer to the pending list for the timer thread
     SDL_LockSpinlock(&data->lock);
     timer->next = data->pending;
     data->pending = timer;
+    wakeup = (data->next_deadline != 0 && timer->scheduled < data->next_deadline);
+    if (wakeup) {
+        // The timer thread will pick up anything else added before it wakes up
+        data->next_deadline = 0;
+    }
     SDL_UnlockSpinlock(&data->lock);
 
-    // Wake up the timer thread if necessary
-    SDL_SignalSemaphore(data->sem);
+    // Wake up the timer thread if it's going to sleep past this timer
+    if (wakeup) {
+        SDL_SignalSemaphore(data->sem);
+    }
 
-    return entry->timerID;
+    return timer->timerID;
 }
 
 SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *userdata)
@@ -371,7 +622,7 @@ SDL_TimerID SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *
 bool SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    const void *value = NULL;
     bool canceled = false;
 
     if (!id) {
@@ -380,26 +631,18 @@ bool SDL_RemoveTimer(SDL_TimerID id)
 
     // Find the timer
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
-        }
-    }
-    SDL_UnlockMutex(data->timermap_lock);
+    if (data->timermap && SDL_FindInHashTable(data->timermap, (const void *)(uintptr_t)id, &value)) {
+        SDL_Timer *timer = (SDL_Timer *)value;
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)id);
 
-    if (entry) {
-        if (!SDL_GetAtomicInt(&entry->timer->canceled)) {
-            SDL_SetAtomicInt(&entry->timer->canceled, 1);
+        // the timer thread might be finishing this timer right now, so only count it if we're the one that canceled it.
+        if (SDL_CompareAndSwapAtomicInt(&timer->canceled, 0, 1)) {
+            SDL_AddAtomicInt(&data->num_canceled, 1);
             canceled = true;
         }
-        SDL_free(entry);
     }
+    SDL_UnlockMutex(data->timermap_lock);
+
     if (canceled) {
         return true;
     } else {
@@ -407,6 +650,14 @@ bool SDL_RemoveTimer(SDL_TimerID id)
     }
 }
 
+SDL_PropertiesID SDL_GetTimerProperties(void)
+{
+    if (!SDL_CheckInitTimers()) {
+        return 0;
+    }
+    return SDL_timer_data.props;
+}
+
 #else
 
 #include <emscripten/emscripten.h>
@@ -426,6 +677,7 @@ typedef struct SDL_TimerMap
 typedef struct
 {
     SDL_TimerMap *timermap;
+    SDL_PropertiesID props;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
@@ -460,6 +712,11 @@ void SDL_QuitTimers(void)
         data->timermap = entry->next;
         SDL_free(entry);
     }
+
+    if (data->props) {
+        SDL_DestroyProperties(data->props);
+        data->props = 0;
+    }
 }
 
 static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_ms, SDL_NSTimerCallback callback_ns, void *userdata)
@@ -533,6 +790,17 @@ bool SDL_RemoveTimer(SDL_TimerID id)
     }
 }
 
+SDL_PropertiesID SDL_GetTimerProperties(void)
+{
+    SDL_TimerData *data = &SDL_timer_data;
+
+    // Timers are run by the browser here, so there's nothing to report.
+    if (!data->props) {
+        data->props = SDL_CreateProperties();
+    }
+    return data->props;
+}
+
 #endif // !SDL_PLATFORM_EMSCRIPTEN || !SDL_THREADS_DISABLED
 
 static Uint64 tick_start;
@@ -27,6 +27,8 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "../cpuinfo/SDL_cpuinfo_c.h"
+#include "../thread/SDL_thread_c.h"
 
 // The general purpose software blit routine
 static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
@@ -97,7 +99,140 @@ static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
     return okay;
 }
 
-#ifdef SDL_HAVE_BLIT_AUTO
+/* Large conversions can be split into bands of rows that are converted in
+ * parallel on SDL's job threads, with the calling thread converting bands
+ * too. Every row is converted exactly as it is on a single thread, so the
+ * output is identical.
+ */
+#define SDL_MAX_BLIT_THREADS     64
+#define SDL_BLIT_BANDS_PER_THREAD 4
+#define SDL_MIN_PIXELS_PER_THREAD (64 * 1024)
+
+typedef struct
+{
+    SDL_BlitBandFunc func;
+    void *userdata;
+    int height;
+    int band_height;
+    SDL_AtomicInt failed;
+} SDL_BlitBandJob;
+
+static void SDLCALL SDL_RunBlitBandJob(void *userdata, int start, int end)
+{
+    SDL_BlitBandJob *job = (SDL_BlitBandJob *)userdata;
+    const int y = start * job->band_height;
+    const int h = SDL_min(end * job->band_height, job->height) - y;
+
+    if (!job->func(job->userdata, y, h)) {
+        SDL_SetAtomicInt(&job->failed, 1);
+    }
+}
+
+int SDL_GetBlitThreadCount(SDL_PropertiesID src_properties, SDL_PropertiesID dst_properties)
+{
+    const Sint64 unset = -1;
+    Sint64 num_threads;
+
+    num_threads = SDL_GetNumberProperty(dst_properties, SDL_PROP_SURFACE_CONVERT_THREADS_NUMBER, unset);
+    if (num_threads == unset) {
+        num_threads = SDL_GetNumberProperty(src_properties, SDL_PROP_SURFACE_CONVERT_THREADS_NUMBER, unset);
+    }
+    if (num_threads == unset) {
+        const char *hint = SDL_GetHint(SDL_HINT_SURFACE_CONVERT_THREADS);
+        num_threads = (hint && *hint) ? SDL_atoi(hint) : 1;
+    }
+    if (num_threads <= 0) {
+        num_threads = SDL_GetNumLogicalCPUCores();
+    }
+    return (int)SDL_min(num_threads, SDL_MAX_BLIT_THREADS);
+}
+
+bool SDL_RunBlitBands(int num_threads, int width, int height, int row_alignment, SDL_BlitBandFunc func, void *userdata)
+{
+    SDL_BlitBandJob job;
+    int num_bands;
+
+    // Don't wake up threads for less work than it takes to wake them up
+    num_threads = SDL_min(num_threads, (int)(((Sint64)width * height) / SDL_MIN_PIXELS_PER_THREAD));
+    num_threads = SDL_min(num_threads, height / row_alignment);
+    if (num_threads <= 1) {
+        return func(userdata, 0, height);
+    }
+
+    // Use a few bands per thread, so threads that finish early can take more
+    num_bands = SDL_min(num_threads * SDL_BLIT_BANDS_PER_THREAD, height / row_alignment);
+    job.func = func;
+    job.userdata = userdata;
+    job.height = height;
+    job.band_height = (height + num_bands - 1) / num_bands;
+    job.band_height = ((job.band_height + row_alignment - 1) / row_alignment) * row_alignment;
+    num_bands = (height + job.band_height - 1) / job.band_height;
+    SDL_SetAtomicInt(&job.failed, 0);
+
+    // Errors set on the job threads are lost, so run it again here to report them
+    if (!SDL_RunParallelFor(0, num_bands, 1, num_threads, SDL_RunBlitBandJob, &job) ||
+        SDL_GetAtomicInt(&job.failed)) {
+        return func(userdata, 0, height);
+    }
+    return true;
+}
+
+typedef struct
+{
+    SDL_Surface *src;
+    SDL_Surface *dst;
+} SDL_BlitBandData;
+
+static bool SDL_BlitSurfaceBand(void *userdata, int y, int h)
+{
+    SDL_BlitBandData *data = (SDL_BlitBandData *)userdata;
+    SDL_Surface *src = data->src;
+    SDL_Surface *dst = data->dst;
+    SDL_BlitInfo info;
+
+    // Each band blits with its own copy of the blit information
+    SDL_copyp(&info, &src->map.info);
+    info.src = (Uint8 *)src->pixels + y * src->pitch;
+    info.src_w = src->w;
+    info.src_h = h;
+    info.src_pitch = src->pitch;
+    info.src_skip = info.src_pitch - info.src_w * info.src_fmt->bytes_per_pixel;
+    info.dst = (Uint8 *)dst->pixels + y * dst->pitch;
+    info.dst_w = dst->w;
+    info.dst_h = h;
+    info.dst_pitch = dst->pitch;
+    info.dst_skip = info.dst_pitch - info.dst_w * info.dst_fmt->bytes_per_pixel;
+    ((SDL_BlitFunc)src->map.data)(&info);
+    return true;
+}
+
+bool SDL_BlitSurfaceBands(SDL_Surface *src, SDL_Surface *dst, int num_threads)
+{
+    SDL_Rect rect;
+
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = src->w;
+    rect.h = src->h;
+
+    if (num_threads > 1 && src->w == dst->w && src->h == dst->h) {
+        if (!SDL_ValidateMap(src, dst)) {
+            return false;
+        }
+
+        /* RLE blits can't start in the middle of the image, and the palette
+         * lookup cache used for indexed destinations isn't thread-safe */
+        if (src->map.blit == SDL_SoftBlit && !src->map.info.palette_map &&
+            !SDL_MUSTLOCK(src) && !SDL_MUSTLOCK(dst)) {
+            SDL_BlitBandData data;
+
+            data.src = src;
+            data.dst = dst;
+            return SDL_RunBlitBands(num_threads, src->w, src->h, 1, SDL_BlitSurfaceBand, &data);
+        }
+    }
+    return SDL_BlitSurfaceUnchecked(src, &rect, dst, &rect);
+}
 
 #ifdef SDL_PLATFORM_MACOS
 #include <sys/sysctl.h>
@@ -122,11 +257,42 @@ static bool SDL_UseAltivecPrefetch(void)
 }
 #endif // SDL_PLATFORM_MACOS
 
-static SDL_BlitFunc SDL_ChooseBlitFunc(SDL_PixelFormat src_format, SDL_PixelFormat dst_format, int flags,
-                                       SDL_BlitFuncEntry *entries)
+// Each tier includes the tiers below it on the same architecture
+static const struct
 {
-    int i, flagcheck = (flags & (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
-    static unsigned int features = 0x7fffffff;
+    const char *name;
+    Uint32 features;
+} SDL_blit_cpu_tiers[] = {
+    { "scalar", SDL_CPU_ANY },
+    { "mmx", SDL_CPU_MMX },
+    { "sse2", SDL_CPU_MMX | SDL_CPU_SSE | SDL_CPU_SSE2 },
+    { "sse4.1", SDL_CPU_MMX | SDL_CPU_SSE | SDL_CPU_SSE2 | SDL_CPU_SSE4_1 },
+    { "avx2", SDL_CPU_MMX | SDL_CPU_SSE | SDL_CPU_SSE2 | SDL_CPU_SSE4_1 | SDL_CPU_AVX2 },
+    { "avx512bw", SDL_CPU_MMX | SDL_CPU_SSE | SDL_CPU_SSE2 | SDL_CPU_SSE4_1 | SDL_CPU_AVX2 | SDL_CPU_AVX512BW },
+    { "altivec", SDL_CPU_ALTIVEC_PREFETCH | SDL_CPU_ALTIVEC_NOPREFETCH },
+    { "neon", SDL_CPU_NEON },
+    { "lsx", SDL_CPU_LSX },
+};
+
+static Uint32 SDL_GetBlitCPUTierMask(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_BLIT_CPU_TIER);
+    int i;
+
+    if (hint && *hint && SDL_strcasecmp(hint, "auto") != 0) {
+        for (i = 0; i < SDL_arraysize(SDL_blit_cpu_tiers); ++i) {
+            if (SDL_strcasecmp(hint, SDL_blit_cpu_tiers[i].name) == 0) {
+                return SDL_blit_cpu_tiers[i].features;
+            }
+        }
+    }
+    return ~0u;
+}
+
+// Get the CPU features the blitters may use, as SDL_CPU_* flags
+Uint32 SDL_GetBlitCPUFeatures(void)
+{
+    static Uint32 features = 0x7fffffff;
 
     // Get the available CPU features
     if (features == 0x7fffffff) {
@@ -140,6 +306,21 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(SDL_PixelFormat src_format, SDL_PixelForm
         if (SDL_HasSSE2()) {
             features |= SDL_CPU_SSE2;
         }
+        if (SDL_HasSSE41()) {
+            features |= SDL_CPU_SSE4_1;
+        }
+        if (SDL_HasAVX2()) {
+            features |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasAVX512BW()) {
+            features |= SDL_CPU_AVX512BW;
+        }
+        if (SDL_HasNEON()) {
+            features |= SDL_CPU_NEON;
+        }
+        if (SDL_HasLSX()) {
+            features |= SDL_CPU_LSX;
+        }
         if (SDL_HasAltiVec()) {
             if (SDL_UseAltivecPrefetch()) {
                 features |= SDL_CPU_ALTIVEC_PREFETCH;
@@ -148,6 +329,16 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(SDL_PixelFormat src_format, SDL_PixelForm
             }
         }
     }
+    return features & SDL_GetBlitCPUTierMask();
+}
+
+#ifdef SDL_HAVE_BLIT_AUTO
+
+static SDL_BlitFunc SDL_ChooseBlitFunc(SDL_PixelFormat src_format, SDL_PixelFormat dst_format, int flags,
+                                       SDL_BlitFuncEntry *entries)
+{
+    int i, flagcheck = (flags & (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
+    const Uint32 features = SDL_GetBlitCPUFeatures();
 
     for (i = 0; entries[i].func; ++i) {
         // Check for matching pixel formats
@@ -52,6 +52,11 @@ extern const Uint16 SDL_expand_byte_10[];
 #define SDL_CPU_SSE2               0x00000004
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000008
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000010
+#define SDL_CPU_SSE4_1             0x00000020
+#define SDL_CPU_AVX2               0x00000040
+#define SDL_CPU_NEON               0x00000080
+#define SDL_CPU_AVX512BW           0x00000100
+#define SDL_CPU_LSX                0x00000200
 
 typedef struct
 {
@@ -105,6 +110,14 @@ typedef struct SDL_BlitMap
 
 // Functions found in SDL_blit.c
 extern bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst);
+extern Uint32 SDL_GetBlitCPUFeatures(void);
+
+// Converts rows y to y+h-1 of an image, returning false on error
+typedef bool (*SDL_BlitBandFunc)(void *userdata, int y, int h);
+
+extern int SDL_GetBlitThreadCount(SDL_PropertiesID src_properties, SDL_PropertiesID dst_properties);
+extern bool SDL_RunBlitBands(int num_threads, int width, int height, int row_alignment, SDL_BlitBandFunc func, void *userdata);
+extern bool SDL_BlitSurfaceBands(SDL_Surface *src, SDL_Surface *dst, int num_threads);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface *surface);
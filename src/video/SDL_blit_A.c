@@ -1366,6 +1366,9 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 {
     const SDL_PixelFormatDetails *sf = surface->fmt;
     const SDL_PixelFormatDetails *df = surface->map.info.dst_fmt;
+    const Uint32 features = SDL_GetBlitCPUFeatures();
+
+    (void)features; // Only used by the SIMD blitters
 
     switch (surface->map.info.flags & ~SDL_COPY_RLE_MASK) {
     case SDL_COPY_BLEND:
@@ -1393,27 +1396,25 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
             if (SDL_PIXELLAYOUT(sf->format) == SDL_PACKEDLAYOUT_8888 && sf->Amask &&
                 SDL_PIXELLAYOUT(df->format) == SDL_PACKEDLAYOUT_8888) {
 #ifdef SDL_AVX2_INTRINSICS
-                if (SDL_HasAVX2()) {
+                if (features & SDL_CPU_AVX2) {
                     return Blit8888to8888PixelAlphaSwizzleAVX2;
                 }
 #endif
 #ifdef SDL_SSE4_1_INTRINSICS
-                if (SDL_HasSSE41()) {
+                if (features & SDL_CPU_SSE4_1) {
                     return Blit8888to8888PixelAlphaSwizzleSSE41;
                 }
 #endif
 #if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8)
-                // To prevent "unused function" compiler warnings/errors
-                (void)Blit8888to8888PixelAlpha;
-                (void)Blit8888to8888PixelAlphaSwizzle;
-                return Blit8888to8888PixelAlphaSwizzleNEON;
-#else
+                if (features & SDL_CPU_NEON) {
+                    return Blit8888to8888PixelAlphaSwizzleNEON;
+                }
+#endif
                 if (sf->format == df->format) {
                     return Blit8888to8888PixelAlpha;
                 } else {
                     return Blit8888to8888PixelAlphaSwizzle;
                 }
-#endif
             }
             return BlitNtoNPixelAlpha;
 
@@ -1439,7 +1440,7 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
                 if (surface->map.identity) {
                     if (df->Gmask == 0x7e0) {
 #ifdef SDL_MMX_INTRINSICS
-                        if (SDL_HasMMX()) {
+                        if (features & SDL_CPU_MMX) {
                             return Blit565to565SurfaceAlphaMMX;
                         } else
 #endif
@@ -1448,7 +1449,7 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
                         }
                     } else if (df->Gmask == 0x3e0) {
 #ifdef SDL_MMX_INTRINSICS
-                        if (SDL_HasMMX()) {
+                        if (features & SDL_CPU_MMX) {
                             return Blit555to555SurfaceAlphaMMX;
                         } else
 #endif
@@ -1462,7 +1463,7 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
             case 4:
                 if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->bytes_per_pixel == 4) {
 #ifdef SDL_SSE2_INTRINSICS
-                    if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasSSE2()) {
+                    if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && (features & SDL_CPU_SSE2)) {
                         return Blit888to888SurfaceAlphaSSE2;
                     }
 #endif
@@ -870,20 +870,20 @@ static void ConvertAltivec32to32_prefetch(SDL_BlitInfo *info)
     vec_dss(DST_CHAN_DEST);
 }
 
-static Uint32 GetBlitFeatures(void)
+static Uint32 GetBlitFeatures(Uint32 cpu_features)
 {
-    static Uint32 features = ~0u;
-    if (features == ~0u) {
-        features = (0
-                    // Feature 1 is has-MMX
-                    | ((SDL_HasMMX()) ? BLIT_FEATURE_HAS_MMX : 0)
-                    // Feature 2 is has-AltiVec
-                    | ((SDL_HasAltiVec()) ? BLIT_FEATURE_HAS_ALTIVEC : 0)
-                    // Feature 4 is dont-use-prefetch
-                    // !!!! FIXME: Check for G5 or later, not the cache size! Always prefetch on a G4.
-                    | ((GetL3CacheSize() == 0) ? BLIT_FEATURE_ALTIVEC_DONT_USE_PREFETCH : 0));
-    }
-    return features;
+    static Uint32 prefetch_features = ~0u;
+    if (prefetch_features == ~0u) {
+        // Feature 4 is dont-use-prefetch
+        // !!!! FIXME: Check for G5 or later, not the cache size! Always prefetch on a G4.
+        prefetch_features = ((GetL3CacheSize() == 0) ? BLIT_FEATURE_ALTIVEC_DONT_USE_PREFETCH : 0);
+    }
+    return (0
+            // Feature 1 is has-MMX
+            | ((cpu_features & SDL_CPU_MMX) ? BLIT_FEATURE_HAS_MMX : 0)
+            // Feature 2 is has-AltiVec
+            | ((cpu_features & (SDL_CPU_ALTIVEC_PREFETCH | SDL_CPU_ALTIVEC_NOPREFETCH)) ? BLIT_FEATURE_HAS_ALTIVEC : 0)
+            | prefetch_features);
 }
 
 #ifdef __MWERKS__
@@ -891,7 +891,7 @@ static Uint32 GetBlitFeatures(void)
 #endif
 #else
 // Feature 1 is has-MMX
-#define GetBlitFeatures() ((SDL_HasMMX() ? BLIT_FEATURE_HAS_MMX : 0))
+#define GetBlitFeatures(cpu_features) (((cpu_features) & SDL_CPU_MMX) ? BLIT_FEATURE_HAS_MMX : 0)
 #endif
 
 // This is now endian dependent
@@ -3109,6 +3109,7 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
     const SDL_PixelFormatDetails *srcfmt;
     const SDL_PixelFormatDetails *dstfmt;
     const struct blit_table *table;
+    const Uint32 features = SDL_GetBlitCPUFeatures();
     int which;
     SDL_BlitFunc blitfun;
 
@@ -3126,17 +3127,19 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
         if (SDL_PIXELLAYOUT(srcfmt->format) == SDL_PACKEDLAYOUT_8888 &&
             SDL_PIXELLAYOUT(dstfmt->format) == SDL_PACKEDLAYOUT_8888) {
 #ifdef SDL_AVX2_INTRINSICS
-            if (SDL_HasAVX2()) {
+            if (features & SDL_CPU_AVX2) {
                 return Blit8888to8888PixelSwizzleAVX2;
             }
 #endif
 #ifdef SDL_SSE4_1_INTRINSICS
-            if (SDL_HasSSE41()) {
+            if (features & SDL_CPU_SSE4_1) {
                 return Blit8888to8888PixelSwizzleSSE41;
             }
 #endif
 #if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8)
-            return Blit8888to8888PixelSwizzleNEON;
+            if (features & SDL_CPU_NEON) {
+                return Blit8888to8888PixelSwizzleNEON;
+            }
 #endif
         }
 
@@ -3158,7 +3161,7 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
                         MASKOK(dstfmt->Bmask, table[which].dstB) &&
                         dstfmt->bytes_per_pixel == table[which].dstbpp &&
                         (a_need & table[which].alpha) == a_need &&
-                        ((table[which].blit_features & GetBlitFeatures()) ==
+                        ((table[which].blit_features & GetBlitFeatures(features)) ==
                          table[which].blit_features)) {
                         break;
                     }
@@ -3203,7 +3206,7 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
             return Blit2to2Key;
         } else {
 #ifdef SDL_ALTIVEC_BLITTERS
-            if ((srcfmt->bytes_per_pixel == 4) && (dstfmt->bytes_per_pixel == 4) && SDL_HasAltiVec()) {
+            if ((srcfmt->bytes_per_pixel == 4) && (dstfmt->bytes_per_pixel == 4) && (features & (SDL_CPU_ALTIVEC_PREFETCH | SDL_CPU_ALTIVEC_NOPREFETCH))) {
                 return Blit32to32KeyAltivec;
             } else
 #endif
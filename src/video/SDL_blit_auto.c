@@ -11364,7 +11364,1236 @@ static void SDL_Blit_BGRA8888_ABGR8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#if defined(SDL_AVX2_INTRINSICS) || defined(SDL_SSE4_1_INTRINSICS) || (defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8) && (SDL_BYTEORDER == SDL_LIL_ENDIAN))
+
+// Byte shuffles for 4 pixels, an index of 0x80 clears the byte
+typedef struct
+{
+    Uint8 to_argb[16];      // src pixels to ARGB8888
+    Uint8 dst_to_argb[16];  // dst pixels to ARGB8888
+    Uint8 from_argb[16];    // ARGB8888 to dst pixels
+    Uint8 copy[16];         // src pixels directly to dst pixels
+    Uint32 src_alpha;       // ORed into the ARGB8888 pixels if the src has no alpha
+    Uint32 copy_alpha;      // ORed into the copied pixels if only the dst has alpha
+} SDL_Blit8888Shuffle;
+
+static void SDL_Get8888ChannelBytes(const SDL_PixelFormatDetails *fmt, int bytes[4])
+{
+    bytes[0] = fmt->Bshift / 8;
+    bytes[1] = fmt->Gshift / 8;
+    bytes[2] = fmt->Rshift / 8;
+    bytes[3] = fmt->Amask ? (fmt->Ashift / 8) : -1;
+}
+
+static void SDL_GetBlit8888Shuffle(const SDL_PixelFormatDetails *src_fmt, const SDL_PixelFormatDetails *dst_fmt, SDL_Blit8888Shuffle *shuffle)
+{
+    int src[4], dst[4];
+    int pixel, channel;
+
+    SDL_Get8888ChannelBytes(src_fmt, src);
+    SDL_Get8888ChannelBytes(dst_fmt, dst);
+
+    SDL_memset(shuffle, 0x80, sizeof(*shuffle));
+    for (pixel = 0; pixel < 16; pixel += 4) {
+        for (channel = 0; channel < 4; ++channel) {
+            shuffle->to_argb[pixel + channel] = (src[channel] >= 0) ? (Uint8)(pixel + src[channel]) : 0x80;
+            shuffle->dst_to_argb[pixel + channel] = (dst[channel] >= 0) ? (Uint8)(pixel + dst[channel]) : 0x80;
+            if (dst[channel] >= 0) {
+                shuffle->from_argb[pixel + dst[channel]] = (Uint8)(pixel + channel);
+                shuffle->copy[pixel + dst[channel]] = shuffle->to_argb[pixel + channel];
+            }
+        }
+    }
+    shuffle->src_alpha = (src[3] < 0) ? 0xFF000000 : 0;
+    shuffle->copy_alpha = (src[3] < 0 && dst[3] >= 0) ? (0xFFu << (dst[3] * 8)) : 0;
+}
+
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Load_AVX2(const void *pixels)
+{
+    return _mm256_loadu_si256((const __m256i *)pixels);
+}
+
+static SDL_INLINE void SDL_TARGETING("avx2") SDL_Blit8888_Store_AVX2(void *pixels, __m256i v)
+{
+    _mm256_storeu_si256((__m256i *)pixels, v);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_LoadMask_AVX2(const Uint8 *mask)
+{
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)mask));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Fill_AVX2(Uint32 value)
+{
+    return _mm256_set1_epi32((int)value);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Shuffle_AVX2(__m256i v, __m256i mask)
+{
+    return _mm256_shuffle_epi8(v, mask);
+}
+
+// Copies the ARGB8888 alpha to all the channels
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Alpha_AVX2(__m256i v)
+{
+    return _mm256_shuffle_epi8(v, _mm256_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15,
+                                                   3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Or_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_or_si256(a, b);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Not_AVX2(__m256i v)
+{
+    return _mm256_xor_si256(v, _mm256_set1_epi32(-1));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_AddSat_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_adds_epu8(a, b);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Select_AVX2(__m256i a, __m256i b, __m256i mask)
+{
+    return _mm256_blendv_epi8(a, b, mask);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_MulDiv255_AVX2(__m256i a, __m256i b)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero)), one);
+    __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero)), one);
+    lo = _mm256_srli_epi16(_mm256_add_epi16(lo, _mm256_srli_epi16(lo, 8)), 8);
+    hi = _mm256_srli_epi16(_mm256_add_epi16(hi, _mm256_srli_epi16(hi, 8)), 8);
+    return _mm256_packus_epi16(lo, hi);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Blend_AVX2(__m256i s, __m256i d, int blend)
+{
+    const __m256i alpha_mask = SDL_Blit8888_Fill_AVX2(0xFF000000);
+    const __m256i srcA = SDL_Blit8888_Alpha_AVX2(s);
+    const __m256i inv_srcA = SDL_Blit8888_Not_AVX2(srcA);
+
+    switch (blend) {
+    case SDL_COPY_BLEND:
+        s = SDL_Blit8888_MulDiv255_AVX2(s, SDL_Blit8888_Or_AVX2(srcA, alpha_mask));
+        return SDL_Blit8888_AddSat_AVX2(SDL_Blit8888_MulDiv255_AVX2(inv_srcA, d), s);
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        return SDL_Blit8888_AddSat_AVX2(SDL_Blit8888_MulDiv255_AVX2(inv_srcA, d), s);
+    case SDL_COPY_ADD:
+        s = SDL_Blit8888_MulDiv255_AVX2(s, SDL_Blit8888_Or_AVX2(srcA, alpha_mask));
+        SDL_FALLTHROUGH;
+    case SDL_COPY_ADD_PREMULTIPLIED:
+        return SDL_Blit8888_Select_AVX2(SDL_Blit8888_AddSat_AVX2(s, d), d, alpha_mask);
+    case SDL_COPY_MOD:
+        return SDL_Blit8888_Select_AVX2(SDL_Blit8888_MulDiv255_AVX2(s, d), d, alpha_mask);
+    case SDL_COPY_MUL:
+        return SDL_Blit8888_Select_AVX2(SDL_Blit8888_AddSat_AVX2(SDL_Blit8888_MulDiv255_AVX2(s, d), SDL_Blit8888_MulDiv255_AVX2(d, inv_srcA)), d, alpha_mask);
+    default:
+        return d;
+    }
+}
+
+static SDL_INLINE void SDL_TARGETING("avx2") SDL_Blit8888_AVX2(SDL_BlitInfo *info, bool modulate, bool blend, bool scale)
+{
+    const int flags = info->flags;
+    const bool same_format = (info->src_fmt->format == info->dst_fmt->format);
+    SDL_Blit8888Shuffle shuffle;
+    __m256i to_argb, dst_to_argb, from_argb, copy, src_alpha, copy_alpha, modulation;
+    Uint32 pixels[8];
+    Uint32 dst_pixels[8];
+    Uint64 posy = 0, posx = 0;
+    Uint64 incy = 0, incx = 0;
+    int i;
+
+    SDL_GetBlit8888Shuffle(info->src_fmt, info->dst_fmt, &shuffle);
+    to_argb = SDL_Blit8888_LoadMask_AVX2(shuffle.to_argb);
+    dst_to_argb = SDL_Blit8888_LoadMask_AVX2(shuffle.dst_to_argb);
+    from_argb = SDL_Blit8888_LoadMask_AVX2(shuffle.from_argb);
+    copy = SDL_Blit8888_LoadMask_AVX2(shuffle.copy);
+    src_alpha = SDL_Blit8888_Fill_AVX2(shuffle.src_alpha);
+    copy_alpha = SDL_Blit8888_Fill_AVX2(shuffle.copy_alpha);
+    modulation = SDL_Blit8888_Fill_AVX2(
+        ((Uint32)((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF) << 24) |
+        ((Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF) << 16) |
+        ((Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF) << 8) |
+        (Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF));
+
+    if (scale) {
+        incy = ((Uint64)info->src_h << 16) / info->dst_h;
+        incx = ((Uint64)info->src_w << 16) / info->dst_w;
+        posy = incy / 2;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)(scale ? (info->src + ((posy >> 16) * info->src_pitch)) : info->src);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 8);
+            __m256i s;
+
+            if (scale) {
+                for (i = 0; i < count; ++i) {
+                    pixels[i] = src[posx >> 16];
+                    posx += incx;
+                }
+                s = SDL_Blit8888_Load_AVX2(pixels);
+            } else if (count == 8) {
+                s = SDL_Blit8888_Load_AVX2(src);
+                src += 8;
+            } else {
+                SDL_memcpy(pixels, src, count * sizeof(Uint32));
+                s = SDL_Blit8888_Load_AVX2(pixels);
+            }
+
+            if (!modulate && !blend) {
+                // Pixels in the same format are copied unchanged, like the C blitters do
+                if (!same_format) {
+                    s = SDL_Blit8888_Or_AVX2(SDL_Blit8888_Shuffle_AVX2(s, copy), copy_alpha);
+                }
+            } else {
+                s = SDL_Blit8888_Or_AVX2(SDL_Blit8888_Shuffle_AVX2(s, to_argb), src_alpha);
+                if (modulate) {
+                    s = SDL_Blit8888_MulDiv255_AVX2(s, modulation);
+                }
+                if (blend) {
+                    __m256i d;
+
+                    if (count == 8) {
+                        d = SDL_Blit8888_Load_AVX2(dst);
+                    } else {
+                        SDL_memcpy(dst_pixels, dst, count * sizeof(Uint32));
+                        d = SDL_Blit8888_Load_AVX2(dst_pixels);
+                    }
+                    s = SDL_Blit8888_Blend_AVX2(s, SDL_Blit8888_Shuffle_AVX2(d, dst_to_argb), flags & SDL_COPY_BLEND_MASK);
+                }
+                s = SDL_Blit8888_Shuffle_AVX2(s, from_argb);
+            }
+
+            if (count == 8) {
+                SDL_Blit8888_Store_AVX2(dst, s);
+            } else {
+                SDL_Blit8888_Store_AVX2(pixels, s);
+                SDL_memcpy(dst, pixels, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, false, false, true);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, false, true, false);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, false, true, true);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, true, false, false);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, true, false, true);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, true, true, false);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_AVX2(info, true, true, true);
+}
+
+#endif
+
+#ifdef SDL_SSE4_1_INTRINSICS
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Load_SSE41(const void *pixels)
+{
+    return _mm_loadu_si128((const __m128i *)pixels);
+}
+
+static SDL_INLINE void SDL_TARGETING("sse4.1") SDL_Blit8888_Store_SSE41(void *pixels, __m128i v)
+{
+    _mm_storeu_si128((__m128i *)pixels, v);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_LoadMask_SSE41(const Uint8 *mask)
+{
+    return _mm_loadu_si128((const __m128i *)mask);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Fill_SSE41(Uint32 value)
+{
+    return _mm_set1_epi32((int)value);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Shuffle_SSE41(__m128i v, __m128i mask)
+{
+    return _mm_shuffle_epi8(v, mask);
+}
+
+// Copies the ARGB8888 alpha to all the channels
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Alpha_SSE41(__m128i v)
+{
+    return _mm_shuffle_epi8(v, _mm_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Or_SSE41(__m128i a, __m128i b)
+{
+    return _mm_or_si128(a, b);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Not_SSE41(__m128i v)
+{
+    return _mm_xor_si128(v, _mm_set1_epi32(-1));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_AddSat_SSE41(__m128i a, __m128i b)
+{
+    return _mm_adds_epu8(a, b);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Select_SSE41(__m128i a, __m128i b, __m128i mask)
+{
+    return _mm_blendv_epi8(a, b, mask);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_MulDiv255_SSE41(__m128i a, __m128i b)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero)), one);
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero)), one);
+    lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+    hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+    return _mm_packus_epi16(lo, hi);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Blend_SSE41(__m128i s, __m128i d, int blend)
+{
+    const __m128i alpha_mask = SDL_Blit8888_Fill_SSE41(0xFF000000);
+    const __m128i srcA = SDL_Blit8888_Alpha_SSE41(s);
+    const __m128i inv_srcA = SDL_Blit8888_Not_SSE41(srcA);
+
+    switch (blend) {
+    case SDL_COPY_BLEND:
+        s = SDL_Blit8888_MulDiv255_SSE41(s, SDL_Blit8888_Or_SSE41(srcA, alpha_mask));
+        return SDL_Blit8888_AddSat_SSE41(SDL_Blit8888_MulDiv255_SSE41(inv_srcA, d), s);
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        return SDL_Blit8888_AddSat_SSE41(SDL_Blit8888_MulDiv255_SSE41(inv_srcA, d), s);
+    case SDL_COPY_ADD:
+        s = SDL_Blit8888_MulDiv255_SSE41(s, SDL_Blit8888_Or_SSE41(srcA, alpha_mask));
+        SDL_FALLTHROUGH;
+    case SDL_COPY_ADD_PREMULTIPLIED:
+        return SDL_Blit8888_Select_SSE41(SDL_Blit8888_AddSat_SSE41(s, d), d, alpha_mask);
+    case SDL_COPY_MOD:
+        return SDL_Blit8888_Select_SSE41(SDL_Blit8888_MulDiv255_SSE41(s, d), d, alpha_mask);
+    case SDL_COPY_MUL:
+        return SDL_Blit8888_Select_SSE41(SDL_Blit8888_AddSat_SSE41(SDL_Blit8888_MulDiv255_SSE41(s, d), SDL_Blit8888_MulDiv255_SSE41(d, inv_srcA)), d, alpha_mask);
+    default:
+        return d;
+    }
+}
+
+static SDL_INLINE void SDL_TARGETING("sse4.1") SDL_Blit8888_SSE41(SDL_BlitInfo *info, bool modulate, bool blend, bool scale)
+{
+    const int flags = info->flags;
+    const bool same_format = (info->src_fmt->format == info->dst_fmt->format);
+    SDL_Blit8888Shuffle shuffle;
+    __m128i to_argb, dst_to_argb, from_argb, copy, src_alpha, copy_alpha, modulation;
+    Uint32 pixels[4];
+    Uint32 dst_pixels[4];
+    Uint64 posy = 0, posx = 0;
+    Uint64 incy = 0, incx = 0;
+    int i;
+
+    SDL_GetBlit8888Shuffle(info->src_fmt, info->dst_fmt, &shuffle);
+    to_argb = SDL_Blit8888_LoadMask_SSE41(shuffle.to_argb);
+    dst_to_argb = SDL_Blit8888_LoadMask_SSE41(shuffle.dst_to_argb);
+    from_argb = SDL_Blit8888_LoadMask_SSE41(shuffle.from_argb);
+    copy = SDL_Blit8888_LoadMask_SSE41(shuffle.copy);
+    src_alpha = SDL_Blit8888_Fill_SSE41(shuffle.src_alpha);
+    copy_alpha = SDL_Blit8888_Fill_SSE41(shuffle.copy_alpha);
+    modulation = SDL_Blit8888_Fill_SSE41(
+        ((Uint32)((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF) << 24) |
+        ((Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF) << 16) |
+        ((Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF) << 8) |
+        (Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF));
+
+    if (scale) {
+        incy = ((Uint64)info->src_h << 16) / info->dst_h;
+        incx = ((Uint64)info->src_w << 16) / info->dst_w;
+        posy = incy / 2;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)(scale ? (info->src + ((posy >> 16) * info->src_pitch)) : info->src);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            __m128i s;
+
+            if (scale) {
+                for (i = 0; i < count; ++i) {
+                    pixels[i] = src[posx >> 16];
+                    posx += incx;
+                }
+                s = SDL_Blit8888_Load_SSE41(pixels);
+            } else if (count == 4) {
+                s = SDL_Blit8888_Load_SSE41(src);
+                src += 4;
+            } else {
+                SDL_memcpy(pixels, src, count * sizeof(Uint32));
+                s = SDL_Blit8888_Load_SSE41(pixels);
+            }
+
+            if (!modulate && !blend) {
+                // Pixels in the same format are copied unchanged, like the C blitters do
+                if (!same_format) {
+                    s = SDL_Blit8888_Or_SSE41(SDL_Blit8888_Shuffle_SSE41(s, copy), copy_alpha);
+                }
+            } else {
+                s = SDL_Blit8888_Or_SSE41(SDL_Blit8888_Shuffle_SSE41(s, to_argb), src_alpha);
+                if (modulate) {
+                    s = SDL_Blit8888_MulDiv255_SSE41(s, modulation);
+                }
+                if (blend) {
+                    __m128i d;
+
+                    if (count == 4) {
+                        d = SDL_Blit8888_Load_SSE41(dst);
+                    } else {
+                        SDL_memcpy(dst_pixels, dst, count * sizeof(Uint32));
+                        d = SDL_Blit8888_Load_SSE41(dst_pixels);
+                    }
+                    s = SDL_Blit8888_Blend_SSE41(s, SDL_Blit8888_Shuffle_SSE41(d, dst_to_argb), flags & SDL_COPY_BLEND_MASK);
+                }
+                s = SDL_Blit8888_Shuffle_SSE41(s, from_argb);
+            }
+
+            if (count == 4) {
+                SDL_Blit8888_Store_SSE41(dst, s);
+            } else {
+                SDL_Blit8888_Store_SSE41(pixels, s);
+                SDL_memcpy(dst, pixels, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_SSE41(info, false, false, true);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_SSE41(info, false, true, false);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_SSE41(info, false, true, true);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_SSE41(info, true, false, false);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_SSE41(info, true, false, true);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_SSE41(info, true, true, false);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_SSE41(info, true, true, true);
+}
+
+#endif
+
+#if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Load_NEON(const void *pixels)
+{
+    return vld1q_u8((const Uint8 *)pixels);
+}
+
+static SDL_INLINE void SDL_Blit8888_Store_NEON(void *pixels, uint8x16_t v)
+{
+    vst1q_u8((Uint8 *)pixels, v);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_LoadMask_NEON(const Uint8 *mask)
+{
+    return vld1q_u8(mask);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Fill_NEON(Uint32 value)
+{
+    return vreinterpretq_u8_u32(vdupq_n_u32(value));
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Shuffle_NEON(uint8x16_t v, uint8x16_t mask)
+{
+    return vqtbl1q_u8(v, mask);
+}
+
+// Copies the ARGB8888 alpha to all the channels
+static SDL_INLINE uint8x16_t SDL_Blit8888_Alpha_NEON(uint8x16_t v)
+{
+    static const Uint8 alpha[16] = { 3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15 };
+    return vqtbl1q_u8(v, vld1q_u8(alpha));
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Or_NEON(uint8x16_t a, uint8x16_t b)
+{
+    return vorrq_u8(a, b);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Not_NEON(uint8x16_t v)
+{
+    return vmvnq_u8(v);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_AddSat_NEON(uint8x16_t a, uint8x16_t b)
+{
+    return vqaddq_u8(a, b);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Select_NEON(uint8x16_t a, uint8x16_t b, uint8x16_t mask)
+{
+    return vbslq_u8(mask, b, a);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_MulDiv255_NEON(uint8x16_t a, uint8x16_t b)
+{
+    const uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t lo = vaddq_u16(vmull_u8(vget_low_u8(a), vget_low_u8(b)), one);
+    uint16x8_t hi = vaddq_u16(vmull_u8(vget_high_u8(a), vget_high_u8(b)), one);
+    lo = vsraq_n_u16(lo, lo, 8);
+    hi = vsraq_n_u16(hi, hi, 8);
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Blend_NEON(uint8x16_t s, uint8x16_t d, int blend)
+{
+    const uint8x16_t alpha_mask = SDL_Blit8888_Fill_NEON(0xFF000000);
+    const uint8x16_t srcA = SDL_Blit8888_Alpha_NEON(s);
+    const uint8x16_t inv_srcA = SDL_Blit8888_Not_NEON(srcA);
+
+    switch (blend) {
+    case SDL_COPY_BLEND:
+        s = SDL_Blit8888_MulDiv255_NEON(s, SDL_Blit8888_Or_NEON(srcA, alpha_mask));
+        return SDL_Blit8888_AddSat_NEON(SDL_Blit8888_MulDiv255_NEON(inv_srcA, d), s);
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        return SDL_Blit8888_AddSat_NEON(SDL_Blit8888_MulDiv255_NEON(inv_srcA, d), s);
+    case SDL_COPY_ADD:
+        s = SDL_Blit8888_MulDiv255_NEON(s, SDL_Blit8888_Or_NEON(srcA, alpha_mask));
+        SDL_FALLTHROUGH;
+    case SDL_COPY_ADD_PREMULTIPLIED:
+        return SDL_Blit8888_Select_NEON(SDL_Blit8888_AddSat_NEON(s, d), d, alpha_mask);
+    case SDL_COPY_MOD:
+        return SDL_Blit8888_Select_NEON(SDL_Blit8888_MulDiv255_NEON(s, d), d, alpha_mask);
+    case SDL_COPY_MUL:
+        return SDL_Blit8888_Select_NEON(SDL_Blit8888_AddSat_NEON(SDL_Blit8888_MulDiv255_NEON(s, d), SDL_Blit8888_MulDiv255_NEON(d, inv_srcA)), d, alpha_mask);
+    default:
+        return d;
+    }
+}
+
+static SDL_INLINE void SDL_Blit8888_NEON(SDL_BlitInfo *info, bool modulate, bool blend, bool scale)
+{
+    const int flags = info->flags;
+    const bool same_format = (info->src_fmt->format == info->dst_fmt->format);
+    SDL_Blit8888Shuffle shuffle;
+    uint8x16_t to_argb, dst_to_argb, from_argb, copy, src_alpha, copy_alpha, modulation;
+    Uint32 pixels[4];
+    Uint32 dst_pixels[4];
+    Uint64 posy = 0, posx = 0;
+    Uint64 incy = 0, incx = 0;
+    int i;
+
+    SDL_GetBlit8888Shuffle(info->src_fmt, info->dst_fmt, &shuffle);
+    to_argb = SDL_Blit8888_LoadMask_NEON(shuffle.to_argb);
+    dst_to_argb = SDL_Blit8888_LoadMask_NEON(shuffle.dst_to_argb);
+    from_argb = SDL_Blit8888_LoadMask_NEON(shuffle.from_argb);
+    copy = SDL_Blit8888_LoadMask_NEON(shuffle.copy);
+    src_alpha = SDL_Blit8888_Fill_NEON(shuffle.src_alpha);
+    copy_alpha = SDL_Blit8888_Fill_NEON(shuffle.copy_alpha);
+    modulation = SDL_Blit8888_Fill_NEON(
+        ((Uint32)((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF) << 24) |
+        ((Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF) << 16) |
+        ((Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF) << 8) |
+        (Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF));
+
+    if (scale) {
+        incy = ((Uint64)info->src_h << 16) / info->dst_h;
+        incx = ((Uint64)info->src_w << 16) / info->dst_w;
+        posy = incy / 2;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)(scale ? (info->src + ((posy >> 16) * info->src_pitch)) : info->src);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, 4);
+            uint8x16_t s;
+
+            if (scale) {
+                for (i = 0; i < count; ++i) {
+                    pixels[i] = src[posx >> 16];
+                    posx += incx;
+                }
+                s = SDL_Blit8888_Load_NEON(pixels);
+            } else if (count == 4) {
+                s = SDL_Blit8888_Load_NEON(src);
+                src += 4;
+            } else {
+                SDL_memcpy(pixels, src, count * sizeof(Uint32));
+                s = SDL_Blit8888_Load_NEON(pixels);
+            }
+
+            if (!modulate && !blend) {
+                // Pixels in the same format are copied unchanged, like the C blitters do
+                if (!same_format) {
+                    s = SDL_Blit8888_Or_NEON(SDL_Blit8888_Shuffle_NEON(s, copy), copy_alpha);
+                }
+            } else {
+                s = SDL_Blit8888_Or_NEON(SDL_Blit8888_Shuffle_NEON(s, to_argb), src_alpha);
+                if (modulate) {
+                    s = SDL_Blit8888_MulDiv255_NEON(s, modulation);
+                }
+                if (blend) {
+                    uint8x16_t d;
+
+                    if (count == 4) {
+                        d = SDL_Blit8888_Load_NEON(dst);
+                    } else {
+                        SDL_memcpy(dst_pixels, dst, count * sizeof(Uint32));
+                        d = SDL_Blit8888_Load_NEON(dst_pixels);
+                    }
+                    s = SDL_Blit8888_Blend_NEON(s, SDL_Blit8888_Shuffle_NEON(d, dst_to_argb), flags & SDL_COPY_BLEND_MASK);
+                }
+                s = SDL_Blit8888_Shuffle_NEON(s, from_argb);
+            }
+
+            if (count == 4) {
+                SDL_Blit8888_Store_NEON(dst, s);
+            } else {
+                SDL_Blit8888_Store_NEON(pixels, s);
+                SDL_memcpy(dst, pixels, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_Blit_8888_8888_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, false, false, true);
+}
+
+static void SDL_Blit_8888_8888_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, false, true, false);
+}
+
+static void SDL_Blit_8888_8888_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, false, true, true);
+}
+
+static void SDL_Blit_8888_8888_Modulate_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, true, false, false);
+}
+
+static void SDL_Blit_8888_8888_Modulate_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, true, false, true);
+}
+
+static void SDL_Blit_8888_8888_Modulate_Blend_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, true, true, false);
+}
+
+static void SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON(SDL_BlitInfo *info)
+{
+    SDL_Blit8888_NEON(info, true, true, true);
+}
+
+#endif
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Blend_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Scale_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_AVX2 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_8888_8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Blend_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Scale_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_SSE41 },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_8888_8888_Modulate_Blend_Scale_SSE41 },
+#endif
+#if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Blend_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Scale_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_NEON },
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ABGR8888, (SDL_COPY_MODULATE_MASK | SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_NEON, SDL_Blit_8888_8888_Modulate_Blend_Scale_NEON },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Scale },
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Blend },
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND_MASK | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Blend_Scale },
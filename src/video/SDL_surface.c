@@ -1892,7 +1892,6 @@ SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelForm
     SDL_PropertiesID src_properties;
     Uint32 copy_flags;
     SDL_Color copy_color;
-    SDL_Rect bounds;
     bool result;
     bool palette_ck_transform = false;
     Uint8 palette_ck_value = 0;
@@ -1982,12 +1981,6 @@ SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelForm
     surface->map.info.flags = (copy_flags & (SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY));
     SDL_InvalidateMap(&surface->map);
 
-    // Copy over the image data
-    bounds.x = 0;
-    bounds.y = 0;
-    bounds.w = surface->w;
-    bounds.h = surface->h;
-
     /* Source surface has a palette with no real alpha (0 or OPAQUE).
      * Destination format has alpha.
      * -> set alpha channel to be opaque */
@@ -2026,7 +2019,8 @@ SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelForm
         }
     }
 
-    result = SDL_BlitSurfaceUnchecked(surface, &bounds, convert, &bounds);
+    // Copy over the image data
+    result = SDL_BlitSurfaceBands(surface, convert, SDL_GetBlitThreadCount(surface->props, props));
 
     // Restore colorkey alpha value
     if (palette_ck_transform) {
@@ -2296,7 +2290,6 @@ bool SDL_ConvertPixelsAndColorspace(int width, int height,
 {
     SDL_Surface src_surface;
     SDL_Surface dst_surface;
-    SDL_Rect rect;
     void *nonconst_src = (void *)src;
     bool result;
 
@@ -2364,12 +2357,8 @@ bool SDL_ConvertPixelsAndColorspace(int width, int height,
         return false;
     }
 
-    // Set up the rect and go!
-    rect.x = 0;
-    rect.y = 0;
-    rect.w = width;
-    rect.h = height;
-    result = SDL_BlitSurfaceUnchecked(&src_surface, &rect, &dst_surface, &rect);
+    // Convert the pixels, on several threads if requested
+    result = SDL_BlitSurfaceBands(&src_surface, &dst_surface, SDL_GetBlitThreadCount(src_properties, dst_properties));
 
     SDL_DestroySurface(&src_surface);
     SDL_DestroySurface(&dst_surface);
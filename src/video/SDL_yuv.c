@@ -21,6 +21,7 @@
 #include "SDL_internal.h"
 
 #include "SDL_pixels_c.h"
+#include "SDL_blit.h"
 #include "SDL_yuv_c.h"
 
 #include "yuv2rgb/yuv_rgb.h"
@@ -586,6 +587,62 @@ static bool yuv_rgb_std(
     return false;
 }
 
+typedef struct
+{
+    SDL_PixelFormat src_format;
+    SDL_PixelFormat dst_format;
+    Uint32 width;
+    Uint32 height;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    Uint8 *rgb;
+    Uint32 rgb_stride;
+    YCbCrType yuv_type;
+} YUVToRGBBand;
+
+static bool yuv_rgb_band(void *userdata, int row, int rows)
+{
+    const YUVToRGBBand *band = (const YUVToRGBBand *)userdata;
+    const int uv_row = IsPlanar2x2Format(band->src_format) ? (row / 2) : row;
+    const Uint8 *y = band->y + (size_t)row * band->y_stride;
+    const Uint8 *u = band->u + (size_t)uv_row * band->uv_stride;
+    const Uint8 *v = band->v + (size_t)uv_row * band->uv_stride;
+    Uint8 *rgb = band->rgb + (size_t)row * band->rgb_stride;
+
+    if (yuv_rgb_sse(band->src_format, band->dst_format, band->width, rows, y, u, v, band->y_stride, band->uv_stride, rgb, band->rgb_stride, band->yuv_type)) {
+        /* The SSE code converts the last row of packed formats with the C code,
+           so it doesn't read past the end of the image. Convert that row again
+           with the row below it into a scratch buffer, so it's the same as when
+           the whole image is converted at once. */
+        if (IsPacked4Format(band->src_format) && (Uint32)(row + rows) < band->height) {
+            const size_t length = (size_t)band->width * SDL_BYTESPERPIXEL(band->dst_format);
+            Uint8 *scratch = (Uint8 *)SDL_malloc(2 * length);
+            if (!scratch) {
+                return false;
+            }
+            y += (size_t)(rows - 1) * band->y_stride;
+            u += (size_t)(rows - 1) * band->uv_stride;
+            v += (size_t)(rows - 1) * band->uv_stride;
+            yuv_rgb_sse(band->src_format, band->dst_format, band->width, 2, y, u, v, band->y_stride, band->uv_stride, scratch, (Uint32)length, band->yuv_type);
+            SDL_memcpy(rgb + (size_t)(rows - 1) * band->rgb_stride, scratch, length);
+            SDL_free(scratch);
+        }
+        return true;
+    }
+
+    if (yuv_rgb_lsx(band->src_format, band->dst_format, band->width, rows, y, u, v, band->y_stride, band->uv_stride, rgb, band->rgb_stride, band->yuv_type)) {
+        return true;
+    }
+
+    if (yuv_rgb_std(band->src_format, band->dst_format, band->width, rows, y, u, v, band->y_stride, band->uv_stride, rgb, band->rgb_stride, band->yuv_type)) {
+        return true;
+    }
+    return false;
+}
+
 bool SDL_ConvertPixels_YUV_to_RGB(int width, int height,
                                   SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch,
                                   SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch)
@@ -607,15 +664,23 @@ bool SDL_ConvertPixels_YUV_to_RGB(int width, int height,
             return false;
         }
 
-        if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
-            return true;
-        }
+        YUVToRGBBand band;
 
-        if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
-            return true;
-        }
+        band.src_format = src_format;
+        band.dst_format = dst_format;
+        band.width = width;
+        band.height = height;
+        band.y = y;
+        band.u = u;
+        band.v = v;
+        band.y_stride = y_stride;
+        band.uv_stride = uv_stride;
+        band.rgb = (Uint8 *)dst;
+        band.rgb_stride = dst_pitch;
+        band.yuv_type = yuv_type;
 
-        if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+        // Bands start on even rows, so they don't split the chroma rows of 4:2:0 formats
+        if (SDL_RunBlitBands(SDL_GetBlitThreadCount(src_properties, dst_properties), width, height, 2, yuv_rgb_band, &band)) {
             return true;
         }
     }
@@ -716,16 +781,21 @@ static struct RGB2YUVFactors RGB2YUVFactorTables[] = {
     },
 };
 
-static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
+/* The RGB to YUV conversions are done a row at a time. The SIMD versions of
+ * each row function convert as much of the row as they can and return how far
+ * they got, and the scalar version converts the rest. The SIMD versions do
+ * the same float operations in the same order as the scalar ones, but on
+ * ARM64 compilers fuse the scalar multiplies and adds into FMA instructions by
+ * default, so a result can be off by one step from what the SIMD code gives.
+ */
+typedef struct RGB2YUVKernels
 {
-    const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
-    const int width_half = width / 2;
-    const int width_remainder = (width & 0x1);
-    int i, j;
-
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
+    int (*XRGB8888_to_Y)(const Uint8 *src, Uint8 *plane_y, int width, const struct RGB2YUVFactors *cvt);
+    int (*XRGB8888_to_UV)(const Uint8 *curr_row, const Uint8 *next_row, Uint8 *plane_u, Uint8 *plane_v, int uv_step, int width, const struct RGB2YUVFactors *cvt);
+    int (*XRGB8888_to_Packed)(const Uint8 *src, Uint8 *plane, SDL_PixelFormat dst_format, int width, const struct RGB2YUVFactors *cvt);
+    int (*XBGR2101010_to_Y)(const Uint8 *src, Uint16 *plane_y, int width, const struct RGB2YUVFactors *cvt);
+    int (*XBGR2101010_to_UV)(const Uint8 *curr_row, const Uint8 *next_row, Uint16 *plane_uv, int width, const struct RGB2YUVFactors *cvt);
+} RGB2YUVKernels;
 
 #define MAKE_Y(r, g, b) (Uint8)SDL_clamp(((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset), 0, 255)
 #define MAKE_U(r, g, b) (Uint8)SDL_clamp(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128), 0, 255)
@@ -747,13 +817,6 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
     const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;  \
     const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;
 
-#define READ_1x2_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];        \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;  \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;
-
 #define READ_1x1_PIXEL                                  \
     const Uint32 p = ((const Uint32 *)curr_row)[2 * i]; \
     const Uint32 r = (p & 0x00ff0000) >> 16;            \
@@ -775,19 +838,817 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
 
 #define READ_ONE_RGB_PIXEL READ_1x1_PIXEL
 
+// Converts a row of XRGB8888 pixels to Y, starting at pixel i
+static void XRGB8888_to_Y_std(const Uint8 *curr_row, Uint8 *plane_y, int i, int width, const struct RGB2YUVFactors *cvt)
+{
+    for (; i < width; i++) {
+        const Uint32 p1 = ((const Uint32 *)curr_row)[i];
+        const Uint32 r = (p1 & 0x00ff0000) >> 16;
+        const Uint32 g = (p1 & 0x0000ff00) >> 8;
+        const Uint32 b = (p1 & 0x000000ff);
+        plane_y[i] = MAKE_Y(r, g, b);
+    }
+}
+
+/* Converts two rows of XRGB8888 pixels to U and V, starting at the 2x2 block i.
+ * The U and V samples are uv_step bytes apart, 1 for separate planes and 2
+ * for interleaved ones. The last row of an odd height is passed as both rows,
+ * which averages each pair of pixels in it.
+ */
+static void XRGB8888_to_UV_std(const Uint8 *curr_row, const Uint8 *next_row, Uint8 *plane_u, Uint8 *plane_v, int uv_step, int i, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+
+    for (; i < width_half; i++) {
+        READ_2x2_PIXELS;
+        plane_u[i * uv_step] = MAKE_U(r, g, b);
+        plane_v[i * uv_step] = MAKE_V(r, g, b);
+    }
+    if (width & 0x1) {
+        READ_2x1_PIXELS;
+        plane_u[i * uv_step] = MAKE_U(r, g, b);
+        plane_v[i * uv_step] = MAKE_V(r, g, b);
+    }
+}
+
+// Converts a row of XRGB8888 pixels to packed YUV, starting at the pair of pixels i
+static void XRGB8888_to_Packed_std(const Uint8 *curr_row, Uint8 *plane, SDL_PixelFormat dst_format, int i, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+    int y0, u, y1, v;
+
+    // Offsets of the samples in each group of 4 bytes
+    if (dst_format == SDL_PIXELFORMAT_YUY2) {
+        // Y U Y1 V
+        y0 = 0;
+        u = 1;
+        y1 = 2;
+        v = 3;
+    } else if (dst_format == SDL_PIXELFORMAT_UYVY) {
+        // U Y V Y1
+        u = 0;
+        y0 = 1;
+        v = 2;
+        y1 = 3;
+    } else {
+        // Y V Y1 U
+        y0 = 0;
+        v = 1;
+        y1 = 2;
+        u = 3;
+    }
+
+    plane += 4 * i;
+    for (; i < width_half; i++) {
+        READ_TWO_RGB_PIXELS;
+        plane[y0] = MAKE_Y(r, g, b);
+        plane[u] = MAKE_U(R, G, B);
+        plane[y1] = MAKE_Y(r1, g1, b1);
+        plane[v] = MAKE_V(R, G, B);
+        plane += 4;
+    }
+    if (width & 0x1) {
+        READ_ONE_RGB_PIXEL;
+        plane[y0] = MAKE_Y(r, g, b);
+        plane[u] = MAKE_U(r, g, b);
+        plane[y1] = MAKE_Y(r, g, b);
+        plane[v] = MAKE_V(r, g, b);
+    }
+}
+
+#undef MAKE_Y
+#undef MAKE_U
+#undef MAKE_V
+#undef READ_2x2_PIXELS
+#undef READ_2x1_PIXELS
+#undef READ_1x1_PIXEL
+#undef READ_TWO_RGB_PIXELS
+#undef READ_ONE_RGB_PIXEL
+
+#define MAKE_Y(r, g, b) (Uint16)(((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset) << 6)
+#define MAKE_U(r, g, b) (Uint16)(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 512) << 6)
+#define MAKE_V(r, g, b) (Uint16)(((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 512) << 6)
+
+#define READ_2x2_PIXELS                                                                                     \
+    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
+    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
+    const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
+    const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
+    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff) + (p3 & 0x000003ff) + (p4 & 0x000003ff)) >> 2;  \
+    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00) + (p3 & 0x000ffc00) + (p4 & 0x000ffc00)) >> 12; \
+    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000) + (p3 & 0x3ff00000) + (p4 & 0x3ff00000)) >> 22;
+
+#define READ_2x1_PIXELS                                             \
+    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
+    const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];            \
+    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff)) >> 1;  \
+    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00)) >> 11; \
+    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000)) >> 21;
+
+// Converts a row of XBGR2101010 pixels to Y, starting at pixel i
+static void XBGR2101010_to_Y_std(const Uint8 *curr_row, Uint16 *plane_y, int i, int width, const struct RGB2YUVFactors *cvt)
+{
+    for (; i < width; i++) {
+        const Uint32 p1 = ((const Uint32 *)curr_row)[i];
+        const Uint32 r = (p1 >>  0) & 0x03ff;
+        const Uint32 g = (p1 >> 10) & 0x03ff;
+        const Uint32 b = (p1 >> 20) & 0x03ff;
+        plane_y[i] = MAKE_Y(r, g, b);
+    }
+}
+
+// Converts two rows of XBGR2101010 pixels to interleaved U and V, starting at the 2x2 block i
+static void XBGR2101010_to_UV_std(const Uint8 *curr_row, const Uint8 *next_row, Uint16 *plane_uv, int i, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+
+    for (; i < width_half; i++) {
+        READ_2x2_PIXELS;
+        plane_uv[2 * i] = MAKE_U(r, g, b);
+        plane_uv[2 * i + 1] = MAKE_V(r, g, b);
+    }
+    if (width & 0x1) {
+        READ_2x1_PIXELS;
+        plane_uv[2 * i] = MAKE_U(r, g, b);
+        plane_uv[2 * i + 1] = MAKE_V(r, g, b);
+    }
+}
+
+#undef MAKE_Y
+#undef MAKE_U
+#undef MAKE_V
+#undef READ_2x2_PIXELS
+#undef READ_2x1_PIXELS
+
+#ifdef SDL_SSE2_INTRINSICS
+// Returns (int)(factors[0] * r + factors[1] * g + factors[2] * b + 0.5f)
+static SDL_INLINE __m128i SDL_TARGETING("sse2") RGB2YUV_Dot_SSE2(__m128i r, __m128i g, __m128i b, const float *factors)
+{
+    __m128 sum = _mm_mul_ps(_mm_cvtepi32_ps(r), _mm_set1_ps(factors[0]));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_cvtepi32_ps(g), _mm_set1_ps(factors[1])));
+    sum = _mm_add_ps(sum, _mm_mul_ps(_mm_cvtepi32_ps(b), _mm_set1_ps(factors[2])));
+    sum = _mm_add_ps(sum, _mm_set1_ps(0.5f));
+    return _mm_cvttps_epi32(sum);
+}
+
+// Returns the even and the odd elements of a followed by b
+static SDL_INLINE __m128i SDL_TARGETING("sse2") RGB2YUV_Even_SSE2(__m128i a, __m128i b)
+{
+    return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") RGB2YUV_Odd_SSE2(__m128i a, __m128i b)
+{
+    return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+// Packs to 16 bits, keeping the low 16 bits of each value like a cast to Uint16
+static SDL_INLINE __m128i SDL_TARGETING("sse2") RGB2YUV_Pack16_SSE2(__m128i a, __m128i b)
+{
+    a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+    b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+    return _mm_packs_epi32(a, b);
+}
+
+// Averages four 2x2 blocks of XRGB8888 pixels, adding red and blue, and green, in 16-bit halves
+static SDL_INLINE void SDL_TARGETING("sse2") XRGB8888_Read2x2_SSE2(const Uint8 *curr_row, const Uint8 *next_row, __m128i *r, __m128i *g, __m128i *b)
+{
+    const __m128i mask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i low = _mm_set1_epi32(0x0000ffff);
+    const __m128i p1 = _mm_loadu_si128((const __m128i *)curr_row);
+    const __m128i p2 = _mm_loadu_si128((const __m128i *)(curr_row + 16));
+    const __m128i p3 = _mm_loadu_si128((const __m128i *)next_row);
+    const __m128i p4 = _mm_loadu_si128((const __m128i *)(next_row + 16));
+    const __m128i rb1 = _mm_add_epi32(_mm_and_si128(p1, mask), _mm_and_si128(p3, mask));
+    const __m128i rb2 = _mm_add_epi32(_mm_and_si128(p2, mask), _mm_and_si128(p4, mask));
+    const __m128i g1 = _mm_add_epi32(_mm_and_si128(_mm_srli_epi32(p1, 8), mask), _mm_and_si128(_mm_srli_epi32(p3, 8), mask));
+    const __m128i g2 = _mm_add_epi32(_mm_and_si128(_mm_srli_epi32(p2, 8), mask), _mm_and_si128(_mm_srli_epi32(p4, 8), mask));
+    const __m128i rb = _mm_add_epi32(RGB2YUV_Even_SSE2(rb1, rb2), RGB2YUV_Odd_SSE2(rb1, rb2));
+    const __m128i ag = _mm_add_epi32(RGB2YUV_Even_SSE2(g1, g2), RGB2YUV_Odd_SSE2(g1, g2));
+
+    *r = _mm_srli_epi32(rb, 18);
+    *g = _mm_srli_epi32(_mm_and_si128(ag, low), 2);
+    *b = _mm_srli_epi32(_mm_and_si128(rb, low), 2);
+}
+
+static int SDL_TARGETING("sse2") XRGB8888_to_Y_SSE2(const Uint8 *src, Uint8 *plane_y, int width, const struct RGB2YUVFactors *cvt)
+{
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128i offset = _mm_set1_epi32(cvt->y_offset);
+    __m128i y[4];
+    int i, k;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        for (k = 0; k < 4; ++k) {
+            const __m128i p = _mm_loadu_si128((const __m128i *)(src + (i + 4 * k) * 4));
+            const __m128i r = _mm_and_si128(_mm_srli_epi32(p, 16), mask);
+            const __m128i g = _mm_and_si128(_mm_srli_epi32(p, 8), mask);
+            const __m128i b = _mm_and_si128(p, mask);
+            y[k] = _mm_add_epi32(RGB2YUV_Dot_SSE2(r, g, b, cvt->y), offset);
+        }
+        // The saturating packs clamp to 0-255
+        _mm_storeu_si128((__m128i *)(plane_y + i), _mm_packus_epi16(_mm_packs_epi32(y[0], y[1]), _mm_packs_epi32(y[2], y[3])));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse2") XRGB8888_to_UV_SSE2(const Uint8 *curr_row, const Uint8 *next_row, Uint8 *plane_u, Uint8 *plane_v, int uv_step, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+    const __m128i offset = _mm_set1_epi32(128);
+    __m128i r, g, b, u1, v1, u2, v2, uv;
+    int i;
+
+    for (i = 0; i + 8 <= width_half; i += 8) {
+        XRGB8888_Read2x2_SSE2(curr_row + i * 8, next_row + i * 8, &r, &g, &b);
+        u1 = _mm_add_epi32(RGB2YUV_Dot_SSE2(r, g, b, cvt->u), offset);
+        v1 = _mm_add_epi32(RGB2YUV_Dot_SSE2(r, g, b, cvt->v), offset);
+        XRGB8888_Read2x2_SSE2(curr_row + i * 8 + 32, next_row + i * 8 + 32, &r, &g, &b);
+        u2 = _mm_add_epi32(RGB2YUV_Dot_SSE2(r, g, b, cvt->u), offset);
+        v2 = _mm_add_epi32(RGB2YUV_Dot_SSE2(r, g, b, cvt->v), offset);
+
+        // 8 U samples followed by 8 V samples
+        uv = _mm_packus_epi16(_mm_packs_epi32(u1, u2), _mm_packs_epi32(v1, v2));
+        if (uv_step == 1) {
+            _mm_storel_epi64((__m128i *)(plane_u + i), uv);
+            _mm_storel_epi64((__m128i *)(plane_v + i), _mm_srli_si128(uv, 8));
+        } else if (plane_u < plane_v) {
+            _mm_storeu_si128((__m128i *)(plane_u + i * 2), _mm_unpacklo_epi8(uv, _mm_srli_si128(uv, 8)));
+        } else {
+            _mm_storeu_si128((__m128i *)(plane_v + i * 2), _mm_unpacklo_epi8(_mm_srli_si128(uv, 8), uv));
+        }
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse2") XRGB8888_to_Packed_SSE2(const Uint8 *src, Uint8 *plane, SDL_PixelFormat dst_format, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128i mask16 = _mm_set1_epi32(0x00ff00ff);
+    const __m128i low = _mm_set1_epi32(0x0000ffff);
+    const __m128i y_offset = _mm_set1_epi32(cvt->y_offset);
+    const __m128i uv_offset = _mm_set1_epi32(128);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max = _mm_set1_epi16(255);
+    int i;
+
+    for (i = 0; i + 4 <= width_half; i += 4) {
+        const __m128i pixels1 = _mm_loadu_si128((const __m128i *)(src + i * 8));
+        const __m128i pixels2 = _mm_loadu_si128((const __m128i *)(src + i * 8 + 16));
+        const __m128i p = RGB2YUV_Even_SSE2(pixels1, pixels2);
+        const __m128i p1 = RGB2YUV_Odd_SSE2(pixels1, pixels2);
+        const __m128i y0 = _mm_add_epi32(RGB2YUV_Dot_SSE2(_mm_and_si128(_mm_srli_epi32(p, 16), mask), _mm_and_si128(_mm_srli_epi32(p, 8), mask), _mm_and_si128(p, mask), cvt->y), y_offset);
+        const __m128i y1 = _mm_add_epi32(RGB2YUV_Dot_SSE2(_mm_and_si128(_mm_srli_epi32(p1, 16), mask), _mm_and_si128(_mm_srli_epi32(p1, 8), mask), _mm_and_si128(p1, mask), cvt->y), y_offset);
+        const __m128i rb = _mm_add_epi32(_mm_and_si128(p, mask16), _mm_and_si128(p1, mask16));
+        const __m128i ag = _mm_add_epi32(_mm_and_si128(_mm_srli_epi32(p, 8), mask16), _mm_and_si128(_mm_srli_epi32(p1, 8), mask16));
+        const __m128i R = _mm_srli_epi32(rb, 17);
+        const __m128i G = _mm_srli_epi32(_mm_and_si128(ag, low), 1);
+        const __m128i B = _mm_srli_epi32(_mm_and_si128(rb, low), 1);
+        const __m128i u = _mm_add_epi32(RGB2YUV_Dot_SSE2(R, G, B, cvt->u), uv_offset);
+        const __m128i v = _mm_add_epi32(RGB2YUV_Dot_SSE2(R, G, B, cvt->v), uv_offset);
+        __m128i ys, uvs, words;
+
+        // Clamp to 0-255 in 16 bits, Y for the first pixels then Y for the second pixels
+        ys = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(y0, y1), zero), max);
+        if (dst_format == SDL_PIXELFORMAT_YVYU) {
+            uvs = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(v, u), zero), max);
+        } else {
+            uvs = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(u, v), zero), max);
+        }
+
+        // Pair each Y with the chroma sample that follows or precedes it, then interleave the pairs
+        if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            words = _mm_or_si128(uvs, _mm_slli_epi16(ys, 8));
+        } else {
+            words = _mm_or_si128(ys, _mm_slli_epi16(uvs, 8));
+        }
+        _mm_storeu_si128((__m128i *)(plane + i * 4), _mm_unpacklo_epi16(words, _mm_srli_si128(words, 8)));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse2") XBGR2101010_to_Y_SSE2(const Uint8 *src, Uint16 *plane_y, int width, const struct RGB2YUVFactors *cvt)
+{
+    const __m128i mask = _mm_set1_epi32(0x3ff);
+    const __m128i offset = _mm_set1_epi32(cvt->y_offset);
+    __m128i y[2];
+    int i, k;
+
+    for (i = 0; i + 8 <= width; i += 8) {
+        for (k = 0; k < 2; ++k) {
+            const __m128i p = _mm_loadu_si128((const __m128i *)(src + (i + 4 * k) * 4));
+            const __m128i r = _mm_and_si128(p, mask);
+            const __m128i g = _mm_and_si128(_mm_srli_epi32(p, 10), mask);
+            const __m128i b = _mm_and_si128(_mm_srli_epi32(p, 20), mask);
+            y[k] = _mm_slli_epi32(_mm_add_epi32(RGB2YUV_Dot_SSE2(r, g, b, cvt->y), offset), 6);
+        }
+        _mm_storeu_si128((__m128i *)(plane_y + i), RGB2YUV_Pack16_SSE2(y[0], y[1]));
+    }
+    return i;
+}
+
+// Sums one 10-bit component of two rows of four pairs of pixels
+static SDL_INLINE __m128i SDL_TARGETING("sse2") XBGR2101010_Sum2x2_SSE2(__m128i p1, __m128i p2, __m128i p3, __m128i p4, int shift)
+{
+    const __m128i mask = _mm_set1_epi32(0x3ff);
+    const __m128i shift_count = _mm_cvtsi32_si128(shift);
+    const __m128i c1 = _mm_add_epi32(_mm_and_si128(_mm_srl_epi32(p1, shift_count), mask), _mm_and_si128(_mm_srl_epi32(p3, shift_count), mask));
+    const __m128i c2 = _mm_add_epi32(_mm_and_si128(_mm_srl_epi32(p2, shift_count), mask), _mm_and_si128(_mm_srl_epi32(p4, shift_count), mask));
+    return _mm_add_epi32(RGB2YUV_Even_SSE2(c1, c2), RGB2YUV_Odd_SSE2(c1, c2));
+}
+
+static int SDL_TARGETING("sse2") XBGR2101010_to_UV_SSE2(const Uint8 *curr_row, const Uint8 *next_row, Uint16 *plane_uv, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+    const __m128i offset = _mm_set1_epi32(512);
+    const __m128i low = _mm_set1_epi32(0x0000ffff);
+    int i;
+
+    for (i = 0; i + 4 <= width_half; i += 4) {
+        const __m128i p1 = _mm_loadu_si128((const __m128i *)(curr_row + i * 8));
+        const __m128i p2 = _mm_loadu_si128((const __m128i *)(curr_row + i * 8 + 16));
+        const __m128i p3 = _mm_loadu_si128((const __m128i *)(next_row + i * 8));
+        const __m128i p4 = _mm_loadu_si128((const __m128i *)(next_row + i * 8 + 16));
+        const __m128i r = _mm_srli_epi32(XBGR2101010_Sum2x2_SSE2(p1, p2, p3, p4, 0), 2);
+        const __m128i g = _mm_srli_epi32(XBGR2101010_Sum2x2_SSE2(p1, p2, p3, p4, 10), 2);
+        const __m128i b = _mm_srli_epi32(XBGR2101010_Sum2x2_SSE2(p1, p2, p3, p4, 20), 2);
+        const __m128i u = _mm_slli_epi32(_mm_add_epi32(RGB2YUV_Dot_SSE2(r, g, b, cvt->u), offset), 6);
+        const __m128i v = _mm_slli_epi32(_mm_add_epi32(RGB2YUV_Dot_SSE2(r, g, b, cvt->v), offset), 6);
+
+        // U in the low 16 bits and V in the high 16 bits of each pair
+        _mm_storeu_si128((__m128i *)(plane_uv + i * 2), _mm_or_si128(_mm_and_si128(u, low), _mm_slli_epi32(v, 16)));
+    }
+    return i;
+}
+
+static const RGB2YUVKernels RGB2YUVKernels_SSE2 = {
+    XRGB8888_to_Y_SSE2,
+    XRGB8888_to_UV_SSE2,
+    XRGB8888_to_Packed_SSE2,
+    XBGR2101010_to_Y_SSE2,
+    XBGR2101010_to_UV_SSE2
+};
+#endif // SDL_SSE2_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+// Returns (int)(factors[0] * r + factors[1] * g + factors[2] * b + 0.5f)
+static SDL_INLINE __m256i SDL_TARGETING("avx2") RGB2YUV_Dot_AVX2(__m256i r, __m256i g, __m256i b, const float *factors)
+{
+    __m256 sum = _mm256_mul_ps(_mm256_cvtepi32_ps(r), _mm256_set1_ps(factors[0]));
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_cvtepi32_ps(g), _mm256_set1_ps(factors[1])));
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_cvtepi32_ps(b), _mm256_set1_ps(factors[2])));
+    sum = _mm256_add_ps(sum, _mm256_set1_ps(0.5f));
+    return _mm256_cvttps_epi32(sum);
+}
+
+// Returns the even and the odd elements of a followed by b, fixing up the order of the 128-bit lanes
+static SDL_INLINE __m256i SDL_TARGETING("avx2") RGB2YUV_Even_AVX2(__m256i a, __m256i b)
+{
+    const __m256 even = _mm256_shuffle_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _MM_SHUFFLE(2, 0, 2, 0));
+    return _mm256_permute4x64_epi64(_mm256_castps_si256(even), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") RGB2YUV_Odd_AVX2(__m256i a, __m256i b)
+{
+    const __m256 odd = _mm256_shuffle_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _MM_SHUFFLE(3, 1, 3, 1));
+    return _mm256_permute4x64_epi64(_mm256_castps_si256(odd), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+// Packs four vectors to bytes with saturation, in order
+static SDL_INLINE __m256i SDL_TARGETING("avx2") RGB2YUV_Pack8_AVX2(__m256i a, __m256i b, __m256i c, __m256i d)
+{
+    const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+    return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+// Averages eight 2x2 blocks of XRGB8888 pixels, adding red and blue, and green, in 16-bit halves
+static SDL_INLINE void SDL_TARGETING("avx2") XRGB8888_Read2x2_AVX2(const Uint8 *curr_row, const Uint8 *next_row, __m256i *r, __m256i *g, __m256i *b)
+{
+    const __m256i mask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i low = _mm256_set1_epi32(0x0000ffff);
+    const __m256i p1 = _mm256_loadu_si256((const __m256i *)curr_row);
+    const __m256i p2 = _mm256_loadu_si256((const __m256i *)(curr_row + 32));
+    const __m256i p3 = _mm256_loadu_si256((const __m256i *)next_row);
+    const __m256i p4 = _mm256_loadu_si256((const __m256i *)(next_row + 32));
+    const __m256i rb1 = _mm256_add_epi32(_mm256_and_si256(p1, mask), _mm256_and_si256(p3, mask));
+    const __m256i rb2 = _mm256_add_epi32(_mm256_and_si256(p2, mask), _mm256_and_si256(p4, mask));
+    const __m256i g1 = _mm256_add_epi32(_mm256_and_si256(_mm256_srli_epi32(p1, 8), mask), _mm256_and_si256(_mm256_srli_epi32(p3, 8), mask));
+    const __m256i g2 = _mm256_add_epi32(_mm256_and_si256(_mm256_srli_epi32(p2, 8), mask), _mm256_and_si256(_mm256_srli_epi32(p4, 8), mask));
+    const __m256i rb = _mm256_add_epi32(RGB2YUV_Even_AVX2(rb1, rb2), RGB2YUV_Odd_AVX2(rb1, rb2));
+    const __m256i ag = _mm256_add_epi32(RGB2YUV_Even_AVX2(g1, g2), RGB2YUV_Odd_AVX2(g1, g2));
+
+    *r = _mm256_srli_epi32(rb, 18);
+    *g = _mm256_srli_epi32(_mm256_and_si256(ag, low), 2);
+    *b = _mm256_srli_epi32(_mm256_and_si256(rb, low), 2);
+}
+
+static int SDL_TARGETING("avx2") XRGB8888_to_Y_AVX2(const Uint8 *src, Uint8 *plane_y, int width, const struct RGB2YUVFactors *cvt)
+{
+    const __m256i mask = _mm256_set1_epi32(0xff);
+    const __m256i offset = _mm256_set1_epi32(cvt->y_offset);
+    __m256i y[4];
+    int i, k;
+
+    for (i = 0; i + 32 <= width; i += 32) {
+        for (k = 0; k < 4; ++k) {
+            const __m256i p = _mm256_loadu_si256((const __m256i *)(src + (i + 8 * k) * 4));
+            const __m256i r = _mm256_and_si256(_mm256_srli_epi32(p, 16), mask);
+            const __m256i g = _mm256_and_si256(_mm256_srli_epi32(p, 8), mask);
+            const __m256i b = _mm256_and_si256(p, mask);
+            y[k] = _mm256_add_epi32(RGB2YUV_Dot_AVX2(r, g, b, cvt->y), offset);
+        }
+        _mm256_storeu_si256((__m256i *)(plane_y + i), RGB2YUV_Pack8_AVX2(y[0], y[1], y[2], y[3]));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("avx2") XRGB8888_to_UV_AVX2(const Uint8 *curr_row, const Uint8 *next_row, Uint8 *plane_u, Uint8 *plane_v, int uv_step, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+    const __m256i offset = _mm256_set1_epi32(128);
+    __m256i r, g, b, u1, v1, u2, v2, uv;
+    __m128i u, v;
+    int i;
+
+    for (i = 0; i + 16 <= width_half; i += 16) {
+        XRGB8888_Read2x2_AVX2(curr_row + i * 8, next_row + i * 8, &r, &g, &b);
+        u1 = _mm256_add_epi32(RGB2YUV_Dot_AVX2(r, g, b, cvt->u), offset);
+        v1 = _mm256_add_epi32(RGB2YUV_Dot_AVX2(r, g, b, cvt->v), offset);
+        XRGB8888_Read2x2_AVX2(curr_row + i * 8 + 64, next_row + i * 8 + 64, &r, &g, &b);
+        u2 = _mm256_add_epi32(RGB2YUV_Dot_AVX2(r, g, b, cvt->u), offset);
+        v2 = _mm256_add_epi32(RGB2YUV_Dot_AVX2(r, g, b, cvt->v), offset);
+
+        // 16 U samples followed by 16 V samples
+        uv = RGB2YUV_Pack8_AVX2(u1, u2, v1, v2);
+        u = _mm256_castsi256_si128(uv);
+        v = _mm256_extracti128_si256(uv, 1);
+        if (uv_step == 1) {
+            _mm_storeu_si128((__m128i *)(plane_u + i), u);
+            _mm_storeu_si128((__m128i *)(plane_v + i), v);
+        } else if (plane_u < plane_v) {
+            _mm_storeu_si128((__m128i *)(plane_u + i * 2), _mm_unpacklo_epi8(u, v));
+            _mm_storeu_si128((__m128i *)(plane_u + i * 2 + 16), _mm_unpackhi_epi8(u, v));
+        } else {
+            _mm_storeu_si128((__m128i *)(plane_v + i * 2), _mm_unpacklo_epi8(v, u));
+            _mm_storeu_si128((__m128i *)(plane_v + i * 2 + 16), _mm_unpackhi_epi8(v, u));
+        }
+    }
+    return i;
+}
+
+static int SDL_TARGETING("avx2") XRGB8888_to_Packed_AVX2(const Uint8 *src, Uint8 *plane, SDL_PixelFormat dst_format, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+    const __m256i mask = _mm256_set1_epi32(0xff);
+    const __m256i mask16 = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i low = _mm256_set1_epi32(0x0000ffff);
+    const __m256i y_offset = _mm256_set1_epi32(cvt->y_offset);
+    const __m256i uv_offset = _mm256_set1_epi32(128);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i max = _mm256_set1_epi16(255);
+    int i;
+
+    for (i = 0; i + 8 <= width_half; i += 8) {
+        const __m256i pixels1 = _mm256_loadu_si256((const __m256i *)(src + i * 8));
+        const __m256i pixels2 = _mm256_loadu_si256((const __m256i *)(src + i * 8 + 32));
+        const __m256i p = RGB2YUV_Even_AVX2(pixels1, pixels2);
+        const __m256i p1 = RGB2YUV_Odd_AVX2(pixels1, pixels2);
+        const __m256i y0 = _mm256_add_epi32(RGB2YUV_Dot_AVX2(_mm256_and_si256(_mm256_srli_epi32(p, 16), mask), _mm256_and_si256(_mm256_srli_epi32(p, 8), mask), _mm256_and_si256(p, mask), cvt->y), y_offset);
+        const __m256i y1 = _mm256_add_epi32(RGB2YUV_Dot_AVX2(_mm256_and_si256(_mm256_srli_epi32(p1, 16), mask), _mm256_and_si256(_mm256_srli_epi32(p1, 8), mask), _mm256_and_si256(p1, mask), cvt->y), y_offset);
+        const __m256i rb = _mm256_add_epi32(_mm256_and_si256(p, mask16), _mm256_and_si256(p1, mask16));
+        const __m256i ag = _mm256_add_epi32(_mm256_and_si256(_mm256_srli_epi32(p, 8), mask16), _mm256_and_si256(_mm256_srli_epi32(p1, 8), mask16));
+        const __m256i R = _mm256_srli_epi32(rb, 17);
+        const __m256i G = _mm256_srli_epi32(_mm256_and_si256(ag, low), 1);
+        const __m256i B = _mm256_srli_epi32(_mm256_and_si256(rb, low), 1);
+        const __m256i u = _mm256_add_epi32(RGB2YUV_Dot_AVX2(R, G, B, cvt->u), uv_offset);
+        const __m256i v = _mm256_add_epi32(RGB2YUV_Dot_AVX2(R, G, B, cvt->v), uv_offset);
+        __m256i ys, uvs, words;
+
+        // The same as the SSE2 version, within each 128-bit lane
+        ys = _mm256_min_epi16(_mm256_max_epi16(_mm256_packs_epi32(y0, y1), zero), max);
+        if (dst_format == SDL_PIXELFORMAT_YVYU) {
+            uvs = _mm256_min_epi16(_mm256_max_epi16(_mm256_packs_epi32(v, u), zero), max);
+        } else {
+            uvs = _mm256_min_epi16(_mm256_max_epi16(_mm256_packs_epi32(u, v), zero), max);
+        }
+        if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            words = _mm256_or_si256(uvs, _mm256_slli_epi16(ys, 8));
+        } else {
+            words = _mm256_or_si256(ys, _mm256_slli_epi16(uvs, 8));
+        }
+        _mm256_storeu_si256((__m256i *)(plane + i * 4), _mm256_unpacklo_epi16(words, _mm256_srli_si256(words, 8)));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("avx2") XBGR2101010_to_Y_AVX2(const Uint8 *src, Uint16 *plane_y, int width, const struct RGB2YUVFactors *cvt)
+{
+    const __m256i mask = _mm256_set1_epi32(0x3ff);
+    const __m256i offset = _mm256_set1_epi32(cvt->y_offset);
+    __m256i y[2];
+    int i, k;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        for (k = 0; k < 2; ++k) {
+            const __m256i p = _mm256_loadu_si256((const __m256i *)(src + (i + 8 * k) * 4));
+            const __m256i r = _mm256_and_si256(p, mask);
+            const __m256i g = _mm256_and_si256(_mm256_srli_epi32(p, 10), mask);
+            const __m256i b = _mm256_and_si256(_mm256_srli_epi32(p, 20), mask);
+            y[k] = _mm256_slli_epi32(_mm256_add_epi32(RGB2YUV_Dot_AVX2(r, g, b, cvt->y), offset), 6);
+
+            // Keep the low 16 bits of each value like a cast to Uint16
+            y[k] = _mm256_srai_epi32(_mm256_slli_epi32(y[k], 16), 16);
+        }
+        _mm256_storeu_si256((__m256i *)(plane_y + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(y[0], y[1]), _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+    return i;
+}
+
+// Sums one 10-bit component of two rows of eight pairs of pixels
+static SDL_INLINE __m256i SDL_TARGETING("avx2") XBGR2101010_Sum2x2_AVX2(__m256i p1, __m256i p2, __m256i p3, __m256i p4, int shift)
+{
+    const __m256i mask = _mm256_set1_epi32(0x3ff);
+    const __m128i shift_count = _mm_cvtsi32_si128(shift);
+    const __m256i c1 = _mm256_add_epi32(_mm256_and_si256(_mm256_srl_epi32(p1, shift_count), mask), _mm256_and_si256(_mm256_srl_epi32(p3, shift_count), mask));
+    const __m256i c2 = _mm256_add_epi32(_mm256_and_si256(_mm256_srl_epi32(p2, shift_count), mask), _mm256_and_si256(_mm256_srl_epi32(p4, shift_count), mask));
+    return _mm256_add_epi32(RGB2YUV_Even_AVX2(c1, c2), RGB2YUV_Odd_AVX2(c1, c2));
+}
+
+static int SDL_TARGETING("avx2") XBGR2101010_to_UV_AVX2(const Uint8 *curr_row, const Uint8 *next_row, Uint16 *plane_uv, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+    const __m256i offset = _mm256_set1_epi32(512);
+    const __m256i low = _mm256_set1_epi32(0x0000ffff);
+    int i;
+
+    for (i = 0; i + 8 <= width_half; i += 8) {
+        const __m256i p1 = _mm256_loadu_si256((const __m256i *)(curr_row + i * 8));
+        const __m256i p2 = _mm256_loadu_si256((const __m256i *)(curr_row + i * 8 + 32));
+        const __m256i p3 = _mm256_loadu_si256((const __m256i *)(next_row + i * 8));
+        const __m256i p4 = _mm256_loadu_si256((const __m256i *)(next_row + i * 8 + 32));
+        const __m256i r = _mm256_srli_epi32(XBGR2101010_Sum2x2_AVX2(p1, p2, p3, p4, 0), 2);
+        const __m256i g = _mm256_srli_epi32(XBGR2101010_Sum2x2_AVX2(p1, p2, p3, p4, 10), 2);
+        const __m256i b = _mm256_srli_epi32(XBGR2101010_Sum2x2_AVX2(p1, p2, p3, p4, 20), 2);
+        const __m256i u = _mm256_slli_epi32(_mm256_add_epi32(RGB2YUV_Dot_AVX2(r, g, b, cvt->u), offset), 6);
+        const __m256i v = _mm256_slli_epi32(_mm256_add_epi32(RGB2YUV_Dot_AVX2(r, g, b, cvt->v), offset), 6);
+
+        _mm256_storeu_si256((__m256i *)(plane_uv + i * 2), _mm256_or_si256(_mm256_and_si256(u, low), _mm256_slli_epi32(v, 16)));
+    }
+    return i;
+}
+
+static const RGB2YUVKernels RGB2YUVKernels_AVX2 = {
+    XRGB8888_to_Y_AVX2,
+    XRGB8888_to_UV_AVX2,
+    XRGB8888_to_Packed_AVX2,
+    XBGR2101010_to_Y_AVX2,
+    XBGR2101010_to_UV_AVX2
+};
+#endif // SDL_AVX2_INTRINSICS
+
+#if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8)
+// Returns (int)(factors[0] * r + factors[1] * g + factors[2] * b + 0.5f)
+static SDL_INLINE int32x4_t RGB2YUV_Dot_NEON(uint32x4_t r, uint32x4_t g, uint32x4_t b, const float *factors)
+{
+    float32x4_t sum = vmulq_n_f32(vcvtq_f32_u32(r), factors[0]);
+    sum = vaddq_f32(sum, vmulq_n_f32(vcvtq_f32_u32(g), factors[1]));
+    sum = vaddq_f32(sum, vmulq_n_f32(vcvtq_f32_u32(b), factors[2]));
+    sum = vaddq_f32(sum, vdupq_n_f32(0.5f));
+    return vcvtq_s32_f32(sum);
+}
+
+// Narrows to bytes with saturation, which clamps to 0-255
+static SDL_INLINE uint8x8_t RGB2YUV_Pack8_NEON(int32x4_t a, int32x4_t b)
+{
+    return vqmovun_s16(vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+}
+
+// Averages four 2x2 blocks of XRGB8888 pixels, adding red and blue, and green, in 16-bit halves
+static SDL_INLINE void XRGB8888_Read2x2_NEON(const Uint8 *curr_row, const Uint8 *next_row, uint32x4_t *r, uint32x4_t *g, uint32x4_t *b)
+{
+    const uint32x4_t mask = vdupq_n_u32(0x00ff00ff);
+    const uint32x4_t low = vdupq_n_u32(0x0000ffff);
+    const uint32x4x2_t p1 = vld2q_u32((const uint32_t *)curr_row);
+    const uint32x4x2_t p2 = vld2q_u32((const uint32_t *)next_row);
+    const uint32x4_t rb = vaddq_u32(vaddq_u32(vandq_u32(p1.val[0], mask), vandq_u32(p1.val[1], mask)),
+                                    vaddq_u32(vandq_u32(p2.val[0], mask), vandq_u32(p2.val[1], mask)));
+    const uint32x4_t ag = vaddq_u32(vaddq_u32(vandq_u32(vshrq_n_u32(p1.val[0], 8), mask), vandq_u32(vshrq_n_u32(p1.val[1], 8), mask)),
+                                    vaddq_u32(vandq_u32(vshrq_n_u32(p2.val[0], 8), mask), vandq_u32(vshrq_n_u32(p2.val[1], 8), mask)));
+
+    *r = vshrq_n_u32(rb, 18);
+    *g = vshrq_n_u32(vandq_u32(ag, low), 2);
+    *b = vshrq_n_u32(vandq_u32(rb, low), 2);
+}
+
+static int XRGB8888_to_Y_NEON(const Uint8 *src, Uint8 *plane_y, int width, const struct RGB2YUVFactors *cvt)
+{
+    const uint32x4_t mask = vdupq_n_u32(0xff);
+    const int32x4_t offset = vdupq_n_s32(cvt->y_offset);
+    int32x4_t y[2];
+    int i, k;
+
+    for (i = 0; i + 8 <= width; i += 8) {
+        for (k = 0; k < 2; ++k) {
+            const uint32x4_t p = vld1q_u32((const uint32_t *)(src + (i + 4 * k) * 4));
+            const uint32x4_t r = vandq_u32(vshrq_n_u32(p, 16), mask);
+            const uint32x4_t g = vandq_u32(vshrq_n_u32(p, 8), mask);
+            const uint32x4_t b = vandq_u32(p, mask);
+            y[k] = vaddq_s32(RGB2YUV_Dot_NEON(r, g, b, cvt->y), offset);
+        }
+        vst1_u8(plane_y + i, RGB2YUV_Pack8_NEON(y[0], y[1]));
+    }
+    return i;
+}
+
+static int XRGB8888_to_UV_NEON(const Uint8 *curr_row, const Uint8 *next_row, Uint8 *plane_u, Uint8 *plane_v, int uv_step, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+    const int32x4_t offset = vdupq_n_s32(128);
+    uint32x4_t r, g, b;
+    int32x4_t u1, v1, u2, v2;
+    uint8x8x2_t uv;
+    int i;
+
+    for (i = 0; i + 8 <= width_half; i += 8) {
+        XRGB8888_Read2x2_NEON(curr_row + i * 8, next_row + i * 8, &r, &g, &b);
+        u1 = vaddq_s32(RGB2YUV_Dot_NEON(r, g, b, cvt->u), offset);
+        v1 = vaddq_s32(RGB2YUV_Dot_NEON(r, g, b, cvt->v), offset);
+        XRGB8888_Read2x2_NEON(curr_row + i * 8 + 32, next_row + i * 8 + 32, &r, &g, &b);
+        u2 = vaddq_s32(RGB2YUV_Dot_NEON(r, g, b, cvt->u), offset);
+        v2 = vaddq_s32(RGB2YUV_Dot_NEON(r, g, b, cvt->v), offset);
+
+        if (uv_step == 1) {
+            vst1_u8(plane_u + i, RGB2YUV_Pack8_NEON(u1, u2));
+            vst1_u8(plane_v + i, RGB2YUV_Pack8_NEON(v1, v2));
+        } else if (plane_u < plane_v) {
+            uv.val[0] = RGB2YUV_Pack8_NEON(u1, u2);
+            uv.val[1] = RGB2YUV_Pack8_NEON(v1, v2);
+            vst2_u8(plane_u + i * 2, uv);
+        } else {
+            uv.val[0] = RGB2YUV_Pack8_NEON(v1, v2);
+            uv.val[1] = RGB2YUV_Pack8_NEON(u1, u2);
+            vst2_u8(plane_v + i * 2, uv);
+        }
+    }
+    return i;
+}
+
+static int XRGB8888_to_Packed_NEON(const Uint8 *src, Uint8 *plane, SDL_PixelFormat dst_format, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+    const uint32x4_t mask = vdupq_n_u32(0xff);
+    const uint32x4_t mask16 = vdupq_n_u32(0x00ff00ff);
+    const uint32x4_t low = vdupq_n_u32(0x0000ffff);
+    const int32x4_t y_offset = vdupq_n_s32(cvt->y_offset);
+    const int32x4_t uv_offset = vdupq_n_s32(128);
+    int32x4_t y0[2], y1[2], u[2], v[2];
+    uint8x8x4_t out;
+    int i, k;
+
+    for (i = 0; i + 8 <= width_half; i += 8) {
+        for (k = 0; k < 2; ++k) {
+            const uint32x4x2_t pixels = vld2q_u32((const uint32_t *)(src + i * 8 + k * 32));
+            const uint32x4_t p = pixels.val[0];
+            const uint32x4_t p1 = pixels.val[1];
+            const uint32x4_t rb = vaddq_u32(vandq_u32(p, mask16), vandq_u32(p1, mask16));
+            const uint32x4_t ag = vaddq_u32(vandq_u32(vshrq_n_u32(p, 8), mask16), vandq_u32(vshrq_n_u32(p1, 8), mask16));
+            const uint32x4_t R = vshrq_n_u32(rb, 17);
+            const uint32x4_t G = vshrq_n_u32(vandq_u32(ag, low), 1);
+            const uint32x4_t B = vshrq_n_u32(vandq_u32(rb, low), 1);
+
+            y0[k] = vaddq_s32(RGB2YUV_Dot_NEON(vandq_u32(vshrq_n_u32(p, 16), mask), vandq_u32(vshrq_n_u32(p, 8), mask), vandq_u32(p, mask), cvt->y), y_offset);
+            y1[k] = vaddq_s32(RGB2YUV_Dot_NEON(vandq_u32(vshrq_n_u32(p1, 16), mask), vandq_u32(vshrq_n_u32(p1, 8), mask), vandq_u32(p1, mask), cvt->y), y_offset);
+            u[k] = vaddq_s32(RGB2YUV_Dot_NEON(R, G, B, cvt->u), uv_offset);
+            v[k] = vaddq_s32(RGB2YUV_Dot_NEON(R, G, B, cvt->v), uv_offset);
+        }
+
+        if (dst_format == SDL_PIXELFORMAT_YUY2) {
+            out.val[0] = RGB2YUV_Pack8_NEON(y0[0], y0[1]);
+            out.val[1] = RGB2YUV_Pack8_NEON(u[0], u[1]);
+            out.val[2] = RGB2YUV_Pack8_NEON(y1[0], y1[1]);
+            out.val[3] = RGB2YUV_Pack8_NEON(v[0], v[1]);
+        } else if (dst_format == SDL_PIXELFORMAT_UYVY) {
+            out.val[0] = RGB2YUV_Pack8_NEON(u[0], u[1]);
+            out.val[1] = RGB2YUV_Pack8_NEON(y0[0], y0[1]);
+            out.val[2] = RGB2YUV_Pack8_NEON(v[0], v[1]);
+            out.val[3] = RGB2YUV_Pack8_NEON(y1[0], y1[1]);
+        } else {
+            out.val[0] = RGB2YUV_Pack8_NEON(y0[0], y0[1]);
+            out.val[1] = RGB2YUV_Pack8_NEON(v[0], v[1]);
+            out.val[2] = RGB2YUV_Pack8_NEON(y1[0], y1[1]);
+            out.val[3] = RGB2YUV_Pack8_NEON(u[0], u[1]);
+        }
+        vst4_u8(plane + i * 4, out);
+    }
+    return i;
+}
+
+static int XBGR2101010_to_Y_NEON(const Uint8 *src, Uint16 *plane_y, int width, const struct RGB2YUVFactors *cvt)
+{
+    const uint32x4_t mask = vdupq_n_u32(0x3ff);
+    const int32x4_t offset = vdupq_n_s32(cvt->y_offset);
+    int16x4_t y[2];
+    int i, k;
+
+    for (i = 0; i + 8 <= width; i += 8) {
+        for (k = 0; k < 2; ++k) {
+            const uint32x4_t p = vld1q_u32((const uint32_t *)(src + (i + 4 * k) * 4));
+            const uint32x4_t r = vandq_u32(p, mask);
+            const uint32x4_t g = vandq_u32(vshrq_n_u32(p, 10), mask);
+            const uint32x4_t b = vandq_u32(vshrq_n_u32(p, 20), mask);
+
+            // Narrowing keeps the low 16 bits of each value like a cast to Uint16
+            y[k] = vmovn_s32(vshlq_n_s32(vaddq_s32(RGB2YUV_Dot_NEON(r, g, b, cvt->y), offset), 6));
+        }
+        vst1q_u16(plane_y + i, vreinterpretq_u16_s16(vcombine_s16(y[0], y[1])));
+    }
+    return i;
+}
+
+// Sums one 10-bit component of two rows of four pairs of pixels
+static SDL_INLINE uint32x4_t XBGR2101010_Sum2x2_NEON(uint32x4x2_t p1, uint32x4x2_t p2, int shift)
+{
+    const uint32x4_t mask = vdupq_n_u32(0x3ff);
+    const int32x4_t shift_count = vdupq_n_s32(-shift);
+    return vaddq_u32(vaddq_u32(vandq_u32(vshlq_u32(p1.val[0], shift_count), mask), vandq_u32(vshlq_u32(p1.val[1], shift_count), mask)),
+                     vaddq_u32(vandq_u32(vshlq_u32(p2.val[0], shift_count), mask), vandq_u32(vshlq_u32(p2.val[1], shift_count), mask)));
+}
+
+static int XBGR2101010_to_UV_NEON(const Uint8 *curr_row, const Uint8 *next_row, Uint16 *plane_uv, int width, const struct RGB2YUVFactors *cvt)
+{
+    const int width_half = width / 2;
+    const int32x4_t offset = vdupq_n_s32(512);
+    uint16x4x2_t uv;
+    int i;
+
+    for (i = 0; i + 4 <= width_half; i += 4) {
+        const uint32x4x2_t p1 = vld2q_u32((const uint32_t *)(curr_row + i * 8));
+        const uint32x4x2_t p2 = vld2q_u32((const uint32_t *)(next_row + i * 8));
+        const uint32x4_t r = vshrq_n_u32(XBGR2101010_Sum2x2_NEON(p1, p2, 0), 2);
+        const uint32x4_t g = vshrq_n_u32(XBGR2101010_Sum2x2_NEON(p1, p2, 10), 2);
+        const uint32x4_t b = vshrq_n_u32(XBGR2101010_Sum2x2_NEON(p1, p2, 20), 2);
+
+        uv.val[0] = vreinterpret_u16_s16(vmovn_s32(vshlq_n_s32(vaddq_s32(RGB2YUV_Dot_NEON(r, g, b, cvt->u), offset), 6)));
+        uv.val[1] = vreinterpret_u16_s16(vmovn_s32(vshlq_n_s32(vaddq_s32(RGB2YUV_Dot_NEON(r, g, b, cvt->v), offset), 6)));
+        vst2_u16(plane_uv + i * 2, uv);
+    }
+    return i;
+}
+
+static const RGB2YUVKernels RGB2YUVKernels_NEON = {
+    XRGB8888_to_Y_NEON,
+    XRGB8888_to_UV_NEON,
+    XRGB8888_to_Packed_NEON,
+    XBGR2101010_to_Y_NEON,
+    XBGR2101010_to_UV_NEON
+};
+#endif // SDL_NEON_INTRINSICS && __ARM_ARCH >= 8
+
+// Returns the SIMD row functions to use, or NULL to convert with the scalar code
+static const RGB2YUVKernels *GetRGB2YUVKernels(void)
+{
+    const Uint32 features = SDL_GetBlitCPUFeatures();
+
+    (void)features;
+#ifdef SDL_AVX2_INTRINSICS
+    if (features & SDL_CPU_AVX2) {
+        return &RGB2YUVKernels_AVX2;
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (features & SDL_CPU_SSE2) {
+        return &RGB2YUVKernels_SSE2;
+    }
+#endif
+#if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8)
+    if (features & SDL_CPU_NEON) {
+        return &RGB2YUVKernels_NEON;
+    }
+#endif
+    return NULL;
+}
+
+static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
+{
+    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
+    const RGB2YUVKernels *simd = GetRGB2YUVKernels();
+    const Uint8 *curr_row = (const Uint8 *)src;
+    int i, j;
+
     switch (dst_format) {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
     {
-        const Uint8 *curr_row, *next_row;
+        const Uint8 *next_row;
 
         Uint8 *plane_y;
         Uint8 *plane_u;
         Uint8 *plane_v;
-        Uint8 *plane_interleaved_uv;
-        Uint32 y_stride, uv_stride, y_skip, uv_skip;
+        Uint32 y_stride, uv_stride;
+        int uv_step;
 
         if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
                           (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
@@ -795,119 +1656,30 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
             return false;
         }
 
-        plane_interleaved_uv = (plane_y + height * y_stride);
-        y_skip = (y_stride - width);
-
-        curr_row = (const Uint8 *)src;
+        // The U and V samples are interleaved in NV12 and NV21
+        if (dst_format == SDL_PIXELFORMAT_NV12 || dst_format == SDL_PIXELFORMAT_NV21) {
+            uv_step = 2;
+        } else {
+            uv_step = 1;
+        }
 
         // Write Y plane
         for (j = 0; j < height; j++) {
-            for (i = 0; i < width; i++) {
-                const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-                const Uint32 r = (p1 & 0x00ff0000) >> 16;
-                const Uint32 g = (p1 & 0x0000ff00) >> 8;
-                const Uint32 b = (p1 & 0x000000ff);
-                *plane_y++ = MAKE_Y(r, g, b);
-            }
-            plane_y += y_skip;
+            i = simd ? simd->XRGB8888_to_Y(curr_row, plane_y, width, cvt) : 0;
+            XRGB8888_to_Y_std(curr_row, plane_y, i, width, cvt);
+            plane_y += y_stride;
             curr_row += src_pitch;
         }
 
+        // Write UV planes, from the last row twice for an odd height
         curr_row = (const Uint8 *)src;
-        next_row = (const Uint8 *)src;
-        next_row += src_pitch;
-
-        if (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV) {
-            // Write UV planes, not interleaved
-            uv_skip = (uv_stride - (width + 1) / 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
-            }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
-            }
-        } else if (dst_format == SDL_PIXELFORMAT_NV12) {
-            uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                plane_interleaved_uv += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
-            }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-            }
-        } else /* dst_format == SDL_PIXELFORMAT_NV21 */ {
-            uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                plane_interleaved_uv += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
-            }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-            }
+        for (j = 0; j < height; j += 2) {
+            next_row = (j + 1 < height) ? curr_row + src_pitch : curr_row;
+            i = simd ? simd->XRGB8888_to_UV(curr_row, next_row, plane_u, plane_v, uv_step, width, cvt) : 0;
+            XRGB8888_to_UV_std(curr_row, next_row, plane_u, plane_v, uv_step, i, width, cvt);
+            plane_u += uv_stride;
+            plane_v += uv_stride;
+            curr_row += 2 * src_pitch;
         }
     } break;
 
@@ -915,149 +1687,39 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
     {
-        const Uint8 *curr_row = (const Uint8 *)src;
         Uint8 *plane = (Uint8 *)dst;
         const int row_size = (4 * ((width + 1) / 2));
-        int plane_skip;
 
         if (dst_pitch < row_size) {
             return SDL_SetError("Destination pitch is too small, expected at least %d", row_size);
         }
-        plane_skip = (dst_pitch - row_size);
 
         // Write YUV plane, packed
-        if (dst_format == SDL_PIXELFORMAT_YUY2) {
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_TWO_RGB_PIXELS;
-                    // Y U Y1 V
-                    *plane++ = MAKE_Y(r, g, b);
-                    *plane++ = MAKE_U(R, G, B);
-                    *plane++ = MAKE_Y(r1, g1, b1);
-                    *plane++ = MAKE_V(R, G, B);
-                }
-                if (width_remainder) {
-                    READ_ONE_RGB_PIXEL;
-                    // Y U Y V
-                    *plane++ = MAKE_Y(r, g, b);
-                    *plane++ = MAKE_U(r, g, b);
-                    *plane++ = MAKE_Y(r, g, b);
-                    *plane++ = MAKE_V(r, g, b);
-                }
-                plane += plane_skip;
-                curr_row += src_pitch;
-            }
-        } else if (dst_format == SDL_PIXELFORMAT_UYVY) {
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_TWO_RGB_PIXELS;
-                    // U Y V Y1
-                    *plane++ = MAKE_U(R, G, B);
-                    *plane++ = MAKE_Y(r, g, b);
-                    *plane++ = MAKE_V(R, G, B);
-                    *plane++ = MAKE_Y(r1, g1, b1);
-                }
-                if (width_remainder) {
-                    READ_ONE_RGB_PIXEL;
-                    // U Y V Y
-                    *plane++ = MAKE_U(r, g, b);
-                    *plane++ = MAKE_Y(r, g, b);
-                    *plane++ = MAKE_V(r, g, b);
-                    *plane++ = MAKE_Y(r, g, b);
-                }
-                plane += plane_skip;
-                curr_row += src_pitch;
-            }
-        } else if (dst_format == SDL_PIXELFORMAT_YVYU) {
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_TWO_RGB_PIXELS;
-                    // Y V Y1 U
-                    *plane++ = MAKE_Y(r, g, b);
-                    *plane++ = MAKE_V(R, G, B);
-                    *plane++ = MAKE_Y(r1, g1, b1);
-                    *plane++ = MAKE_U(R, G, B);
-                }
-                if (width_remainder) {
-                    READ_ONE_RGB_PIXEL;
-                    // Y V Y U
-                    *plane++ = MAKE_Y(r, g, b);
-                    *plane++ = MAKE_V(r, g, b);
-                    *plane++ = MAKE_Y(r, g, b);
-                    *plane++ = MAKE_U(r, g, b);
-                }
-                plane += plane_skip;
-                curr_row += src_pitch;
-            }
+        for (j = 0; j < height; j++) {
+            i = simd ? simd->XRGB8888_to_Packed(curr_row, plane, dst_format, width, cvt) : 0;
+            XRGB8888_to_Packed_std(curr_row, plane, dst_format, i, width, cvt);
+            plane += dst_pitch;
+            curr_row += src_pitch;
         }
     } break;
 
     default:
         return SDL_SetError("Unsupported YUV destination format: %s", SDL_GetPixelFormatName(dst_format));
     }
-#undef MAKE_Y
-#undef MAKE_U
-#undef MAKE_V
-#undef READ_2x2_PIXELS
-#undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
-#undef READ_1x1_PIXEL
-#undef READ_TWO_RGB_PIXELS
-#undef READ_ONE_RGB_PIXEL
     return true;
 }
 
 static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
 {
-    const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
-    const int width_half = width / 2;
-    const int width_remainder = (width & 0x1);
-    int i, j;
-
     const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
-
-#define MAKE_Y(r, g, b) (Uint16)(((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset) << 6)
-#define MAKE_U(r, g, b) (Uint16)(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 512) << 6)
-#define MAKE_V(r, g, b) (Uint16)(((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 512) << 6)
-
-#define READ_2x2_PIXELS                                                                                     \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-    const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
-    const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
-    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff) + (p3 & 0x000003ff) + (p4 & 0x000003ff)) >> 2;  \
-    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00) + (p3 & 0x000ffc00) + (p4 & 0x000ffc00)) >> 12; \
-    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000) + (p3 & 0x3ff00000) + (p4 & 0x3ff00000)) >> 22;
-
-#define READ_2x1_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];            \
-    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff)) >> 1;  \
-    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00)) >> 11; \
-    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000)) >> 21;
-
-#define READ_1x2_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];        \
-    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff)) >> 1;  \
-    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00)) >> 11; \
-    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000)) >> 21;
-
-#define READ_1x1_PIXEL                                  \
-    const Uint32 p = ((const Uint32 *)curr_row)[2 * i]; \
-    const Uint32 r = (p & 0x000003ff);                  \
-    const Uint32 g = (p & 0x000ffc00) >> 10;            \
-    const Uint32 b = (p & 0x3ff00000) >> 20;
-
+    const RGB2YUVKernels *simd = GetRGB2YUVKernels();
     const Uint8 *curr_row, *next_row;
+    int i, j;
 
     Uint16 *plane_y;
     Uint16 *plane_u;
     Uint16 *plane_v;
-    Uint16 *plane_interleaved_uv;
-    Uint32 y_stride, uv_stride, y_skip, uv_skip;
+    Uint32 y_stride, uv_stride;
 
     if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
                       (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
@@ -1068,64 +1730,25 @@ static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const v
     y_stride /= sizeof(Uint16);
     uv_stride /= sizeof(Uint16);
 
-    plane_interleaved_uv = (plane_y + height * y_stride);
-    y_skip = (y_stride - width);
-
     curr_row = (const Uint8 *)src;
 
     // Write Y plane
     for (j = 0; j < height; j++) {
-        for (i = 0; i < width; i++) {
-            const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-            const Uint32 r = (p1 >>  0) & 0x03ff;
-            const Uint32 g = (p1 >> 10) & 0x03ff;
-            const Uint32 b = (p1 >> 20) & 0x03ff;
-            *plane_y++ = MAKE_Y(r, g, b);
-        }
-        plane_y += y_skip;
+        i = simd ? simd->XBGR2101010_to_Y(curr_row, plane_y, width, cvt) : 0;
+        XBGR2101010_to_Y_std(curr_row, plane_y, i, width, cvt);
+        plane_y += y_stride;
         curr_row += src_pitch;
     }
 
+    // Write the interleaved UV plane, from the last row twice for an odd height
     curr_row = (const Uint8 *)src;
-    next_row = (const Uint8 *)src;
-    next_row += src_pitch;
-
-    uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-    for (j = 0; j < height_half; j++) {
-        for (i = 0; i < width_half; i++) {
-            READ_2x2_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        if (width_remainder) {
-            READ_2x1_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        plane_interleaved_uv += uv_skip;
-        curr_row += src_pitch_x_2;
-        next_row += src_pitch_x_2;
+    for (j = 0; j < height; j += 2) {
+        next_row = (j + 1 < height) ? curr_row + src_pitch : curr_row;
+        i = simd ? simd->XBGR2101010_to_UV(curr_row, next_row, plane_u, width, cvt) : 0;
+        XBGR2101010_to_UV_std(curr_row, next_row, plane_u, i, width, cvt);
+        plane_u += uv_stride;
+        curr_row += 2 * src_pitch;
     }
-    if (height_remainder) {
-        for (i = 0; i < width_half; i++) {
-            READ_1x2_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        if (width_remainder) {
-            READ_1x1_PIXEL;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-    }
-
-#undef MAKE_Y
-#undef MAKE_U
-#undef MAKE_V
-#undef READ_2x2_PIXELS
-#undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
-#undef READ_1x1_PIXEL
     return true;
 }
 
@@ -639,6 +639,437 @@ __EOF__
 __EOF__
 }
 
+# The SIMD blitters convert the 8888 pixels to ARGB8888 channel order with
+# byte shuffles, do the same math as the C blitters on all the channels at
+# once, and shuffle the result to the destination format.
+my @simd_isas = (
+    {
+        name => "AVX2",
+        cpu => "SDL_CPU_AVX2",
+        guard => "#ifdef SDL_AVX2_INTRINSICS",
+        target => "SDL_TARGETING(\"avx2\") ",
+        vec => "__m256i",
+        pixels => 8,
+        primitives => <<'__EOF__',
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Load_AVX2(const void *pixels)
+{
+    return _mm256_loadu_si256((const __m256i *)pixels);
+}
+
+static SDL_INLINE void SDL_TARGETING("avx2") SDL_Blit8888_Store_AVX2(void *pixels, __m256i v)
+{
+    _mm256_storeu_si256((__m256i *)pixels, v);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_LoadMask_AVX2(const Uint8 *mask)
+{
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)mask));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Fill_AVX2(Uint32 value)
+{
+    return _mm256_set1_epi32((int)value);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Shuffle_AVX2(__m256i v, __m256i mask)
+{
+    return _mm256_shuffle_epi8(v, mask);
+}
+
+// Copies the ARGB8888 alpha to all the channels
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Alpha_AVX2(__m256i v)
+{
+    return _mm256_shuffle_epi8(v, _mm256_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15,
+                                                   3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Or_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_or_si256(a, b);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Not_AVX2(__m256i v)
+{
+    return _mm256_xor_si256(v, _mm256_set1_epi32(-1));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_AddSat_AVX2(__m256i a, __m256i b)
+{
+    return _mm256_adds_epu8(a, b);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_Select_AVX2(__m256i a, __m256i b, __m256i mask)
+{
+    return _mm256_blendv_epi8(a, b, mask);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit8888_MulDiv255_AVX2(__m256i a, __m256i b)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one = _mm256_set1_epi16(1);
+    __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero)), one);
+    __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero)), one);
+    lo = _mm256_srli_epi16(_mm256_add_epi16(lo, _mm256_srli_epi16(lo, 8)), 8);
+    hi = _mm256_srli_epi16(_mm256_add_epi16(hi, _mm256_srli_epi16(hi, 8)), 8);
+    return _mm256_packus_epi16(lo, hi);
+}
+__EOF__
+    },
+    {
+        name => "SSE41",
+        cpu => "SDL_CPU_SSE4_1",
+        guard => "#ifdef SDL_SSE4_1_INTRINSICS",
+        target => "SDL_TARGETING(\"sse4.1\") ",
+        vec => "__m128i",
+        pixels => 4,
+        primitives => <<'__EOF__',
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Load_SSE41(const void *pixels)
+{
+    return _mm_loadu_si128((const __m128i *)pixels);
+}
+
+static SDL_INLINE void SDL_TARGETING("sse4.1") SDL_Blit8888_Store_SSE41(void *pixels, __m128i v)
+{
+    _mm_storeu_si128((__m128i *)pixels, v);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_LoadMask_SSE41(const Uint8 *mask)
+{
+    return _mm_loadu_si128((const __m128i *)mask);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Fill_SSE41(Uint32 value)
+{
+    return _mm_set1_epi32((int)value);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Shuffle_SSE41(__m128i v, __m128i mask)
+{
+    return _mm_shuffle_epi8(v, mask);
+}
+
+// Copies the ARGB8888 alpha to all the channels
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Alpha_SSE41(__m128i v)
+{
+    return _mm_shuffle_epi8(v, _mm_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Or_SSE41(__m128i a, __m128i b)
+{
+    return _mm_or_si128(a, b);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Not_SSE41(__m128i v)
+{
+    return _mm_xor_si128(v, _mm_set1_epi32(-1));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_AddSat_SSE41(__m128i a, __m128i b)
+{
+    return _mm_adds_epu8(a, b);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_Select_SSE41(__m128i a, __m128i b, __m128i mask)
+{
+    return _mm_blendv_epi8(a, b, mask);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit8888_MulDiv255_SSE41(__m128i a, __m128i b)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero)), one);
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero)), one);
+    lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+    hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+    return _mm_packus_epi16(lo, hi);
+}
+__EOF__
+    },
+    {
+        name => "NEON",
+        cpu => "SDL_CPU_NEON",
+        guard => "#if defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)",
+        target => "",
+        vec => "uint8x16_t",
+        pixels => 4,
+        primitives => <<'__EOF__',
+static SDL_INLINE uint8x16_t SDL_Blit8888_Load_NEON(const void *pixels)
+{
+    return vld1q_u8((const Uint8 *)pixels);
+}
+
+static SDL_INLINE void SDL_Blit8888_Store_NEON(void *pixels, uint8x16_t v)
+{
+    vst1q_u8((Uint8 *)pixels, v);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_LoadMask_NEON(const Uint8 *mask)
+{
+    return vld1q_u8(mask);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Fill_NEON(Uint32 value)
+{
+    return vreinterpretq_u8_u32(vdupq_n_u32(value));
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Shuffle_NEON(uint8x16_t v, uint8x16_t mask)
+{
+    return vqtbl1q_u8(v, mask);
+}
+
+// Copies the ARGB8888 alpha to all the channels
+static SDL_INLINE uint8x16_t SDL_Blit8888_Alpha_NEON(uint8x16_t v)
+{
+    static const Uint8 alpha[16] = { 3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15 };
+    return vqtbl1q_u8(v, vld1q_u8(alpha));
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Or_NEON(uint8x16_t a, uint8x16_t b)
+{
+    return vorrq_u8(a, b);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Not_NEON(uint8x16_t v)
+{
+    return vmvnq_u8(v);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_AddSat_NEON(uint8x16_t a, uint8x16_t b)
+{
+    return vqaddq_u8(a, b);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_Select_NEON(uint8x16_t a, uint8x16_t b, uint8x16_t mask)
+{
+    return vbslq_u8(mask, b, a);
+}
+
+static SDL_INLINE uint8x16_t SDL_Blit8888_MulDiv255_NEON(uint8x16_t a, uint8x16_t b)
+{
+    const uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t lo = vaddq_u16(vmull_u8(vget_low_u8(a), vget_low_u8(b)), one);
+    uint16x8_t hi = vaddq_u16(vmull_u8(vget_high_u8(a), vget_high_u8(b)), one);
+    lo = vsraq_n_u16(lo, lo, 8);
+    hi = vsraq_n_u16(hi, hi, 8);
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+__EOF__
+    },
+);
+
+sub output_simd_shuffle
+{
+    print FILE <<__EOF__;
+#if defined(SDL_AVX2_INTRINSICS) || defined(SDL_SSE4_1_INTRINSICS) || (defined(SDL_NEON_INTRINSICS) && (__ARM_ARCH >= 8) && (SDL_BYTEORDER == SDL_LIL_ENDIAN))
+
+// Byte shuffles for 4 pixels, an index of 0x80 clears the byte
+typedef struct
+{
+    Uint8 to_argb[16];      // src pixels to ARGB8888
+    Uint8 dst_to_argb[16];  // dst pixels to ARGB8888
+    Uint8 from_argb[16];    // ARGB8888 to dst pixels
+    Uint8 copy[16];         // src pixels directly to dst pixels
+    Uint32 src_alpha;       // ORed into the ARGB8888 pixels if the src has no alpha
+    Uint32 copy_alpha;      // ORed into the copied pixels if only the dst has alpha
+} SDL_Blit8888Shuffle;
+
+static void SDL_Get8888ChannelBytes(const SDL_PixelFormatDetails *fmt, int bytes[4])
+{
+    bytes[0] = fmt->Bshift / 8;
+    bytes[1] = fmt->Gshift / 8;
+    bytes[2] = fmt->Rshift / 8;
+    bytes[3] = fmt->Amask ? (fmt->Ashift / 8) : -1;
+}
+
+static void SDL_GetBlit8888Shuffle(const SDL_PixelFormatDetails *src_fmt, const SDL_PixelFormatDetails *dst_fmt, SDL_Blit8888Shuffle *shuffle)
+{
+    int src[4], dst[4];
+    int pixel, channel;
+
+    SDL_Get8888ChannelBytes(src_fmt, src);
+    SDL_Get8888ChannelBytes(dst_fmt, dst);
+
+    SDL_memset(shuffle, 0x80, sizeof(*shuffle));
+    for (pixel = 0; pixel < 16; pixel += 4) {
+        for (channel = 0; channel < 4; ++channel) {
+            shuffle->to_argb[pixel + channel] = (src[channel] >= 0) ? (Uint8)(pixel + src[channel]) : 0x80;
+            shuffle->dst_to_argb[pixel + channel] = (dst[channel] >= 0) ? (Uint8)(pixel + dst[channel]) : 0x80;
+            if (dst[channel] >= 0) {
+                shuffle->from_argb[pixel + dst[channel]] = (Uint8)(pixel + channel);
+                shuffle->copy[pixel + dst[channel]] = shuffle->to_argb[pixel + channel];
+            }
+        }
+    }
+    shuffle->src_alpha = (src[3] < 0) ? 0xFF000000 : 0;
+    shuffle->copy_alpha = (src[3] < 0 && dst[3] >= 0) ? (0xFFu << (dst[3] * 8)) : 0;
+}
+
+#endif
+
+__EOF__
+}
+
+sub output_simd_isa
+{
+    my $isa = shift;
+    my $code = <<'__EOF__';
+static SDL_INLINE __VEC__ __TARGET__SDL_Blit8888_Blend__ISA__(__VEC__ s, __VEC__ d, int blend)
+{
+    const __VEC__ alpha_mask = SDL_Blit8888_Fill__ISA__(0xFF000000);
+    const __VEC__ srcA = SDL_Blit8888_Alpha__ISA__(s);
+    const __VEC__ inv_srcA = SDL_Blit8888_Not__ISA__(srcA);
+
+    switch (blend) {
+    case SDL_COPY_BLEND:
+        s = SDL_Blit8888_MulDiv255__ISA__(s, SDL_Blit8888_Or__ISA__(srcA, alpha_mask));
+        return SDL_Blit8888_AddSat__ISA__(SDL_Blit8888_MulDiv255__ISA__(inv_srcA, d), s);
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        return SDL_Blit8888_AddSat__ISA__(SDL_Blit8888_MulDiv255__ISA__(inv_srcA, d), s);
+    case SDL_COPY_ADD:
+        s = SDL_Blit8888_MulDiv255__ISA__(s, SDL_Blit8888_Or__ISA__(srcA, alpha_mask));
+        SDL_FALLTHROUGH;
+    case SDL_COPY_ADD_PREMULTIPLIED:
+        return SDL_Blit8888_Select__ISA__(SDL_Blit8888_AddSat__ISA__(s, d), d, alpha_mask);
+    case SDL_COPY_MOD:
+        return SDL_Blit8888_Select__ISA__(SDL_Blit8888_MulDiv255__ISA__(s, d), d, alpha_mask);
+    case SDL_COPY_MUL:
+        return SDL_Blit8888_Select__ISA__(SDL_Blit8888_AddSat__ISA__(SDL_Blit8888_MulDiv255__ISA__(s, d), SDL_Blit8888_MulDiv255__ISA__(d, inv_srcA)), d, alpha_mask);
+    default:
+        return d;
+    }
+}
+
+static SDL_INLINE void __TARGET__SDL_Blit8888__ISA__(SDL_BlitInfo *info, bool modulate, bool blend, bool scale)
+{
+    const int flags = info->flags;
+    const bool same_format = (info->src_fmt->format == info->dst_fmt->format);
+    SDL_Blit8888Shuffle shuffle;
+    __VEC__ to_argb, dst_to_argb, from_argb, copy, src_alpha, copy_alpha, modulation;
+    Uint32 pixels[__PIXELS__];
+    Uint32 dst_pixels[__PIXELS__];
+    Uint64 posy = 0, posx = 0;
+    Uint64 incy = 0, incx = 0;
+    int i;
+
+    SDL_GetBlit8888Shuffle(info->src_fmt, info->dst_fmt, &shuffle);
+    to_argb = SDL_Blit8888_LoadMask__ISA__(shuffle.to_argb);
+    dst_to_argb = SDL_Blit8888_LoadMask__ISA__(shuffle.dst_to_argb);
+    from_argb = SDL_Blit8888_LoadMask__ISA__(shuffle.from_argb);
+    copy = SDL_Blit8888_LoadMask__ISA__(shuffle.copy);
+    src_alpha = SDL_Blit8888_Fill__ISA__(shuffle.src_alpha);
+    copy_alpha = SDL_Blit8888_Fill__ISA__(shuffle.copy_alpha);
+    modulation = SDL_Blit8888_Fill__ISA__(
+        ((Uint32)((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF) << 24) |
+        ((Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->r : 0xFF) << 16) |
+        ((Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->g : 0xFF) << 8) |
+        (Uint32)((flags & SDL_COPY_MODULATE_COLOR) ? info->b : 0xFF));
+
+    if (scale) {
+        incy = ((Uint64)info->src_h << 16) / info->dst_h;
+        incx = ((Uint64)info->src_w << 16) / info->dst_w;
+        posy = incy / 2;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)(scale ? (info->src + ((posy >> 16) * info->src_pitch)) : info->src);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        while (n > 0) {
+            const int count = SDL_min(n, __PIXELS__);
+            __VEC__ s;
+
+            if (scale) {
+                for (i = 0; i < count; ++i) {
+                    pixels[i] = src[posx >> 16];
+                    posx += incx;
+                }
+                s = SDL_Blit8888_Load__ISA__(pixels);
+            } else if (count == __PIXELS__) {
+                s = SDL_Blit8888_Load__ISA__(src);
+                src += __PIXELS__;
+            } else {
+                SDL_memcpy(pixels, src, count * sizeof(Uint32));
+                s = SDL_Blit8888_Load__ISA__(pixels);
+            }
+
+            if (!modulate && !blend) {
+                // Pixels in the same format are copied unchanged, like the C blitters do
+                if (!same_format) {
+                    s = SDL_Blit8888_Or__ISA__(SDL_Blit8888_Shuffle__ISA__(s, copy), copy_alpha);
+                }
+            } else {
+                s = SDL_Blit8888_Or__ISA__(SDL_Blit8888_Shuffle__ISA__(s, to_argb), src_alpha);
+                if (modulate) {
+                    s = SDL_Blit8888_MulDiv255__ISA__(s, modulation);
+                }
+                if (blend) {
+                    __VEC__ d;
+
+                    if (count == __PIXELS__) {
+                        d = SDL_Blit8888_Load__ISA__(dst);
+                    } else {
+                        SDL_memcpy(dst_pixels, dst, count * sizeof(Uint32));
+                        d = SDL_Blit8888_Load__ISA__(dst_pixels);
+                    }
+                    s = SDL_Blit8888_Blend__ISA__(s, SDL_Blit8888_Shuffle__ISA__(d, dst_to_argb), flags & SDL_COPY_BLEND_MASK);
+                }
+                s = SDL_Blit8888_Shuffle__ISA__(s, from_argb);
+            }
+
+            if (count == __PIXELS__) {
+                SDL_Blit8888_Store__ISA__(dst, s);
+            } else {
+                SDL_Blit8888_Store__ISA__(pixels, s);
+                SDL_memcpy(dst, pixels, count * sizeof(Uint32));
+            }
+            dst += count;
+            n -= count;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+    my $name = $isa->{name};
+    my $prefix = "static void $isa->{target}";
+    $prefix =~ s/\s+$//;
+    $code =~ s/__VEC__/$isa->{vec}/g;
+    $code =~ s/__TARGET__/$isa->{target}/g;
+    $code =~ s/__ISA__/_$name/g;
+    $code =~ s/__PIXELS__/$isa->{pixels}/g;
+
+    print FILE "$isa->{guard}\n\n";
+    print FILE $isa->{primitives};
+    print FILE "\n";
+    print FILE $code;
+    for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+        for (my $blend = 0; $blend <= 1; ++$blend) {
+            for (my $scale = 0; $scale <= 1; ++$scale) {
+                if ( $modulate || $blend || $scale ) {
+                    my $args = join(", ", $modulate ? "true" : "false", $blend ? "true" : "false", $scale ? "true" : "false");
+                    output_copyfuncname($prefix, "8888", "8888", $modulate, $blend, $scale, 0, "_$name(SDL_BlitInfo *info)\n");
+                    print FILE <<__EOF__;
+{
+    SDL_Blit8888_$name(info, $args);
+}
+
+__EOF__
+                }
+            }
+        }
+    }
+    print FILE "#endif\n\n";
+}
+
 sub output_copyfunc_h
 {
 }
@@ -660,11 +1091,68 @@ sub output_copyinc_h
 __EOF__
 }
 
+sub get_copyflags
+{
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $flags = "";
+    my $flag = "";
+
+    if ( $modulate ) {
+        $flag = "SDL_COPY_MODULATE_MASK";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $blend ) {
+        $flag = "SDL_COPY_BLEND_MASK";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $scale ) {
+        $flag = "SDL_COPY_NEAREST";
+        if ( $flags eq "" ) {
+            $flags = $flag;
+        } else {
+            $flags = "$flags | $flag";
+        }
+    }
+    if ( $flags eq "" ) {
+        $flags = "0";
+    }
+    return $flags;
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
 __EOF__
+    # The SIMD blitters come first, so they're chosen when the CPU supports them
+    foreach my $isa (@simd_isas) {
+        print FILE "$isa->{guard}\n";
+        foreach my $src (@src_formats) {
+            foreach my $dst (@dst_formats) {
+                for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                    for (my $blend = 0; $blend <= 1; ++$blend) {
+                        for (my $scale = 0; $scale <= 1; ++$scale) {
+                            if ( $modulate || $blend || $scale ) {
+                                print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, (" . get_copyflags($modulate, $blend, $scale) . "), $isa->{cpu},";
+                                output_copyfuncname("", "8888", "8888", $modulate, $blend, $scale, 0, "_$isa->{name} },\n");
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        print FILE "#endif\n";
+    }
     for (my $i = 0; $i <= $#src_formats; ++$i) {
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
@@ -674,35 +1162,7 @@ __EOF__
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
                             print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
-                            my $flags = "";
-                            my $flag = "";
-                            if ( $modulate ) {
-                                $flag = "SDL_COPY_MODULATE_MASK";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $blend ) {
-                                $flag = "SDL_COPY_BLEND_MASK";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $scale ) {
-                                $flag = "SDL_COPY_NEAREST";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $flags eq "" ) {
-                                $flags = "0";
-                            }
+                            my $flags = get_copyflags($modulate, $blend, $scale);
                             print FILE "($flags), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
@@ -752,5 +1212,9 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simd_shuffle();
+foreach my $isa (@simd_isas) {
+    output_simd_isa($isa);
+}
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
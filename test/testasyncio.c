@@ -23,7 +23,6 @@ static SDLTest_CommonState *state = NULL;
 SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
 {
     const char *base = NULL;
-    SDL_AsyncIO *asyncio = NULL;
     char **bmps = NULL;
     int bmpcount = 0;
     int i;
@@ -106,13 +105,10 @@ SDL_AppResult SDL_AppInit(void **appstate, int argc, char *argv[])
     SDL_free(bmps);
 
     SDL_Log("Opening asyncio.tmp...");
-    asyncio = SDL_AsyncIOFromFile("asyncio.tmp", "w");
-    if (!asyncio) {
+    if (!SDL_OpenAsyncIO("asyncio.tmp", "w", queue, "asyncio.tmp (open)")) {
         SDL_Log("Failed!");
         return SDL_APP_FAILURE;
     }
-    SDL_WriteAsyncIO(asyncio, "hello", 0, 5, queue, "asyncio.tmp (write)");
-    SDL_CloseAsyncIO(asyncio, true, queue, "asyncio.tmp (flush/close)");
 
     return SDL_APP_CONTINUE;
 }
@@ -146,6 +142,11 @@ static void async_io_task_complete(const SDL_AsyncIOOutcome *outcome)
     SDL_Log("File '%s' async results: %s", fname, resultstr);
 
     if (SDL_strncmp(fname, "asyncio.tmp", 11) == 0) {
+        /* the file opens in the background, and then we write to it. */
+        if ((outcome->type == SDL_ASYNCIO_TASK_OPEN) && (outcome->result == SDL_ASYNCIO_COMPLETE)) {
+            SDL_WriteAsyncIO(outcome->asyncio, "hello", 0, 5, queue, "asyncio.tmp (write)");
+            SDL_CloseAsyncIO(outcome->asyncio, true, queue, "asyncio.tmp (flush/close)");
+        }
         return;
     }
 
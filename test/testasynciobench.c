@@ -0,0 +1,374 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Reads small blocks from random offsets of a temporary file on several
+   threads, each with its own async I/O queue, and reports the reads per
+   second and the system calls per read with and without batching. Then it
+   starts a burst of reads all at once from one thread and reports how long
+   each read waited, to show whether older requests get starved. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static const char *filename = "testasynciobench.tmp";
+static int file_size_mb = 64;
+static int block_size = 4096;
+static int queue_depth = 32;
+static int num_requests = 100000;
+static int num_threads = 4;
+static int burst_size = 10000;
+
+typedef enum
+{
+    MODE_SINGLE,
+    MODE_BATCHED,
+    MODE_BATCHED_BUFFERS
+} BenchMode;
+
+static const char *mode_names[] = { "one at a time", "batched", "batched, registered buffers" };
+
+typedef struct
+{
+    SDL_AsyncIO *asyncio;
+    BenchMode mode;
+    int num_requests;
+    Uint64 seed;
+    Sint64 syscalls;
+    bool failed;
+} BenchThread;
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--file-size MB]", "[--block-size N]", "[--depth N]", "[--requests N]", "[--threads N]", "[--burst N]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+static bool CreateTestFile(void)
+{
+    const size_t chunk_size = 1024 * 1024;
+    Uint8 *chunk = (Uint8 *)SDL_malloc(chunk_size);
+    SDL_IOStream *io;
+    Uint64 seed = 1;
+    size_t i;
+    int mb;
+
+    if (!chunk) {
+        return false;
+    }
+    for (i = 0; i < chunk_size; ++i) {
+        chunk[i] = (Uint8)SDL_rand_bits_r(&seed);
+    }
+
+    io = SDL_IOFromFile(filename, "wb");
+    if (!io) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create %s: %s", filename, SDL_GetError());
+        SDL_free(chunk);
+        return false;
+    }
+    for (mb = 0; mb < file_size_mb; ++mb) {
+        if (SDL_WriteIO(io, chunk, chunk_size) != chunk_size) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't write %s: %s", filename, SDL_GetError());
+            SDL_CloseIO(io);
+            SDL_free(chunk);
+            return false;
+        }
+    }
+    SDL_free(chunk);
+    return SDL_CloseIO(io);
+}
+
+static int SDLCALL BenchThreadFunc(void *data)
+{
+    BenchThread *thread = (BenchThread *)data;
+    const Uint64 num_blocks = ((Uint64)file_size_mb * 1024 * 1024) / block_size;
+    SDL_AsyncIOQueue *queue = SDL_CreateAsyncIOQueue();
+    Uint8 *buffer = (Uint8 *)SDL_malloc((size_t)block_size * queue_depth);
+    int finished = 0;
+
+    if (!queue || !buffer) {
+        thread->failed = true;
+        goto done;
+    }
+
+    if (thread->mode == MODE_BATCHED_BUFFERS) {
+        void *buffers[1];
+        size_t sizes[1];
+
+        buffers[0] = buffer;
+        sizes[0] = (size_t)block_size * queue_depth;
+        if (!SDL_SetAsyncIOQueueBuffers(queue, buffers, sizes, 1)) {
+            thread->failed = true;
+            goto done;
+        }
+    }
+
+    while (finished < thread->num_requests && !thread->failed) {
+        const int count = SDL_min(queue_depth, thread->num_requests - finished);
+        int i;
+
+        if (thread->mode != MODE_SINGLE) {
+            SDL_BeginAsyncIOBatch(queue);
+        }
+        for (i = 0; i < count; ++i) {
+            const Uint64 block = (Uint64)SDL_rand_r(&thread->seed, (Sint32)SDL_min(num_blocks, SDL_MAX_SINT32));
+            if (!SDL_ReadAsyncIO(thread->asyncio, buffer + (size_t)i * block_size, block * block_size, block_size, queue, NULL)) {
+                thread->failed = true;
+                break;
+            }
+        }
+        if (thread->mode != MODE_SINGLE) {
+            SDL_EndAsyncIOBatch(queue);
+        }
+
+        /* Wait for everything we started, even if starting the rest failed */
+        for (; i > 0; --i) {
+            SDL_AsyncIOOutcome outcome;
+            if (!SDL_WaitAsyncIOResult(queue, &outcome, -1) || outcome.result != SDL_ASYNCIO_COMPLETE || outcome.bytes_transferred != (Uint64)block_size) {
+                thread->failed = true;
+            }
+        }
+        finished += count;
+    }
+
+    thread->syscalls = SDL_GetNumberProperty(SDL_GetAsyncIOQueueProperties(queue), SDL_PROP_ASYNCIO_QUEUE_SYSCALLS_NUMBER, -1);
+
+done:
+    if (queue) {
+        SDL_DestroyAsyncIOQueue(queue);
+    }
+    SDL_free(buffer);
+    return 0;
+}
+
+/* Returns false if any read failed */
+static bool RunBenchmark(SDL_AsyncIO *asyncio, BenchMode mode)
+{
+    BenchThread *threads = (BenchThread *)SDL_calloc(num_threads, sizeof(*threads));
+    SDL_Thread **handles = (SDL_Thread **)SDL_calloc(num_threads, sizeof(*handles));
+    Sint64 syscalls = 0;
+    bool failed = false;
+    Uint64 start, elapsed;
+    double rate;
+    int i;
+
+    if (!threads || !handles) {
+        SDL_free(threads);
+        SDL_free(handles);
+        return false;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_threads; ++i) {
+        char name[32];
+
+        threads[i].asyncio = asyncio;
+        threads[i].mode = mode;
+        threads[i].num_requests = num_requests / num_threads + ((i < num_requests % num_threads) ? 1 : 0);
+        threads[i].seed = i + 1;
+        SDL_snprintf(name, sizeof(name), "bench%d", i);
+        handles[i] = SDL_CreateThread(BenchThreadFunc, name, &threads[i]);
+        if (!handles[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+            failed = true;
+            break;
+        }
+    }
+    for (i = 0; i < num_threads; ++i) {
+        if (handles[i]) {
+            SDL_WaitThread(handles[i], NULL);
+            if (threads[i].failed) {
+                failed = true;
+            }
+            if (threads[i].syscalls < 0 || syscalls < 0) {
+                syscalls = -1;
+            } else {
+                syscalls += threads[i].syscalls;
+            }
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    rate = (double)num_requests * SDL_NS_PER_SECOND / SDL_max(elapsed, 1);
+    if (failed) {
+        SDL_Log("  %-28s reads failed!", mode_names[mode]);
+    } else if (syscalls < 0) {
+        SDL_Log("  %-28s %10.0f reads/s  syscalls/read n/a", mode_names[mode], rate);
+    } else {
+        SDL_Log("  %-28s %10.0f reads/s  syscalls/read %5.3f", mode_names[mode], rate, (double)syscalls / num_requests);
+    }
+
+    SDL_free(threads);
+    SDL_free(handles);
+    return !failed;
+}
+
+static int SDLCALL CompareLatency(const void *a, const void *b)
+{
+    const Uint64 lhs = *(const Uint64 *)a;
+    const Uint64 rhs = *(const Uint64 *)b;
+    return (lhs < rhs) ? -1 : (lhs > rhs) ? 1 : 0;
+}
+
+/* Returns false if any read failed */
+static bool RunBurst(SDL_AsyncIO *asyncio)
+{
+    const Uint64 num_blocks = ((Uint64)file_size_mb * 1024 * 1024) / block_size;
+    SDL_AsyncIOQueue *queue = SDL_CreateAsyncIOQueue();
+    Uint8 *buffer = (Uint8 *)SDL_malloc((size_t)block_size * burst_size);
+    Uint64 *start_times = (Uint64 *)SDL_calloc(burst_size, sizeof(Uint64));
+    Uint64 *latencies = (Uint64 *)SDL_calloc(burst_size, sizeof(Uint64));
+    Uint64 seed = 1;
+    Uint64 start, elapsed;
+    int started = 0;
+    int finished = 0;
+    bool failed = false;
+    int i;
+
+    if (!queue || !buffer || !start_times || !latencies) {
+        failed = true;
+        goto done;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < burst_size; ++i) {
+        const Uint64 block = (Uint64)SDL_rand_r(&seed, (Sint32)SDL_min(num_blocks, SDL_MAX_SINT32));
+        start_times[i] = SDL_GetTicksNS();
+        if (!SDL_ReadAsyncIO(asyncio, buffer + (size_t)i * block_size, block * block_size, block_size, queue, (void *)(intptr_t)i)) {
+            failed = true;
+            break;
+        }
+        ++started;
+    }
+    while (finished < started) {
+        SDL_AsyncIOOutcome outcome;
+        if (SDL_WaitAsyncIOResult(queue, &outcome, -1)) {
+            const int index = (int)(intptr_t)outcome.userdata;
+            latencies[finished++] = SDL_GetTicksNS() - start_times[index];
+            if (outcome.result != SDL_ASYNCIO_COMPLETE) {
+                failed = true;
+            }
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    if (failed) {
+        SDL_Log("  %-28s reads failed!", "burst");
+    } else {
+        SDL_qsort(latencies, finished, sizeof(Uint64), CompareLatency);
+        SDL_Log("  %-28s %10.0f reads/s  latency ms: median %.2f  99%% %.2f  max %.2f", "burst",
+                (double)finished * SDL_NS_PER_SECOND / SDL_max(elapsed, 1),
+                (double)latencies[finished / 2] / SDL_NS_PER_MS,
+                (double)latencies[(finished * 99) / 100] / SDL_NS_PER_MS,
+                (double)latencies[finished - 1] / SDL_NS_PER_MS);
+    }
+
+done:
+    if (queue) {
+        SDL_DestroyAsyncIOQueue(queue);
+    }
+    SDL_free(buffer);
+    SDL_free(start_times);
+    SDL_free(latencies);
+    return !failed;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_AsyncIO *asyncio = NULL;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--file-size") == 0 && argv[i + 1]) {
+                file_size_mb = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--block-size") == 0 && argv[i + 1]) {
+                block_size = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--depth") == 0 && argv[i + 1]) {
+                queue_depth = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--requests") == 0 && argv[i + 1]) {
+                num_requests = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                num_threads = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--burst") == 0 && argv[i + 1]) {
+                burst_size = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || file_size_mb <= 0 || block_size <= 0 || block_size > 1024 * 1024 * file_size_mb ||
+            queue_depth <= 0 || num_requests <= 0 || num_threads <= 0 || burst_size <= 0) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (!CreateTestFile()) {
+        result = 1;
+        goto done;
+    }
+
+    asyncio = SDL_AsyncIOFromFile(filename, "r");
+    if (!asyncio) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open %s: %s", filename, SDL_GetError());
+        result = 1;
+        goto done;
+    }
+
+    SDL_Log("%d MB file, %d byte reads, %d requests, %d threads, %d reads in flight per thread",
+            file_size_mb, block_size, num_requests, num_threads, queue_depth);
+
+    if (!RunBenchmark(asyncio, MODE_SINGLE) ||
+        !RunBenchmark(asyncio, MODE_BATCHED) ||
+        !RunBenchmark(asyncio, MODE_BATCHED_BUFFERS) ||
+        !RunBurst(asyncio)) {
+        result = 1;
+    }
+
+done:
+    if (asyncio) {
+        SDL_AsyncIOQueue *queue = SDL_CreateAsyncIOQueue();
+        if (queue) {
+            SDL_AsyncIOOutcome outcome;
+            SDL_CloseAsyncIO(asyncio, false, queue, NULL);
+            SDL_WaitAsyncIOResult(queue, &outcome, -1);
+            SDL_DestroyAsyncIOQueue(queue);
+        }
+    }
+    SDL_RemovePath(filename);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
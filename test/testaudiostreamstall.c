@@ -0,0 +1,218 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures how long a high-priority thread pulling from an audio stream gets
+   stalled by a low-priority thread feeding it, with and without an input ring. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define SAMPLE_RATE     48000
+#define CHANNELS        2
+#define PERIOD_FRAMES   256
+#define PUT_FRAMES      64
+#define MAX_SAMPLES     (1024 * 1024)
+
+static SDL_AudioStream *stream;
+static SDL_AtomicInt alive;
+static Uint64 stall_threshold_ns = SDL_NS_PER_MS / 2;
+
+typedef struct Consumer_State
+{
+    Uint64 *times;
+    int num_times;
+    int underruns;
+} Consumer_State;
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--seconds N]", "[--stall-us N]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+static int SDLCALL
+ProducerThread(void *data)
+{
+    float buf[PUT_FRAMES * CHANNELS];
+    int i;
+
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_LOW);
+
+    for (i = 0; i < SDL_arraysize(buf); i++) {
+        buf[i] = SDL_sinf((float) i * 0.01f) * 0.5f;
+    }
+
+    while (SDL_GetAtomicInt(&alive)) {
+        /* keep a few periods queued, but don't let the stream grow forever. */
+        if (SDL_GetAudioStreamQueued(stream) >= (int) (PERIOD_FRAMES * 8 * sizeof (buf[0]) * CHANNELS)) {
+            SDL_DelayNS(100 * SDL_NS_PER_US);
+            continue;
+        }
+        SDL_PutAudioStreamData(stream, buf, sizeof (buf));
+    }
+    return 0;
+}
+
+static int SDLCALL
+ConsumerThread(void *data)
+{
+    Consumer_State *state = (Consumer_State *)data;
+    Sint16 buf[PERIOD_FRAMES * CHANNELS];
+    const Uint64 period_ns = ((Uint64) PERIOD_FRAMES * SDL_NS_PER_SECOND) / SAMPLE_RATE;
+    Uint64 next = SDL_GetTicksNS();
+
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
+
+    while (SDL_GetAtomicInt(&alive)) {
+        const Uint64 start = SDL_GetTicksNS();
+        const int got = SDL_GetAudioStreamData(stream, buf, sizeof (buf));
+        const Uint64 end = SDL_GetTicksNS();
+
+        if (got < (int) sizeof (buf)) {
+            ++state->underruns;
+        }
+        if (state->num_times < MAX_SAMPLES) {
+            state->times[state->num_times++] = end - start;
+        }
+
+        next += period_ns;
+        if (next > end) {
+            SDL_DelayPrecise(next - end);
+        } else {
+            next = end;
+        }
+    }
+    return 0;
+}
+
+static int SDLCALL
+CompareTimes(const void *a, const void *b)
+{
+    const Uint64 lhs = *(const Uint64 *)a;
+    const Uint64 rhs = *(const Uint64 *)b;
+    return (lhs < rhs) ? -1 : (lhs > rhs) ? 1 : 0;
+}
+
+static bool
+RunTest(int seconds, int ring_size)
+{
+    const SDL_AudioSpec src_spec = { SDL_AUDIO_F32, CHANNELS, SAMPLE_RATE };
+    const SDL_AudioSpec dst_spec = { SDL_AUDIO_S16, CHANNELS, SAMPLE_RATE };
+    Consumer_State consumer = { 0 };
+    SDL_Thread *producer_thread;
+    SDL_Thread *consumer_thread;
+    SDL_PropertiesID props;
+    Uint64 total = 0;
+    int stalls = 0;
+    int i;
+
+    props = SDL_CreateProperties();
+    SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_INPUT_RING_SIZE_NUMBER, ring_size);
+    stream = SDL_CreateAudioStreamWithProperties(&src_spec, &dst_spec, props);
+    SDL_DestroyProperties(props);
+    if (!stream) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create audio stream: %s", SDL_GetError());
+        return false;
+    }
+
+    consumer.times = (Uint64 *)SDL_malloc(MAX_SAMPLES * sizeof (Uint64));
+    if (!consumer.times) {
+        SDL_DestroyAudioStream(stream);
+        return false;
+    }
+
+    SDL_Log("Running for %d seconds, input ring size = %d bytes", seconds, ring_size);
+
+    SDL_SetAtomicInt(&alive, 1);
+    producer_thread = SDL_CreateThread(ProducerThread, "Producer", NULL);
+    consumer_thread = SDL_CreateThread(ConsumerThread, "Consumer", &consumer);
+
+    SDL_Delay(seconds * 1000);
+
+    SDL_SetAtomicInt(&alive, 0);
+    SDL_WaitThread(producer_thread, NULL);
+    SDL_WaitThread(consumer_thread, NULL);
+
+    if (consumer.num_times > 0) {
+        SDL_qsort(consumer.times, consumer.num_times, sizeof (Uint64), CompareTimes);
+        for (i = 0; i < consumer.num_times; i++) {
+            total += consumer.times[i];
+            if (consumer.times[i] >= stall_threshold_ns) {
+                ++stalls;
+            }
+        }
+        SDL_Log("%d gets: avg %" SDL_PRIu64 "ns, p99 %" SDL_PRIu64 "ns, p99.9 %" SDL_PRIu64 "ns, max %" SDL_PRIu64 "ns",
+                consumer.num_times, total / consumer.num_times,
+                consumer.times[(consumer.num_times * 99) / 100],
+                consumer.times[(consumer.num_times * 999) / 1000],
+                consumer.times[consumer.num_times - 1]);
+        SDL_Log("%d gets stalled for %" SDL_PRIu64 "us or more, %d came up short", stalls, stall_threshold_ns / SDL_NS_PER_US, consumer.underruns);
+    }
+    SDL_Log("%s", "");
+
+    SDL_free(consumer.times);
+    SDL_DestroyAudioStream(stream);
+    stream = NULL;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    int seconds = 2;
+    int i;
+    SDLTest_CommonState *state;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--seconds") == 0 && argv[i + 1]) {
+                seconds = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--stall-us") == 0 && argv[i + 1]) {
+                stall_threshold_ns = (Uint64) SDL_atoi(argv[i + 1]) * SDL_NS_PER_US;
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || seconds <= 0) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    /* Load the SDL library */
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (!RunTest(seconds, 0) || !RunTest(seconds, 64 * 1024)) {
+        SDL_Quit();
+        SDLTest_CommonDestroyState(state);
+        return 1;
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return 0;
+}
@@ -23,7 +23,9 @@ static SDLTest_TestSuiteRunner *runner;
 
 /* All test suites */
 static SDLTest_TestSuiteReference *testSuites[] = {
+    &asyncioTestSuite,
     &audioTestSuite,
+    &cameraTestSuite,
     &clipboardTestSuite,
     &eventsTestSuite,
     &guidTestSuite,
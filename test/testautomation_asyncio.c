@@ -0,0 +1,328 @@
+/**
+ * Async I/O test suite
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+#define ASYNCIO_TEST_TIMEOUT_MS 5000
+#define ASYNCIO_TEST_NUM_LOADS  16
+
+static const char *AsyncIOTestFilename = "asyncio_test";
+static const char *AsyncIOMissingFilename = "asyncio_missing";
+
+static const char AsyncIOTestString[] = "The quick brown fox jumps over the lazy dog.";
+
+/* ================= Test Case Implementation ================== */
+
+/* Fixture */
+
+static void SDLCALL asyncioSetUp(void **arg)
+{
+    bool result;
+
+    /* Clean up from previous runs (if any); ignore errors */
+    SDL_RemovePath(AsyncIOTestFilename);
+    SDL_RemovePath(AsyncIOMissingFilename);
+
+    result = SDL_SaveFile(AsyncIOTestFilename, AsyncIOTestString, SDL_strlen(AsyncIOTestString));
+    SDLTest_AssertCheck(result == true, "Verify creation of file '%s'", AsyncIOTestFilename);
+}
+
+static void SDLCALL asyncioTearDown(void *arg)
+{
+    SDL_RemovePath(AsyncIOTestFilename);
+    SDLTest_AssertPass("Cleanup of test files completed");
+}
+
+/* Helper to wait for the next result on a queue, or give up */
+static bool waitForAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
+{
+    const bool result = SDL_WaitAsyncIOResult(queue, outcome, ASYNCIO_TEST_TIMEOUT_MS);
+    SDLTest_AssertCheck(result == true, "Verify a task completed within %d ms", ASYNCIO_TEST_TIMEOUT_MS);
+    return result;
+}
+
+/* Test case functions */
+
+/**
+ * Load a file that exists, and check its contents come back null-terminated.
+ *
+ * \sa SDL_LoadFileAsync
+ */
+static int SDLCALL asyncio_testLoadFile(void *arg)
+{
+    const size_t len = SDL_strlen(AsyncIOTestString);
+    SDL_AsyncIOQueue *queue;
+    SDL_AsyncIOOutcome outcome;
+    int userdata = 0;
+    bool result;
+
+    queue = SDL_CreateAsyncIOQueue();
+    SDLTest_AssertPass("Call to SDL_CreateAsyncIOQueue()");
+    SDLTest_AssertCheck(queue != NULL, "Verify result value is not NULL");
+    if (!queue) {
+        return TEST_ABORTED;
+    }
+
+    result = SDL_LoadFileAsync(AsyncIOTestFilename, queue, &userdata);
+    SDLTest_AssertPass("Call to SDL_LoadFileAsync(\"%s\")", AsyncIOTestFilename);
+    SDLTest_AssertCheck(result == true, "Verify result value; expected: true, got: %d", result);
+
+    if (result && waitForAsyncIOResult(queue, &outcome)) {
+        SDLTest_AssertCheck(outcome.type == SDL_ASYNCIO_TASK_READ, "Verify outcome type; expected: %d, got: %d", SDL_ASYNCIO_TASK_READ, outcome.type);
+        SDLTest_AssertCheck(outcome.result == SDL_ASYNCIO_COMPLETE, "Verify outcome result; expected: %d, got: %d", SDL_ASYNCIO_COMPLETE, outcome.result);
+        SDLTest_AssertCheck(outcome.asyncio == NULL, "Verify outcome has no SDL_AsyncIO");
+        SDLTest_AssertCheck(outcome.userdata == &userdata, "Verify outcome userdata");
+        SDLTest_AssertCheck(outcome.bytes_transferred == len, "Verify bytes transferred; expected: %d, got: %d", (int)len, (int)outcome.bytes_transferred);
+        SDLTest_AssertCheck(outcome.buffer != NULL, "Verify outcome buffer is not NULL");
+        if (outcome.buffer) {
+            SDLTest_AssertCheck(SDL_memcmp(outcome.buffer, AsyncIOTestString, len) == 0, "Verify file contents");
+            SDLTest_AssertCheck(((const char *)outcome.buffer)[len] == '\0', "Verify buffer is null-terminated");
+            SDL_free(outcome.buffer);
+        }
+    }
+
+    /* None of the steps before the read should be reported */
+    result = SDL_WaitAsyncIOResult(queue, &outcome, 100);
+    SDLTest_AssertCheck(result == false, "Verify there are no more results; got: %d", result);
+
+    SDL_DestroyAsyncIOQueue(queue);
+    SDLTest_AssertPass("Call to SDL_DestroyAsyncIOQueue()");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Load a file that doesn't exist, and check it's reported as a failed read.
+ *
+ * \sa SDL_LoadFileAsync
+ */
+static int SDLCALL asyncio_testLoadMissingFile(void *arg)
+{
+    SDL_AsyncIOQueue *queue;
+    SDL_AsyncIOOutcome outcome;
+    int userdata = 0;
+    bool result;
+
+    queue = SDL_CreateAsyncIOQueue();
+    SDLTest_AssertPass("Call to SDL_CreateAsyncIOQueue()");
+    SDLTest_AssertCheck(queue != NULL, "Verify result value is not NULL");
+    if (!queue) {
+        return TEST_ABORTED;
+    }
+
+    result = SDL_LoadFileAsync(AsyncIOMissingFilename, queue, &userdata);
+    SDLTest_AssertPass("Call to SDL_LoadFileAsync(\"%s\")", AsyncIOMissingFilename);
+    SDLTest_AssertCheck(result == true, "Verify result value, a missing file fails later; expected: true, got: %d", result);
+
+    if (result && waitForAsyncIOResult(queue, &outcome)) {
+        SDLTest_AssertCheck(outcome.type == SDL_ASYNCIO_TASK_READ, "Verify outcome type; expected: %d, got: %d", SDL_ASYNCIO_TASK_READ, outcome.type);
+        SDLTest_AssertCheck(outcome.result == SDL_ASYNCIO_FAILURE, "Verify outcome result; expected: %d, got: %d", SDL_ASYNCIO_FAILURE, outcome.result);
+        SDLTest_AssertCheck(outcome.asyncio == NULL, "Verify outcome has no SDL_AsyncIO");
+        SDLTest_AssertCheck(outcome.userdata == &userdata, "Verify outcome userdata");
+        SDLTest_AssertCheck(outcome.buffer == NULL, "Verify outcome buffer is NULL");
+    }
+
+    result = SDL_WaitAsyncIOResult(queue, &outcome, 100);
+    SDLTest_AssertCheck(result == false, "Verify there are no more results; got: %d", result);
+
+    SDL_DestroyAsyncIOQueue(queue);
+    SDLTest_AssertPass("Call to SDL_DestroyAsyncIOQueue()");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Open, stat and close a file asynchronously, and open a missing one.
+ *
+ * \sa SDL_OpenAsyncIO
+ * \sa SDL_StatAsyncIO
+ * \sa SDL_CloseAsyncIO
+ */
+static int SDLCALL asyncio_testOpenStatClose(void *arg)
+{
+    SDL_AsyncIOQueue *queue;
+    SDL_AsyncIOOutcome outcome;
+    SDL_AsyncIO *asyncio = NULL;
+    bool result;
+
+    queue = SDL_CreateAsyncIOQueue();
+    SDLTest_AssertPass("Call to SDL_CreateAsyncIOQueue()");
+    SDLTest_AssertCheck(queue != NULL, "Verify result value is not NULL");
+    if (!queue) {
+        return TEST_ABORTED;
+    }
+
+    result = SDL_OpenAsyncIO(AsyncIOMissingFilename, "r", queue, NULL);
+    SDLTest_AssertPass("Call to SDL_OpenAsyncIO(\"%s\", \"r\")", AsyncIOMissingFilename);
+    SDLTest_AssertCheck(result == true, "Verify result value, a missing file fails later; expected: true, got: %d", result);
+    if (result && waitForAsyncIOResult(queue, &outcome)) {
+        SDLTest_AssertCheck(outcome.type == SDL_ASYNCIO_TASK_OPEN, "Verify outcome type; expected: %d, got: %d", SDL_ASYNCIO_TASK_OPEN, outcome.type);
+        SDLTest_AssertCheck(outcome.result == SDL_ASYNCIO_FAILURE, "Verify outcome result; expected: %d, got: %d", SDL_ASYNCIO_FAILURE, outcome.result);
+        SDLTest_AssertCheck(outcome.asyncio == NULL, "Verify outcome has no SDL_AsyncIO");
+    }
+
+    result = SDL_OpenAsyncIO(AsyncIOTestFilename, "r", queue, NULL);
+    SDLTest_AssertPass("Call to SDL_OpenAsyncIO(\"%s\", \"r\")", AsyncIOTestFilename);
+    SDLTest_AssertCheck(result == true, "Verify result value; expected: true, got: %d", result);
+    if (result && waitForAsyncIOResult(queue, &outcome)) {
+        SDLTest_AssertCheck(outcome.type == SDL_ASYNCIO_TASK_OPEN, "Verify outcome type; expected: %d, got: %d", SDL_ASYNCIO_TASK_OPEN, outcome.type);
+        SDLTest_AssertCheck(outcome.result == SDL_ASYNCIO_COMPLETE, "Verify outcome result; expected: %d, got: %d", SDL_ASYNCIO_COMPLETE, outcome.result);
+        SDLTest_AssertCheck(outcome.asyncio != NULL, "Verify outcome has the new SDL_AsyncIO");
+        asyncio = outcome.asyncio;
+    }
+
+    if (asyncio) {
+        result = SDL_StatAsyncIO(asyncio, queue, NULL);
+        SDLTest_AssertPass("Call to SDL_StatAsyncIO()");
+        SDLTest_AssertCheck(result == true, "Verify result value; expected: true, got: %d", result);
+        if (result && waitForAsyncIOResult(queue, &outcome)) {
+            SDLTest_AssertCheck(outcome.type == SDL_ASYNCIO_TASK_STAT, "Verify outcome type; expected: %d, got: %d", SDL_ASYNCIO_TASK_STAT, outcome.type);
+            SDLTest_AssertCheck(outcome.result == SDL_ASYNCIO_COMPLETE, "Verify outcome result; expected: %d, got: %d", SDL_ASYNCIO_COMPLETE, outcome.result);
+            SDLTest_AssertCheck(outcome.bytes_transferred == SDL_strlen(AsyncIOTestString), "Verify file size; expected: %d, got: %d", (int)SDL_strlen(AsyncIOTestString), (int)outcome.bytes_transferred);
+        }
+
+        result = SDL_CloseAsyncIO(asyncio, false, queue, NULL);
+        SDLTest_AssertPass("Call to SDL_CloseAsyncIO()");
+        SDLTest_AssertCheck(result == true, "Verify result value; expected: true, got: %d", result);
+        if (result && waitForAsyncIOResult(queue, &outcome)) {
+            SDLTest_AssertCheck(outcome.type == SDL_ASYNCIO_TASK_CLOSE, "Verify outcome type; expected: %d, got: %d", SDL_ASYNCIO_TASK_CLOSE, outcome.type);
+            SDLTest_AssertCheck(outcome.result == SDL_ASYNCIO_COMPLETE, "Verify outcome result; expected: %d, got: %d", SDL_ASYNCIO_COMPLETE, outcome.result);
+        }
+    }
+
+    SDL_DestroyAsyncIOQueue(queue);
+    SDLTest_AssertPass("Call to SDL_DestroyAsyncIOQueue()");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Start a batch of loads of present and missing files, and destroy the queue while they're still going.
+ *
+ * \sa SDL_LoadFileAsync
+ * \sa SDL_DestroyAsyncIOQueue
+ */
+static int SDLCALL asyncio_testDestroyQueueWithLoadsInFlight(void *arg)
+{
+    SDL_AsyncIOQueue *queue;
+    int started = 0;
+    int i;
+
+    queue = SDL_CreateAsyncIOQueue();
+    SDLTest_AssertPass("Call to SDL_CreateAsyncIOQueue()");
+    SDLTest_AssertCheck(queue != NULL, "Verify result value is not NULL");
+    if (!queue) {
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < ASYNCIO_TEST_NUM_LOADS; i++) {
+        const char *file = (i % 2) ? AsyncIOMissingFilename : AsyncIOTestFilename;
+        if (SDL_LoadFileAsync(file, queue, NULL)) {
+            started++;
+        }
+    }
+    SDLTest_AssertCheck(started == ASYNCIO_TEST_NUM_LOADS, "Verify all loads started; expected: %d, got: %d", ASYNCIO_TEST_NUM_LOADS, started);
+
+    /* This has to wait for every step of every load, and clean up the ones that never got to the read. */
+    SDL_DestroyAsyncIOQueue(queue);
+    SDLTest_AssertPass("Call to SDL_DestroyAsyncIOQueue() with loads in flight");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Nest batches on a queue, check tasks started inside a batch still complete, and check an unmatched end fails.
+ *
+ * \sa SDL_BeginAsyncIOBatch
+ * \sa SDL_EndAsyncIOBatch
+ */
+static int SDLCALL asyncio_testBatch(void *arg)
+{
+    SDL_AsyncIOQueue *queue;
+    SDL_AsyncIOOutcome outcome;
+    bool result;
+
+    queue = SDL_CreateAsyncIOQueue();
+    SDLTest_AssertPass("Call to SDL_CreateAsyncIOQueue()");
+    SDLTest_AssertCheck(queue != NULL, "Verify result value is not NULL");
+    if (!queue) {
+        return TEST_ABORTED;
+    }
+
+    result = SDL_EndAsyncIOBatch(queue);
+    SDLTest_AssertPass("Call to SDL_EndAsyncIOBatch() without a batch");
+    SDLTest_AssertCheck(result == false, "Verify result value; expected: false, got: %d", result);
+
+    result = SDL_BeginAsyncIOBatch(queue);
+    SDLTest_AssertCheck(result == true, "Verify result value of outer SDL_BeginAsyncIOBatch(); expected: true, got: %d", result);
+    result = SDL_BeginAsyncIOBatch(queue);
+    SDLTest_AssertCheck(result == true, "Verify result value of inner SDL_BeginAsyncIOBatch(); expected: true, got: %d", result);
+
+    result = SDL_LoadFileAsync(AsyncIOTestFilename, queue, NULL);
+    SDLTest_AssertPass("Call to SDL_LoadFileAsync(\"%s\") inside a batch", AsyncIOTestFilename);
+    SDLTest_AssertCheck(result == true, "Verify result value; expected: true, got: %d", result);
+
+    /* Waiting on the queue starts held-back tasks, so this can't block forever */
+    if (result && waitForAsyncIOResult(queue, &outcome)) {
+        SDLTest_AssertCheck(outcome.result == SDL_ASYNCIO_COMPLETE, "Verify outcome result; expected: %d, got: %d", SDL_ASYNCIO_COMPLETE, outcome.result);
+        SDL_free(outcome.buffer);
+    }
+
+    result = SDL_EndAsyncIOBatch(queue);
+    SDLTest_AssertCheck(result == true, "Verify result value of inner SDL_EndAsyncIOBatch(); expected: true, got: %d", result);
+    result = SDL_EndAsyncIOBatch(queue);
+    SDLTest_AssertCheck(result == true, "Verify result value of outer SDL_EndAsyncIOBatch(); expected: true, got: %d", result);
+
+    result = SDL_EndAsyncIOBatch(queue);
+    SDLTest_AssertPass("Call to SDL_EndAsyncIOBatch() after the outermost batch ended");
+    SDLTest_AssertCheck(result == false, "Verify result value; expected: false, got: %d", result);
+
+    SDL_DestroyAsyncIOQueue(queue);
+    SDLTest_AssertPass("Call to SDL_DestroyAsyncIOQueue()");
+
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* AsyncIO test cases */
+static const SDLTest_TestCaseReference asyncioTest1 = {
+    asyncio_testLoadFile, "asyncio_testLoadFile", "Load a file asynchronously and check its contents", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference asyncioTest2 = {
+    asyncio_testLoadMissingFile, "asyncio_testLoadMissingFile", "Load a missing file asynchronously and check it fails", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference asyncioTest3 = {
+    asyncio_testOpenStatClose, "asyncio_testOpenStatClose", "Open, stat and close a file asynchronously", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference asyncioTest4 = {
+    asyncio_testDestroyQueueWithLoadsInFlight, "asyncio_testDestroyQueueWithLoadsInFlight", "Destroy a queue while file loads are still in flight", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference asyncioTest5 = {
+    asyncio_testBatch, "asyncio_testBatch", "Nest batches on a queue and check an unmatched end fails", TEST_ENABLED
+};
+
+/* Sequence of AsyncIO test cases */
+static const SDLTest_TestCaseReference *asyncioTests[] = {
+    &asyncioTest1,
+    &asyncioTest2,
+    &asyncioTest3,
+    &asyncioTest4,
+    &asyncioTest5,
+    NULL
+};
+
+/* AsyncIO test suite (global) */
+SDLTest_TestSuiteReference asyncioTestSuite = {
+    "AsyncIO",
+    asyncioSetUp,
+    asyncioTests,
+    asyncioTearDown
+};
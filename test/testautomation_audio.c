@@ -1166,6 +1166,204 @@ static int SDLCALL audio_resampleLoss(void *arg)
   return TEST_COMPLETED;
 }
 
+/**
+ * Check the signal-to-noise ratio of each resampler quality tier, through each of its kernels.
+ *
+ * \sa SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER
+ */
+static int SDLCALL audio_resampleQuality(void *arg)
+{
+  struct test_spec_t {
+    SDL_AudioResampleQuality quality;
+    int freq;
+    int rate_in;
+    int rate_out;
+    double signal_to_noise;
+  } test_specs[] = {
+    { SDL_AUDIO_RESAMPLE_QUALITY_FAST, 440, 44100, 48000, 60 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM, 440, 44100, 48000, 80 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 440, 44100, 48000, 100 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_FAST, 5000, 22050, 48000, 12 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM, 5000, 22050, 48000, 70 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 5000, 22050, 48000, 90 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 440, 96000, 44100, 105 },
+  };
+  const int time = 2;
+  int spec_idx;
+  int num_channels;
+
+  for (spec_idx = 0; spec_idx < SDL_arraysize(test_specs); ++spec_idx) {
+    /* 1 and 2 channels have their own kernels; 3 takes the generic path. */
+    for (num_channels = 1; num_channels <= 3; ++num_channels) {
+      const struct test_spec_t *spec = &test_specs[spec_idx];
+      const int frames_in = time * spec->rate_in;
+      const int frames_target = time * spec->rate_out;
+      const int len_in = (frames_in * num_channels) * (int)sizeof(float);
+      const int len_target = (frames_target * num_channels) * (int)sizeof(float);
+      SDL_AudioSpec tmpspec1, tmpspec2;
+      SDL_AudioStream *stream;
+      float *buf_in;
+      float *buf_out;
+      double sum_squared_error = 0;
+      double sum_squared_value = 0;
+      double signal_to_noise;
+      int len_out;
+      int i, j;
+
+      tmpspec1.format = SDL_AUDIO_F32;
+      tmpspec1.channels = num_channels;
+      tmpspec1.freq = spec->rate_in;
+      tmpspec2.format = SDL_AUDIO_F32;
+      tmpspec2.channels = num_channels;
+      tmpspec2.freq = spec->rate_out;
+      stream = SDL_CreateAudioStream(&tmpspec1, &tmpspec2);
+      SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+      if (stream == NULL) {
+        return TEST_ABORTED;
+      }
+      SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, spec->quality);
+
+      buf_in = (float *)SDL_malloc(len_in);
+      buf_out = (float *)SDL_malloc(len_target * 2);
+      if (!SDLTest_AssertCheck(buf_in && buf_out, "Expected buffers to be created.")) {
+        SDL_DestroyAudioStream(stream);
+        SDL_free(buf_in);
+        SDL_free(buf_out);
+        return TEST_ABORTED;
+      }
+
+      for (i = 0; i < frames_in; ++i) {
+        const float f = (float)sine_wave_sample(i, spec->rate_in, spec->freq, 0);
+        for (j = 0; j < num_channels; ++j) {
+          buf_in[(i * num_channels) + j] = f;
+        }
+      }
+
+      len_out = convert_audio_chunks(stream, buf_in, len_in, buf_out, len_target * 2);
+      SDLTest_AssertCheck(len_out == len_target, "Expected output length to be %i, got %i.", len_target, len_out);
+
+      if (len_out == len_target) {
+        /* Skip the start and end, where the filters see the signal abruptly start and stop. */
+        for (i = 64; i < frames_target - 64; ++i) {
+          const double target = sine_wave_sample(i, spec->rate_out, spec->freq, 0);
+          for (j = 0; j < num_channels; ++j) {
+            const double error = target - buf_out[(i * num_channels) + j];
+            sum_squared_error += error * error;
+            sum_squared_value += target * target;
+          }
+        }
+        signal_to_noise = 10 * SDL_log10(sum_squared_value / sum_squared_error); /* decibel */
+        SDLTest_AssertCheck(signal_to_noise >= spec->signal_to_noise,
+                            "Quality %d, %i Hz sine, %i -> %i Hz, %i channels: signal-to-noise ratio %f dB should be no less than %f dB.",
+                            (int)spec->quality, spec->freq, spec->rate_in, spec->rate_out, num_channels, signal_to_noise, spec->signal_to_noise);
+      }
+
+      SDL_free(buf_in);
+      SDL_free(buf_out);
+      SDL_DestroyAudioStream(stream);
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * Check that precalculated filters for simple rate ratios match the general resampler.
+ *
+ * \sa SDL_HINT_AUDIO_RESAMPLER_EXACT_RATIOS
+ */
+static int SDLCALL audio_resampleExactRatios(void *arg)
+{
+  struct test_spec_t {
+    SDL_AudioResampleQuality quality;
+    int rate_in;
+    int rate_out;
+  } test_specs[] = {
+    { SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM, 44100, 48000 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM, 22050, 48000 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_MEDIUM, 48000, 44100 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 44100, 48000 },
+    { SDL_AUDIO_RESAMPLE_QUALITY_HIGH, 22050, 48000 },
+  };
+  const int time = 2;
+  const int freq = 1000;
+  int spec_idx;
+  int num_channels;
+
+  for (spec_idx = 0; spec_idx < SDL_arraysize(test_specs); ++spec_idx) {
+    /* 1 and 2 channels have their own loops; 3 takes the generic path. */
+    for (num_channels = 1; num_channels <= 3; ++num_channels) {
+      const struct test_spec_t *spec = &test_specs[spec_idx];
+      const int frames_in = time * spec->rate_in;
+      const int frames_target = time * spec->rate_out;
+      const int len_in = (frames_in * num_channels) * (int)sizeof(float);
+      const int len_target = (frames_target * num_channels) * (int)sizeof(float);
+      SDL_AudioSpec tmpspec1, tmpspec2;
+      float *buf_in;
+      float *buf_out[2];
+      double max_difference = 0;
+      int len_out[2];
+      int i, j, pass;
+
+      tmpspec1.format = SDL_AUDIO_F32;
+      tmpspec1.channels = num_channels;
+      tmpspec1.freq = spec->rate_in;
+      tmpspec2.format = SDL_AUDIO_F32;
+      tmpspec2.channels = num_channels;
+      tmpspec2.freq = spec->rate_out;
+
+      buf_in = (float *)SDL_malloc(len_in);
+      buf_out[0] = (float *)SDL_malloc(len_target * 2);
+      buf_out[1] = (float *)SDL_malloc(len_target * 2);
+      if (!SDLTest_AssertCheck(buf_in && buf_out[0] && buf_out[1], "Expected buffers to be created.")) {
+        SDL_free(buf_in);
+        SDL_free(buf_out[0]);
+        SDL_free(buf_out[1]);
+        return TEST_ABORTED;
+      }
+
+      for (i = 0; i < frames_in; ++i) {
+        const float f = (float)sine_wave_sample(i, spec->rate_in, freq, 0);
+        for (j = 0; j < num_channels; ++j) {
+          buf_in[(i * num_channels) + j] = f;
+        }
+      }
+
+      /* Pass 0 uses the general resampler, pass 1 the precalculated filters. */
+      for (pass = 0; pass < 2; ++pass) {
+        SDL_AudioStream *stream;
+
+        SDL_SetHint(SDL_HINT_AUDIO_RESAMPLER_EXACT_RATIOS, pass ? "1" : "0");
+        stream = SDL_CreateAudioStream(&tmpspec1, &tmpspec2);
+        SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+        if (stream == NULL) {
+          len_out[pass] = -1;
+          continue;
+        }
+        SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, spec->quality);
+        len_out[pass] = convert_audio_chunks(stream, buf_in, len_in, buf_out[pass], len_target * 2);
+        SDL_DestroyAudioStream(stream);
+      }
+      SDL_ResetHint(SDL_HINT_AUDIO_RESAMPLER_EXACT_RATIOS);
+
+      SDLTest_AssertCheck(len_out[0] == len_target && len_out[1] == len_target, "Expected output lengths to be %i, got %i and %i.", len_target, len_out[0], len_out[1]);
+      if (len_out[0] == len_target && len_out[1] == len_target) {
+        for (i = 0; i < frames_target * num_channels; ++i) {
+          max_difference = SDL_max(max_difference, SDL_fabs((double)buf_out[0][i] - buf_out[1][i]));
+        }
+        SDLTest_AssertCheck(max_difference <= 0.0001, "Quality %d, %i -> %i Hz, %i channels: maximum difference %f should be no more than 0.0001.",
+                            (int)spec->quality, spec->rate_in, spec->rate_out, num_channels, max_difference);
+      }
+
+      SDL_free(buf_in);
+      SDL_free(buf_out[0]);
+      SDL_free(buf_out[1]);
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
 /**
  * Check accuracy converting between audio formats.
  *
@@ -1460,6 +1658,256 @@ cleanup:
 
     return status;
 }
+
+#define MIX_THREADS_NUM_STREAMS 8
+#define MIX_THREADS_SAMPLE_VALUE 0.4f
+
+static SDL_AtomicInt g_audio_mixThreadsCallbacks;
+static SDL_AtomicInt g_audio_mixThreadsPostmixes;
+static SDL_AtomicInt g_audio_mixThreadsBadSamples;
+
+/* Any three of the first half of the streams would clip together, but the other half cancel most of that out again. */
+static float audio_mixThreadsStreamValue(int stream_index)
+{
+    return (stream_index < (MIX_THREADS_NUM_STREAMS / 2)) ? MIX_THREADS_SAMPLE_VALUE : -(MIX_THREADS_SAMPLE_VALUE * 0.75f);
+}
+
+static void SDLCALL audio_mixThreadsStreamCallback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    const float value = audio_mixThreadsStreamValue((int)(intptr_t)userdata);
+    float samples[256];
+    int i;
+
+    for (i = 0; i < SDL_arraysize(samples); i++) {
+        samples[i] = value;
+    }
+
+    while (additional_amount > 0) {
+        const int len = SDL_min(additional_amount, (int)sizeof(samples));
+        SDL_PutAudioStreamData(stream, samples, len);
+        additional_amount -= len;
+    }
+
+    SDL_AddAtomicInt(&g_audio_mixThreadsCallbacks, 1);
+}
+
+static void SDLCALL audio_mixThreadsPostmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    const int num_samples = buflen / (int)sizeof(float);
+    float expected = 0.0f;
+    int i;
+
+    for (i = 0; i < MIX_THREADS_NUM_STREAMS; i++) {
+        expected += audio_mixThreadsStreamValue(i);
+    }
+
+    /* Every stream is always fed, so every sample should be the sum of all of them, without clipping in between. */
+    for (i = 0; i < num_samples; i++) {
+        if (SDL_fabsf(buffer[i] - expected) > 0.0001f) {
+            SDL_AddAtomicInt(&g_audio_mixThreadsBadSamples, 1);
+        }
+    }
+
+    SDL_AddAtomicInt(&g_audio_mixThreadsPostmixes, 1);
+}
+
+/* Mix the test streams on a device opened with `num_threads` helper threads, and check the mix and iteration timing. */
+static int audio_mixThreadsRun(const char *num_threads)
+{
+    SDL_AudioStream *streams[MIX_THREADS_NUM_STREAMS];
+    SDL_AudioDeviceID devid;
+    SDL_AudioSpec spec;
+    SDL_PropertiesID props;
+    Sint64 iteration_ns, iteration_max_ns, period_ns;
+    int total_delay;
+    int i;
+
+    SDL_zeroa(streams);
+    SDL_SetAtomicInt(&g_audio_mixThreadsCallbacks, 0);
+    SDL_SetAtomicInt(&g_audio_mixThreadsPostmixes, 0);
+    SDL_SetAtomicInt(&g_audio_mixThreadsBadSamples, 0);
+
+    /* The test harness already has the default device open, and helper threads only start when a physical device is opened, so start audio over. */
+    while (SDL_WasInit(SDL_INIT_AUDIO)) {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    }
+    SDL_SetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS, num_threads);
+    SDLTest_Log("Mixing with SDL_HINT_AUDIO_DEVICE_MIX_THREADS=%s", num_threads);
+    audioSetUp(NULL);
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec);
+    SDLTest_AssertPass("Call to SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, spec)");
+    if (!SDLTest_AssertCheck(devid != 0, "Verify return value; expected != 0 got: %" SDL_PRIu32, devid)) {
+        SDL_ResetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+        return TEST_ABORTED;
+    }
+
+    /* Feed the streams in the device's own format, so nothing gets resampled. */
+    SDL_GetAudioDeviceFormat(devid, &spec, NULL);
+    spec.format = SDL_AUDIO_F32;
+
+    SDL_PauseAudioDevice(devid);
+    SDL_SetAudioPostmixCallback(devid, audio_mixThreadsPostmix, NULL);
+
+    for (i = 0; i < MIX_THREADS_NUM_STREAMS; i++) {
+        streams[i] = SDL_CreateAudioStream(&spec, &spec);
+        SDLTest_AssertCheck(streams[i] != NULL, "Expected SDL_CreateAudioStream to succeed");
+        SDL_SetAudioStreamGetCallback(streams[i], audio_mixThreadsStreamCallback, (void *)(intptr_t)i);
+    }
+    SDLTest_AssertCheck(SDL_BindAudioStreams(devid, streams, MIX_THREADS_NUM_STREAMS), "Expected SDL_BindAudioStreams to succeed");
+
+    props = SDL_GetAudioDeviceProperties(devid);
+    SDLTest_AssertCheck(props != 0, "Expected SDL_GetAudioDeviceProperties to succeed");
+
+    SDL_ResumeAudioDevice(devid);
+
+    total_delay = 0;
+    while (SDL_GetAtomicInt(&g_audio_mixThreadsPostmixes) < 4 && total_delay < 2000) {
+        SDL_Delay(10);
+        total_delay += 10;
+    }
+
+    SDL_PauseAudioDevice(devid);
+
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_audio_mixThreadsPostmixes) >= 4, "Verify postmix callback ran; got %d calls", SDL_GetAtomicInt(&g_audio_mixThreadsPostmixes));
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_audio_mixThreadsCallbacks) >= MIX_THREADS_NUM_STREAMS, "Verify stream callbacks ran; got %d calls", SDL_GetAtomicInt(&g_audio_mixThreadsCallbacks));
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_audio_mixThreadsBadSamples) == 0, "Verify mixed samples; got %d bad samples", SDL_GetAtomicInt(&g_audio_mixThreadsBadSamples));
+
+    iteration_ns = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_ITERATION_NS_NUMBER, -1);
+    iteration_max_ns = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_ITERATION_MAX_NS_NUMBER, -1);
+    period_ns = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_BUFFER_PERIOD_NS_NUMBER, -1);
+    SDLTest_AssertCheck(iteration_ns >= 0, "Verify iteration time is reported; got %" SDL_PRIs64, iteration_ns);
+    SDLTest_AssertCheck(iteration_max_ns >= iteration_ns, "Verify maximum iteration time; got %" SDL_PRIs64 ", last %" SDL_PRIs64, iteration_max_ns, iteration_ns);
+    SDLTest_AssertCheck(period_ns > 0, "Verify buffer period is reported; got %" SDL_PRIs64, period_ns);
+
+    for (i = 0; i < MIX_THREADS_NUM_STREAMS; i++) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    SDL_CloseAudioDevice(devid);
+    SDL_ResetHint(SDL_HINT_AUDIO_DEVICE_MIX_THREADS);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Mix several streams on a device that uses helper threads, and check the mix and iteration timing.
+ * The same mix without helper threads has to clamp the same way.
+ *
+ * \sa SDL_HINT_AUDIO_DEVICE_MIX_THREADS
+ * \sa SDL_GetAudioDeviceProperties
+ */
+static int SDLCALL audio_mixThreads(void *arg)
+{
+    if (audio_mixThreadsRun("3") != TEST_COMPLETED) {
+        return TEST_ABORTED;
+    }
+    return audio_mixThreadsRun("0");
+}
+
+/**
+ * Put data through a stream with an input ring, wrapping around it and overflowing it, and check it comes out intact.
+ *
+ * \sa SDL_CreateAudioStreamWithProperties
+ */
+static void SDLCALL audio_inputRingPutCallback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    *(int *) userdata += additional_amount;
+}
+
+static int SDLCALL audio_inputRing(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_S16, 2, 48000 };
+    const int frame_size = SDL_AUDIO_FRAMESIZE(spec);
+    Sint16 in[96], out[96];
+    SDL_AudioSpec other_spec;
+    SDL_AudioStream *stream;
+    SDL_PropertiesID props;
+    Sint16 next = 0, expect = 0;
+    bool ok = true;
+    int put_total = 0;
+    int i, j, got;
+
+    props = SDL_CreateProperties();
+    SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_CREATE_INPUT_RING_SIZE_NUMBER, 100);  /* rounds up to 128 bytes. */
+
+    stream = SDL_CreateAudioStreamWithProperties(NULL, &spec, props);
+    SDLTest_AssertCheck(stream == NULL, "Expected SDL_CreateAudioStreamWithProperties to fail without a source format");
+
+    /* the ring can't take data until the stream knows where it's going. */
+    stream = SDL_CreateAudioStreamWithProperties(&spec, NULL, props);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStreamWithProperties to succeed without a destination format")) {
+        SDL_DestroyProperties(props);
+        return TEST_ABORTED;
+    }
+    SDL_memset(in, 0, sizeof(in));
+    SDLTest_AssertCheck(!SDL_PutAudioStreamData(stream, in, frame_size), "Expected putting data to fail without a destination format");
+    SDLTest_AssertCheck(SDL_SetAudioStreamFormat(stream, NULL, &spec), "Expected setting the output format to succeed");
+    SDLTest_AssertCheck(SDL_PutAudioStreamData(stream, in, frame_size), "Expected putting data to succeed with a destination format");
+    SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) == frame_size, "Verify data put through the input ring is available");
+
+    /* put callbacks need the stream lock, so they have to skip the ring. */
+    SDL_SetAudioStreamPutCallback(stream, audio_inputRingPutCallback, &put_total);
+    SDL_PutAudioStreamData(stream, in, frame_size);
+    SDLTest_AssertCheck(put_total == frame_size, "Verify the put callback ran; expected %d bytes, got %d", frame_size, put_total);
+    SDL_SetAudioStreamPutCallback(stream, NULL, NULL);
+    SDL_PutAudioStreamData(stream, in, frame_size);
+    SDLTest_AssertCheck(put_total == frame_size, "Verify the put callback isn't called after it's removed");
+    SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) == frame_size * 3, "Verify all the data is available");
+    SDL_DestroyAudioStream(stream);
+
+    stream = SDL_CreateAudioStreamWithProperties(&spec, &spec, props);
+    SDL_DestroyProperties(props);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStreamWithProperties to succeed")) {
+        return TEST_ABORTED;
+    }
+
+    SDLTest_AssertCheck(!SDL_PutAudioStreamData(stream, in, frame_size + 1), "Expected a partial frame to be rejected");
+
+    other_spec = spec;
+    other_spec.freq = 44100;
+    SDLTest_AssertCheck(!SDL_SetAudioStreamFormat(stream, &other_spec, NULL), "Expected changing the input format to fail");
+    SDLTest_AssertCheck(SDL_SetAudioStreamFormat(stream, &spec, &other_spec), "Expected changing the output format to succeed");
+    SDLTest_AssertCheck(SDL_SetAudioStreamFormat(stream, NULL, &spec), "Expected restoring the output format to succeed");
+
+    /* odd-sized puts walk the ring position around, and the larger ones won't fit in the ring at all. */
+    for (i = 1; ok && (i <= 24); i++) {
+        const int frames = (i % 12) + 1;
+        for (j = 0; j < frames * 2; j++) {
+            in[j] = next++;
+        }
+        if (!SDL_PutAudioStreamData(stream, in, frames * frame_size)) {
+            ok = false;
+            break;
+        }
+        if ((i % 3) != 0) {
+            continue;  /* let a few puts pile up in the ring. */
+        }
+        while ((got = SDL_GetAudioStreamData(stream, out, sizeof(out))) > 0) {
+            for (j = 0; j < got / (int) sizeof(Sint16); j++) {
+                if (out[j] != expect++) {
+                    ok = false;
+                }
+            }
+        }
+    }
+    SDLTest_AssertCheck(ok, "Verify data came through the input ring in order");
+    SDLTest_AssertCheck(expect == next, "Verify all data came out; expected %d samples, got %d", (int) next, (int) expect);
+
+    in[0] = 1;
+    in[1] = 2;
+    SDL_PutAudioStreamData(stream, in, frame_size);
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == frame_size, "Verify queued data includes the input ring");
+    SDL_ClearAudioStream(stream);
+    SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) == 0, "Verify clearing the stream empties the input ring");
+
+    SDL_DestroyAudioStream(stream);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1541,13 +1989,29 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_mixThreads, "audio_mixThreads", "Mix several streams with helper threads and check iteration timing.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_inputRing, "audio_inputRing", "Put data through an audio stream's lock-free input ring.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_resampleQuality, "audio_resampleQuality", "Check signal-to-noise ratio of each resampling quality.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_resampleExactRatios, "audio_resampleExactRatios", "Check precalculated filters for simple rate ratios against the general resampler.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTestGetAudioFormatName,
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22, NULL
 };
 
 /* Audio test suite (global) */
@@ -0,0 +1,167 @@
+/**
+ * Camera test suite, using the dummy camera driver's fake camera
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+#define CAMERA_TEST_FRAME_BUFFERS 3
+#define CAMERA_TEST_TIMEOUT_MS 5000
+
+/* ================= Test Case Implementation ================== */
+
+/* Fixture */
+
+static void SDLCALL cameraSetUp(void **arg)
+{
+    bool ret;
+
+    SDL_SetHint(SDL_HINT_CAMERA_DRIVER, "dummy");
+    SDL_SetHint(SDL_HINT_CAMERA_FRAME_BUFFERS, "3");  /* CAMERA_TEST_FRAME_BUFFERS */
+
+    ret = SDL_InitSubSystem(SDL_INIT_CAMERA);
+    SDLTest_AssertPass("Call to SDL_InitSubSystem(SDL_INIT_CAMERA)");
+    SDLTest_AssertCheck(ret == true, "Check result from SDL_InitSubSystem(SDL_INIT_CAMERA)");
+    if (!ret) {
+        SDLTest_LogError("%s", SDL_GetError());
+    }
+}
+
+static void SDLCALL cameraTearDown(void *arg)
+{
+    SDL_QuitSubSystem(SDL_INIT_CAMERA);
+    SDLTest_AssertPass("Call to SDL_QuitSubSystem(SDL_INIT_CAMERA)");
+
+    SDL_ResetHint(SDL_HINT_CAMERA_DRIVER);
+    SDL_ResetHint(SDL_HINT_CAMERA_FRAME_BUFFERS);
+}
+
+/* Helper to wait until a camera property reaches a value, or give up */
+static Sint64 waitForCameraStat(SDL_Camera *camera, const char *name, Sint64 value)
+{
+    const Uint64 end = SDL_GetTicks() + CAMERA_TEST_TIMEOUT_MS;
+    Sint64 current;
+
+    for (;;) {
+        current = SDL_GetNumberProperty(SDL_GetCameraProperties(camera), name, 0);
+        if (current >= value || SDL_GetTicks() >= end) {
+            break;
+        }
+        SDL_Delay(10);
+    }
+    return current;
+}
+
+/* Test case functions */
+
+/**
+ * Open the fake camera with a spec that needs scaling and conversion, let the frame ring fill up,
+ * and check the ring size, dropped frame and converted frame counts.
+ *
+ * \sa SDL_OpenCamera
+ * \sa SDL_GetCameraProperties
+ * \sa SDL_AcquireCameraFrame
+ */
+static int SDLCALL camera_testConversionRing(void *arg)
+{
+    const char *driver;
+    SDL_CameraID *cameras;
+    SDL_CameraSpec spec;
+    SDL_Camera *camera;
+    SDL_Surface *frames[CAMERA_TEST_FRAME_BUFFERS];
+    Uint64 timestamp;
+    Sint64 value;
+    int count = 0;
+    int i;
+
+    driver = SDL_GetCurrentCameraDriver();
+    if (!driver || SDL_strcmp(driver, "dummy") != 0) {
+        SDLTest_Log("The dummy camera driver isn't available, skipping");
+        return TEST_SKIPPED;
+    }
+
+    cameras = SDL_GetCameras(&count);
+    SDLTest_AssertPass("Call to SDL_GetCameras()");
+    SDLTest_AssertCheck(cameras != NULL && count == 1, "Validate the dummy driver has one camera; got: %d", count);
+    if (!cameras || count < 1) {
+        SDL_free(cameras);
+        return TEST_ABORTED;
+    }
+
+    /* Half the size and a different format than the fake camera makes */
+    SDL_zero(spec);
+    spec.format = SDL_PIXELFORMAT_ABGR8888;
+    spec.colorspace = SDL_COLORSPACE_SRGB;
+    spec.width = 160;
+    spec.height = 120;
+    spec.framerate_numerator = 60;
+    spec.framerate_denominator = 1;
+
+    camera = SDL_OpenCamera(cameras[0], &spec);
+    SDL_free(cameras);
+    SDLTest_AssertPass("Call to SDL_OpenCamera()");
+    SDLTest_AssertCheck(camera != NULL, "Validate result from SDL_OpenCamera(); got: %s", camera ? "a camera" : SDL_GetError());
+    if (!camera) {
+        return TEST_ABORTED;
+    }
+
+    value = SDL_GetNumberProperty(SDL_GetCameraProperties(camera), SDL_PROP_CAMERA_FRAME_BUFFERS_NUMBER, 0);
+    SDLTest_AssertCheck(value == CAMERA_TEST_FRAME_BUFFERS, "Validate frame buffer count; expected: %d, got: %" SDL_PRIs64, CAMERA_TEST_FRAME_BUFFERS, value);
+
+    /* Don't take any frames, so the ring fills up and the camera has to drop the rest */
+    value = waitForCameraStat(camera, SDL_PROP_CAMERA_DROPPED_FRAMES_NUMBER, 1);
+    SDLTest_AssertCheck(value > 0, "Validate frames were dropped once the ring was full; got: %" SDL_PRIs64, value);
+
+    /* The last frame into the ring might still be converting when the next one is dropped */
+    value = waitForCameraStat(camera, SDL_PROP_CAMERA_CONVERTED_FRAMES_NUMBER, CAMERA_TEST_FRAME_BUFFERS);
+    SDLTest_AssertCheck(value == CAMERA_TEST_FRAME_BUFFERS, "Validate converted frame count with a full ring; expected: %d, got: %" SDL_PRIs64, CAMERA_TEST_FRAME_BUFFERS, value);
+
+    /* Every frame in the ring can be taken, converted to what we asked for */
+    for (i = 0; i < CAMERA_TEST_FRAME_BUFFERS; i++) {
+        frames[i] = SDL_AcquireCameraFrame(camera, &timestamp);
+        SDLTest_AssertCheck(frames[i] != NULL, "Validate frame %d can be acquired", i);
+        if (frames[i]) {
+            SDLTest_AssertCheck(frames[i]->w == spec.width && frames[i]->h == spec.height && frames[i]->format == spec.format,
+                                "Validate frame %d is %dx%d %s; got: %dx%d %s", i, spec.width, spec.height, SDL_GetPixelFormatName(spec.format),
+                                frames[i]->w, frames[i]->h, SDL_GetPixelFormatName(frames[i]->format));
+        }
+    }
+    SDLTest_AssertCheck(SDL_AcquireCameraFrame(camera, &timestamp) == NULL, "Validate there are no more frames than the ring holds");
+
+    for (i = 0; i < CAMERA_TEST_FRAME_BUFFERS; i++) {
+        if (frames[i]) {
+            SDL_ReleaseCameraFrame(camera, frames[i]);
+        }
+    }
+
+    /* With the ring empty again, new frames get converted */
+    value = waitForCameraStat(camera, SDL_PROP_CAMERA_CONVERTED_FRAMES_NUMBER, CAMERA_TEST_FRAME_BUFFERS + 1);
+    SDLTest_AssertCheck(value > CAMERA_TEST_FRAME_BUFFERS, "Validate frames are converted after the ring is emptied; got: %" SDL_PRIs64, value);
+
+    SDL_CloseCamera(camera);
+    SDLTest_AssertPass("Call to SDL_CloseCamera()");
+
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Camera test cases */
+static const SDLTest_TestCaseReference cameraTest1 = {
+    camera_testConversionRing, "camera_testConversionRing", "Fill the frame ring of a camera that needs conversion and check its statistics", TEST_ENABLED
+};
+
+/* Sequence of Camera test cases */
+static const SDLTest_TestCaseReference *cameraTests[] = {
+    &cameraTest1,
+    NULL
+};
+
+/* Camera test suite (global) */
+SDLTest_TestSuiteReference cameraTestSuite = {
+    "Camera",
+    cameraSetUp,
+    cameraTests,
+    cameraTearDown
+};
@@ -304,6 +304,229 @@ static int SDLCALL events_mainThreadCallbacks(void *arg)
     return TEST_COMPLETED;
 }
 
+#define PUSH_THREADS        4
+#define EVENTS_PER_THREAD   5000
+
+#ifndef SDL_PLATFORM_EMSCRIPTEN /* Emscripten doesn't have threads */
+static int SDLCALL PushEventsThread(void *userdata)
+{
+    const int index = (int)(intptr_t)userdata;
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    event.user.code = index;
+    for (i = 0; i < EVENTS_PER_THREAD; ++i) {
+        event.user.data1 = (void *)(intptr_t)i;
+        event.common.timestamp = 0;
+        if (!SDL_PushEvent(&event)) {
+            return i;
+        }
+    }
+    return i;
+}
+#endif /* !SDL_PLATFORM_EMSCRIPTEN */
+
+/**
+ * Pushes events from several threads and checks they all arrive, in the order each thread pushed them.
+ *
+ * \sa SDL_PushEvent
+ * \sa SDL_PeepEvents
+ */
+static int SDLCALL events_pushFromThreads(void *arg)
+{
+#ifdef SDL_PLATFORM_EMSCRIPTEN
+    SDLTest_Log("Emscripten doesn't have threads");
+    return TEST_SKIPPED;
+#else
+    SDL_Thread *threads[PUSH_THREADS];
+    int next_expected[PUSH_THREADS];
+    SDL_Event events[256];
+    int pushed = 0;
+    int received = 0;
+    int out_of_order = 0;
+    int count;
+    int i;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    for (i = 0; i < PUSH_THREADS; ++i) {
+        next_expected[i] = 0;
+        threads[i] = SDL_CreateThread(PushEventsThread, "PushEvents", (void *)(intptr_t)i);
+        SDLTest_AssertCheck(threads[i] != NULL, "Create pushing thread %d", i);
+    }
+    for (i = 0; i < PUSH_THREADS; ++i) {
+        int result = 0;
+        SDL_WaitThread(threads[i], &result);
+        pushed += result;
+    }
+    SDLTest_AssertCheck(pushed == PUSH_THREADS * EVENTS_PER_THREAD, "Check events pushed, expected: %d, got: %d", PUSH_THREADS * EVENTS_PER_THREAD, pushed);
+
+    count = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_EVENT_USER, SDL_EVENT_USER);
+    SDLTest_AssertCheck(count == pushed, "Check queued user events, expected: %d, got: %d", pushed, count);
+    SDLTest_AssertCheck(SDL_HasEvent(SDL_EVENT_USER), "Check SDL_HasEvent(SDL_EVENT_USER)");
+
+    while ((count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER)) > 0) {
+        for (i = 0; i < count; ++i) {
+            const int index = events[i].user.code;
+            const int value = (int)(intptr_t)events[i].user.data1;
+            if (index < 0 || index >= PUSH_THREADS || value != next_expected[index]) {
+                ++out_of_order;
+                continue;
+            }
+            next_expected[index] = value + 1;
+        }
+        received += count;
+    }
+    SDLTest_AssertCheck(received == pushed, "Check events received, expected: %d, got: %d", pushed, received);
+    SDLTest_AssertCheck(out_of_order == 0, "Check events arrived in order, expected: 0 out of order, got: %d", out_of_order);
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER), "Check the queue has no user events left");
+
+    return TEST_COMPLETED;
+#endif
+}
+
+/**
+ * Pushes some events and takes them all off the queue at once.
+ *
+ * \sa SDL_AcquireEvents
+ * \sa SDL_ReleaseEvents
+ */
+static int SDLCALL events_acquireEvents(void *arg)
+{
+    const SDL_Event *events;
+    SDL_Event event;
+    int count = -1;
+    int expected = 0;
+    int out_of_order = 0;
+    int i;
+
+    /* Start with an empty queue */
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    for (i = 0; i < 300; ++i) {
+        event.user.code = i;
+        event.common.timestamp = 0;
+        SDL_PushEvent(&event);
+    }
+
+    events = SDL_AcquireEvents(&count);
+    SDLTest_AssertPass("Call to SDL_AcquireEvents()");
+    SDLTest_AssertCheck(events != NULL, "Check result, expected: non-NULL, got: %p", events);
+    SDLTest_AssertCheck(count >= 300, "Check count, expected: >=300, got: %d", count);
+
+    /* User events should come back in the order they were pushed */
+    for (i = 0; events && i < count; ++i) {
+        if (events[i].type == SDL_EVENT_USER) {
+            if (events[i].user.code != expected) {
+                ++out_of_order;
+            }
+            expected = events[i].user.code + 1;
+        }
+    }
+    SDLTest_AssertCheck(expected == 300, "Check all user events were returned, expected: 300, got: %d", expected);
+    SDLTest_AssertCheck(out_of_order == 0, "Check events are in order, expected: 0 out of order, got: %d", out_of_order);
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER), "Check the queue has no user events left");
+
+    /* Only one batch can be out at a time */
+    SDL_PushEvent(&event);
+    SDLTest_AssertCheck(SDL_AcquireEvents(&count) == NULL, "Check second SDL_AcquireEvents() fails before release");
+
+    SDL_ReleaseEvents(events);
+    SDLTest_AssertPass("Call to SDL_ReleaseEvents()");
+
+    events = SDL_AcquireEvents(&count);
+    SDLTest_AssertCheck(events != NULL && count >= 1, "Check SDL_AcquireEvents() after release, expected: >=1 events, got: %d", count);
+    SDL_ReleaseEvents(events);
+
+    return TEST_COMPLETED;
+}
+
+static void PushMouseMotion(SDL_MouseID which, float x)
+{
+    SDL_Event event;
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_MOUSE_MOTION;
+    event.motion.which = which;
+    event.motion.x = x;
+    event.motion.xrel = 1.0f;
+    SDL_PushEvent(&event);
+}
+
+/**
+ * Checks that consecutive motion events are merged when coalescing is enabled.
+ *
+ * \sa SDL_SetEventCoalescingEnabled
+ * \sa SDL_GetCoalescedEventCount
+ */
+static int SDLCALL events_coalescing(void *arg)
+{
+    SDL_Event events[8];
+    SDL_Event event;
+    Uint64 merged;
+    bool result;
+    int count;
+    int i;
+
+    result = SDL_SetEventCoalescingEnabled(SDL_EVENT_KEY_DOWN, true);
+    SDLTest_AssertCheck(!result, "Check SDL_SetEventCoalescingEnabled(SDL_EVENT_KEY_DOWN) fails, got: %d", result);
+
+    result = SDL_SetEventCoalescingEnabled(SDL_EVENT_MOUSE_MOTION, true);
+    SDLTest_AssertCheck(result, "Check SDL_SetEventCoalescingEnabled(SDL_EVENT_MOUSE_MOTION) succeeds, got: %d", result);
+    SDLTest_AssertCheck(SDL_EventCoalescingEnabled(SDL_EVENT_MOUSE_MOTION), "Check SDL_EventCoalescingEnabled(SDL_EVENT_MOUSE_MOTION)");
+
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    merged = SDL_GetCoalescedEventCount(SDL_EVENT_MOUSE_MOTION);
+
+    /* Two mice moving, then a button press, then more motion */
+    for (i = 0; i < 50; ++i) {
+        PushMouseMotion(1, (float)i);
+    }
+    for (i = 0; i < 50; ++i) {
+        PushMouseMotion(2, (float)i);
+    }
+    SDL_zero(event);
+    event.type = SDL_EVENT_MOUSE_BUTTON_DOWN;
+    event.button.which = 1;
+    event.button.button = SDL_BUTTON_LEFT;
+    SDL_PushEvent(&event);
+    for (i = 0; i < 10; ++i) {
+        PushMouseMotion(1, 100.0f + i);
+    }
+
+    count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_MOUSE_MOTION, SDL_EVENT_MOUSE_BUTTON_DOWN);
+    SDLTest_AssertCheck(count == 4, "Check queued events, expected: 4, got: %d", count);
+    if (count == 4) {
+        SDLTest_AssertCheck(events[0].type == SDL_EVENT_MOUSE_MOTION && events[0].motion.which == 1 && events[0].motion.x == 49.0f && events[0].motion.xrel == 50.0f,
+                            "Check first mouse motion, expected: x=49 xrel=50, got: x=%g xrel=%g", events[0].motion.x, events[0].motion.xrel);
+        SDLTest_AssertCheck(events[1].type == SDL_EVENT_MOUSE_MOTION && events[1].motion.which == 2 && events[1].motion.x == 49.0f && events[1].motion.xrel == 50.0f,
+                            "Check second mouse motion, expected: x=49 xrel=50, got: x=%g xrel=%g", events[1].motion.x, events[1].motion.xrel);
+        SDLTest_AssertCheck(events[2].type == SDL_EVENT_MOUSE_BUTTON_DOWN, "Check button press stays in order");
+        SDLTest_AssertCheck(events[3].type == SDL_EVENT_MOUSE_MOTION && events[3].motion.x == 109.0f && events[3].motion.xrel == 10.0f,
+                            "Check motion after the button press, expected: x=109 xrel=10, got: x=%g xrel=%g", events[3].motion.x, events[3].motion.xrel);
+    }
+
+    merged = SDL_GetCoalescedEventCount(SDL_EVENT_MOUSE_MOTION) - merged;
+    SDLTest_AssertCheck(merged == 107, "Check merged event count, expected: 107, got: %" SDL_PRIu64, merged);
+
+    SDL_SetEventCoalescingEnabled(SDL_EVENT_MOUSE_MOTION, false);
+    SDLTest_AssertCheck(!SDL_EventCoalescingEnabled(SDL_EVENT_MOUSE_MOTION), "Check coalescing was disabled");
+
+    for (i = 0; i < 5; ++i) {
+        PushMouseMotion(1, (float)i);
+    }
+    count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_MOUSE_MOTION, SDL_EVENT_MOUSE_MOTION);
+    SDLTest_AssertCheck(count == 5, "Check events aren't merged once coalescing is disabled, expected: 5, got: %d", count);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -323,12 +546,27 @@ static const SDLTest_TestCaseReference eventsTest_mainThreadCallbacks = {
     events_mainThreadCallbacks, "events_mainThreadCallbacks", "Run callbacks on the main thread", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_pushFromThreads = {
+    events_pushFromThreads, "events_pushFromThreads", "Push events from several threads at once", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_acquireEvents = {
+    events_acquireEvents, "events_acquireEvents", "Take all pending events off the queue at once", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_coalescing = {
+    events_coalescing, "events_coalescing", "Merge consecutive motion events", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
     &eventsTest_pushPumpAndPollUserevent,
     &eventsTest_addDelEventWatch,
     &eventsTest_addDelEventWatchWithUserdata,
     &eventsTest_mainThreadCallbacks,
+    &eventsTest_pushFromThreads,
+    &eventsTest_acquireEvents,
+    &eventsTest_coalescing,
     NULL
 };
 
@@ -199,6 +199,182 @@ static int SDLCALL TestVirtualJoystick(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Check that mapping lookups honor the GUID version and the CRC field
+ *
+ * \sa SDL_AddGamepadMapping
+ * \sa SDL_GetGamepadMappingForGUID
+ */
+static int SDLCALL TestGamepadMappingLookup(void *arg)
+{
+    static const char *guid_v1 = "03000000341200007856000001000000";
+    static const char *guid_v2 = "03000000341200007856000002000000";
+    static const char *guid_crc = "0300cdab341200007856000001000000";
+    static const char *guid_other_crc = "03001111341200007856000001000000";
+    static const char *guid_unknown = "03000000341200007956000001000000";
+    static const struct
+    {
+        const char **guid;
+        const char *expected;
+    } lookups[] = {
+        { &guid_v1, "Mapping Test v1," },
+        { &guid_v2, "Mapping Test v1," },
+        { &guid_crc, "Mapping Test CRC," },
+        { &guid_other_crc, "Mapping Test v1," },
+        { &guid_unknown, NULL },
+    };
+    char mapping[256];
+    int i;
+
+    SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_GAMEPAD), "SDL_InitSubSystem(SDL_INIT_GAMEPAD)");
+
+    /* A mapping for version 1 and a mapping for one CRC of the same device */
+    SDL_snprintf(mapping, sizeof(mapping), "%s,Mapping Test v1,a:b0,b:b1,leftx:a0,lefty:a1,", guid_v1);
+    SDLTest_AssertCheck(SDL_AddGamepadMapping(mapping) == 1, "SDL_AddGamepadMapping(v1)");
+    SDL_snprintf(mapping, sizeof(mapping), "%s,Mapping Test CRC,a:b1,b:b0,leftx:a0,lefty:a1,crc:abcd,", guid_v1);
+    SDLTest_AssertCheck(SDL_AddGamepadMapping(mapping) == 1, "SDL_AddGamepadMapping(crc)");
+
+    for (i = 0; i < SDL_arraysize(lookups); ++i) {
+        char *result = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(*lookups[i].guid));
+        if (lookups[i].expected) {
+            SDLTest_AssertCheck(result && SDL_strstr(result, lookups[i].expected) != NULL,
+                                "SDL_GetGamepadMappingForGUID(%s) -> %s (expected \"%s\")", *lookups[i].guid, result ? result : "NULL", lookups[i].expected);
+        } else {
+            SDLTest_AssertCheck(result == NULL, "SDL_GetGamepadMappingForGUID(%s) -> %s (expected NULL)", *lookups[i].guid, result ? result : "NULL");
+        }
+        SDL_free(result);
+    }
+
+    /* A mapping added later for another CRC of the same device */
+    SDL_snprintf(mapping, sizeof(mapping), "%s,Mapping Test CRC2,a:b1,b:b0,leftx:a0,lefty:a1,crc:1111,", guid_v1);
+    SDLTest_AssertCheck(SDL_AddGamepadMapping(mapping) == 1, "SDL_AddGamepadMapping(crc2)");
+    {
+        char *result = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(guid_other_crc));
+        SDLTest_AssertCheck(result && SDL_strstr(result, "Mapping Test CRC2,") != NULL,
+                            "SDL_GetGamepadMappingForGUID(%s) -> %s (expected \"Mapping Test CRC2,\")", guid_other_crc, result ? result : "NULL");
+        SDL_free(result);
+    }
+
+    SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
+
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL GamepadStateReader(void *data)
+{
+    SDL_Gamepad *gamepad = (SDL_Gamepad *)data;
+    int mismatches = 0;
+    int i;
+
+    for (i = 0; i < 100000; ++i) {
+        SDL_GamepadState state;
+
+        if (!SDL_GetGamepadState(gamepad, &state) ||
+            state.axes[SDL_GAMEPAD_AXIS_LEFTX] != state.axes[SDL_GAMEPAD_AXIS_LEFTY]) {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+/**
+ * Check gamepad state snapshots
+ *
+ * \sa SDL_GetGamepadState
+ */
+static int SDLCALL TestGamepadState(void *arg)
+{
+    SDL_VirtualJoystickDesc desc;
+    SDL_VirtualJoystickTouchpadDesc touchpad;
+    SDL_VirtualJoystickSensorDesc sensor;
+    SDL_Joystick *joystick = NULL;
+    SDL_Gamepad *gamepad = NULL;
+    SDL_GamepadState state;
+    SDL_JoystickID device_id;
+    SDL_Thread *thread;
+    const float gyro[3] = { 1.0f, 2.0f, 3.0f };
+    int mismatches = 0;
+    int i;
+
+    SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_GAMEPAD), "SDL_InitSubSystem(SDL_INIT_GAMEPAD)");
+
+    SDL_zero(touchpad);
+    touchpad.nfingers = 2;
+    SDL_zero(sensor);
+    sensor.type = SDL_SENSOR_GYRO;
+    sensor.rate = 100.0f;
+
+    SDL_INIT_INTERFACE(&desc);
+    desc.type = SDL_JOYSTICK_TYPE_GAMEPAD;
+    desc.naxes = SDL_GAMEPAD_AXIS_COUNT;
+    desc.nbuttons = SDL_GAMEPAD_BUTTON_COUNT;
+    desc.ntouchpads = 1;
+    desc.touchpads = &touchpad;
+    desc.nsensors = 1;
+    desc.sensors = &sensor;
+    desc.name = "Virtual Gamepad State";
+    device_id = SDL_AttachVirtualJoystick(&desc);
+    SDLTest_AssertCheck(device_id > 0, "SDL_AttachVirtualJoystick() -> %" SDL_PRIs32 " (expected > 0)", device_id);
+
+    gamepad = SDL_OpenGamepad(device_id);
+    SDLTest_AssertCheck(gamepad != NULL, "SDL_OpenGamepad() succeeded");
+    if (gamepad) {
+        joystick = SDL_GetGamepadJoystick(gamepad);
+
+        SDLTest_AssertCheck(!SDL_GetGamepadState(gamepad, NULL), "SDL_GetGamepadState(gamepad, NULL) fails");
+        SDLTest_AssertCheck(!SDL_GetGamepadState(NULL, &state), "SDL_GetGamepadState(NULL, state) fails");
+
+        SDL_SetGamepadSensorEnabled(gamepad, SDL_SENSOR_GYRO, true);
+        SDL_SetJoystickVirtualButton(joystick, SDL_GAMEPAD_BUTTON_SOUTH, true);
+        SDL_SetJoystickVirtualAxis(joystick, SDL_GAMEPAD_AXIS_LEFTX, 1000);
+        SDL_SetJoystickVirtualTouchpad(joystick, 0, 1, true, 0.25f, 0.75f, 0.5f);
+        SDL_SendJoystickVirtualSensorData(joystick, SDL_SENSOR_GYRO, 1, gyro, SDL_arraysize(gyro));
+
+        /* The snapshot is only taken when the joysticks are updated */
+        SDLTest_AssertCheck(SDL_GetGamepadState(gamepad, &state), "SDL_GetGamepadState()");
+        SDLTest_AssertCheck(!state.buttons[SDL_GAMEPAD_BUTTON_SOUTH], "state.buttons[SDL_GAMEPAD_BUTTON_SOUTH] == false before update");
+
+        SDL_UpdateJoysticks();
+        SDLTest_AssertCheck(SDL_GetGamepadState(gamepad, &state), "SDL_GetGamepadState()");
+        SDLTest_AssertCheck(state.timestamp != 0, "state.timestamp != 0");
+        SDLTest_AssertCheck(state.buttons[SDL_GAMEPAD_BUTTON_SOUTH], "state.buttons[SDL_GAMEPAD_BUTTON_SOUTH] == true");
+        SDLTest_AssertCheck(!state.buttons[SDL_GAMEPAD_BUTTON_EAST], "state.buttons[SDL_GAMEPAD_BUTTON_EAST] == false");
+        SDLTest_AssertCheck(state.axes[SDL_GAMEPAD_AXIS_LEFTX] == SDL_GetGamepadAxis(gamepad, SDL_GAMEPAD_AXIS_LEFTX),
+                            "state.axes[SDL_GAMEPAD_AXIS_LEFTX] -> %d (expected %d)", state.axes[SDL_GAMEPAD_AXIS_LEFTX], SDL_GetGamepadAxis(gamepad, SDL_GAMEPAD_AXIS_LEFTX));
+        SDLTest_AssertCheck(state.num_touchpads == 1 && state.num_fingers[0] == 2, "state has 1 touchpad with 2 fingers -> %d, %d", state.num_touchpads, state.num_fingers[0]);
+        SDLTest_AssertCheck(!state.fingers[0][0].down && state.fingers[0][1].down &&
+                            state.fingers[0][1].x == 0.25f && state.fingers[0][1].y == 0.75f && state.fingers[0][1].pressure == 0.5f,
+                            "state.fingers[0][1] is down at 0.25, 0.75 with pressure 0.5");
+        SDLTest_AssertCheck(state.num_sensors == 1 && state.sensors[0].type == SDL_SENSOR_GYRO && state.sensors[0].enabled,
+                            "state has an enabled gyro sensor");
+        SDLTest_AssertCheck(state.sensors[0].data[0] == 1.0f && state.sensors[0].data[1] == 2.0f && state.sensors[0].data[2] == 3.0f,
+                            "state.sensors[0].data -> %g, %g, %g (expected 1, 2, 3)", state.sensors[0].data[0], state.sensors[0].data[1], state.sensors[0].data[2]);
+
+        /* Readers on another thread must never see a half written snapshot */
+        SDL_SetJoystickVirtualAxis(joystick, SDL_GAMEPAD_AXIS_LEFTX, 0);
+        SDL_SetJoystickVirtualAxis(joystick, SDL_GAMEPAD_AXIS_LEFTY, 0);
+        SDL_UpdateJoysticks();
+        thread = SDL_CreateThread(GamepadStateReader, "GamepadStateReader", gamepad);
+        SDLTest_AssertCheck(thread != NULL, "SDL_CreateThread()");
+        for (i = 0; i < 1000; ++i) {
+            const Sint16 value = (Sint16)((i % 2) ? i * 16 : -i * 16);
+            SDL_SetJoystickVirtualAxis(joystick, SDL_GAMEPAD_AXIS_LEFTX, value);
+            SDL_SetJoystickVirtualAxis(joystick, SDL_GAMEPAD_AXIS_LEFTY, value);
+            SDL_UpdateJoysticks();
+        }
+        SDL_WaitThread(thread, &mismatches);
+        SDLTest_AssertCheck(mismatches == 0, "Concurrent SDL_GetGamepadState() mismatches -> %d (expected 0)", mismatches);
+
+        SDL_CloseGamepad(gamepad);
+    }
+
+    SDLTest_AssertCheck(SDL_DetachVirtualJoystick(device_id), "SDL_DetachVirtualJoystick()");
+
+    SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Joystick routine test cases */
@@ -206,9 +382,19 @@ static const SDLTest_TestCaseReference joystickTest1 = {
     TestVirtualJoystick, "TestVirtualJoystick", "Test virtual joystick functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference joystickTest2 = {
+    TestGamepadMappingLookup, "TestGamepadMappingLookup", "Test gamepad mapping lookups by GUID", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference joystickTest3 = {
+    TestGamepadState, "TestGamepadState", "Test gamepad state snapshots", TEST_ENABLED
+};
+
 /* Sequence of Joystick routine test cases */
 static const SDLTest_TestCaseReference *joystickTests[] = {
     &joystickTest1,
+    &joystickTest2,
+    &joystickTest3,
     NULL
 };
 
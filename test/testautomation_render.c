@@ -1323,6 +1323,213 @@ static int SDLCALL render_testRGBSurfaceNoAlpha(void* arg)
     return TEST_COMPLETED;
 }
 
+static void drawSoftwareThreadsScene(SDL_Renderer *software_renderer, SDL_Texture *face)
+{
+    SDL_FRect rect;
+    SDL_FPoint points[64];
+    SDL_Vertex verts[3];
+    SDL_Rect viewport;
+    SDL_Rect cliprect;
+    int i;
+
+    SDL_SetRenderDrawColor(software_renderer, 0x20, 0x40, 0x60, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(software_renderer);
+
+    /* Fills and copies straddling the band edges, some of them partly off the target */
+    for (i = 0; i < 16; i++) {
+        rect.x = (float)(i * 23 - 20);
+        rect.y = (float)(i * 17 - 10);
+        rect.w = 60.0f;
+        rect.h = 45.0f;
+        SDL_SetRenderDrawBlendMode(software_renderer, (i % 2) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(software_renderer, (Uint8)(i * 16), 0xff, (Uint8)(255 - i * 16), 0x80);
+        SDL_RenderFillRect(software_renderer, &rect);
+
+        rect.x += 10.0f;
+        rect.w = (float)face->w;
+        rect.h = (float)face->h;
+        SDL_SetTextureColorMod(face, 0xff, (Uint8)(i * 16), 0xff);
+        SDL_SetTextureAlphaMod(face, (Uint8)(255 - i * 8));
+        SDL_SetTextureBlendMode(face, (i % 3) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_ADD);
+        SDL_RenderTexture(software_renderer, face, NULL, &rect);
+    }
+
+    for (i = 0; i < SDL_arraysize(points); i++) {
+        points[i].x = (float)(i * 5);
+        points[i].y = (float)(i * 3 + 7);
+    }
+    SDL_SetRenderDrawBlendMode(software_renderer, SDL_BLENDMODE_ADD);
+    SDL_SetRenderDrawColor(software_renderer, 0x80, 0x10, 0x10, 0x80);
+    SDL_RenderPoints(software_renderer, points, SDL_arraysize(points));
+
+    /* Drawing that isn't split into bands, in between the drawing that is */
+    SDL_RenderLines(software_renderer, points, SDL_arraysize(points));
+    rect.x = 100.0f;
+    rect.y = 50.0f;
+    rect.w = face->w * 1.5f;
+    rect.h = face->h * 2.5f;
+    SDL_RenderTexture(software_renderer, face, NULL, &rect);
+    SDL_RenderTextureRotated(software_renderer, face, NULL, &rect, 30.0, NULL, SDL_FLIP_HORIZONTAL);
+    SDL_zeroa(verts);
+    verts[0].position.x = 10.0f;
+    verts[0].position.y = 200.0f;
+    verts[1].position.x = 300.0f;
+    verts[1].position.y = 20.0f;
+    verts[2].position.x = 250.0f;
+    verts[2].position.y = 230.0f;
+    for (i = 0; i < 3; i++) {
+        verts[i].color.r = 1.0f;
+        verts[i].color.g = 0.5f;
+        verts[i].color.b = i * 0.5f;
+        verts[i].color.a = 0.5f;
+    }
+    SDL_RenderGeometry(software_renderer, NULL, verts, 3, NULL, 0);
+
+    /* A viewport and clip rectangle that cross several bands */
+    viewport.x = 40;
+    viewport.y = 30;
+    viewport.w = 200;
+    viewport.h = 150;
+    SDL_SetRenderViewport(software_renderer, &viewport);
+    cliprect.x = 10;
+    cliprect.y = 20;
+    cliprect.w = 150;
+    cliprect.h = 100;
+    SDL_SetRenderClipRect(software_renderer, &cliprect);
+    SDL_SetRenderDrawBlendMode(software_renderer, SDL_BLENDMODE_MOD);
+    SDL_SetRenderDrawColor(software_renderer, 0xff, 0x80, 0xff, SDL_ALPHA_OPAQUE);
+    rect.x = 0.0f;
+    rect.y = 0.0f;
+    rect.w = 200.0f;
+    rect.h = 150.0f;
+    SDL_RenderFillRect(software_renderer, &rect);
+    SDL_SetTextureBlendMode(face, SDL_BLENDMODE_BLEND);
+    rect.x = 50.0f;
+    rect.y = 60.0f;
+    rect.w = (float)face->w;
+    rect.h = (float)face->h;
+    SDL_RenderTexture(software_renderer, face, NULL, &rect);
+    SDL_SetRenderClipRect(software_renderer, NULL);
+    SDL_SetRenderViewport(software_renderer, NULL);
+
+    SDL_RenderPresent(software_renderer);
+}
+
+static SDL_Surface *renderSoftwareThreadsScene(const char *threads)
+{
+    SDL_Surface *surface;
+    SDL_Surface *image;
+    SDL_Renderer *software_renderer;
+    SDL_Texture *face;
+
+    surface = SDL_CreateSurface(320, 240, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify SDL_CreateSurface() result");
+    if (!surface) {
+        return NULL;
+    }
+
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, threads);
+    software_renderer = SDL_CreateSoftwareRenderer(surface);
+    SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    SDLTest_AssertCheck(software_renderer != NULL, "Verify SDL_CreateSoftwareRenderer() result with %s threads", threads);
+    if (!software_renderer) {
+        SDL_DestroySurface(surface);
+        return NULL;
+    }
+
+    image = SDLTest_ImageFace();
+    face = SDL_CreateTextureFromSurface(software_renderer, image);
+    SDL_DestroySurface(image);
+    SDLTest_AssertCheck(face != NULL, "Verify SDL_CreateTextureFromSurface() result");
+    if (face) {
+        /* Draw twice so the second frame reuses the per band state */
+        drawSoftwareThreadsScene(software_renderer, face);
+        drawSoftwareThreadsScene(software_renderer, face);
+        SDL_DestroyTexture(face);
+    }
+    SDL_DestroyRenderer(software_renderer);
+    return surface;
+}
+
+/**
+ * Tests that the software renderer draws the same image on several threads
+ *
+ * \sa SDL_HINT_RENDER_SOFTWARE_THREADS
+ */
+static int SDLCALL render_testSoftwareThreads(void *arg)
+{
+    SDL_Surface *reference;
+    SDL_Surface *threaded;
+    int ret;
+
+    reference = renderSoftwareThreadsScene("1");
+    threaded = renderSoftwareThreadsScene("4");
+    if (reference && threaded) {
+        ret = SDLTest_CompareSurfaces(threaded, reference, 0);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+    }
+    SDL_DestroySurface(reference);
+    SDL_DestroySurface(threaded);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that consecutive copies with the same state are merged into one command
+ *
+ * \sa SDL_PROP_RENDERER_COMMANDS_NUMBER
+ * \sa SDL_PROP_RENDERER_MERGED_COMMANDS_NUMBER
+ */
+static int SDLCALL render_testCommandMerging(void *arg)
+{
+    SDL_PropertiesID props = SDL_GetRendererProperties(renderer);
+    SDL_Texture *tface;
+    SDL_FRect rect;
+    Sint64 commands, merged, vertex_bytes;
+    int i;
+
+    tface = loadTestFace();
+    SDLTest_AssertCheck(tface != NULL, "Verify loadTestFace() result");
+    if (!tface) {
+        return TEST_ABORTED;
+    }
+
+    SDL_FlushRenderer(renderer);
+    commands = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_COMMANDS_NUMBER, 0);
+    merged = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_MERGED_COMMANDS_NUMBER, 0);
+    vertex_bytes = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_VERTEX_BYTES_NUMBER, 0);
+
+    /* Copies with the same texture and state are appended to one command */
+    rect.w = (float)tface->w;
+    rect.h = (float)tface->h;
+    for (i = 0; i < 100; i++) {
+        rect.x = (float)(i % 10) * 4.0f;
+        rect.y = (float)(i / 10) * 4.0f;
+        SDL_RenderTexture(renderer, tface, NULL, &rect);
+    }
+    SDL_FlushRenderer(renderer);
+
+    merged = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_MERGED_COMMANDS_NUMBER, 0) - merged;
+    commands = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_COMMANDS_NUMBER, 0) - commands;
+    vertex_bytes = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_VERTEX_BYTES_NUMBER, 0) - vertex_bytes;
+    SDLTest_AssertCheck(merged == 99, "Check merged copies, expected: 99, got: %" SDL_PRIs64, merged);
+    SDLTest_AssertCheck(commands > 0 && commands < 10, "Check commands issued, expected: less than 10, got: %" SDL_PRIs64, commands);
+    SDLTest_AssertCheck(vertex_bytes > 0, "Check vertex data was queued, got: %" SDL_PRIs64, vertex_bytes);
+
+    /* Changing the texture color between copies stops them from being merged */
+    merged = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_MERGED_COMMANDS_NUMBER, 0);
+    for (i = 0; i < 10; i++) {
+        SDL_SetTextureColorMod(tface, (i % 2) ? 0xff : 0x80, 0xff, 0xff);
+        SDL_RenderTexture(renderer, tface, NULL, &rect);
+    }
+    SDL_FlushRenderer(renderer);
+    merged = SDL_GetNumberProperty(props, SDL_PROP_RENDERER_MERGED_COMMANDS_NUMBER, 0) - merged;
+    SDLTest_AssertCheck(merged == 0, "Check copies with different colors aren't merged, got: %" SDL_PRIs64, merged);
+
+    SDL_DestroyTexture(tface);
+    return TEST_COMPLETED;
+}
+
 /**
  * Test clip rect
  */
@@ -2051,6 +2258,14 @@ static const SDLTest_TestCaseReference renderTestRGBSurfaceNoAlpha = {
     render_testRGBSurfaceNoAlpha, "render_testRGBSurfaceNoAlpha", "Tests RGB surface with no alpha using software renderer", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTestCommandMerging = {
+    render_testCommandMerging, "render_testCommandMerging", "Tests merging copies with the same render state", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTestSoftwareThreads = {
+    render_testSoftwareThreads, "render_testSoftwareThreads", "Tests software rendering on several threads matches a single thread", TEST_ENABLED
+};
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestGetNumRenderDrivers,
@@ -2069,6 +2284,8 @@ static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestTextureState,
     &renderTestGetSetTextureScaleMode,
     &renderTestRGBSurfaceNoAlpha,
+    &renderTestSoftwareThreads,
+    &renderTestCommandMerging,
     NULL
 };
 
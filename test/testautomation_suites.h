@@ -13,7 +13,9 @@
 #define ISNAN(X)    isnan((float)(X))
 
 /* Test collections */
+extern SDLTest_TestSuiteReference asyncioTestSuite;
 extern SDLTest_TestSuiteReference audioTestSuite;
+extern SDLTest_TestSuiteReference cameraTestSuite;
 extern SDLTest_TestSuiteReference clipboardTestSuite;
 extern SDLTest_TestSuiteReference eventsTestSuite;
 extern SDLTest_TestSuiteReference guidTestSuite;
@@ -1586,6 +1586,204 @@ static int SDLCALL surface_testScale(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Returns the size of the pixels of the formats used by surface_testConvertThreads() */
+static size_t GetPixelsSize(SDL_Surface *surface)
+{
+    size_t size = (size_t)surface->pitch * surface->h;
+
+    if (surface->format == SDL_PIXELFORMAT_NV12) {
+        /* The interleaved chroma plane follows the luma plane */
+        size += (size_t)((surface->pitch + 1) & ~1) * ((surface->h + 1) / 2);
+    }
+    return size;
+}
+
+/**
+ * Tests that converting on several threads gives the same result as on one thread.
+ */
+static int SDLCALL surface_testConvertThreads(void *arg)
+{
+    const struct
+    {
+        SDL_PixelFormat src_format;
+        SDL_PixelFormat dst_format;
+    } conversions[] = {
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 },
+        { SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_XRGB8888 },
+        { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_RGBA8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_NV12 },
+    };
+    /* Odd sizes, so the last band is shorter than the others */
+    const int w = 1023, h = 511;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(conversions); ++i) {
+        const SDL_PixelFormat src_format = conversions[i].src_format;
+        const SDL_PixelFormat dst_format = conversions[i].dst_format;
+        SDL_Surface *src, *expected, *actual;
+        Uint64 seed = 1;
+        size_t j;
+        int ret;
+
+        src = SDL_CreateSurface(w, h, src_format);
+        SDLTest_AssertCheck(src != NULL, "SDL_CreateSurface(%s)", SDL_GetPixelFormatName(src_format));
+        if (!src) {
+            continue;
+        }
+        if (SDL_ISPIXELFORMAT_INDEXED(src_format)) {
+            SDL_Palette *palette = SDL_CreateSurfacePalette(src);
+            SDLTest_AssertCheck(palette != NULL, "SDL_CreateSurfacePalette()");
+            if (palette) {
+                for (j = 0; j < (size_t)palette->ncolors; ++j) {
+                    SDL_Color color;
+                    color.r = (Uint8)SDL_rand_bits_r(&seed);
+                    color.g = (Uint8)SDL_rand_bits_r(&seed);
+                    color.b = (Uint8)SDL_rand_bits_r(&seed);
+                    color.a = (Uint8)SDL_rand_bits_r(&seed);
+                    SDL_SetPaletteColors(palette, &color, (int)j, 1);
+                }
+            }
+        }
+        for (j = 0; j < GetPixelsSize(src); ++j) {
+            ((Uint8 *)src->pixels)[j] = (Uint8)SDL_rand_bits_r(&seed);
+        }
+
+        SDL_SetHint(SDL_HINT_SURFACE_CONVERT_THREADS, "1");
+        expected = SDL_ConvertSurface(src, dst_format);
+        SDLTest_AssertCheck(expected != NULL, "SDL_ConvertSurface(%s -> %s) on 1 thread", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format));
+
+        SDL_SetHint(SDL_HINT_SURFACE_CONVERT_THREADS, "4");
+        actual = SDL_ConvertSurface(src, dst_format);
+        SDL_ResetHint(SDL_HINT_SURFACE_CONVERT_THREADS);
+        SDLTest_AssertCheck(actual != NULL, "SDL_ConvertSurface(%s -> %s) on 4 threads", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format));
+
+        if (expected && actual) {
+            ret = SDL_memcmp(expected->pixels, actual->pixels, GetPixelsSize(expected));
+            SDLTest_AssertCheck(ret == 0, "Check %s -> %s is the same on 1 and 4 threads", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format));
+        }
+
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(expected);
+        SDL_DestroySurface(actual);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests that the SIMD RGB to YUV conversions give the same result as the scalar ones.
+ */
+static int SDLCALL surface_testConvertRGBToYUV(void *arg)
+{
+    const SDL_PixelFormat formats[] = {
+        SDL_PIXELFORMAT_YV12,
+        SDL_PIXELFORMAT_IYUV,
+        SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_NV21,
+        SDL_PIXELFORMAT_YUY2,
+        SDL_PIXELFORMAT_UYVY,
+        SDL_PIXELFORMAT_YVYU,
+        SDL_PIXELFORMAT_P010,
+    };
+    const SDL_Colorspace colorspaces[] = {
+        SDL_COLORSPACE_JPEG,
+        SDL_COLORSPACE_BT601_LIMITED,
+        SDL_COLORSPACE_BT709_FULL,
+        SDL_COLORSPACE_BT709_LIMITED,
+        SDL_COLORSPACE_BT2020_FULL,
+    };
+    /* Sizes smaller than, and not a multiple of, the SIMD width */
+    const int sizes[][2] = { { 1, 1 }, { 3, 3 }, { 67, 33 }, { 130, 7 } };
+    const int max_w = 130, max_h = 33;
+    const size_t src_size = (size_t)max_w * max_h * 4;
+    const size_t dst_size = (size_t)max_w * max_h * 4;
+    Uint8 *src = (Uint8 *)SDL_malloc(src_size);
+    Uint8 *expected = (Uint8 *)SDL_malloc(dst_size);
+    Uint8 *actual = (Uint8 *)SDL_malloc(dst_size);
+    Uint64 seed = 1;
+    size_t j;
+    int f, c, s;
+
+    SDLTest_AssertCheck(src && expected && actual, "Allocate the pixel buffers");
+    if (!src || !expected || !actual) {
+        SDL_free(src);
+        SDL_free(expected);
+        SDL_free(actual);
+        return TEST_ABORTED;
+    }
+    for (j = 0; j < src_size; ++j) {
+        src[j] = (Uint8)SDL_rand_bits_r(&seed);
+    }
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        const SDL_PixelFormat dst_format = formats[f];
+
+        for (c = 0; c < SDL_arraysize(colorspaces); ++c) {
+            const SDL_Colorspace dst_colorspace = colorspaces[c];
+            SDL_PixelFormat src_format;
+            SDL_Colorspace src_colorspace;
+
+            if (dst_format == SDL_PIXELFORMAT_P010) {
+                if (dst_colorspace != SDL_COLORSPACE_BT2020_FULL) {
+                    continue;
+                }
+                src_format = SDL_PIXELFORMAT_XBGR2101010;
+                src_colorspace = SDL_COLORSPACE_HDR10;
+            } else {
+                /* Use the same primaries, so the pixels go straight to the YUV conversion */
+                src_format = SDL_PIXELFORMAT_XRGB8888;
+                src_colorspace = SDL_DEFINE_COLORSPACE(SDL_COLOR_TYPE_RGB, SDL_COLOR_RANGE_FULL, SDL_COLORSPACEPRIMARIES(dst_colorspace),
+                                                       SDL_TRANSFER_CHARACTERISTICS_SRGB, SDL_MATRIX_COEFFICIENTS_IDENTITY, SDL_CHROMA_LOCATION_NONE);
+            }
+
+            for (s = 0; s < SDL_arraysize(sizes); ++s) {
+                const int w = sizes[s][0];
+                const int h = sizes[s][1];
+                int dst_pitch, max_diff = 0;
+                bool result;
+
+                if (dst_format == SDL_PIXELFORMAT_P010) {
+                    dst_pitch = w * 2;
+                } else if (dst_format == SDL_PIXELFORMAT_YUY2 || dst_format == SDL_PIXELFORMAT_UYVY || dst_format == SDL_PIXELFORMAT_YVYU) {
+                    dst_pitch = ((w + 1) / 2) * 4;
+                } else {
+                    dst_pitch = w;
+                }
+
+                SDL_memset(expected, 0, dst_size);
+                SDL_SetHint(SDL_HINT_BLIT_CPU_TIER, "scalar");
+                result = SDL_ConvertPixelsAndColorspace(w, h, src_format, src_colorspace, 0, src, w * 4, dst_format, dst_colorspace, 0, expected, dst_pitch);
+                SDLTest_AssertCheck(result, "SDL_ConvertPixelsAndColorspace(%s -> %s) %dx%d with scalar code", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format), w, h);
+
+                SDL_memset(actual, 0, dst_size);
+                SDL_ResetHint(SDL_HINT_BLIT_CPU_TIER);
+                result = SDL_ConvertPixelsAndColorspace(w, h, src_format, src_colorspace, 0, src, w * 4, dst_format, dst_colorspace, 0, actual, dst_pitch);
+                SDLTest_AssertCheck(result, "SDL_ConvertPixelsAndColorspace(%s -> %s) %dx%d with SIMD code", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format), w, h);
+
+                /* Fused multiply-add may round differently on some CPUs, allow one step of difference */
+                if (dst_format == SDL_PIXELFORMAT_P010) {
+                    for (j = 0; j < dst_size / 2; ++j) {
+                        max_diff = SDL_max(max_diff, SDL_abs(((Uint16 *)expected)[j] - ((Uint16 *)actual)[j]) >> 6);
+                    }
+                } else {
+                    for (j = 0; j < dst_size; ++j) {
+                        max_diff = SDL_max(max_diff, SDL_abs(expected[j] - actual[j]));
+                    }
+                }
+                SDLTest_AssertCheck(max_diff <= 1, "Check %s -> %s %dx%d in colorspace %d, expected difference <= 1, got %d", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format), w, h, c, max_diff);
+            }
+        }
+    }
+
+    SDL_free(src);
+    SDL_free(expected);
+    SDL_free(actual);
+
+    return TEST_COMPLETED;
+}
 
 /* ================= Test References ================== */
 
@@ -1694,6 +1892,14 @@ static const SDLTest_TestCaseReference surfaceTestScale = {
     surface_testScale, "surface_testScale", "Test scaling operations.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestConvertThreads = {
+    surface_testConvertThreads, "surface_testConvertThreads", "Test converting on several threads.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestConvertRGBToYUV = {
+    surface_testConvertRGBToYUV, "surface_testConvertRGBToYUV", "Test the SIMD RGB to YUV conversions.", TEST_ENABLED
+};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestInvalidFormat,
@@ -1722,6 +1928,8 @@ static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestClearSurface,
     &surfaceTestPremultiplyAlpha,
     &surfaceTestScale,
+    &surfaceTestConvertThreads,
+    &surfaceTestConvertRGBToYUV,
     NULL
 };
 
@@ -174,6 +174,184 @@ static int SDLCALL timer_addRemoveTimer(void *arg)
 #endif
 }
 
+#define NUM_MANY_TIMERS 1000
+
+static SDL_AtomicInt g_manyTimersFired;
+static int g_manyTimersOrder[NUM_MANY_TIMERS];
+static int g_manyTimersCalls[NUM_MANY_TIMERS];
+
+static Uint32 SDLCALL timerManyCallback(void *param, SDL_TimerID timerID, Uint32 interval)
+{
+    const int index = (int)(intptr_t)param;
+
+    g_manyTimersOrder[SDL_AddAtomicInt(&g_manyTimersFired, 1)] = index;
+    ++g_manyTimersCalls[index];
+    return 0;
+}
+
+/**
+ * Adds lots of timers, removes some of them, and checks that the rest fire once each, in order.
+ *
+ * \sa SDL_AddTimer
+ * \sa SDL_RemoveTimer
+ */
+static int SDLCALL timer_addRemoveManyTimers(void *arg)
+{
+#ifdef SDL_PLATFORM_EMSCRIPTEN
+    SDLTest_Log("Timer callbacks on Emscripten require a main loop to handle events");
+    return TEST_SKIPPED;
+#else
+    SDL_TimerID ids[NUM_MANY_TIMERS];
+    int expected = 0;
+    int removed = 0;
+    int out_of_order = 0;
+    int bad_calls = 0;
+    int fired;
+    int i;
+
+    SDL_SetAtomicInt(&g_manyTimersFired, 0);
+    SDL_zeroa(g_manyTimersOrder);
+    SDL_zeroa(g_manyTimersCalls);
+
+    /* Timers are added with non-decreasing intervals, so they should fire in the order they were added */
+    for (i = 0; i < NUM_MANY_TIMERS; ++i) {
+        ids[i] = SDL_AddTimer(200 + (i / 100), timerManyCallback, (void *)(intptr_t)i);
+        if (!ids[i]) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(i == NUM_MANY_TIMERS, "Check all timers were added, expected: %d, got: %d", NUM_MANY_TIMERS, i);
+
+    /* Remove every third timer */
+    for (i = 0; i < NUM_MANY_TIMERS; i += 3) {
+        if (SDL_RemoveTimer(ids[i])) {
+            ++removed;
+        }
+    }
+    SDLTest_AssertPass("Call to SDL_RemoveTimer() on every third timer");
+    SDLTest_AssertCheck(removed == (NUM_MANY_TIMERS + 2) / 3, "Check removed timers, expected: %d, got: %d", (NUM_MANY_TIMERS + 2) / 3, removed);
+    expected = NUM_MANY_TIMERS - removed;
+
+    for (i = 0; i < 100 && SDL_GetAtomicInt(&g_manyTimersFired) < expected; ++i) {
+        SDL_Delay(20);
+    }
+    SDL_Delay(50);
+    fired = SDL_GetAtomicInt(&g_manyTimersFired);
+    SDLTest_AssertCheck(fired == expected, "Check number of callbacks, expected: %d, got: %d", expected, fired);
+
+    for (i = 0; i < NUM_MANY_TIMERS; ++i) {
+        if (g_manyTimersCalls[i] != ((i % 3) ? 1 : 0)) {
+            ++bad_calls;
+        }
+    }
+    SDLTest_AssertCheck(bad_calls == 0, "Check each remaining timer fired once and no removed timer fired, got %d mismatches", bad_calls);
+
+    for (i = 1; i < fired && i < NUM_MANY_TIMERS; ++i) {
+        if (g_manyTimersOrder[i] < g_manyTimersOrder[i - 1]) {
+            ++out_of_order;
+        }
+    }
+    SDLTest_AssertCheck(out_of_order == 0, "Check timers fired in order, expected: 0 out of order, got: %d", out_of_order);
+
+    return TEST_COMPLETED;
+#endif
+}
+
+#define NUM_SLACK_TIMERS 20
+
+static Uint64 g_slackDeadlines[NUM_SLACK_TIMERS];
+static Uint64 g_slackFired[NUM_SLACK_TIMERS];
+static SDL_AtomicInt g_slackTimersFired;
+
+static Uint64 SDLCALL timerSlackCallback(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    const int index = (int)(intptr_t)param;
+
+    g_slackFired[index] = SDL_GetTicksNS();
+    SDL_AddAtomicInt(&g_slackTimersFired, 1);
+    return 0;
+}
+
+static Uint32 SDLCALL timerStatsCallback(void *param, SDL_TimerID timerID, Uint32 interval)
+{
+    return 0;
+}
+
+/**
+ * Checks that timers given slack fire together, and never early.
+ *
+ * \sa SDL_GetTimerProperties
+ */
+static int SDLCALL timer_slack(void *arg)
+{
+#ifdef SDL_PLATFORM_EMSCRIPTEN
+    SDLTest_Log("Timer callbacks on Emscripten require a main loop to handle events");
+    return TEST_SKIPPED;
+#else
+    SDL_PropertiesID props = SDL_GetTimerProperties();
+    Sint64 callbacks;
+    Uint64 fired[NUM_SLACK_TIMERS];
+    int early = 0;
+    int wakeups = 0;
+    int i, j;
+
+    SDLTest_AssertCheck(props != 0, "Check SDL_GetTimerProperties(), expected: !=0, got: %" SDL_PRIu32, props);
+    SDL_SetNumberProperty(props, SDL_PROP_TIMER_SLACK_NS_NUMBER, 100 * SDL_NS_PER_MS);
+
+    /* The stats are only published once a second, so this may be a little behind */
+    callbacks = SDL_GetNumberProperty(props, SDL_PROP_TIMER_CALLBACKS_NUMBER, 0);
+
+    SDL_SetAtomicInt(&g_slackTimersFired, 0);
+    for (i = 0; i < NUM_SLACK_TIMERS; ++i) {
+        const Uint64 interval = (20 + i) * SDL_NS_PER_MS;
+        g_slackDeadlines[i] = SDL_GetTicksNS() + interval;
+        g_slackFired[i] = 0;
+        SDL_AddTimerNS(interval, timerSlackCallback, (void *)(intptr_t)i);
+    }
+
+    for (i = 0; i < 100 && SDL_GetAtomicInt(&g_slackTimersFired) < NUM_SLACK_TIMERS; ++i) {
+        SDL_Delay(10);
+    }
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_slackTimersFired) == NUM_SLACK_TIMERS, "Check all timers fired, expected: %d, got: %d", NUM_SLACK_TIMERS, SDL_GetAtomicInt(&g_slackTimersFired));
+
+    for (i = 0; i < NUM_SLACK_TIMERS; ++i) {
+        if (g_slackFired[i] < g_slackDeadlines[i]) {
+            ++early;
+        }
+    }
+    SDLTest_AssertCheck(early == 0, "Check no timer fired early, expected: 0, got: %d", early);
+
+    /* Timers that fired in the same wakeup ran back to back, so count the gaps between them */
+    SDL_memcpy(fired, g_slackFired, sizeof(fired));
+    for (i = 1; i < NUM_SLACK_TIMERS; ++i) {
+        const Uint64 value = fired[i];
+        for (j = i; j > 0 && fired[j - 1] > value; --j) {
+            fired[j] = fired[j - 1];
+        }
+        fired[j] = value;
+    }
+    for (i = 0; i < NUM_SLACK_TIMERS; ++i) {
+        if (i == 0 || (fired[i] - fired[i - 1]) > (SDL_NS_PER_MS / 2)) {
+            ++wakeups;
+        }
+    }
+    SDLTest_AssertCheck(wakeups < NUM_SLACK_TIMERS / 2, "Check timers were coalesced, expected: <%d wakeups, got: %d", NUM_SLACK_TIMERS / 2, wakeups);
+
+    /* Keep the timer thread waking up until it publishes a new set of stats */
+    for (i = 0; i < 30 && (SDL_GetNumberProperty(props, SDL_PROP_TIMER_CALLBACKS_NUMBER, 0) - callbacks) < NUM_SLACK_TIMERS; ++i) {
+        SDL_AddTimer(100, timerStatsCallback, NULL);
+        SDL_Delay(110);
+    }
+    callbacks = SDL_GetNumberProperty(props, SDL_PROP_TIMER_CALLBACKS_NUMBER, 0) - callbacks;
+    SDLTest_AssertCheck(callbacks >= NUM_SLACK_TIMERS, "Check callback count, expected: >=%d, got: %" SDL_PRIs64, NUM_SLACK_TIMERS, callbacks);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_TIMER_WAKEUPS_NUMBER, 0) > 0, "Check wakeup count was published");
+
+    SDL_ClearProperty(props, SDL_PROP_TIMER_SLACK_NS_NUMBER);
+
+    return TEST_COMPLETED;
+#endif
+}
+
 /* ================= Test References ================== */
 
 /* Timer test cases */
@@ -193,9 +371,17 @@ static const SDLTest_TestCaseReference timerTest4 = {
     timer_addRemoveTimer, "timer_addRemoveTimer", "Call to SDL_AddTimer and SDL_RemoveTimer", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference timerTest5 = {
+    timer_addRemoveManyTimers, "timer_addRemoveManyTimers", "Add and remove many timers and check the order they fire in", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference timerTest6 = {
+    timer_slack, "timer_slack", "Check that timers with slack are fired together", TEST_ENABLED
+};
+
 /* Sequence of Timer test cases */
 static const SDLTest_TestCaseReference *timerTests[] = {
-    &timerTest1, &timerTest2, &timerTest3, &timerTest4, NULL
+    &timerTest1, &timerTest2, &timerTest3, &timerTest4, &timerTest5, &timerTest6, NULL
 };
 
 /* Timer test suite (global) */
@@ -0,0 +1,242 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Times every combination of format, color modulation, blend mode and
+   scaling covered by the generated blitters in SDL_blit_auto.c, and prints
+   a checksum of each result.
+
+   The checksums don't depend on the CPU features used, so running this
+   with each SDL_BLIT_CPU_TIER (scalar, sse2, sse4.1, avx2, neon, ...) and
+   comparing the output checks the SIMD blitters against the C ones, and
+   shows how fast each tier is on this machine. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static int surface_w = 640;
+static int surface_h = 480;
+static int num_iterations = 10;
+static const char *filter = NULL;
+
+static const SDL_PixelFormat src_formats[] = {
+    SDL_PIXELFORMAT_XRGB8888,
+    SDL_PIXELFORMAT_XBGR8888,
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_BGRA8888,
+};
+
+static const SDL_PixelFormat dst_formats[] = {
+    SDL_PIXELFORMAT_XRGB8888,
+    SDL_PIXELFORMAT_XBGR8888,
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_ABGR8888,
+};
+
+static const struct
+{
+    SDL_BlendMode mode;
+    const char *name;
+} blend_modes[] = {
+    { SDL_BLENDMODE_BLEND, "blend" },
+    { SDL_BLENDMODE_BLEND_PREMULTIPLIED, "blend_premultiplied" },
+    { SDL_BLENDMODE_ADD, "add" },
+    { SDL_BLENDMODE_ADD_PREMULTIPLIED, "add_premultiplied" },
+    { SDL_BLENDMODE_MOD, "mod" },
+    { SDL_BLENDMODE_MUL, "mul" },
+};
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--size WxH]", "[--iterations N]", "[--filter TEXT]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+/* Fills the surface with the same pixels every time, including alpha values
+   of 0 and 255 and the unused bytes of formats without alpha */
+static void FillSurface(SDL_Surface *surface, Uint64 seed)
+{
+    Uint32 *pixels = (Uint32 *)surface->pixels;
+    const int count = surface->pitch / 4 * surface->h;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        Uint32 pixel = SDL_rand_bits_r(&seed);
+        switch (i % 16) {
+        case 0:
+            pixel |= 0xFF000000;
+            break;
+        case 1:
+            pixel &= 0x00FFFFFF;
+            break;
+        default:
+            break;
+        }
+        pixels[i] = pixel;
+    }
+}
+
+/* Returns the number of pixels blitted per second, or a negative value on error */
+static double RunBlit(SDL_Surface *src, SDL_Surface *dst, bool scale, Uint32 *checksum)
+{
+    SDL_Rect dstrect = { 0, 0, dst->w, dst->h };
+    Uint64 start, elapsed;
+    int i;
+
+    /* The first blit starts from a known destination for the checksum */
+    FillSurface(dst, 2);
+    if (!(scale ? SDL_BlitSurfaceScaled(src, NULL, dst, &dstrect, SDL_SCALEMODE_NEAREST) : SDL_BlitSurface(src, NULL, dst, NULL))) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't blit: %s", SDL_GetError());
+        return -1.0;
+    }
+    *checksum = SDL_crc32(0, dst->pixels, (size_t)dst->pitch * dst->h);
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_iterations; ++i) {
+        if (scale) {
+            SDL_BlitSurfaceScaled(src, NULL, dst, &dstrect, SDL_SCALEMODE_NEAREST);
+        } else {
+            SDL_BlitSurface(src, NULL, dst, NULL);
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    return (double)dst->w * dst->h * num_iterations * SDL_NS_PER_SECOND / SDL_max(elapsed, 1);
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_Surface *dst = NULL;
+    int src_index, dst_index, modulate, blend, scale;
+    int num_blits = 0;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--size") == 0 && argv[i + 1]) {
+                char *x = SDL_strchr(argv[i + 1], 'x');
+                if (x) {
+                    surface_w = SDL_atoi(argv[i + 1]);
+                    surface_h = SDL_atoi(x + 1);
+                    consumed = 2;
+                }
+            } else if (SDL_strcasecmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                num_iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--filter") == 0 && argv[i + 1]) {
+                filter = argv[i + 1];
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || surface_w < 2 || surface_h < 2 || num_iterations <= 0) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("%dx%d pixels, %d iterations", surface_w, surface_h, num_iterations);
+
+    for (src_index = 0; src_index < SDL_arraysize(src_formats) && result == 0; ++src_index) {
+        for (dst_index = 0; dst_index < SDL_arraysize(dst_formats) && result == 0; ++dst_index) {
+            dst = SDL_CreateSurface(surface_w, surface_h, dst_formats[dst_index]);
+            if (!dst) {
+                result = 1;
+                break;
+            }
+
+            for (modulate = 0; modulate <= 1 && result == 0; ++modulate) {
+                for (blend = 0; blend <= 1 && result == 0; ++blend) {
+                    for (scale = 0; scale <= 1 && result == 0; ++scale) {
+                        const int num_modes = blend ? SDL_arraysize(blend_modes) : 1;
+                        SDL_Surface *src;
+                        int mode;
+
+                        if (!modulate && !blend && !scale) {
+                            continue;
+                        }
+
+                        /* Scaled blits stretch a smaller surface, with a width that isn't a multiple of the SIMD width */
+                        if (scale) {
+                            src = SDL_CreateSurface(surface_w / 2 + 3, surface_h / 2 + 1, src_formats[src_index]);
+                        } else {
+                            src = SDL_CreateSurface(surface_w, surface_h, src_formats[src_index]);
+                        }
+                        if (!src) {
+                            result = 1;
+                            break;
+                        }
+                        FillSurface(src, 1);
+                        if (modulate) {
+                            SDL_SetSurfaceColorMod(src, 200, 150, 100);
+                            SDL_SetSurfaceAlphaMod(src, 180);
+                        }
+
+                        for (mode = 0; mode < num_modes; ++mode) {
+                            char name[128];
+                            Uint32 checksum = 0;
+                            double rate;
+
+                            SDL_SetSurfaceBlendMode(src, blend ? blend_modes[mode].mode : SDL_BLENDMODE_NONE);
+
+                            SDL_snprintf(name, sizeof(name), "%s -> %s%s%s%s%s",
+                                         SDL_GetPixelFormatName(src_formats[src_index]) + 16,
+                                         SDL_GetPixelFormatName(dst_formats[dst_index]) + 16,
+                                         modulate ? " modulate" : "",
+                                         blend ? " " : "", blend ? blend_modes[mode].name : "",
+                                         scale ? " scale" : "");
+                            if (filter && !SDL_strstr(name, filter)) {
+                                continue;
+                            }
+
+                            rate = RunBlit(src, dst, scale != 0, &checksum);
+                            if (rate < 0.0) {
+                                result = 1;
+                                break;
+                            }
+                            SDL_Log("%-52s %8.1f Mpixels/s  checksum %.8" SDL_PRIx32, name, rate / 1000000.0, checksum);
+                            ++num_blits;
+                        }
+                        SDL_DestroySurface(src);
+                    }
+                }
+            }
+            SDL_DestroySurface(dst);
+        }
+    }
+
+    SDL_Log("%d blit combinations", num_blits);
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
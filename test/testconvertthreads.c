@@ -0,0 +1,197 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Converts a large image between several pixel formats with 1, 2, 4, 8 and
+   16 threads, reports the time each conversion takes and checks that every
+   thread count produces the same pixels as a single thread. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static int image_w = 7680;
+static int image_h = 4320;
+static int num_iterations = 10;
+static int max_threads = 16;
+
+static const struct
+{
+    SDL_PixelFormat src_format;
+    SDL_PixelFormat dst_format;
+} conversions[] = {
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888 },
+    { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 },
+    { SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_RGBA8888 },
+    { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_XRGB8888 },
+    { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_ARGB8888 },
+};
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--size WxH]", "[--iterations N]", "[--threads N]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+/* Returns the number of bytes in the planes of an image */
+static size_t GetImageSize(SDL_PixelFormat format, int pitch, int h)
+{
+    size_t size = (size_t)pitch * h;
+
+    if (format == SDL_PIXELFORMAT_NV12) {
+        /* The interleaved chroma plane follows the luma plane */
+        size += (size_t)((pitch + 1) & ~1) * ((h + 1) / 2);
+    }
+    return size;
+}
+
+static int GetImagePitch(SDL_PixelFormat format, int w)
+{
+    if (format == SDL_PIXELFORMAT_NV12) {
+        return w;
+    } else if (format == SDL_PIXELFORMAT_YUY2) {
+        return ((w + 1) / 2) * 4;
+    }
+    return w * SDL_BYTESPERPIXEL(format);
+}
+
+/* Returns the average time of a conversion in milliseconds, or a negative value on error */
+static double RunConversion(int threads, SDL_PixelFormat src_format, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch)
+{
+    char hint[32];
+    Uint64 start, elapsed;
+    int i;
+
+    SDL_snprintf(hint, sizeof(hint), "%d", threads);
+    SDL_SetHint(SDL_HINT_SURFACE_CONVERT_THREADS, hint);
+
+    /* The first conversion starts the threads, only the rest are timed */
+    if (!SDL_ConvertPixels(image_w, image_h, src_format, src, src_pitch, dst_format, dst, dst_pitch)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert pixels: %s", SDL_GetError());
+        return -1.0;
+    }
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_iterations; ++i) {
+        SDL_ConvertPixels(image_w, image_h, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    SDL_ResetHint(SDL_HINT_SURFACE_CONVERT_THREADS);
+
+    return (double)elapsed / SDL_NS_PER_MS / num_iterations;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--size") == 0 && argv[i + 1]) {
+                char *x = SDL_strchr(argv[i + 1], 'x');
+                if (x) {
+                    image_w = SDL_atoi(argv[i + 1]);
+                    image_h = SDL_atoi(x + 1);
+                    consumed = 2;
+                }
+            } else if (SDL_strcasecmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                num_iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || image_w < 2 || image_h < 2 || num_iterations <= 0 || max_threads <= 0) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("%dx%d pixels, %d iterations, %d logical CPU cores", image_w, image_h, num_iterations, SDL_GetNumLogicalCPUCores());
+
+    for (i = 0; i < SDL_arraysize(conversions) && result == 0; ++i) {
+        const SDL_PixelFormat src_format = conversions[i].src_format;
+        const SDL_PixelFormat dst_format = conversions[i].dst_format;
+        const int src_pitch = GetImagePitch(src_format, image_w);
+        const int dst_pitch = GetImagePitch(dst_format, image_w);
+        const size_t src_size = GetImageSize(src_format, src_pitch, image_h);
+        const size_t dst_size = GetImageSize(dst_format, dst_pitch, image_h);
+        Uint8 *src = (Uint8 *)SDL_malloc(src_size);
+        Uint8 *reference = (Uint8 *)SDL_malloc(dst_size);
+        Uint8 *dst = (Uint8 *)SDL_malloc(dst_size);
+        double serial_time = 0.0;
+        Uint64 seed = 1;
+        size_t j;
+        int threads;
+
+        if (!src || !reference || !dst) {
+            SDL_free(src);
+            SDL_free(reference);
+            SDL_free(dst);
+            result = 1;
+            break;
+        }
+        for (j = 0; j < src_size; ++j) {
+            src[j] = (Uint8)SDL_rand_bits_r(&seed);
+        }
+
+        SDL_Log("%s -> %s", SDL_GetPixelFormatName(src_format), SDL_GetPixelFormatName(dst_format));
+        for (threads = 1; threads <= max_threads; threads *= 2) {
+            Uint8 *target = (threads == 1) ? reference : dst;
+            const double time = RunConversion(threads, src_format, src, src_pitch, dst_format, target, dst_pitch);
+            bool identical = true;
+
+            if (time < 0.0) {
+                result = 1;
+                break;
+            }
+            if (threads == 1) {
+                serial_time = time;
+            } else {
+                identical = (SDL_memcmp(reference, dst, dst_size) == 0);
+                if (!identical) {
+                    result = 1;
+                }
+            }
+            SDL_Log("  %2d thread%s: %8.2f ms  %5.2fx%s", threads, (threads == 1) ? " " : "s", time, serial_time / SDL_max(time, 0.001),
+                    identical ? "" : " (output differs from 1 thread!)");
+        }
+
+        SDL_free(src);
+        SDL_free(reference);
+        SDL_free(dst);
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
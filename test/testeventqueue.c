@@ -0,0 +1,288 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures event queue throughput with several threads pushing events while
+   the main thread polls them, and checks that each thread's events arrive in
+   the order they were pushed. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_PRODUCERS       64
+#define LATENCY_SAMPLES     4096
+
+typedef struct Producer_State
+{
+    SDL_Thread *thread;
+    int index;
+    int num_events;
+    int retries;
+    Uint64 *push_times;
+    int num_push_times;
+} Producer_State;
+
+static Uint32 event_type;
+static SDL_AtomicInt go;
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--threads N]", "[--events N]", "[--batch]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+static int SDLCALL
+ProducerThread(void *data)
+{
+    Producer_State *state = (Producer_State *)data;
+    const int sample_every = SDL_max(state->num_events / LATENCY_SAMPLES, 1);
+    SDL_Event event;
+    int i;
+
+    while (!SDL_GetAtomicInt(&go)) {
+        SDL_CPUPauseInstruction();
+    }
+
+    SDL_zero(event);
+    event.type = event_type;
+    event.user.code = state->index;
+
+    for (i = 0; i < state->num_events; i++) {
+        const bool sample = ((i % sample_every) == 0 && state->num_push_times < LATENCY_SAMPLES);
+        Uint64 start = 0;
+
+        event.user.data1 = (void *)(intptr_t)i;
+        event.common.timestamp = 0;
+
+        if (sample) {
+            start = SDL_GetTicksNS();
+        }
+        while (!SDL_PushEvent(&event)) {
+            /* the queue is full, give the main thread a chance to catch up */
+            ++state->retries;
+            SDL_Delay(0);
+        }
+        if (sample) {
+            state->push_times[state->num_push_times++] = SDL_GetTicksNS() - start;
+        }
+    }
+    return 0;
+}
+
+static void
+CheckEvent(const SDL_Event *event, int *next_expected, int *received, int *out_of_order)
+{
+    if (event->type == event_type) {
+        const int index = event->user.code;
+        const int value = (int)(intptr_t)event->user.data1;
+        if (value != next_expected[index]) {
+            ++*out_of_order;
+        }
+        next_expected[index] = value + 1;
+        ++*received;
+    }
+}
+
+/* Time how long the main thread takes to empty a full queue, without anything else running */
+static int
+DrainQueue(bool batch)
+{
+    SDL_Event event;
+    int received = 0;
+    int i;
+
+    if (batch) {
+        int count = 0;
+        const SDL_Event *events = SDL_AcquireEvents(&count);
+        for (i = 0; i < count; i++) {
+            if (events[i].type == event_type) {
+                ++received;
+            }
+        }
+        SDL_ReleaseEvents(events);
+    } else {
+        while (SDL_PollEvent(&event)) {
+            if (event.type == event_type) {
+                ++received;
+            }
+        }
+    }
+    return received;
+}
+
+static void
+MeasureDrain(bool batch)
+{
+    const int num_events = 60000;
+    SDL_Event event;
+    Uint64 start, elapsed = 0;
+    int received = 0;
+    int round;
+    int i;
+
+    SDL_zero(event);
+    event.type = event_type;
+
+    /* The first round warms up any buffers, only the second one counts */
+    for (round = 0; round < 2; round++) {
+        for (i = 0; i < num_events; i++) {
+            event.common.timestamp = 0;
+            SDL_PushEvent(&event);
+        }
+
+        start = SDL_GetTicksNS();
+        received = DrainQueue(batch);
+        elapsed = SDL_GetTicksNS() - start;
+    }
+
+    SDL_Log("%s drained %d queued events at %.1f ns per event", batch ? "SDL_AcquireEvents" : "SDL_PollEvent", received, (double)elapsed / SDL_max(received, 1));
+}
+
+static int SDLCALL
+CompareTimes(const void *a, const void *b)
+{
+    const Uint64 lhs = *(const Uint64 *)a;
+    const Uint64 rhs = *(const Uint64 *)b;
+    return (lhs < rhs) ? -1 : (lhs > rhs) ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    Producer_State producers[MAX_PRODUCERS];
+    int next_expected[MAX_PRODUCERS];
+    int num_threads = 4;
+    int num_events = 250000;
+    bool batch = false;
+    Uint64 *push_times = NULL;
+    int num_push_times = 0;
+    int received = 0;
+    int total;
+    int out_of_order = 0;
+    int retries = 0;
+    Uint64 start, elapsed;
+    Uint64 consume_start, consume_time = 0;
+    SDL_Event event;
+    SDLTest_CommonState *state;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                num_threads = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--events") == 0 && argv[i + 1]) {
+                num_events = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--batch") == 0) {
+                batch = true;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0 || num_threads <= 0 || num_threads > MAX_PRODUCERS || num_events <= 0) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!SDL_Init(SDL_INIT_EVENTS)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    event_type = SDL_RegisterEvents(1);
+    push_times = (Uint64 *)SDL_malloc(num_threads * LATENCY_SAMPLES * sizeof(Uint64));
+    if (!push_times) {
+        SDL_Quit();
+        return 1;
+    }
+
+    SDL_Log("%d threads pushing %d events each, %s", num_threads, num_events, batch ? "SDL_AcquireEvents" : "SDL_PollEvent");
+
+    SDL_SetAtomicInt(&go, 0);
+    for (i = 0; i < num_threads; i++) {
+        char name[32];
+
+        SDL_zero(producers[i]);
+        producers[i].index = i;
+        producers[i].num_events = num_events;
+        producers[i].push_times = &push_times[i * LATENCY_SAMPLES];
+        next_expected[i] = 0;
+
+        SDL_snprintf(name, sizeof(name), "Producer%d", i);
+        producers[i].thread = SDL_CreateThread(ProducerThread, name, &producers[i]);
+    }
+
+    total = num_threads * num_events;
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&go, 1);
+
+    while (received < total) {
+        consume_start = SDL_GetTicksNS();
+        if (batch) {
+            int count = 0;
+            const SDL_Event *events = SDL_AcquireEvents(&count);
+            for (i = 0; i < count; i++) {
+                CheckEvent(&events[i], next_expected, &received, &out_of_order);
+            }
+            SDL_ReleaseEvents(events);
+        } else {
+            while (SDL_PollEvent(&event)) {
+                CheckEvent(&event, next_expected, &received, &out_of_order);
+            }
+        }
+        consume_time += SDL_GetTicksNS() - consume_start;
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    for (i = 0; i < num_threads; i++) {
+        SDL_WaitThread(producers[i].thread, NULL);
+        retries += producers[i].retries;
+        SDL_memmove(&push_times[num_push_times], producers[i].push_times, producers[i].num_push_times * sizeof(Uint64));
+        num_push_times += producers[i].num_push_times;
+    }
+
+    SDL_Log("%d events in %.2f ms, %.0f events/second", total, (double)elapsed / SDL_NS_PER_MS, (double)total * SDL_NS_PER_SECOND / elapsed);
+    SDL_Log("Main thread spent %.1f ns per event receiving them", (double)consume_time / total);
+    if (num_push_times > 0) {
+        SDL_qsort(push_times, num_push_times, sizeof(Uint64), CompareTimes);
+        SDL_Log("SDL_PushEvent: p50 %" SDL_PRIu64 "ns, p99 %" SDL_PRIu64 "ns, p99.9 %" SDL_PRIu64 "ns, max %" SDL_PRIu64 "ns",
+                push_times[num_push_times / 2],
+                push_times[(num_push_times * 99) / 100],
+                push_times[(num_push_times * 999) / 1000],
+                push_times[num_push_times - 1]);
+    }
+    SDL_Log("%d pushes retried because the queue was full", retries);
+
+    MeasureDrain(batch);
+    if (out_of_order) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d events arrived out of order", out_of_order);
+        result = 1;
+    }
+
+    SDL_free(push_times);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
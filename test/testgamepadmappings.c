@@ -0,0 +1,200 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Loads a large gamepad mapping database and reports how long it takes to
+   add the mappings and to look up the mapping for a device GUID.
+
+   Pass --file to load a mapping file like gamecontrollerdb.txt, otherwise a
+   database of --count generated mappings is used. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static int num_mappings = 5000;
+static int num_rounds = 10;
+static const char *mapping_file = NULL;
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--file FILE]", "[--count N]", "[--rounds N]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+/* Generated mappings use a unique vendor and product per device, and every
+   eighth mapping is for a specific CRC of the device before it */
+static void GetGeneratedGUID(int index, Uint16 crc, char *guid, size_t size)
+{
+    const Uint16 vendor = (Uint16)(0x1000 + index / 0x1000);
+    const Uint16 product = (Uint16)(index % 0x1000);
+
+    (void)SDL_snprintf(guid, size, "0300%.2x%.2x%.2x%.2x0000%.2x%.2x000001000000",
+                       crc & 0xFF, crc >> 8, vendor & 0xFF, vendor >> 8, product & 0xFF, product >> 8);
+}
+
+static char *GenerateMappings(size_t *size)
+{
+    const size_t line_size = 256;
+    char *mappings = (char *)SDL_malloc(num_mappings * line_size);
+    size_t length = 0;
+    int i;
+
+    if (!mappings) {
+        return NULL;
+    }
+
+    for (i = 0; i < num_mappings; ++i) {
+        char guid[33];
+
+        if ((i % 8) == 7) {
+            GetGeneratedGUID(i - 1, 0, guid, sizeof(guid));
+            length += SDL_snprintf(&mappings[length], line_size, "%s,Generated Gamepad %d CRC,a:b1,b:b0,x:b3,y:b2,leftx:a0,lefty:a1,crc:%.4x,platform:%s,\n", guid, i - 1, i, SDL_GetPlatform());
+        } else {
+            GetGeneratedGUID(i, 0, guid, sizeof(guid));
+            length += SDL_snprintf(&mappings[length], line_size, "%s,Generated Gamepad %d,a:b0,b:b1,x:b2,y:b3,leftx:a0,lefty:a1,platform:%s,\n", guid, i, SDL_GetPlatform());
+        }
+    }
+    *size = length;
+    return mappings;
+}
+
+/* Collects the GUIDs from a mapping file, so they can be looked up again */
+static SDL_GUID *GetMappingGUIDs(const char *mappings, int *count)
+{
+    const char *line = mappings;
+    SDL_GUID *guids = NULL;
+    int capacity = 0;
+
+    *count = 0;
+    while (line && *line) {
+        const char *end = SDL_strchr(line, '\n');
+        if (*line != '#' && SDL_strchr(line, ',')) {
+            char guid[33];
+            size_t length = (size_t)(SDL_strchr(line, ',') - line);
+
+            if (length < sizeof(guid)) {
+                if (*count == capacity) {
+                    SDL_GUID *new_guids;
+                    capacity = capacity ? capacity * 2 : 1024;
+                    new_guids = (SDL_GUID *)SDL_realloc(guids, capacity * sizeof(*guids));
+                    if (!new_guids) {
+                        break;
+                    }
+                    guids = new_guids;
+                }
+                SDL_strlcpy(guid, line, length + 1);
+                guids[(*count)++] = SDL_StringToGUID(guid);
+            }
+        }
+        line = end ? end + 1 : NULL;
+    }
+    return guids;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    char *mappings = NULL;
+    size_t size = 0;
+    SDL_GUID *guids = NULL;
+    int num_guids = 0;
+    int added, found = 0;
+    Uint64 start, elapsed;
+    int result = 1;
+    int i, round;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--file") == 0 && argv[i + 1]) {
+                mapping_file = argv[i + 1];
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--count") == 0 && argv[i + 1]) {
+                num_mappings = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--rounds") == 0 && argv[i + 1]) {
+                num_rounds = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || num_mappings <= 0 || num_rounds <= 0) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!SDL_Init(SDL_INIT_GAMEPAD)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (mapping_file) {
+        mappings = (char *)SDL_LoadFile(mapping_file, &size);
+    } else {
+        mappings = GenerateMappings(&size);
+    }
+    if (!mappings) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't load mappings: %s", SDL_GetError());
+        goto done;
+    }
+    guids = GetMappingGUIDs(mappings, &num_guids);
+    if (!guids) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't find any mappings");
+        goto done;
+    }
+
+    start = SDL_GetTicksNS();
+    added = SDL_AddGamepadMappingsFromIO(SDL_IOFromConstMem(mappings, size), true);
+    elapsed = SDL_GetTicksNS() - start;
+    if (added < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't add mappings: %s", SDL_GetError());
+        goto done;
+    }
+    SDL_Log("Added %d mappings in %.2f ms (%.2f us per mapping)", added,
+            (double)elapsed / SDL_NS_PER_MS, (double)elapsed / SDL_NS_PER_US / SDL_max(added, 1));
+
+    start = SDL_GetTicksNS();
+    for (round = 0; round < num_rounds; ++round) {
+        for (i = 0; i < num_guids; ++i) {
+            char *mapping = SDL_GetGamepadMappingForGUID(guids[i]);
+            if (mapping) {
+                if (round == 0) {
+                    ++found;
+                }
+                SDL_free(mapping);
+            }
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    SDL_Log("Looked up %d device GUIDs %d times, %d found, %.3f us per lookup", num_guids, num_rounds, found,
+            (double)elapsed / SDL_NS_PER_US / ((double)num_guids * num_rounds));
+
+    result = 0;
+
+done:
+    SDL_free(guids);
+    SDL_free(mappings);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,227 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Creates the same graphics pipeline on several Vulkan GPU devices that share
+   a pipeline cache, first through a cache file and then through the data
+   returned by SDL_GetGPUPipelineCacheData(), and reports the cache hits.
+
+   This runs without a window, so a software driver like lavapipe works:
+   VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json ./testgpu_pipelinecache
+*/
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#include "testgpu/testgpu_spirv.h"
+
+static const char *cache_file = "testgpu_pipelinecache.bin";
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--cache FILE]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+static SDL_GPUShader *LoadShader(SDL_GPUDevice *device, bool is_vertex)
+{
+    SDL_GPUShaderCreateInfo createinfo;
+
+    SDL_zero(createinfo);
+    createinfo.num_uniform_buffers = is_vertex ? 1 : 0;
+    createinfo.format = SDL_GPU_SHADERFORMAT_SPIRV;
+    createinfo.code = is_vertex ? cube_vert_spv : cube_frag_spv;
+    createinfo.code_size = is_vertex ? cube_vert_spv_len : cube_frag_spv_len;
+    createinfo.entrypoint = "main";
+    createinfo.stage = is_vertex ? SDL_GPU_SHADERSTAGE_VERTEX : SDL_GPU_SHADERSTAGE_FRAGMENT;
+    return SDL_CreateGPUShader(device, &createinfo);
+}
+
+static bool CreatePipeline(SDL_GPUDevice *device)
+{
+    SDL_GPUGraphicsPipelineCreateInfo pipelinedesc;
+    SDL_GPUColorTargetDescription color_target_desc;
+    SDL_GPUVertexBufferDescription vertex_buffer_desc;
+    SDL_GPUVertexAttribute vertex_attributes[2];
+    SDL_GPUGraphicsPipeline *pipeline = NULL;
+    SDL_GPUShader *vertex_shader = LoadShader(device, true);
+    SDL_GPUShader *fragment_shader = LoadShader(device, false);
+
+    if (vertex_shader && fragment_shader) {
+        SDL_zero(pipelinedesc);
+        SDL_zero(color_target_desc);
+        SDL_zero(vertex_buffer_desc);
+        SDL_zeroa(vertex_attributes);
+
+        color_target_desc.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+        pipelinedesc.target_info.num_color_targets = 1;
+        pipelinedesc.target_info.color_target_descriptions = &color_target_desc;
+        pipelinedesc.target_info.depth_stencil_format = SDL_GPU_TEXTUREFORMAT_D16_UNORM;
+        pipelinedesc.target_info.has_depth_stencil_target = true;
+        pipelinedesc.depth_stencil_state.enable_depth_test = true;
+        pipelinedesc.depth_stencil_state.enable_depth_write = true;
+        pipelinedesc.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS_OR_EQUAL;
+        pipelinedesc.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
+        pipelinedesc.vertex_shader = vertex_shader;
+        pipelinedesc.fragment_shader = fragment_shader;
+
+        vertex_buffer_desc.pitch = sizeof(float) * 6;
+        vertex_attributes[0].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
+        vertex_attributes[1].format = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT3;
+        vertex_attributes[1].location = 1;
+        vertex_attributes[1].offset = sizeof(float) * 3;
+        pipelinedesc.vertex_input_state.num_vertex_buffers = 1;
+        pipelinedesc.vertex_input_state.vertex_buffer_descriptions = &vertex_buffer_desc;
+        pipelinedesc.vertex_input_state.num_vertex_attributes = 2;
+        pipelinedesc.vertex_input_state.vertex_attributes = vertex_attributes;
+
+        pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelinedesc);
+    }
+    if (!pipeline) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create pipeline: %s", SDL_GetError());
+    }
+
+    SDL_ReleaseGPUShader(device, vertex_shader);
+    SDL_ReleaseGPUShader(device, fragment_shader);
+    SDL_ReleaseGPUGraphicsPipeline(device, pipeline);
+    return pipeline != NULL;
+}
+
+/* Fills in the cache hits and misses, which both stay 0 if the driver can't
+   report them. When data is not NULL, it receives the contents of the
+   pipeline cache before the device goes away. */
+static bool RunDevice(const char *label, const void *initial_data, size_t initial_size, Sint64 *hits, Sint64 *misses, void **data, size_t *size)
+{
+    SDL_PropertiesID props = SDL_CreateProperties();
+    SDL_PropertiesID device_props;
+    SDL_GPUDevice *device;
+    Sint64 created;
+    bool ok;
+
+    SDL_SetStringProperty(props, SDL_PROP_GPU_DEVICE_CREATE_NAME_STRING, "vulkan");
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_SHADERS_SPIRV_BOOLEAN, true);
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_DEBUGMODE_BOOLEAN, false);
+    SDL_SetBooleanProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VERBOSE_BOOLEAN, false);
+    if (initial_data) {
+        SDL_SetPointerProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_DATA_POINTER, (void *)initial_data);
+        SDL_SetNumberProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_SIZE_NUMBER, (Sint64)initial_size);
+    } else {
+        SDL_SetStringProperty(props, SDL_PROP_GPU_DEVICE_CREATE_VULKAN_PIPELINE_CACHE_FILENAME_STRING, cache_file);
+    }
+    device = SDL_CreateGPUDeviceWithProperties(props);
+    SDL_DestroyProperties(props);
+    if (!device) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create Vulkan GPU device: %s", SDL_GetError());
+        return false;
+    }
+
+    ok = CreatePipeline(device);
+
+    device_props = SDL_GetGPUDeviceProperties(device);
+    created = SDL_GetNumberProperty(device_props, SDL_PROP_GPU_DEVICE_PIPELINES_CREATED_NUMBER, 0);
+    *hits = SDL_GetNumberProperty(device_props, SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_HITS_NUMBER, 0);
+    *misses = SDL_GetNumberProperty(device_props, SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_MISSES_NUMBER, 0);
+    SDL_Log("%-12s %" SDL_PRIs64 " pipeline(s) created, %" SDL_PRIs64 " cache hit(s), %" SDL_PRIs64 " cache miss(es)", label, created, *hits, *misses);
+
+    if (ok && data) {
+        *data = SDL_GetGPUPipelineCacheData(device, size);
+        if (!*data) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't get pipeline cache data: %s", SDL_GetError());
+            ok = false;
+        }
+    }
+
+    SDL_DestroyGPUDevice(device);
+
+    return ok;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    void *data = NULL;
+    size_t size = 0;
+    Sint64 hits = 0, misses = 0;
+    bool have_feedback;
+    int result = 1;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--cache") == 0 && argv[i + 1]) {
+                cache_file = argv[i + 1];
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!SDL_Init(SDL_INIT_VIDEO)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    /* Start from an empty cache, the first device compiles and saves it */
+    SDL_RemovePath(cache_file);
+    if (!RunDevice("empty cache:", NULL, 0, &hits, &misses, NULL, NULL)) {
+        goto done;
+    }
+    have_feedback = (hits + misses) > 0;
+    if (!SDL_GetPathInfo(cache_file, NULL)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The pipeline cache wasn't saved to %s", cache_file);
+        goto done;
+    }
+
+    if (!RunDevice("cache file:", NULL, 0, &hits, &misses, &data, &size)) {
+        goto done;
+    }
+    if (have_feedback && hits == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The pipeline wasn't found in the cache file");
+        goto done;
+    }
+    SDL_Log("Pipeline cache is %d bytes", (int)size);
+
+    if (!RunDevice("cache data:", data, size, &hits, &misses, NULL, NULL)) {
+        goto done;
+    }
+    if (have_feedback && hits == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The pipeline wasn't found in the cache data");
+        goto done;
+    }
+
+    if (!have_feedback) {
+        SDL_Log("The driver doesn't report pipeline cache hits, only the cache round trip was checked");
+    }
+    result = 0;
+
+done:
+    SDL_free(data);
+    SDL_RemovePath(cache_file);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,254 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Runs the job system with 1, 2, 4, 8 and 16 job threads and reports how a
+   parallel for loop, lots of tiny jobs and stages of dependent jobs scale,
+   checking that every job ran once and in the right order. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define NUM_STAGES 64
+#define JOBS_PER_STAGE 256
+
+static int num_elements = 1000000;
+static int num_jobs = 100000;
+static int max_threads = 16;
+
+static Uint32 *results;
+static SDL_AtomicInt jobs_run;
+static SDL_AtomicInt stage_jobs_run[NUM_STAGES];
+static SDL_AtomicInt stage_errors;
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--elements N]", "[--jobs N]", "[--threads N]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+/* Some busy work for each element, so there's something to split up */
+static Uint32 HashElement(int i)
+{
+    Uint32 hash = (Uint32)i;
+    int j;
+
+    for (j = 0; j < 200; ++j) {
+        hash ^= hash << 13;
+        hash ^= hash >> 17;
+        hash ^= hash << 5;
+    }
+    return hash;
+}
+
+static void SDLCALL HashElements(void *userdata, int start, int end)
+{
+    int i;
+
+    for (i = start; i < end; ++i) {
+        results[i] += HashElement(i);
+    }
+}
+
+static void SDLCALL CountJob(void *userdata)
+{
+    SDL_AtomicIncRef(&jobs_run);
+}
+
+static void SDLCALL StageJob(void *userdata)
+{
+    const int stage = (int)(intptr_t)userdata;
+
+    /* Every job in the previous stage must have finished first */
+    if (stage > 0 && SDL_GetAtomicInt(&stage_jobs_run[stage - 1]) != JOBS_PER_STAGE) {
+        SDL_AtomicIncRef(&stage_errors);
+    }
+    SDL_AtomicIncRef(&stage_jobs_run[stage]);
+}
+
+/* Returns the time taken in milliseconds, or a negative value on error */
+static double RunParallelFor(void)
+{
+    Uint64 start, elapsed;
+    int i;
+
+    SDL_memset(results, 0, num_elements * sizeof(*results));
+    start = SDL_GetTicksNS();
+    if (!SDL_ParallelFor(0, num_elements, 0, HashElements, NULL)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't run parallel for: %s", SDL_GetError());
+        return -1.0;
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    for (i = 0; i < num_elements; ++i) {
+        if (results[i] != HashElement(i)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Element %d wasn't processed exactly once", i);
+            return -1.0;
+        }
+    }
+    return (double)elapsed / SDL_NS_PER_MS;
+}
+
+static double RunTinyJobs(void)
+{
+    SDL_JobCounter *counter = SDL_CreateJobCounter();
+    Uint64 start, elapsed;
+    int i;
+
+    if (!counter) {
+        return -1.0;
+    }
+    SDL_SetAtomicInt(&jobs_run, 0);
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_jobs; ++i) {
+        if (!SDL_SubmitJob(CountJob, NULL, NULL, counter)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't submit job: %s", SDL_GetError());
+            break;
+        }
+    }
+    SDL_WaitJobCounter(counter);
+    elapsed = SDL_GetTicksNS() - start;
+    SDL_DestroyJobCounter(counter);
+
+    if (SDL_GetAtomicInt(&jobs_run) != num_jobs) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d of %d jobs ran", SDL_GetAtomicInt(&jobs_run), num_jobs);
+        return -1.0;
+    }
+    return (double)elapsed / SDL_NS_PER_MS;
+}
+
+static double RunStages(void)
+{
+    SDL_JobCounter *counters[NUM_STAGES];
+    Uint64 start, elapsed;
+    bool okay = true;
+    int i, j;
+
+    for (i = 0; i < NUM_STAGES; ++i) {
+        counters[i] = SDL_CreateJobCounter();
+        if (!counters[i]) {
+            while (i--) {
+                SDL_DestroyJobCounter(counters[i]);
+            }
+            return -1.0;
+        }
+        SDL_SetAtomicInt(&stage_jobs_run[i], 0);
+    }
+    SDL_SetAtomicInt(&stage_errors, 0);
+
+    /* Submit everything up front, so the dependencies decide the order */
+    start = SDL_GetTicksNS();
+    for (i = 0; i < NUM_STAGES && okay; ++i) {
+        for (j = 0; j < JOBS_PER_STAGE && okay; ++j) {
+            okay = SDL_SubmitJob(StageJob, (void *)(intptr_t)i, (i > 0) ? counters[i - 1] : NULL, counters[i]);
+        }
+    }
+    for (i = 0; i < NUM_STAGES; ++i) {
+        SDL_WaitJobCounter(counters[i]);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    for (i = 0; i < NUM_STAGES; ++i) {
+        SDL_DestroyJobCounter(counters[i]);
+    }
+
+    if (!okay) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't submit job: %s", SDL_GetError());
+        return -1.0;
+    }
+    if (SDL_GetAtomicInt(&stage_errors) != 0 || SDL_GetAtomicInt(&stage_jobs_run[NUM_STAGES - 1]) != JOBS_PER_STAGE) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d jobs started before the stage they depend on finished", SDL_GetAtomicInt(&stage_errors));
+        return -1.0;
+    }
+    return (double)elapsed / SDL_NS_PER_MS;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    double serial_time = 0.0;
+    int result = 0;
+    int i, threads;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--elements") == 0 && argv[i + 1]) {
+                num_elements = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--jobs") == 0 && argv[i + 1]) {
+                num_jobs = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || num_elements <= 0 || num_jobs <= 0 || max_threads <= 0) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    results = (Uint32 *)SDL_malloc(num_elements * sizeof(*results));
+    if (!results) {
+        return 1;
+    }
+
+    SDL_Log("%d elements, %d tiny jobs, %d stages of %d jobs, %d logical CPU cores",
+            num_elements, num_jobs, NUM_STAGES, JOBS_PER_STAGE, SDL_GetNumLogicalCPUCores());
+
+    for (threads = 1; threads <= max_threads && result == 0; threads *= 2) {
+        char hint[32];
+        double parallel_time, tiny_time, stage_time;
+
+        /* The job threads are started with the hint's value, and stopped by SDL_Quit() */
+        SDL_snprintf(hint, sizeof(hint), "%d", threads);
+        SDL_SetHint(SDL_HINT_JOB_THREADS, hint);
+        if (!SDL_Init(0)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+            result = 1;
+            break;
+        }
+
+        parallel_time = RunParallelFor();
+        tiny_time = RunTinyJobs();
+        stage_time = RunStages();
+        if (parallel_time < 0.0 || tiny_time < 0.0 || stage_time < 0.0) {
+            result = 1;
+        } else {
+            if (threads == 1) {
+                serial_time = parallel_time;
+            }
+            SDL_Log("  %2d job thread%s: parallel for %8.2f ms  %5.2fx   tiny jobs %9.0f jobs/s   stages %8.2f ms",
+                    SDL_GetNumJobThreads(), (threads == 1) ? " " : "s", parallel_time, serial_time / SDL_max(parallel_time, 0.001),
+                    num_jobs * 1000.0 / SDL_max(tiny_time, 0.001), stage_time);
+        }
+
+        SDL_Quit();
+    }
+
+    SDL_free(results);
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -0,0 +1,244 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Creates a virtual gamepad with uinput, presses its buttons from another
+   thread while the main thread pumps events at a fixed frame rate, and
+   prints the joystick latency histogram.
+
+   Run it once as-is and once with --thread to compare reading input when
+   events are pumped against the dedicated Linux joystick input thread.
+   This needs write access to /dev/uinput. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#ifdef SDL_PLATFORM_LINUX
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <linux/uinput.h>
+
+static int num_presses = 200;
+static int press_interval = 7;
+static int frame_rate = 30;
+static SDL_AtomicInt presses_done;
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--thread]", "[--presses N]", "[--interval MS]", "[--fps N]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+static int CreateVirtualGamepad(void)
+{
+    struct uinput_setup setup;
+    int fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK);
+
+    if (fd < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open /dev/uinput: %s", strerror(errno));
+        return -1;
+    }
+
+    SDL_zero(setup);
+    setup.id.bustype = BUS_VIRTUAL;
+    setup.id.vendor = 0x1234;
+    setup.id.product = 0x5678;
+    SDL_strlcpy(setup.name, "SDL Latency Test Gamepad", sizeof(setup.name));
+
+    if (ioctl(fd, UI_SET_EVBIT, EV_KEY) < 0 ||
+        ioctl(fd, UI_SET_KEYBIT, BTN_SOUTH) < 0 ||
+        ioctl(fd, UI_SET_KEYBIT, BTN_EAST) < 0 ||
+        ioctl(fd, UI_SET_KEYBIT, BTN_NORTH) < 0 ||
+        ioctl(fd, UI_SET_KEYBIT, BTN_WEST) < 0 ||
+        ioctl(fd, UI_DEV_SETUP, &setup) < 0 ||
+        ioctl(fd, UI_DEV_CREATE) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create virtual gamepad: %s", strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void WriteEvent(int fd, int type, int code, int value)
+{
+    struct input_event event;
+
+    SDL_zero(event);
+    event.type = (Uint16)type;
+    event.code = (Uint16)code;
+    event.value = value;
+    if (write(fd, &event, sizeof(event)) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't write input event: %s", strerror(errno));
+    }
+}
+
+static int SDLCALL PressButtons(void *data)
+{
+    const int fd = *(int *)data;
+    int i;
+
+    /* Spread the presses out so they land at different points in a frame */
+    for (i = 0; i < num_presses; ++i) {
+        WriteEvent(fd, EV_KEY, BTN_SOUTH, (i % 2) == 0);
+        WriteEvent(fd, EV_SYN, SYN_REPORT, 0);
+        SDL_Delay(press_interval + (i % 3));
+    }
+    SDL_SetAtomicInt(&presses_done, 1);
+    return 0;
+}
+
+static SDL_Joystick *WaitForJoystick(void)
+{
+    const Uint64 timeout = SDL_GetTicks() + 5000;
+    SDL_Event event;
+
+    while (SDL_GetTicks() < timeout) {
+        while (SDL_PollEvent(&event)) {
+            if (event.type == SDL_EVENT_JOYSTICK_ADDED) {
+                SDL_Joystick *joystick = SDL_OpenJoystick(event.jdevice.which);
+                if (joystick && SDL_GetJoystickVendor(joystick) == 0x1234 && SDL_GetJoystickProduct(joystick) == 0x5678) {
+                    return joystick;
+                }
+                SDL_CloseJoystick(joystick);
+            }
+        }
+        SDL_Delay(10);
+    }
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The virtual gamepad didn't show up");
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_Joystick *joystick = NULL;
+    SDL_Thread *thread = NULL;
+    const Uint64 *histogram;
+    Uint64 total = 0;
+    bool use_thread = false;
+    int fd = -1;
+    int result = 1;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--thread") == 0) {
+                use_thread = true;
+                consumed = 1;
+            } else if (SDL_strcasecmp(argv[i], "--presses") == 0 && argv[i + 1]) {
+                num_presses = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--interval") == 0 && argv[i + 1]) {
+                press_interval = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--fps") == 0 && argv[i + 1]) {
+                frame_rate = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || num_presses <= 0 || press_interval < 0 || frame_rate <= 0) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    /* Create the device first, so it's found when joysticks are initialized */
+    fd = CreateVirtualGamepad();
+    if (fd < 0) {
+        SDLTest_CommonDestroyState(state);
+        return 1;
+    }
+
+    SDL_SetHint(SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD, use_thread ? "1" : "0");
+    SDL_SetHint(SDL_HINT_JOYSTICK_HIDAPI, "0");
+    SDL_SetHint(SDL_HINT_JOYSTICK_ALLOW_BACKGROUND_EVENTS, "1");
+    if (!SDL_Init(SDL_INIT_JOYSTICK)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        goto done;
+    }
+
+    joystick = WaitForJoystick();
+    if (!joystick) {
+        goto done;
+    }
+    histogram = (const Uint64 *)SDL_GetPointerProperty(SDL_GetJoystickProperties(joystick), SDL_PROP_JOYSTICK_LATENCY_HISTOGRAM_POINTER, NULL);
+    if (!histogram) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The joystick doesn't have a latency histogram");
+        goto done;
+    }
+
+    thread = SDL_CreateThread(PressButtons, "PressButtons", &fd);
+    if (!thread) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+        goto done;
+    }
+
+    /* Pump events like a game running at a fixed frame rate */
+    while (!SDL_GetAtomicInt(&presses_done)) {
+        SDL_Event event;
+        while (SDL_PollEvent(&event)) {
+        }
+        SDL_Delay(1000 / frame_rate);
+    }
+    SDL_WaitThread(thread, NULL);
+    SDL_UpdateJoysticks();
+
+    SDL_Log("%d button presses at %d FPS, %s", num_presses, frame_rate, use_thread ? "input thread" : "read when pumping events");
+    SDL_LockJoysticks();
+    for (i = 0; i < SDL_JOYSTICK_LATENCY_HISTOGRAM_BUCKETS; ++i) {
+        total += histogram[i];
+    }
+    for (i = 0; i < SDL_JOYSTICK_LATENCY_HISTOGRAM_BUCKETS; ++i) {
+        if (i < SDL_JOYSTICK_LATENCY_HISTOGRAM_BUCKETS - 1) {
+            SDL_Log("  < %6d us: %5" SDL_PRIu64 " (%5.1f%%)", 64 << i, histogram[i], total ? 100.0 * histogram[i] / total : 0.0);
+        } else {
+            SDL_Log("  slower   : %5" SDL_PRIu64 " (%5.1f%%)", histogram[i], total ? 100.0 * histogram[i] / total : 0.0);
+        }
+    }
+    SDL_UnlockJoysticks();
+
+    result = (total > 0) ? 0 : 1;
+
+done:
+    SDL_CloseJoystick(joystick);
+    SDL_Quit();
+    ioctl(fd, UI_DEV_DESTROY);
+    close(fd);
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
+
+#else
+
+int main(int argc, char *argv[])
+{
+    SDL_Log("This test requires Linux uinput support");
+    return 0;
+}
+
+#endif /* SDL_PLATFORM_LINUX */
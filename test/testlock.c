@@ -12,6 +12,7 @@
 
 /* Test the thread and mutex locking functions
    Also exercises the system's signal/thread interaction
+   With --bench, measures how long locking takes with and without contention instead
 */
 
 #include <signal.h>
@@ -27,6 +28,11 @@ static SDL_AtomicInt doterminate;
 static int nb_threads = 6;
 static SDL_Thread **threads;
 static int worktime = 1000;
+static int bench_ops = 0;
+static SDL_AtomicInt bench_go;
+static SDL_SpinLock bench_spinlock;
+static SDL_Condition *bench_cond;
+static int bench_counter;
 static SDLTest_CommonState *state;
 
 /**
@@ -99,6 +105,147 @@ Run(void *data)
     return 0;
 }
 
+static void BenchLock(bool use_spinlock)
+{
+    if (use_spinlock) {
+        SDL_LockSpinlock(&bench_spinlock);
+    } else {
+        SDL_LockMutex(mutex);
+    }
+}
+
+static void BenchUnlock(bool use_spinlock)
+{
+    if (use_spinlock) {
+        SDL_UnlockSpinlock(&bench_spinlock);
+    } else {
+        SDL_UnlockMutex(mutex);
+    }
+}
+
+static int SDLCALL
+BenchThread(void *data)
+{
+    const bool use_spinlock = (data != NULL);
+    int i;
+
+    while (!SDL_GetAtomicInt(&bench_go)) {
+        SDL_CPUPauseInstruction();
+    }
+    for (i = 0; i < bench_ops; ++i) {
+        BenchLock(use_spinlock);
+        ++bench_counter;
+        BenchUnlock(use_spinlock);
+    }
+    return 0;
+}
+
+/* Returns the average nanoseconds per lock/unlock pair, or a negative value on error */
+static double BenchLocking(bool use_spinlock, int num_threads)
+{
+    SDL_Thread **bench_threads;
+    Uint64 start, elapsed;
+    int i;
+
+    bench_threads = (SDL_Thread **)SDL_calloc(num_threads, sizeof(*bench_threads));
+    if (!bench_threads) {
+        return -1.0;
+    }
+
+    bench_counter = 0;
+    SDL_SetAtomicInt(&bench_go, 0);
+    for (i = 0; i < num_threads; ++i) {
+        bench_threads[i] = SDL_CreateThread(BenchThread, "Bench", use_spinlock ? (void *)&bench_spinlock : NULL);
+    }
+
+    start = SDL_GetTicksNS();
+    SDL_SetAtomicInt(&bench_go, 1);
+    for (i = 0; i < num_threads; ++i) {
+        SDL_WaitThread(bench_threads[i], NULL);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    SDL_free(bench_threads);
+
+    if (bench_counter != num_threads * bench_ops) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Counted %d instead of %d, the lock didn't work!", bench_counter, num_threads * bench_ops);
+        return -1.0;
+    }
+    return (double)elapsed / ((double)num_threads * bench_ops);
+}
+
+static int SDLCALL
+BenchPingPongThread(void *data)
+{
+    int i;
+
+    SDL_LockMutex(mutex);
+    for (i = 0; i < bench_ops; ++i) {
+        /* Wait for an odd count, then make it even */
+        while (!(bench_counter & 1)) {
+            SDL_WaitCondition(bench_cond, mutex);
+        }
+        ++bench_counter;
+        SDL_SignalCondition(bench_cond);
+    }
+    SDL_UnlockMutex(mutex);
+    return 0;
+}
+
+/* Returns the average nanoseconds for a condition signal to go to another thread and back */
+static double BenchPingPong(void)
+{
+    SDL_Thread *thread;
+    Uint64 start, elapsed;
+    int i;
+
+    bench_counter = 0;
+    thread = SDL_CreateThread(BenchPingPongThread, "PingPong", NULL);
+
+    start = SDL_GetTicksNS();
+    SDL_LockMutex(mutex);
+    for (i = 0; i < bench_ops; ++i) {
+        ++bench_counter;
+        SDL_SignalCondition(bench_cond);
+        while (bench_counter & 1) {
+            SDL_WaitCondition(bench_cond, mutex);
+        }
+    }
+    SDL_UnlockMutex(mutex);
+    SDL_WaitThread(thread, NULL);
+    elapsed = SDL_GetTicksNS() - start;
+
+    return (double)elapsed / bench_ops;
+}
+
+static int Bench(void)
+{
+    double mutex_uncontended, mutex_contended, spinlock_uncontended, spinlock_contended, pingpong;
+
+    bench_cond = SDL_CreateCondition();
+    if (!bench_cond) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create condition: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("Locking %d times per thread, %d threads when contended, %d logical CPU cores",
+            bench_ops, nb_threads, SDL_GetNumLogicalCPUCores());
+
+    mutex_uncontended = BenchLocking(false, 1);
+    mutex_contended = BenchLocking(false, nb_threads);
+    spinlock_uncontended = BenchLocking(true, 1);
+    spinlock_contended = BenchLocking(true, nb_threads);
+    pingpong = BenchPingPong();
+    SDL_DestroyCondition(bench_cond);
+
+    if (mutex_uncontended < 0.0 || mutex_contended < 0.0 || spinlock_uncontended < 0.0 || spinlock_contended < 0.0) {
+        return 1;
+    }
+    SDL_Log("Mutex:     %8.1f ns per lock/unlock uncontended, %8.1f ns contended", mutex_uncontended, mutex_contended);
+    SDL_Log("Spinlock:  %8.1f ns per lock/unlock uncontended, %8.1f ns contended", spinlock_uncontended, spinlock_contended);
+    SDL_Log("Condition: %8.1f ns to signal another thread and be signaled back", pingpong);
+    return 0;
+}
+
 #ifndef _WIN32
 static Uint32 hit_timeout(void *param, SDL_TimerID timerID, Uint32 interval) {
     SDL_Log("Hit timeout! Sending SIGINT!");
@@ -142,6 +289,14 @@ int main(int argc, char *argv[])
                         consumed = 2;
                     }
                 }
+            } else if (SDL_strcmp(argv[i], "--bench") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    bench_ops = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && bench_ops > 0) {
+                        consumed = 2;
+                    }
+                }
 #ifndef _WIN32
             } else if (SDL_strcmp(argv[i], "--timeout") == 0) {
                 if (argv[i + 1]) {
@@ -158,6 +313,7 @@ int main(int argc, char *argv[])
             static const char *options[] = {
                 "[--nbthreads NB]",
                 "[--worktime ms]",
+                "[--bench OPS]",
 #ifndef _WIN32
                 "[--timeout ms]",
 #endif
@@ -187,6 +343,14 @@ int main(int argc, char *argv[])
         exit(1);
     }
 
+    if (bench_ops > 0) {
+        SDL_free(threads);
+        threads = NULL;
+        i = Bench();
+        SDL_DestroyMutex(mutex);
+        return i;
+    }
+
     mainthread = SDL_GetCurrentThreadID();
     SDL_Log("Main thread: %" SDL_PRIu64, mainthread);
     (void)atexit(printid);
@@ -14,11 +14,64 @@
 #include <SDL3/SDL_main.h>
 #include <SDL3/SDL_test.h>
 
+static const char *quality_names[] = { "fast", "medium", "high" };
+
 static void log_usage(char *progname, SDLTest_CommonState *state) {
-    static const char *options[] = { "in.wav", "out.wav", "newfreq", "newchan", NULL };
+    static const char *options[] = { "[--quality fast|medium|high]", "[--benchmark]", "in.wav", "out.wav", "newfreq", "newchan", NULL };
     SDLTest_CommonLogUsage(state, progname, options);
 }
 
+static SDL_AudioStream *CreateStream(const SDL_AudioSpec *spec, const SDL_AudioSpec *cvtspec, int quality)
+{
+    SDL_AudioStream *stream = SDL_CreateAudioStream(spec, cvtspec);
+    if (stream) {
+        SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, quality);
+    }
+    return stream;
+}
+
+/* Resample the whole file through each quality, a few times over, and report how fast it went. */
+static void Benchmark(const SDL_AudioSpec *spec, const SDL_AudioSpec *cvtspec, const Uint8 *data, Uint32 len)
+{
+    const int iterations = 10;
+    const int frames = (int)(len / SDL_AUDIO_FRAMESIZE(*spec));
+    const int dst_len = (int)(((Sint64)frames * cvtspec->freq / spec->freq) + 64) * SDL_AUDIO_FRAMESIZE(*cvtspec);
+    Uint8 *dst = (Uint8 *)SDL_malloc(dst_len);
+    int quality, i;
+
+    if (!dst) {
+        return;
+    }
+
+    SDL_Log("Resampling %d frames from %d Hz to %d Hz, %d channels", frames, spec->freq, cvtspec->freq, cvtspec->channels);
+
+    for (quality = 0; quality < SDL_arraysize(quality_names); quality++) {
+        SDL_AudioStream *stream = CreateStream(spec, cvtspec, quality);
+        Uint64 start, elapsed;
+
+        if (!stream) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "failed to create stream: %s", SDL_GetError());
+            break;
+        }
+
+        start = SDL_GetTicksNS();
+        for (i = 0; i < iterations; i++) {
+            SDL_PutAudioStreamData(stream, data, len);
+            SDL_FlushAudioStream(stream);
+            while (SDL_GetAudioStreamData(stream, dst, dst_len) > 0) {
+            }
+            SDL_ClearAudioStream(stream);
+        }
+        elapsed = SDL_GetTicksNS() - start;
+
+        SDL_Log("%-6s: %.1f ms, %.2f Mframes/sec", quality_names[quality], (double)elapsed / SDL_NS_PER_MS,
+                ((double)frames * iterations) / ((double)elapsed / SDL_NS_PER_SECOND) / 1000000.0);
+        SDL_DestroyAudioStream(stream);
+    }
+
+    SDL_free(dst);
+}
+
 int main(int argc, char **argv)
 {
     SDL_AudioSpec spec;
@@ -38,6 +91,8 @@ int main(int argc, char **argv)
     SDLTest_CommonState *state;
     char *file_in = NULL;
     char *file_out = NULL;
+    int quality = 1;
+    bool benchmark = false;
 
     /* Initialize test framework */
     state = SDLTest_CommonCreateState(argv, 0);
@@ -53,7 +108,17 @@ int main(int argc, char **argv)
 
         consumed = SDLTest_CommonArg(state, i);
         if (!consumed) {
-            if (argpos == 0) {
+            if (SDL_strcmp(argv[i], "--quality") == 0 && argv[i + 1]) {
+                for (quality = 0; quality < SDL_arraysize(quality_names); quality++) {
+                    if (SDL_strcmp(argv[i + 1], quality_names[quality]) == 0) {
+                        consumed = 2;
+                        break;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                benchmark = true;
+                consumed = 1;
+            } else if (argpos == 0) {
                 file_in = argv[i];
                 argpos++;
                 consumed = 1;
@@ -105,12 +170,25 @@ int main(int argc, char **argv)
     }
 
     cvtspec.format = spec.format;
-    if (!SDL_ConvertAudioSamples(&spec, data, len, &cvtspec, &dst_buf, &dst_len)) {
+    stream = CreateStream(&spec, &cvtspec, quality);
+    if (!stream || !SDL_PutAudioStreamData(stream, data, len) || !SDL_FlushAudioStream(stream)) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "failed to convert samples: %s", SDL_GetError());
         ret = 4;
         goto end;
     }
 
+    dst_len = SDL_GetAudioStreamAvailable(stream);
+    dst_buf = (Uint8 *)SDL_malloc(dst_len);
+    if (!dst_buf || SDL_GetAudioStreamData(stream, dst_buf, dst_len) != dst_len) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "failed to convert samples: %s", SDL_GetError());
+        ret = 4;
+        goto end;
+    }
+
+    if (benchmark) {
+        Benchmark(&spec, &cvtspec, data, len);
+    }
+
     /* write out a WAV header... */
     io = SDL_IOFromFile(file_out, "wb");
     if (!io) {
@@ -0,0 +1,206 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Times converting a frame of RGB pixels to each YUV format, with the scalar
+   code and with the SIMD code for this CPU, and reports the largest
+   difference between the two results. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static int image_w = 1920;
+static int image_h = 1080;
+static int num_iterations = 20;
+
+static const SDL_PixelFormat formats[] = {
+    SDL_PIXELFORMAT_YV12,
+    SDL_PIXELFORMAT_IYUV,
+    SDL_PIXELFORMAT_NV12,
+    SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2,
+    SDL_PIXELFORMAT_UYVY,
+    SDL_PIXELFORMAT_YVYU,
+    SDL_PIXELFORMAT_P010,
+};
+
+static const struct
+{
+    SDL_Colorspace colorspace;
+    const char *name;
+} colorspaces[] = {
+    { SDL_COLORSPACE_BT601_LIMITED, "BT.601" },
+    { SDL_COLORSPACE_BT709_LIMITED, "BT.709" },
+    { SDL_COLORSPACE_BT2020_FULL, "BT.2020" },
+};
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--size WxH]", "[--iterations N]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+static int GetYUVPitch(SDL_PixelFormat format, int w)
+{
+    if (format == SDL_PIXELFORMAT_P010) {
+        return w * 2;
+    } else if (format == SDL_PIXELFORMAT_YUY2 || format == SDL_PIXELFORMAT_UYVY || format == SDL_PIXELFORMAT_YVYU) {
+        return ((w + 1) / 2) * 4;
+    }
+    return w;
+}
+
+/* Returns the number of pixels converted per second, or a negative value on error */
+static double RunConversion(const char *tier, SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, const void *src,
+                            SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, void *dst)
+{
+    const int dst_pitch = GetYUVPitch(dst_format, image_w);
+    Uint64 start, elapsed;
+    int i;
+
+    SDL_SetHint(SDL_HINT_BLIT_CPU_TIER, tier);
+
+    if (!SDL_ConvertPixelsAndColorspace(image_w, image_h, src_format, src_colorspace, 0, src, image_w * 4, dst_format, dst_colorspace, 0, dst, dst_pitch)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert pixels: %s", SDL_GetError());
+        return -1.0;
+    }
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_iterations; ++i) {
+        SDL_ConvertPixelsAndColorspace(image_w, image_h, src_format, src_colorspace, 0, src, image_w * 4, dst_format, dst_colorspace, 0, dst, dst_pitch);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    SDL_ResetHint(SDL_HINT_BLIT_CPU_TIER);
+
+    return (double)image_w * image_h * num_iterations * SDL_NS_PER_SECOND / SDL_max(elapsed, 1);
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Uint8 *src = NULL;
+    Uint8 *scalar = NULL;
+    Uint8 *simd = NULL;
+    size_t src_size, dst_size, j;
+    Uint64 seed = 1;
+    int result = 0;
+    int i, f, c;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--size") == 0 && argv[i + 1]) {
+                char *x = SDL_strchr(argv[i + 1], 'x');
+                if (x) {
+                    image_w = SDL_atoi(argv[i + 1]);
+                    image_h = SDL_atoi(x + 1);
+                    consumed = 2;
+                }
+            } else if (SDL_strcasecmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                num_iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || image_w < 1 || image_h < 1 || num_iterations <= 0) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    /* Every YUV format fits in 4 bytes per pixel */
+    src_size = (size_t)image_w * image_h * 4;
+    dst_size = (size_t)(image_w + 1) * (image_h + 1) * 4;
+    src = (Uint8 *)SDL_malloc(src_size);
+    scalar = (Uint8 *)SDL_calloc(1, dst_size);
+    simd = (Uint8 *)SDL_calloc(1, dst_size);
+    if (!src || !scalar || !simd) {
+        result = 1;
+        goto done;
+    }
+    for (j = 0; j < src_size; ++j) {
+        src[j] = (Uint8)SDL_rand_bits_r(&seed);
+    }
+
+    SDL_Log("%dx%d pixels, %d iterations", image_w, image_h, num_iterations);
+
+    for (f = 0; f < SDL_arraysize(formats) && result == 0; ++f) {
+        for (c = 0; c < SDL_arraysize(colorspaces) && result == 0; ++c) {
+            const SDL_PixelFormat dst_format = formats[f];
+            const SDL_Colorspace dst_colorspace = colorspaces[c].colorspace;
+            SDL_PixelFormat src_format;
+            SDL_Colorspace src_colorspace;
+            double scalar_rate, simd_rate;
+            int max_diff = 0;
+
+            if (dst_format == SDL_PIXELFORMAT_P010) {
+                if (dst_colorspace != SDL_COLORSPACE_BT2020_FULL) {
+                    continue;
+                }
+                src_format = SDL_PIXELFORMAT_XBGR2101010;
+                src_colorspace = SDL_COLORSPACE_HDR10;
+            } else {
+                /* Use the same primaries, so only the YUV conversion is timed */
+                src_format = SDL_PIXELFORMAT_XRGB8888;
+                src_colorspace = SDL_DEFINE_COLORSPACE(SDL_COLOR_TYPE_RGB, SDL_COLOR_RANGE_FULL, SDL_COLORSPACEPRIMARIES(dst_colorspace),
+                                                       SDL_TRANSFER_CHARACTERISTICS_SRGB, SDL_MATRIX_COEFFICIENTS_IDENTITY, SDL_CHROMA_LOCATION_NONE);
+            }
+
+            scalar_rate = RunConversion("scalar", src_format, src_colorspace, src, dst_format, dst_colorspace, scalar);
+            simd_rate = RunConversion("auto", src_format, src_colorspace, src, dst_format, dst_colorspace, simd);
+            if (scalar_rate < 0.0 || simd_rate < 0.0) {
+                result = 1;
+                break;
+            }
+
+            if (dst_format == SDL_PIXELFORMAT_P010) {
+                for (j = 0; j < dst_size / 2; ++j) {
+                    max_diff = SDL_max(max_diff, SDL_abs(((Uint16 *)scalar)[j] - ((Uint16 *)simd)[j]) >> 6);
+                }
+            } else {
+                for (j = 0; j < dst_size; ++j) {
+                    max_diff = SDL_max(max_diff, SDL_abs(scalar[j] - simd[j]));
+                }
+            }
+
+            SDL_Log("%-6s %-8s scalar %8.1f Mpixels/s  SIMD %8.1f Mpixels/s  %5.2fx  max difference %d",
+                    SDL_GetPixelFormatName(dst_format) + 16, colorspaces[c].name,
+                    scalar_rate / 1000000.0, simd_rate / 1000000.0, simd_rate / scalar_rate, max_diff);
+            if (max_diff > 1) {
+                result = 1;
+            }
+        }
+    }
+
+done:
+    SDL_free(src);
+    SDL_free(scalar);
+    SDL_free(simd);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -145,7 +145,7 @@ TestOverheadUncontended(void)
     sem = SDL_CreateSemaphore(0);
     SDL_Log("Doing %d uncontended Post/Wait operations on semaphore", NUM_OVERHEAD_OPS * NUM_OVERHEAD_OPS_MULT);
 
-    start_ticks = SDL_GetTicks();
+    start_ticks = SDL_GetTicksNS();
     for (i = 0; i < NUM_OVERHEAD_OPS_MULT; i++) {
         for (j = 0; j < NUM_OVERHEAD_OPS; j++) {
             SDL_SignalSemaphore(sem);
@@ -154,10 +154,11 @@ TestOverheadUncontended(void)
             SDL_WaitSemaphore(sem);
         }
     }
-    end_ticks = SDL_GetTicks();
+    end_ticks = SDL_GetTicksNS();
 
     duration = end_ticks - start_ticks;
-    SDL_Log("Took %" SDL_PRIu64 " milliseconds", duration);
+    SDL_Log("Took %" SDL_PRIu64 " milliseconds, %.1f nanoseconds per Post/Wait",
+            SDL_NS_TO_MS(duration), (double)duration / (NUM_OVERHEAD_OPS * NUM_OVERHEAD_OPS_MULT));
     SDL_Log("%s", "");
 
     SDL_DestroySemaphore(sem);
@@ -212,7 +213,7 @@ TestOverheadContended(bool try_wait)
         thread_states[i].thread = SDL_CreateThread(ThreadFuncOverheadContended, name, (void *)&thread_states[i]);
     }
 
-    start_ticks = SDL_GetTicks();
+    start_ticks = SDL_GetTicksNS();
     for (i = 0; i < NUM_OVERHEAD_OPS_MULT; i++) {
         for (j = 0; j < NUM_OVERHEAD_OPS; j++) {
             SDL_SignalSemaphore(sem);
@@ -223,7 +224,7 @@ TestOverheadContended(bool try_wait)
             SDL_DelayNS(1);
         }
     }
-    end_ticks = SDL_GetTicks();
+    end_ticks = SDL_GetTicksNS();
 
     alive = 0;
     loop_count = 0;
@@ -236,8 +237,8 @@ TestOverheadContended(bool try_wait)
     SDL_assert_release((loop_count - content_count) == NUM_OVERHEAD_OPS * NUM_OVERHEAD_OPS_MULT);
 
     duration = end_ticks - start_ticks;
-    SDL_Log("Took %" SDL_PRIu64 " milliseconds, threads %s %d out of %d times in total (%.2f%%)",
-            duration, try_wait ? "where contended" : "timed out", content_count,
+    SDL_Log("Took %" SDL_PRIu64 " milliseconds, %.1f nanoseconds per Post/Wait, threads %s %d out of %d times in total (%.2f%%)",
+            SDL_NS_TO_MS(duration), (double)duration / (NUM_OVERHEAD_OPS * NUM_OVERHEAD_OPS_MULT), try_wait ? "where contended" : "timed out", content_count,
             loop_count, ((float)content_count * 100) / loop_count);
     /* Print how many semaphores where consumed per thread */
     (void)SDL_snprintf(textBuffer, sizeof(textBuffer), "{ ");
@@ -0,0 +1,247 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Moves sprites around an offscreen surface with the software renderer and
+   reports how many sprites per second it draws with each number of render
+   threads, checking that every thread count produces the same image. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#include "icon.h"
+
+#define MAX_SPEED 1
+
+static int surface_w = 1920;
+static int surface_h = 1080;
+static int num_sprites = 2000;
+static int num_frames = 100;
+static SDL_FRect *positions;
+static SDL_FRect *velocities;
+
+static void log_usage(char *progname, SDLTest_CommonState *state) {
+    static const char *options[] = { "[--size WxH]", "[--sprites N]", "[--frames N]", "[--threads N]", NULL };
+    SDLTest_CommonLogUsage(state, progname, options);
+}
+
+static SDL_Texture *CreateSprite(SDL_Renderer *renderer, int *w, int *h)
+{
+    SDL_Texture *texture = NULL;
+    SDL_Surface *surface;
+    SDL_IOStream *src = SDL_IOFromConstMem(icon_bmp, icon_bmp_len);
+    if (src) {
+        surface = SDL_LoadBMP_IO(src, true);
+        if (surface) {
+            /* Treat white as transparent */
+            SDL_SetSurfaceColorKey(surface, true, SDL_MapSurfaceRGB(surface, 255, 255, 255));
+
+            texture = SDL_CreateTextureFromSurface(renderer, surface);
+            *w = surface->w;
+            *h = surface->h;
+            SDL_DestroySurface(surface);
+        }
+    }
+    return texture;
+}
+
+static void ResetSprites(int sprite_w, int sprite_h)
+{
+    int i;
+
+    /* Every run starts from the same positions so the images can be compared */
+    SDL_srand(1);
+    for (i = 0; i < num_sprites; ++i) {
+        positions[i].x = (float)SDL_rand(surface_w - sprite_w);
+        positions[i].y = (float)SDL_rand(surface_h - sprite_h);
+        positions[i].w = (float)sprite_w;
+        positions[i].h = (float)sprite_h;
+        velocities[i].x = 0.0f;
+        velocities[i].y = 0.0f;
+        while (velocities[i].x == 0.0f && velocities[i].y == 0.0f) {
+            velocities[i].x = (float)(SDL_rand(MAX_SPEED * 2 + 1) - MAX_SPEED);
+            velocities[i].y = (float)(SDL_rand(MAX_SPEED * 2 + 1) - MAX_SPEED);
+        }
+    }
+}
+
+static void MoveSprites(SDL_Renderer *renderer, SDL_Texture *sprite)
+{
+    int i;
+
+    /* Draw a gray background */
+    SDL_SetRenderDrawColor(renderer, 0xA0, 0xA0, 0xA0, 0xFF);
+    SDL_RenderClear(renderer);
+
+    /* Move the sprite, bounce at the wall, and draw */
+    for (i = 0; i < num_sprites; ++i) {
+        SDL_FRect *position = &positions[i];
+        SDL_FRect *velocity = &velocities[i];
+        position->x += velocity->x;
+        if ((position->x < 0) || (position->x >= (surface_w - position->w))) {
+            velocity->x = -velocity->x;
+            position->x += velocity->x;
+        }
+        position->y += velocity->y;
+        if ((position->y < 0) || (position->y >= (surface_h - position->h))) {
+            velocity->y = -velocity->y;
+            position->y += velocity->y;
+        }
+        SDL_RenderTexture(renderer, sprite, NULL, position);
+    }
+
+    /* Flush the queued drawing into the surface */
+    SDL_RenderPresent(renderer);
+}
+
+/* Returns the sprites drawn per second, or a negative value on error */
+static double RunFrames(SDL_Surface *surface, int threads)
+{
+    SDL_Renderer *renderer;
+    SDL_Texture *sprite;
+    char hint[32];
+    int sprite_w = 0, sprite_h = 0;
+    Uint64 start, elapsed;
+    int i;
+
+    SDL_snprintf(hint, sizeof(hint), "%d", threads);
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, hint);
+    renderer = SDL_CreateSoftwareRenderer(surface);
+    SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    if (!renderer) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create software renderer: %s", SDL_GetError());
+        return -1.0;
+    }
+
+    sprite = CreateSprite(renderer, &sprite_w, &sprite_h);
+    if (!sprite) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create sprite texture: %s", SDL_GetError());
+        SDL_DestroyRenderer(renderer);
+        return -1.0;
+    }
+
+    ResetSprites(sprite_w, sprite_h);
+
+    /* The first frame warms up any buffers, only the rest are timed */
+    MoveSprites(renderer, sprite);
+    start = SDL_GetTicksNS();
+    for (i = 1; i < num_frames; ++i) {
+        MoveSprites(renderer, sprite);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    SDL_DestroyTexture(sprite);
+    SDL_DestroyRenderer(renderer);
+
+    return (double)num_sprites * (num_frames - 1) * SDL_NS_PER_SECOND / SDL_max(elapsed, 1);
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_Surface *reference = NULL;
+    SDL_Surface *surface = NULL;
+    int max_threads = 0;
+    int threads;
+    int result = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcasecmp(argv[i], "--size") == 0 && argv[i + 1]) {
+                char *x = SDL_strchr(argv[i + 1], 'x');
+                if (x) {
+                    surface_w = SDL_atoi(argv[i + 1]);
+                    surface_h = SDL_atoi(x + 1);
+                    consumed = 2;
+                }
+            } else if (SDL_strcasecmp(argv[i], "--sprites") == 0 && argv[i + 1]) {
+                num_sprites = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+                num_frames = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcasecmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || surface_w < 64 || surface_h < 64 || num_sprites <= 0 || num_frames <= 1) {
+            log_usage(argv[0], state);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (max_threads <= 0) {
+        max_threads = SDL_GetNumLogicalCPUCores();
+    }
+
+    positions = (SDL_FRect *)SDL_malloc(num_sprites * sizeof(*positions));
+    velocities = (SDL_FRect *)SDL_malloc(num_sprites * sizeof(*velocities));
+    reference = SDL_CreateSurface(surface_w, surface_h, SDL_PIXELFORMAT_XRGB8888);
+    surface = SDL_CreateSurface(surface_w, surface_h, SDL_PIXELFORMAT_XRGB8888);
+    if (!positions || !velocities || !reference || !surface) {
+        result = 1;
+        goto done;
+    }
+
+    SDL_Log("%d sprites on a %dx%d surface, %d frames", num_sprites, surface_w, surface_h, num_frames);
+
+    for (threads = 1; threads <= max_threads; threads = (threads < max_threads && threads * 2 > max_threads) ? max_threads : threads * 2) {
+        SDL_Surface *target = (threads == 1) ? reference : surface;
+        const double rate = RunFrames(target, threads);
+        bool identical = true;
+
+        if (rate < 0.0) {
+            result = 1;
+            break;
+        }
+        if (target != reference) {
+            identical = (SDLTest_CompareSurfaces(target, reference, 0) == 0);
+            if (!identical) {
+                result = 1;
+            }
+        }
+        SDL_Log("%2d thread%s: %10.0f sprites/second%s", threads, (threads == 1) ? " " : "s", rate, identical ? "" : " (output differs from 1 thread!)");
+
+        if (threads == max_threads) {
+            break;
+        }
+    }
+
+done:
+    SDL_free(positions);
+    SDL_free(velocities);
+    SDL_DestroySurface(reference);
+    SDL_DestroySurface(surface);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
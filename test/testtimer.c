@@ -72,6 +72,136 @@ callback(void *param, SDL_TimerID timerID, Uint32 interval)
     return interval;
 }
 
+#define DEFAULT_STRESS_TIMERS 10000
+
+typedef struct StressTimer
+{
+    Uint64 deadline;
+    Uint64 lateness;
+    bool fired;
+} StressTimer;
+
+static SDL_AtomicInt stress_fired;
+
+static Uint64 SDLCALL
+stress_callback(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    StressTimer *timer = (StressTimer *)param;
+    const Uint64 now = SDL_GetTicksNS();
+
+    timer->lateness = (now > timer->deadline) ? (now - timer->deadline) : 0;
+    timer->fired = true;
+    SDL_AddAtomicInt(&stress_fired, 1);
+    return 0;
+}
+
+static int SDLCALL
+compare_times(const void *a, const void *b)
+{
+    const Uint64 lhs = *(const Uint64 *)a;
+    const Uint64 rhs = *(const Uint64 *)b;
+    return (lhs < rhs) ? -1 : (lhs > rhs) ? 1 : 0;
+}
+
+static void
+log_percentiles(const char *what, Uint64 *times, int count)
+{
+    if (count <= 0) {
+        return;
+    }
+    SDL_qsort(times, count, sizeof(*times), compare_times);
+    SDL_Log("%s (%d): p50 %" SDL_PRIu64 " ns, p99 %" SDL_PRIu64 " ns, p99.9 %" SDL_PRIu64 " ns, max %" SDL_PRIu64 " ns",
+            what, count,
+            times[count / 2],
+            times[((Sint64)count * 99) / 100],
+            times[((Sint64)count * 999) / 1000],
+            times[count - 1]);
+}
+
+/* Add a lot of one-shot timers spread over the next second, cancel every
+   other one, and report how long adding, removing and firing them took. */
+static int
+run_stress_test(int count)
+{
+    StressTimer *timers = (StressTimer *)SDL_calloc(count, sizeof(*timers));
+    SDL_TimerID *ids = (SDL_TimerID *)SDL_calloc(count, sizeof(*ids));
+    Uint64 *add_times = (Uint64 *)SDL_calloc(count, sizeof(*add_times));
+    Uint64 *remove_times = (Uint64 *)SDL_calloc(count, sizeof(*remove_times));
+    Uint64 *fire_times = (Uint64 *)SDL_calloc(count, sizeof(*fire_times));
+    SDL_PropertiesID props = SDL_GetTimerProperties();
+    Uint64 start, now;
+    int num_removed = 0;
+    int num_fired = 0;
+    int expected;
+    int i;
+    int result = 0;
+
+    if (!timers || !ids || !add_times || !remove_times || !fire_times) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+        result = 1;
+        goto done;
+    }
+
+    SDL_Log("Stress testing with %d timers", count);
+    SDL_SetAtomicInt(&stress_fired, 0);
+
+    for (i = 0; i < count; ++i) {
+        const Uint64 interval = SDL_NS_PER_MS * (10 + (Uint64)SDL_rand(1000));
+
+        start = SDL_GetTicksNS();
+        timers[i].deadline = start + interval;
+        ids[i] = SDL_AddTimerNS(interval, stress_callback, &timers[i]);
+        add_times[i] = SDL_GetTicksNS() - start;
+        if (!ids[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create timer %d: %s", i, SDL_GetError());
+            result = 1;
+            goto done;
+        }
+    }
+
+    /* Only the removals that beat the timer count towards the expected total */
+    expected = count;
+    for (i = 0; i < count; i += 2) {
+        start = SDL_GetTicksNS();
+        if (SDL_RemoveTimer(ids[i])) {
+            --expected;
+        }
+        remove_times[num_removed++] = SDL_GetTicksNS() - start;
+    }
+
+    /* Wait for the rest to fire */
+    start = SDL_GetTicksNS();
+    while (SDL_GetAtomicInt(&stress_fired) < expected) {
+        if ((SDL_GetTicksNS() - start) > (10 * SDL_NS_PER_SECOND)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only %d of %d timers fired", SDL_GetAtomicInt(&stress_fired), expected);
+            result = 1;
+            break;
+        }
+        SDL_Delay(10);
+    }
+    now = SDL_GetTicksNS();
+
+    for (i = 0; i < count; ++i) {
+        if (timers[i].fired) {
+            fire_times[num_fired++] = timers[i].lateness;
+        }
+    }
+
+    log_percentiles("Add", add_times, count);
+    log_percentiles("Remove", remove_times, num_removed);
+    log_percentiles("Fire lateness", fire_times, num_fired);
+    SDL_Log("%d timers fired, finished %.2f ms after the last add", SDL_GetAtomicInt(&stress_fired), (double)(now - start) / SDL_NS_PER_MS);
+    SDL_Log("Timer thread was waking up %.1f times a second, with %" SDL_PRIu64 " ns of slack", SDL_GetFloatProperty(props, SDL_PROP_TIMER_WAKEUPS_PER_SECOND_FLOAT, 0.0f), (Uint64)SDL_GetNumberProperty(props, SDL_PROP_TIMER_SLACK_NS_NUMBER, 0));
+
+done:
+    SDL_free(timers);
+    SDL_free(ids);
+    SDL_free(add_times);
+    SDL_free(remove_times);
+    SDL_free(fire_times);
+    return result;
+}
+
 int main(int argc, char *argv[])
 {
     int i;
@@ -81,6 +211,8 @@ int main(int argc, char *argv[])
     Uint64 start_perf, now_perf;
     SDLTest_CommonState  *state;
     bool run_interactive_tests = true;
+    int stress_timers = 0;
+    Sint64 slack = 0;
     int return_code = 0;
 
     /* Initialize test framework */
@@ -98,6 +230,16 @@ int main(int argc, char *argv[])
             if (SDL_strcmp(argv[i], "--no-interactive") == 0) {
                 run_interactive_tests = false;
                 consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--stress") == 0) {
+                stress_timers = DEFAULT_STRESS_TIMERS;
+                consumed = 1;
+                if (argv[i + 1] && SDL_isdigit(*argv[i + 1])) {
+                    stress_timers = SDL_atoi(argv[i + 1]);
+                    consumed = 2;
+                }
+            } else if (SDL_strcmp(argv[i], "--slack") == 0 && argv[i + 1]) {
+                slack = SDL_strtoll(argv[i + 1], NULL, 0);
+                consumed = 2;
             } else if (desired < 0) {
                 char *endptr;
 
@@ -108,7 +250,7 @@ int main(int argc, char *argv[])
             }
         }
         if (consumed <= 0) {
-            static const char *options[] = { "[--no-interactive]", "[interval]", NULL };
+            static const char *options[] = { "[--no-interactive]", "[--stress [count]]", "[--slack ns]", "[interval]", NULL };
             SDLTest_CommonLogUsage(state, argv[0], options);
             return 1;
         }
@@ -116,6 +258,18 @@ int main(int argc, char *argv[])
         i += consumed;
     }
 
+    if (stress_timers > 0) {
+        if (!SDL_Init(0)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s", SDL_GetError());
+            return 1;
+        }
+        SDL_SetNumberProperty(SDL_GetTimerProperties(), SDL_PROP_TIMER_SLACK_NS_NUMBER, slack);
+        return_code = run_stress_test(stress_timers);
+        SDL_Quit();
+        SDLTest_CommonDestroyState(state);
+        return return_code;
+    }
+
     if (SDL_GetEnvironmentVariable(SDL_GetEnvironment(), "SDL_TESTS_QUICK") != NULL) {
         SDL_Log("Not running slower tests");
         SDL_Quit();